@@ -391,6 +391,11 @@ namespace AZ
         m_workers[nextWorker].Enqueue(&task);
     }
 
+    uint32_t TaskExecutor::GetThreadCount() const
+    {
+        return m_threadCount;
+    }
+
     void TaskExecutor::ReleaseGraph()
     {
         --m_graphsRemaining;
@@ -78,6 +78,9 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        // The number of worker threads that execute the submitted tasks
+        uint32_t GetThreadCount() const;
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
@@ -77,13 +77,16 @@ namespace AZ
             m_compiledTaskGraph->m_tasks[i].Init();
         }
 
-        executor.Submit(*m_compiledTaskGraph, waitEvent);
-
+        // A retained graph is marked as submitted before its tasks are queued, as its last task can
+        // finish (and clear the flag again) before the executor returns
         if (m_retained)
         {
             m_submitted = true;
         }
-        else
+
+        executor.Submit(*m_compiledTaskGraph, waitEvent);
+
+        if (!m_retained)
         {
             m_compiledTaskGraph = nullptr;
             Reset();
@@ -105,6 +105,10 @@ namespace AZ
         // Returns false if 1 or more tasks have been added to the graph
         bool IsEmpty();
 
+        // Returns true while a retained graph is in flight, from its submission until its last task
+        // has finished and the graph can be submitted again
+        bool IsSubmitted() const;
+
         // Add a task to the graph, retrieiving a token that can be used to express dependencies
         // between tasks. The first argument specifies the TaskKind, used for tracking the task.
         // NOTE: This operation is invalid if the graph is in-flight
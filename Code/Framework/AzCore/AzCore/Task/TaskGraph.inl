@@ -59,6 +59,11 @@ namespace AZ
         return m_tasks.empty();
     }
 
+    inline bool TaskGraph::IsSubmitted() const
+    {
+        return m_submitted;
+    }
+
     inline void TaskGraph::Detach()
     {
         m_retained = false;
@@ -17,6 +17,7 @@
 #include <AzCore/Memory/MemoryDriller.h>
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/std/containers/variant.h>
+#include <AzCore/std/optional.h>
 
 #if defined(HAVE_BENCHMARK)
 
@@ -155,6 +156,72 @@ namespace UnitTest
             TeardownAllocator();
         }
     };
+
+    /**
+    * Helper class to run a test fixture around every run of a benchmark, for benchmarks that need the same environment
+    * as the tests of their target. Do the additional setup and tear down of the benchmark in SetUpBenchmark and
+    * TearDownBenchmark, which run after the SetUp and before the TearDown of the test fixture.
+    */
+    template<class TestFixture>
+    class TestFixtureBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        //Benchmark interface
+        void SetUp(const ::benchmark::State& st) override
+        {
+            AZ_UNUSED(st);
+            InternalSetUp();
+        }
+        void SetUp(::benchmark::State& st) override
+        {
+            AZ_UNUSED(st);
+            InternalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            AZ_UNUSED(st);
+            InternalTearDown();
+        }
+        void TearDown(::benchmark::State& st) override
+        {
+            AZ_UNUSED(st);
+            InternalTearDown();
+        }
+
+    protected:
+        virtual void SetUpBenchmark() {}
+        virtual void TearDownBenchmark() {}
+
+    private:
+        // The test fixture outside of a gtest test case.
+        class Environment
+            : public TestFixture
+        {
+        public:
+            using TestFixture::SetUp;
+            using TestFixture::TearDown;
+
+            void TestBody() override {}
+        };
+
+        void InternalSetUp()
+        {
+            m_environment.emplace();
+            m_environment->SetUp();
+            SetUpBenchmark();
+        }
+
+        void InternalTearDown()
+        {
+            TearDownBenchmark();
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+        AZStd::optional<Environment> m_environment;
+    };
 #endif
 
     class DLLTestVirtualClass
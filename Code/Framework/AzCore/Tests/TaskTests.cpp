@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -622,6 +623,32 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, RetainedGraphIsSubmittedUntilFinished)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                ++x;
+            });
+        EXPECT_FALSE(graph.IsSubmitted());
+
+        // Resubmit as soon as the graph has finished, without waiting on an event
+        constexpr int submitCount = 1000;
+        for (int i = 0; i != submitCount; ++i)
+        {
+            graph.SubmitOnExecutor(*m_executor);
+            while (graph.IsSubmitted())
+            {
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(i + 1, x);
+        }
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
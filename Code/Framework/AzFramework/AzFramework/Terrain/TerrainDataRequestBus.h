@@ -9,6 +9,7 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
@@ -134,6 +135,128 @@ namespace AzFramework
             //!                  otherwise *terrainExistsPtr will be set to true.
             virtual AZ::Vector3 GetNormal(AZ::Vector3 position, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
             virtual AZ::Vector3 GetNormalFromFloats(float x, float y, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
+
+            //! Bulk versions of GetHeight, GetNormal and GetSurfaceWeights for a list of positions, the input Z values are ignored.
+            //! The outputs are resized to the number of input positions and hold the same values as the per position queries.
+            //! @terrainExists: Can be nullptr. If != nullptr then it is resized as well, and holds the per position terrainExists values.
+            //! The default implementations query one position at a time, terrain systems should override them with bulk versions.
+            virtual void GetHeightsFromList(
+                const AZStd::vector<AZ::Vector3>& inPositions,
+                AZStd::vector<float>& outHeights,
+                Sampler sampler = Sampler::DEFAULT,
+                AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                outHeights.resize(inPositions.size());
+                if (terrainExists)
+                {
+                    terrainExists->resize(inPositions.size());
+                }
+                for (size_t index = 0; index < inPositions.size(); ++index)
+                {
+                    bool exists = false;
+                    outHeights[index] = GetHeight(inPositions[index], sampler, &exists);
+                    if (terrainExists)
+                    {
+                        (*terrainExists)[index] = exists;
+                    }
+                }
+            }
+            virtual void GetNormalsFromList(
+                const AZStd::vector<AZ::Vector3>& inPositions,
+                AZStd::vector<AZ::Vector3>& outNormals,
+                Sampler sampler = Sampler::DEFAULT,
+                AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                outNormals.resize(inPositions.size());
+                if (terrainExists)
+                {
+                    terrainExists->resize(inPositions.size());
+                }
+                for (size_t index = 0; index < inPositions.size(); ++index)
+                {
+                    bool exists = false;
+                    outNormals[index] = GetNormal(inPositions[index], sampler, &exists);
+                    if (terrainExists)
+                    {
+                        (*terrainExists)[index] = exists;
+                    }
+                }
+            }
+            virtual void GetSurfaceWeightsFromList(
+                const AZStd::vector<AZ::Vector3>& inPositions,
+                AZStd::vector<SurfaceData::OrderedSurfaceTagWeightSet>& outSurfaceWeights,
+                Sampler sampleFilter = Sampler::DEFAULT,
+                AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                outSurfaceWeights.resize(inPositions.size());
+                if (terrainExists)
+                {
+                    terrainExists->resize(inPositions.size());
+                }
+                for (size_t index = 0; index < inPositions.size(); ++index)
+                {
+                    bool exists = false;
+                    GetSurfaceWeights(inPositions[index], outSurfaceWeights[index], sampleFilter, &exists);
+                    if (terrainExists)
+                    {
+                        (*terrainExists)[index] = exists;
+                    }
+                }
+            }
+
+            //! Bulk versions of GetHeight, GetNormal and GetSurfaceWeights for a regular grid of positions. The grid starts at the min
+            //! corner of inRegion and steps by stepSize while it's below the max corner, the outputs are in row major order (X first).
+            virtual void GetHeightsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                AZStd::vector<float>& outHeights,
+                Sampler sampler = Sampler::DEFAULT,
+                AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                AZStd::vector<AZ::Vector3> positions;
+                GetRegionPositions(inRegion, stepSize, positions);
+                GetHeightsFromList(positions, outHeights, sampler, terrainExists);
+            }
+            virtual void GetNormalsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                AZStd::vector<AZ::Vector3>& outNormals,
+                Sampler sampler = Sampler::DEFAULT,
+                AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                AZStd::vector<AZ::Vector3> positions;
+                GetRegionPositions(inRegion, stepSize, positions);
+                GetNormalsFromList(positions, outNormals, sampler, terrainExists);
+            }
+            virtual void GetSurfaceWeightsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                AZStd::vector<SurfaceData::OrderedSurfaceTagWeightSet>& outSurfaceWeights,
+                Sampler sampleFilter = Sampler::DEFAULT,
+                AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                AZStd::vector<AZ::Vector3> positions;
+                GetRegionPositions(inRegion, stepSize, positions);
+                GetSurfaceWeightsFromList(positions, outSurfaceWeights, sampleFilter, terrainExists);
+            }
+
+            //! The grid positions that the region queries sample, in the same order as their outputs.
+            static void GetRegionPositions(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, AZStd::vector<AZ::Vector3>& outPositions)
+            {
+                outPositions.clear();
+                if (!inRegion.IsValid() || stepSize.GetX() <= 0.0f || stepSize.GetY() <= 0.0f)
+                {
+                    return;
+                }
+
+                for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+                {
+                    for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+                    {
+                        outPositions.emplace_back(x, y, 0.0f);
+                    }
+                }
+            }
         };
         using TerrainDataRequestBus = AZ::EBus<TerrainDataRequests>;
 
@@ -8,6 +8,7 @@
 
 
 #include <Atom/ImageProcessing/ImageObject.h>
+#include <Processing/ImageTiles.h>
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
 
@@ -328,65 +329,67 @@ namespace ImageProcessingAtom
             }
         }
 
-        const uint32 mipCount = dstImage->GetMipCount();
-        for (uint32 dwMip = 0; dwMip < mipCount; ++dwMip)
+        // The parameters shared by all the tiles
+        CryTextureSquisher::CompressorParameters compressTemplate;
         {
-            uint32 dwLocalWidth = srcImage->GetWidth(dwMip);
-            uint32 dwLocalHeight = srcImage->GetHeight(dwMip);
-
-            uint8* pSrcMem;
-            uint32 dwSrcPitch;
-            srcImage->GetImagePointer(dwMip, pSrcMem, dwSrcPitch);
-
-            uint8* pDstMem;
-            uint32 dwDstPitch;
-            dstImage->GetImagePointer(dwMip, pDstMem, dwDstPitch);
-
+            compressTemplate.srcType = (CPixelFormats::GetInstance().IsFormatFloatingPoint(fmtSrc, true) ?
+                                        CryTextureSquisher::eBufferType_ufloat : CryTextureSquisher::eBufferType_uint8);
+            if (CPixelFormats::GetInstance().IsFormatSigned(fmtDst))
             {
-                CrySquisherCallbackUserData userData;
-                userData.m_pImageObject = dstImage;
-                userData.m_dstOffset = 0;
-                userData.m_dstMem = pDstMem;
+                compressTemplate.srcType = (compressTemplate.srcType == CryTextureSquisher::eBufferType_ufloat ?
+                                            CryTextureSquisher::eBufferType_sfloat : CryTextureSquisher::eBufferType_sint8);
+            }
 
-                CryTextureSquisher::CompressorParameters compress;
+            const AZ::Vector3 uniform = AZ::Vector3(0.3333f, 0.3334f, 0.3333f);
 
-                compress.srcBuffer = pSrcMem;
-                compress.width = dwLocalWidth;
-                compress.height = dwLocalHeight;
-                compress.pitch = dwSrcPitch;
+            compressTemplate.weights[0] = weights.GetX();
+            compressTemplate.weights[1] = weights.GetY();
+            compressTemplate.weights[2] = weights.GetZ();
 
-                compress.srcType = (CPixelFormats::GetInstance().IsFormatFloatingPoint(fmtSrc, true) ?
-                                    CryTextureSquisher::eBufferType_ufloat : CryTextureSquisher::eBufferType_uint8);
-                if (CPixelFormats::GetInstance().IsFormatSigned(fmtDst))
-                {
-                    compress.srcType = (compress.srcType == CryTextureSquisher::eBufferType_ufloat ?
-                                        CryTextureSquisher::eBufferType_sfloat : CryTextureSquisher::eBufferType_sint8);
-                }
+            compressTemplate.perceptual =
+                (compressTemplate.weights[0] != uniform.GetX()) ||
+                (compressTemplate.weights[1] != uniform.GetY()) ||
+                (compressTemplate.weights[2] != uniform.GetZ());
 
-                const AZ::Vector3 uniform = AZ::Vector3(0.3333f, 0.3334f, 0.3333f);
+            compressTemplate.quality =
+                (quality == eQuality_Preview ? CryTextureSquisher::eQualityProfile_Low :
+                 (quality == eQuality_Fast ? CryTextureSquisher::eQualityProfile_Low :
+                  (quality == eQuality_Slow ? CryTextureSquisher::eQualityProfile_High :
+                   CryTextureSquisher::eQualityProfile_Medium)));
 
-                compress.weights[0] = weights.GetX();
-                compress.weights[1] = weights.GetY();
-                compress.weights[2] = weights.GetZ();
+            compressTemplate.userOutputFunction = CrySquisherOutputCallback;
+            compressTemplate.preset = GetCompressPreset(fmtDst, fmtSrc);
+        }
 
-                compress.perceptual =
-                    (compress.weights[0] != uniform.GetX()) ||
-                    (compress.weights[1] != uniform.GetY()) ||
-                    (compress.weights[2] != uniform.GetZ());
+        // Compress the mips in tiles of 4 pixel rows, which is the block height of all the supported formats. The
+        // blocks are compressed independently of each other, so the tiles can be compressed in parallel.
+        // Note: perceptual compression is serialized by the squisher itself.
+        const AZStd::vector<ImageTile> tiles = BuildImageTiles(dstImage, 4);
+        ProcessImageTiles(tiles, [&](const ImageTile& tile)
+            {
+                uint8* pSrcMem;
+                uint32 dwSrcPitch;
+                srcImage->GetImagePointer(tile.m_mip, pSrcMem, dwSrcPitch);
 
-                compress.quality =
-                    (quality == eQuality_Preview ? CryTextureSquisher::eQualityProfile_Low :
-                     (quality == eQuality_Fast ? CryTextureSquisher::eQualityProfile_Low :
-                      (quality == eQuality_Slow ? CryTextureSquisher::eQualityProfile_High :
-                       CryTextureSquisher::eQualityProfile_Medium)));
+                uint8* pDstMem;
+                uint32 dwDstPitch;
+                dstImage->GetImagePointer(tile.m_mip, pDstMem, dwDstPitch);
 
+                // each tile has its own user data since the output callback writes to it
+                CrySquisherCallbackUserData userData;
+                userData.m_pImageObject = dstImage;
+                userData.m_dstOffset = 0;
+                userData.m_dstMem = pDstMem + static_cast<size_t>(tile.m_firstRow / 4) * dwDstPitch;
+
+                CryTextureSquisher::CompressorParameters compress = compressTemplate;
+                compress.srcBuffer = pSrcMem + static_cast<size_t>(tile.m_firstRow) * dwSrcPitch;
+                compress.width = srcImage->GetWidth(tile.m_mip);
+                compress.height = tile.m_rowCount;
+                compress.pitch = dwSrcPitch;
                 compress.userPtr = &userData;
-                compress.userOutputFunction = CrySquisherOutputCallback;
-                compress.preset = GetCompressPreset(fmtDst, fmtSrc);
 
                 CryTextureSquisher::Compress(compress);
-            }
-        } // for: all mips
+            });
 
         return dstImage;
     }
@@ -10,6 +10,7 @@
 #include <AzCore/std/function/function_template.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
+#include <Processing/ImageTiles.h>
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
 
@@ -182,69 +183,76 @@ namespace ImageProcessingAtom
             }
         }
 
-        // Allocate the destination image
-        IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
-
-        // Compress the images per mip
-        const uint32 mipCount = destinationImage->GetMipCount();
-        for (uint32_t mip = 0; mip < mipCount; mip++)
+        // Get the profile settings once, they are shared by all the tiles
+        bc6h_enc_settings bc6Settings = {};
+        bc7_enc_settings bc7Settings = {};
+        switch (destinationFormat)
         {
-            // Create rgba_surface as input
-            uint32 sourcePitch = 0;
-            AZ::u8* sourceImageData = nullptr;
-            sourceImage->GetImagePointer(mip, sourceImageData, sourcePitch);
-            rgba_surface sourceSurface = {};
-            {
-                sourceSurface.ptr = sourceImageData;
-                sourceSurface.width = sourceImage->GetWidth(mip);
-                sourceSurface.height = sourceImage->GetHeight(mip);
-                sourceSurface.stride = static_cast<int32_t>(sourcePitch);
-            }
-
-            // Get the mip image destination pointer
-            uint32_t destinationPitch = 0;
-            AZ::u8* destinationImageData = nullptr;
-            destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
-
-            // Compress with the correct function, depending on the destination format
-            switch (destinationFormat)
-            {
-            case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
-                break;
-            case ePixelFormat_BC6UH:
-            {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
-                // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
-            }
+        case ePixelFormat_BC3:
             break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
-            {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
-
-                // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
-            }
+        case ePixelFormat_BC6UH:
+            compressionProfile->GetBC6()(&bc6Settings);
             break;
-            default:
-            {
-                // No valid pixel format
-                AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                return nullptr;
-            }
+        case ePixelFormat_BC7:
+        case ePixelFormat_BC7t:
+            compressionProfile->GetBC7(discardAlpha)(&bc7Settings);
             break;
-            }
+        default:
+        {
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+        break;
         }
 
+        // Allocate the destination image
+        IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
+
+        // Compress the images in tiles of block rows. The blocks are compressed independently of each other, so the
+        // tiles can be compressed in parallel and the result is the same as compressing the whole mip at once.
+        const uint32_t blockHeight = CPixelFormats::GetInstance().GetPixelFormatInfo(destinationFormat)->blockHeight;
+        const AZStd::vector<ImageTile> tiles = BuildImageTiles(destinationImage, blockHeight);
+        ProcessImageTiles(tiles, [&](const ImageTile& tile)
+            {
+                // Create rgba_surface of the tile rows as input
+                uint32 sourcePitch = 0;
+                AZ::u8* sourceImageData = nullptr;
+                sourceImage->GetImagePointer(tile.m_mip, sourceImageData, sourcePitch);
+                rgba_surface sourceSurface = {};
+                {
+                    sourceSurface.ptr = sourceImageData + static_cast<size_t>(tile.m_firstRow) * sourcePitch;
+                    sourceSurface.width = sourceImage->GetWidth(tile.m_mip);
+                    sourceSurface.height = tile.m_rowCount;
+                    sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                }
+
+                // Get the destination pointer of the tile's first block row
+                uint32_t destinationPitch = 0;
+                AZ::u8* destinationImageData = nullptr;
+                destinationImage->GetImagePointer(tile.m_mip, destinationImageData, destinationPitch);
+                destinationImageData += static_cast<size_t>(tile.m_firstRow / blockHeight) * destinationPitch;
+
+                // Compress with the correct function, depending on the destination format
+                switch (destinationFormat)
+                {
+                case ePixelFormat_BC3:
+                    CompressBlocksBC3(&sourceSurface, destinationImageData);
+                    break;
+                case ePixelFormat_BC6UH:
+                    // Compress with BC6 half precision
+                    CompressBlocksBC6H(&sourceSurface, destinationImageData, &bc6Settings);
+                    break;
+                case ePixelFormat_BC7:
+                case ePixelFormat_BC7t:
+                    // Compress with BC7
+                    CompressBlocksBC7(&sourceSurface, destinationImageData, &bc7Settings);
+                    break;
+                default:
+                    break;
+                }
+            });
+
         return destinationImage;
     }
 
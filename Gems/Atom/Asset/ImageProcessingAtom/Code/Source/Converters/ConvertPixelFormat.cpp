@@ -10,6 +10,7 @@
 
 #include <Processing/ImageFlags.h>
 #include <Processing/ImageObjectImpl.h>
+#include <Processing/ImageTiles.h>
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
 
@@ -153,25 +154,32 @@ namespace ImageProcessingAtom
         uint32 srcPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(srcFmt)->bitsPerBlock / 8;
         uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
 
-        const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
-        for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
-        {
-            uint8* srcPixelBuf;
-            uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
-            uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
-
-            const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
-
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+        //convert the mips in tiles of rows in parallel. The pixel operations are stateless and every pixel is
+        //converted independently, so the result doesn't depend on the tiling.
+        const AZStd::vector<ImageTile> tiles = BuildImageTiles(dstImage, 1);
+        ProcessImageTiles(tiles, [&](const ImageTile& tile)
             {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
-        }
+                uint8* srcPixelBuf;
+                uint32 srcPitch;
+                srcImage->GetImagePointer(tile.m_mip, srcPixelBuf, srcPitch);
+                uint8* dstPixelBuf;
+                uint32 dstPitch;
+                dstImage->GetImagePointer(tile.m_mip, dstPixelBuf, dstPitch);
+
+                const uint32 width = srcImage->GetWidth(tile.m_mip);
+                const size_t firstPixel = static_cast<size_t>(tile.m_firstRow) * width;
+                srcPixelBuf += firstPixel * srcPixelBytes;
+                dstPixelBuf += firstPixel * dstPixelBytes;
+
+                const uint32 pixelCount = tile.m_rowCount * width;
+
+                float r, g, b, a;
+                for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+                {
+                    srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
+                    dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
+                }
+            });
 
         m_img = dstImage;
     }
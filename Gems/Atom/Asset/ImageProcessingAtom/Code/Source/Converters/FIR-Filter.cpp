@@ -11,6 +11,7 @@
 #include <AzCore/base.h>
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Processing/ImageConvert.h>
+#include <Processing/ImageTiles.h>
 #include <Processing/ImageToProcess.h>
 
 #include <Converters/FIR-Windows.h>
@@ -1276,4 +1277,16 @@ namespace ImageProcessingAtom
         int filterOp = static_cast<int>(evalType);
         FilterImage(filterIndex, filterOp, blurH, blurV, srcImg, srcMip, dstImg, dstMip, srcRect, dstRect);
     }
+
+    /* #################################################################################################################### \
+    */
+    void FilterImageMips(MipGenType filterType, MipGenEvalType evalType, float blurH, float blurV, const IImageObjectPtr srcImg, IImageObjectPtr dstImg)
+    {
+        // every mip is filtered from the top mip of the source image, so the mips don't depend on each other and can be
+        // filtered in parallel. Each mip is filtered as a whole, so the result is the same as filtering them one by one.
+        ProcessImageTiles(BuildImageMipTiles(dstImg), [&](const ImageTile& tile)
+            {
+                FilterImage(filterType, evalType, blurH, blurV, srcImg, 0, dstImg, tile.m_mip, nullptr, nullptr);
+            });
+    }
 }
@@ -494,10 +494,7 @@ namespace ImageProcessingAtom
         float blurV = 0;
 
         // fill mipmap data for uncompressed output image
-        for (uint32 mip = 0; mip < outImage->GetMipCount(); mip++)
-        {
-            FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, blurH, blurV, m_image->Get(), 0, outImage, mip, nullptr, nullptr);
-        }
+        FilterImageMips(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, blurH, blurV, m_image->Get(), outImage);
 
         // transfer alpha coverage
         if (m_input->m_textureSetting.m_maintainAlphaCoverage)
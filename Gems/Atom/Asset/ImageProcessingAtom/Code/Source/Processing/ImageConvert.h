@@ -42,6 +42,9 @@ namespace ImageProcessingAtom
     void FilterImage(MipGenType genType, MipGenEvalType evalType, float blurH, float blurV, const IImageObjectPtr srcImg, int srcMip,
         IImageObjectPtr dstImg, int dstMip, QRect* srcRect, QRect* dstRect);
 
+    //fill all the mips of the dest image by filtering the top mip of the source image. The mips are filtered in parallel
+    void FilterImageMips(MipGenType genType, MipGenEvalType evalType, float blurH, float blurV, const IImageObjectPtr srcImg, IImageObjectPtr dstImg);
+
     //get compression error for an image converting to certain format
     void GetBC1CompressionErrors(IImageObjectPtr originImage, float& errorLinear, float& errorSrgb,
         ICompressor::CompressOption option);
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Processing/ImageTiles.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+
+namespace ImageProcessingAtom
+{
+    AZStd::vector<ImageTile> BuildImageTiles(const IImageObjectPtr& image, AZ::u32 rowAlignment, AZ::u32 tileRows)
+    {
+        AZ_Assert(rowAlignment > 0, "Row alignment of the tiles can't be zero");
+
+        //round the tile height up to the alignment
+        tileRows = AZStd::max(tileRows, rowAlignment);
+        tileRows = ((tileRows + rowAlignment - 1) / rowAlignment) * rowAlignment;
+
+        AZStd::vector<ImageTile> tiles;
+        const AZ::u32 mipCount = image->GetMipCount();
+        for (AZ::u32 mip = 0; mip < mipCount; ++mip)
+        {
+            const AZ::u32 height = image->GetHeight(mip);
+            for (AZ::u32 row = 0; row < height; row += tileRows)
+            {
+                ImageTile tile;
+                tile.m_mip = mip;
+                tile.m_firstRow = row;
+                tile.m_rowCount = AZStd::min(tileRows, height - row);
+                tiles.push_back(tile);
+            }
+        }
+        return tiles;
+    }
+
+    AZStd::vector<ImageTile> BuildImageMipTiles(const IImageObjectPtr& image)
+    {
+        AZStd::vector<ImageTile> tiles;
+        const AZ::u32 mipCount = image->GetMipCount();
+        tiles.reserve(mipCount);
+        for (AZ::u32 mip = 0; mip < mipCount; ++mip)
+        {
+            ImageTile tile;
+            tile.m_mip = mip;
+            tile.m_rowCount = image->GetHeight(mip);
+            tiles.push_back(tile);
+        }
+        return tiles;
+    }
+
+    void ProcessImageTiles(const AZStd::vector<ImageTile>& tiles, const AZStd::function<void(const ImageTile& tile)>& processTile)
+    {
+        if (tiles.size() <= 1 || AZ::JobContext::GetGlobalContext() == nullptr)
+        {
+            for (const ImageTile& tile : tiles)
+            {
+                processTile(tile);
+            }
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (const ImageTile& tile : tiles)
+        {
+            const auto tileLambda = [&processTile, &tile]()
+            {
+                processTile(tile);
+            };
+
+            AZ::Job* tileJob = AZ::CreateJobFunction(AZStd::move(tileLambda), true, nullptr);
+            tileJob->SetDependent(&jobCompletion);
+            tileJob->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+} // namespace ImageProcessingAtom
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/ImageProcessing/ImageObject.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+
+namespace ImageProcessingAtom
+{
+    //a band of rows of one mip of an image, which is processed independently of the other bands
+    struct ImageTile
+    {
+        AZ::u32 m_mip = 0;
+        AZ::u32 m_firstRow = 0;
+        AZ::u32 m_rowCount = 0;
+    };
+
+    //default height of a tile in pixel rows. A 4K mip is split into 64 tiles, which keeps the per job overhead negligible
+    constexpr AZ::u32 DefaultImageTileRows = 64;
+
+    //split every mip of the image into tiles of tileRows rows. Tiles start at multiples of rowAlignment, which needs
+    //to be the block height for block compressed formats so tiles never share a block.
+    AZStd::vector<ImageTile> BuildImageTiles(const IImageObjectPtr& image, AZ::u32 rowAlignment, AZ::u32 tileRows = DefaultImageTileRows);
+
+    //build one tile per mip of the image, which covers the whole mip
+    AZStd::vector<ImageTile> BuildImageMipTiles(const IImageObjectPtr& image);
+
+    //run processTile for every tile on the job system and wait for all of them. Tiles must write disjoint memory, so the
+    //result doesn't depend on the number of worker threads or on the order the tiles run in.
+    //The tiles are processed on the calling thread if there is a single tile or no global job context.
+    void ProcessImageTiles(const AZStd::vector<ImageTile>& tiles, const AZStd::function<void(const ImageTile& tile)>& processTile);
+} // namespace ImageProcessingAtom
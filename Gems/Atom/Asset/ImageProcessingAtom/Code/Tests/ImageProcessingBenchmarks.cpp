@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+
+#include <Atom/ImageProcessing/ImageObject.h>
+#include <BuilderSettings/ImageProcessingDefines.h>
+#include <Processing/ImageConvert.h>
+#include <Processing/ImageToProcess.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace ImageProcessingAtom;
+
+    /*
+     * Generates the mips of a 1024x1024 RGBA32F texture and compresses them, one texture per iteration, so the reported
+     * wall-clock time is per texture. The job manager has as many worker threads as the benchmark argument, which shows
+     * how the tile-parallel mip filtering and compression scale with the number of cores.
+     */
+    class ImageProcessingBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr AZ::u32 ImageSize = 1024;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(static_cast<AZ::u32>(state.range(0)));
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(static_cast<AZ::u32>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void internalSetUp(AZ::u32 threadCount)
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (AZ::u32 i = 0; i < threadCount; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+            m_threadCount = threadCount;
+
+            m_srcImage = IImageObjectPtr(IImageObject::CreateImage(ImageSize, ImageSize, 1, ePixelFormat_R32G32B32A32F));
+            AZ::u8* srcMem;
+            AZ::u32 srcPitch;
+            m_srcImage->GetImagePointer(0, srcMem, srcPitch);
+            for (AZ::u32 y = 0; y < ImageSize; ++y)
+            {
+                float* pixel = reinterpret_cast<float*>(srcMem + y * srcPitch);
+                for (AZ::u32 x = 0; x < ImageSize; ++x, pixel += 4)
+                {
+                    pixel[0] = static_cast<float>(x) / ImageSize;
+                    pixel[1] = static_cast<float>(y) / ImageSize;
+                    pixel[2] = static_cast<float>((x * 7 + y * 13) % 17) / 16.0f;
+                    pixel[3] = static_cast<float>(((x >> 3) ^ (y >> 3)) & 1);
+                }
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_srcImage = nullptr;
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        //! Fills the mip chain of a new image from the source image.
+        IImageObjectPtr GenerateMips() const
+        {
+            IImageObjectPtr mipImage(IImageObject::CreateImage(ImageSize, ImageSize, UINT32_MAX, ePixelFormat_R32G32B32A32F));
+            FilterImageMips(MipGenType::blackmanHarris, MipGenEvalType::sum, 0, 0, m_srcImage, mipImage);
+            return mipImage;
+        }
+
+        //! Generates the mips of the source image and converts them to the pixel format, or only generates the mips
+        //! when the pixel format is the source pixel format.
+        void RunProcessBenchmark(::benchmark::State& state, EPixelFormat pixelFormat)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                ImageToProcess imageToProcess(GenerateMips());
+                imageToProcess.ConvertFormat(pixelFormat);
+                ::benchmark::DoNotOptimize(imageToProcess.Get());
+            }
+
+            state.SetItemsProcessed(state.iterations());
+            state.counters["Threads"] = static_cast<double>(m_threadCount);
+        }
+
+        //! Only compresses the mips, which are generated once before the timing starts.
+        void RunCompressBenchmark(::benchmark::State& state, EPixelFormat pixelFormat)
+        {
+            IImageObjectPtr mipImage = GenerateMips();
+            for ([[maybe_unused]] auto _ : state)
+            {
+                ImageToProcess imageToProcess(mipImage);
+                imageToProcess.ConvertFormat(pixelFormat);
+                ::benchmark::DoNotOptimize(imageToProcess.Get());
+            }
+
+            state.SetItemsProcessed(state.iterations());
+            state.counters["Threads"] = static_cast<double>(m_threadCount);
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZ::u32 m_threadCount = 0;
+        IImageObjectPtr m_srcImage;
+    };
+
+    BENCHMARK_DEFINE_F(ImageProcessingBenchmarkFixture, GenerateMips)(benchmark::State& state)
+    {
+        RunProcessBenchmark(state, ePixelFormat_R32G32B32A32F);
+    }
+
+    BENCHMARK_DEFINE_F(ImageProcessingBenchmarkFixture, CompressBC7_ISPC)(benchmark::State& state)
+    {
+        RunCompressBenchmark(state, ePixelFormat_BC7);
+    }
+
+    BENCHMARK_DEFINE_F(ImageProcessingBenchmarkFixture, CompressBC1_Squish)(benchmark::State& state)
+    {
+        RunCompressBenchmark(state, ePixelFormat_BC1);
+    }
+
+    BENCHMARK_DEFINE_F(ImageProcessingBenchmarkFixture, GenerateMipsAndCompressBC7)(benchmark::State& state)
+    {
+        RunProcessBenchmark(state, ePixelFormat_BC7);
+    }
+
+    BENCHMARK_REGISTER_F(ImageProcessingBenchmarkFixture, GenerateMips)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+    BENCHMARK_REGISTER_F(ImageProcessingBenchmarkFixture, CompressBC7_ISPC)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+    BENCHMARK_REGISTER_F(ImageProcessingBenchmarkFixture, CompressBC1_Squish)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+    BENCHMARK_REGISTER_F(ImageProcessingBenchmarkFixture, GenerateMipsAndCompressBC7)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+} // namespace UnitTest
+#endif
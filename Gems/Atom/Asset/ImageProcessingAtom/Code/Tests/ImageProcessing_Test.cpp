@@ -807,6 +807,53 @@ namespace UnitTest
         }
     }
         
+    TEST_F(ImageProcessingTest, TiledImageProcessing_WithAndWithoutJobs_ProducesIdenticalImages)
+    {
+        // a 200 pixel high image is split into tiles of 64 rows with a remainder tile, and its mips have odd sizes
+        const AZ::u32 width = 256;
+        const AZ::u32 height = 200;
+        IImageObjectPtr srcImage(IImageObject::CreateImage(width, height, 1, ePixelFormat_R32G32B32A32F));
+        AZ::u8* srcMem;
+        AZ::u32 srcPitch;
+        srcImage->GetImagePointer(0, srcMem, srcPitch);
+        for (AZ::u32 y = 0; y < height; ++y)
+        {
+            float* pixel = reinterpret_cast<float*>(srcMem + y * srcPitch);
+            for (AZ::u32 x = 0; x < width; ++x, pixel += 4)
+            {
+                pixel[0] = static_cast<float>(x) / width;
+                pixel[1] = static_cast<float>(y) / height;
+                pixel[2] = static_cast<float>((x * 7 + y * 13) % 17) / 16.0f;
+                pixel[3] = static_cast<float>((x ^ y) & 1);
+            }
+        }
+
+        // generate the mips, then convert them with the ISPC compressor, the squish compressor and the pixel operations
+        const auto processImage = [&srcImage](EPixelFormat targetFormat)
+        {
+            IImageObjectPtr mipImage(IImageObject::CreateImage(width, height, UINT32_MAX, ePixelFormat_R32G32B32A32F));
+            FilterImageMips(MipGenType::blackmanHarris, MipGenEvalType::sum, 0, 0, srcImage, mipImage);
+            ImageToProcess imageToProcess(mipImage);
+            imageToProcess.ConvertFormat(targetFormat);
+            return imageToProcess.Get();
+        };
+
+        const EPixelFormat targetFormats[] = { ePixelFormat_BC7, ePixelFormat_BC1, ePixelFormat_R16G16B16A16F };
+        for (EPixelFormat targetFormat : targetFormats)
+        {
+            IImageObjectPtr parallelImage = processImage(targetFormat);
+
+            // without a job context the tiles are processed one by one on this thread
+            JobContext::SetGlobalContext(nullptr);
+            IImageObjectPtr serialImage = processImage(targetFormat);
+            JobContext::SetGlobalContext(m_jobContext.get());
+
+            ASSERT_TRUE(parallelImage);
+            EXPECT_EQ(parallelImage->GetPixelFormat(), targetFormat);
+            EXPECT_TRUE(parallelImage->CompareImage(serialImage));
+        }
+    }
+
     TEST_F(ImageProcessingTest, Test_ConvertAllAstc_Success)
     {
         // Compress/Decompress to all astc formats (LDR)
@@ -50,6 +50,8 @@ set(FILES
     Source/Processing/ImagePreview.cpp
     Source/Processing/ImagePreview.h
     Source/Processing/ImageToProcess.h
+    Source/Processing/ImageTiles.cpp
+    Source/Processing/ImageTiles.h
     Source/Processing/PixelFormatInfo.cpp
     Source/Processing/PixelFormatInfo.h
     Source/Processing/Utils.cpp
@@ -8,4 +8,5 @@
 
 set(FILES
     Tests/ImageProcessing_Test.cpp
+    Tests/ImageProcessingBenchmarks.cpp
 )
@@ -11,17 +11,20 @@
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/Model/Model.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/Feature/Material/MaterialAssignment.h>
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
 #include <Atom/Feature/Mesh/ModelReloaderSystemInterface.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
+#include <Mesh/MeshDirtyList.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AtomCore/std/parallel/concurrency_checker.h>
 #include <AzCore/Console/Console.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AZ
 {
@@ -29,11 +32,15 @@ namespace AZ
     {
         class TransformServiceFeatureProcessor;
         class RayTracingFeatureProcessor;
+        class MeshFeatureProcessor;
+        class MeshUpdateTaskGraph;
 
         class MeshDataInstance
         {
             friend class MeshFeatureProcessor;
             friend class MeshLoader;
+            template<typename MeshType, typename MaterialType>
+            friend class MeshDirtyList;
 
         public:
             const Data::Instance<RPI::Model>& GetModel() { return m_model; }
@@ -87,6 +94,11 @@ namespace AZ
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
 
+            //! Queues the mesh to be updated in the next MeshFeatureProcessor::Simulate.
+            void MarkDirty();
+
+            void OnLodResidencyChanged();
+
             using DrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
 
             AZStd::fixed_vector<DrawPacketList, RPI::ModelLodAsset::LodCountMax> m_drawPacketListsByLod;
@@ -102,12 +114,22 @@ namespace AZ
             Data::Instance<RPI::ShaderResourceGroup> m_shaderResourceGroup;
             AZStd::unique_ptr<MeshLoader> m_meshLoader;
             RPI::Scene* m_scene = nullptr;
+            MeshFeatureProcessor* m_featureProcessor = nullptr;
             RHI::DrawItemSortKey m_sortKey;
 
             TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
 
             Aabb m_aabb = Aabb::CreateNull();
 
+            //! Index of the mesh in the dirty list of the feature processor, owned by the list.
+            size_t m_dirtyIndex = static_cast<size_t>(-1);
+
+            //! The materials of the draw packets, tracked by the dirty list of the feature processor to find the meshes of changed materials.
+            AZStd::vector<Data::Instance<RPI::Material>> m_trackedMaterials;
+
+            //! Rebuilds the draw packets when lods of a streamed model are made resident or evicted.
+            RPI::Model::LodResidencyChangedEvent::Handler m_lodResidencyChangedHandler{ [this]() { OnLodResidencyChanged(); } };
+
             bool m_cullBoundsNeedsUpdate = false;
             bool m_cullableNeedsRebuild = false;
             bool m_objectSrgNeedsUpdate = true;
@@ -117,9 +139,14 @@ namespace AZ
         };
 
         //! This feature processor handles static and dynamic non-skinned meshes.
+        //! Meshes are only updated in Simulate when something changed since their last update: their transform, bounds,
+        //! material assignments, LOD configuration or visibility, or the materials of their draw packets. The changed meshes
+        //! are collected in a dirty list, which Simulate processes in parallel on a task graph that is reused every frame.
         class MeshFeatureProcessor final
             : public MeshFeatureProcessorInterface
         {
+            friend class MeshDataInstance;
+
         public:
 
             AZ_RTTI(AZ::Render::MeshFeatureProcessor, "{6E3DFA1D-22C7-4738-A3AE-1E10AB88B29B}", MeshFeatureProcessorInterface);
@@ -127,7 +154,7 @@ namespace AZ
             static void Reflect(AZ::ReflectContext* context);
 
             MeshFeatureProcessor() = default;
-            virtual ~MeshFeatureProcessor() = default;
+            virtual ~MeshFeatureProcessor();
 
             // FeatureProcessor overrides ...
             //! Creates pools, buffers, and buffer views
@@ -136,6 +163,8 @@ namespace AZ
             void Deactivate() override;
             //! Updates GPU buffers with latest data from render proxies
             void Simulate(const FeatureProcessor::SimulatePacket& packet) override;
+            //! Adds the mesh updates as tasks of the simulation task graph.
+            void AddSimulateTasks(AZ::TaskGraph& simulateTaskGraph, const SimulatePacket& packet) override;
 
             // RPI::SceneNotificationBus overrides ...
             void OnBeginPrepareRender() override;
@@ -194,13 +223,33 @@ namespace AZ
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline) override;
             void OnRenderPipelineRemoved(RPI::RenderPipeline* pipeline) override;
-                        
+
+            // Mesh updates, in Simulate or in the tasks added by AddSimulateTasks...
+            //! Collects the meshes to update in m_meshesToUpdate.
+            void PrepareMeshUpdates();
+            //! Updates the meshes in [begin, end) of m_meshesToUpdate, called in parallel.
+            void UpdateMeshes(size_t begin, size_t end);
+            //! Finishes the updates that can't run in parallel.
+            void FinishMeshUpdates();
+
+            //! Tracks the materials of the draw packets of the mesh, called when its draw packets are rebuilt.
+            void TrackMeshMaterials(MeshDataInstance& meshDataInstance);
+
+            using DirtyMeshList = MeshDirtyList<MeshDataInstance, RPI::Material>;
+
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<MeshDataInstance> m_meshData;
             TransformServiceFeatureProcessor* m_transformService;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
             bool m_forceRebuildDrawPackets = false;
+
+            DirtyMeshList m_dirtyMeshes;
+
+            //! The meshes updated by the current Simulate, and whether their draw packets are rebuilt.
+            AZStd::vector<MeshDataInstance*> m_meshesToUpdate;
+            bool m_rebuildDrawPackets = false;
+            AZStd::unique_ptr<MeshUpdateTaskGraph> m_meshUpdateTaskGraph;
         };
     } // namespace Render
 } // namespace AZ
@@ -33,16 +33,193 @@ namespace AZ
             {
                 return color.GetA8() == 0xFF;
             }
+
+            // The recording state of ThreadBuffers packs the token of the owner thread, 0 for free buffers, with the index + 1 of
+            // the buffer that the owner records into, NotRecording while it doesn't record.
+            constexpr uint64_t NotRecording = 0;
+
+            uint64_t MakeRecordingState(uint64_t threadToken, uint64_t recordingSlot)
+            {
+                return (threadToken << 8) | recordingSlot;
+            }
+
+            uint64_t GetOwnerToken(uint64_t recordingState)
+            {
+                return recordingState >> 8;
+            }
+
+            uint64_t GetRecordingSlot(uint64_t recordingState)
+            {
+                return recordingState & 0xFF;
+            }
+
+            // Unlike thread ids, the tokens of exited threads are never reused, so a new thread never owns the buffers of an old one.
+            uint64_t GetThreadToken()
+            {
+                static AZStd::atomic_uint64_t s_nextThreadToken{ 1 };
+                static thread_local const uint64_t s_threadToken = s_nextThreadToken.fetch_add(1, AZStd::memory_order_relaxed);
+                return s_threadToken;
+            }
         }
 
         const uint32_t VerticesPerPoint = 1;
         const uint32_t VerticesPerLine = 2;
         const uint32_t VerticesPerTriangle = 3;
 
+        // The size of the per thread cache of GetThreadBuffers. A thread rarely draws to more queues than this in a frame.
+        static const size_t ThreadBuffersCacheSize = 4;
+
+        AuxGeomDrawQueue::AuxGeomDrawQueue()
+        {
+            static AZStd::atomic_uint64_t s_nextQueueId{ 1 };
+            m_queueId = s_nextQueueId.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+
+        AuxGeomDrawQueue::~AuxGeomDrawQueue()
+        {
+            ThreadBuffers* threadBuffers = m_threadBuffers.load(AZStd::memory_order_acquire);
+            while (threadBuffers)
+            {
+                ThreadBuffers* nextThreadBuffers = threadBuffers->m_next;
+                delete threadBuffers;
+                threadBuffers = nextThreadBuffers;
+            }
+        }
+
+        AuxGeomDrawQueue::ThreadBuffers& AuxGeomDrawQueue::GetThreadBuffers(bool findOwned)
+        {
+            struct CacheEntry
+            {
+                uint64_t m_queueId = 0;
+                ThreadBuffers* m_threadBuffers = nullptr;
+            };
+            static thread_local CacheEntry s_cache[ThreadBuffersCacheSize];
+            static thread_local size_t s_nextCacheEntry = 0;
+
+            for (CacheEntry& entry : s_cache)
+            {
+                if (entry.m_queueId == m_queueId)
+                {
+                    if (!findOwned)
+                    {
+                        return *entry.m_threadBuffers;
+                    }
+                    entry = CacheEntry{};
+                }
+            }
+
+            // Find the buffers the thread owns, or take over free buffers. Buffers are never removed from the list while the queue
+            // is alive, so it can be traversed without a lock.
+            const uint64_t threadToken = GetThreadToken();
+            const uint64_t ownedState = MakeRecordingState(threadToken, NotRecording);
+            ThreadBuffers* threadBuffers = m_threadBuffers.load(AZStd::memory_order_acquire);
+            while (threadBuffers && GetOwnerToken(threadBuffers->m_recordingState.load(AZStd::memory_order_acquire)) != threadToken)
+            {
+                threadBuffers = threadBuffers->m_next;
+            }
+
+            if (!threadBuffers)
+            {
+                for (threadBuffers = m_threadBuffers.load(AZStd::memory_order_acquire); threadBuffers; threadBuffers = threadBuffers->m_next)
+                {
+                    uint64_t freeState = MakeRecordingState(0, NotRecording);
+                    if (threadBuffers->m_recordingState.compare_exchange_strong(freeState, ownedState, AZStd::memory_order_acq_rel))
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if (!threadBuffers)
+            {
+                threadBuffers = aznew ThreadBuffers();
+                threadBuffers->m_recordingState.store(ownedState, AZStd::memory_order_relaxed);
+                threadBuffers->m_next = m_threadBuffers.load(AZStd::memory_order_relaxed);
+                while (!m_threadBuffers.compare_exchange_weak(threadBuffers->m_next, threadBuffers, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                }
+            }
+
+            s_cache[s_nextCacheEntry] = CacheEntry{ m_queueId, threadBuffers };
+            s_nextCacheEntry = (s_nextCacheEntry + 1) % ThreadBuffersCacheSize;
+            return *threadBuffers;
+        }
+
+        size_t AuxGeomDrawQueue::GetThreadBuffersCount() const
+        {
+            size_t count = 0;
+            for (ThreadBuffers* threadBuffers = m_threadBuffers.load(AZStd::memory_order_acquire); threadBuffers; threadBuffers = threadBuffers->m_next)
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        AuxGeomDrawQueue::ScopedRecording::ScopedRecording(AuxGeomDrawQueue& drawQueue)
+        {
+            const uint64_t threadToken = GetThreadToken();
+            for (bool findOwned = false; ; findOwned = true)
+            {
+                m_threadBuffers = &drawQueue.GetThreadBuffers(findOwned);
+                uint64_t recordingState = m_threadBuffers->m_recordingState.load(AZStd::memory_order_acquire);
+                if (GetOwnerToken(recordingState) != threadToken)
+                {
+                    // Commit freed the cached buffers while the thread didn't draw.
+                    continue;
+                }
+
+                // Nested recordings keep the buffer of the outer one.
+                if (GetRecordingSlot(recordingState) != NotRecording)
+                {
+                    break;
+                }
+
+                // The recording state must be visible to Commit before the buffer index is read again, so a draw either records
+                // into the buffer that Commit waits for, or into the next one. Commit only frees buffers that aren't recording, so
+                // the exchange only fails if the buffers were freed.
+                int bufferIndex = drawQueue.m_currentBufferIndex.load(AZStd::memory_order_seq_cst);
+                bool isOwned = true;
+                while (true)
+                {
+                    const uint64_t newRecordingState = MakeRecordingState(threadToken, bufferIndex + 1);
+                    if (!m_threadBuffers->m_recordingState.compare_exchange_strong(recordingState, newRecordingState, AZStd::memory_order_seq_cst))
+                    {
+                        isOwned = false;
+                        break;
+                    }
+
+                    const int currentBufferIndex = drawQueue.m_currentBufferIndex.load(AZStd::memory_order_seq_cst);
+                    if (currentBufferIndex == bufferIndex)
+                    {
+                        break;
+                    }
+                    recordingState = newRecordingState;
+                    bufferIndex = currentBufferIndex;
+                }
+
+                if (isOwned)
+                {
+                    m_threadBuffers->m_recordingIndex = bufferIndex;
+                    break;
+                }
+            }
+
+            ++m_threadBuffers->m_recordingDepth;
+            m_buffer = &m_threadBuffers->m_buffers[m_threadBuffers->m_recordingIndex];
+        }
+
+        AuxGeomDrawQueue::ScopedRecording::~ScopedRecording()
+        {
+            if (--m_threadBuffers->m_recordingDepth == 0)
+            {
+                m_threadBuffers->m_recordingState.store(MakeRecordingState(GetThreadToken(), NotRecording), AZStd::memory_order_release);
+            }
+        }
+
         int32_t AuxGeomDrawQueue::AddViewProjOverride(const AZ::Matrix4x4& viewProj)
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            ScopedRecording recording(*this);
+            AuxGeomBufferData& buffer = recording.GetBuffer();
 
             //the override matrix is pushed an array that persists until the frame is over, so that the matrix can be looked up later
             buffer.m_viewProjOverrides.push_back(viewProj);
@@ -51,8 +228,8 @@ namespace AZ
 
         int32_t AuxGeomDrawQueue::GetOrAdd2DViewProjOverride()
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            ScopedRecording recording(*this);
+            AuxGeomBufferData& buffer = recording.GetBuffer();
 
             if (buffer.m_2DViewProjOverrideIndex == -1)
             {
@@ -564,29 +741,82 @@ namespace AZ
         AuxGeomBufferData* AuxGeomDrawQueue::Commit()
         {
             AZ_PROFILE_SCOPE(AzRender, "AuxGeomDrawQueue: Commit");
-            // get a mutually exclusive lock and then switch to the next buffer, returning a pointer to the current buffer (before the switch)
 
-            // grab the lock
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
+            // switch the buffer for future requests to the other buffer, so the threads stop recording into the filled buffers
+            const int filledBufferIndex = m_currentBufferIndex.load(AZStd::memory_order_relaxed);
+            m_currentBufferIndex.store((filledBufferIndex + 1) % NumBuffers, AZStd::memory_order_seq_cst);
 
-            // get a pointer to the buffer we have been filling
-            AuxGeomBufferData* filledBufferData = &m_buffers[m_currentBufferIndex];
+            ClearBufferData(m_committedBuffer);
 
-            // switch the buffer for future requests to the other buffer
-            m_currentBufferIndex = (m_currentBufferIndex + 1) % NumBuffers;
+            // threads that add their buffers after this only see the next buffer index, so they have nothing to merge yet
+            const uint64_t filledRecordingSlot = filledBufferIndex + 1;
+            for (ThreadBuffers* threadBuffers = m_threadBuffers.load(AZStd::memory_order_seq_cst); threadBuffers; threadBuffers = threadBuffers->m_next)
+            {
+                // wait for a draw that started before the switch, it might still write to the filled buffer. Draws that record
+                // into the next buffer don't hold up the commit.
+                while (GetRecordingSlot(threadBuffers->m_recordingState.load(AZStd::memory_order_seq_cst)) == filledRecordingSlot)
+                {
+                    AZStd::this_thread::yield();
+                }
+
+                AuxGeomBufferData& filledBufferData = threadBuffers->m_buffers[filledBufferIndex];
+                threadBuffers->m_idleCommitCount = IsBufferDataEmpty(filledBufferData) ? threadBuffers->m_idleCommitCount + 1 : 0;
+                MergeBufferData(filledBufferData, m_committedBuffer);
+
+                // Free the buffers of a thread that stopped drawing, which might have exited. If it draws again, it takes over free
+                // buffers like a new thread. Draws it recorded into the next buffer are still merged by the next commit.
+                uint64_t recordingState = threadBuffers->m_recordingState.load(AZStd::memory_order_acquire);
+                if ((threadBuffers->m_idleCommitCount >= FreeThreadBuffersAfterIdleCommits) && (GetOwnerToken(recordingState) != 0) &&
+                    (GetRecordingSlot(recordingState) == NotRecording))
+                {
+                    threadBuffers->m_recordingState.compare_exchange_strong(recordingState, MakeRecordingState(0, NotRecording), AZStd::memory_order_acq_rel);
+                }
+
+                // Nobody records into the filled buffer until the next commit, so the memory of free buffers can be released.
+                if (GetOwnerToken(threadBuffers->m_recordingState.load(AZStd::memory_order_acquire)) == 0)
+                {
+                    filledBufferData = AuxGeomBufferData();
+                }
+                else
+                {
+                    ClearBufferData(filledBufferData);
+                }
+            }
 
-            // Clear the buffers that new requests will get added to
-            ClearCurrentBufferData();
+            return &m_committedBuffer;
+        }
 
-            return filledBufferData;
+        void AuxGeomDrawQueue::ValidateViewProjOverrideIndex(
+            [[maybe_unused]] const AuxGeomBufferData& buffer, [[maybe_unused]] int32_t viewProjOverrideIndex)
+        {
+            AZ_Assert(
+                viewProjOverrideIndex < aznumeric_cast<int32_t>(buffer.m_viewProjOverrides.size()),
+                "View projection override index %d wasn't added by this thread in this frame, the thread only added %zu overrides. "
+                "Override indices are only valid on the thread that requested them, until the next commit.",
+                viewProjOverrideIndex, buffer.m_viewProjOverrides.size());
         }
 
-        void AuxGeomDrawQueue::ClearCurrentBufferData()
+        bool AuxGeomDrawQueue::IsBufferDataEmpty(const AuxGeomBufferData& data)
         {
-            AZ_PROFILE_SCOPE(AzRender, "AuxGeomDrawQueue: ClearCurrentBufferData");
-            // no need for mutex here, this function is only called from a function holding a lock
-            AuxGeomBufferData& data = m_buffers[m_currentBufferIndex];
+            const DynamicPrimitiveData& primitives = data.m_primitiveData;
+            if (!primitives.m_primitiveBuffer.empty() || !data.m_viewProjOverrides.empty())
+            {
+                return false;
+            }
 
+            for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
+            {
+                if (!data.m_opaqueShapes[drawStyle].empty() || !data.m_translucentShapes[drawStyle].empty() ||
+                    !data.m_opaqueBoxes[drawStyle].empty() || !data.m_translucentBoxes[drawStyle].empty())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void AuxGeomDrawQueue::ClearBufferData(AuxGeomBufferData& data)
+        {
             DynamicPrimitiveData& primitives = data.m_primitiveData;
             primitives.m_primitiveBuffer.clear();
             primitives.m_vertexBuffer.clear();
@@ -605,6 +835,80 @@ namespace AZ
             data.m_2DViewProjOverrideIndex = -1;
         }
 
+        void AuxGeomDrawQueue::MergeBufferData(AuxGeomBufferData& source, AuxGeomBufferData& target)
+        {
+            DynamicPrimitiveData& sourcePrimitives = source.m_primitiveData;
+            DynamicPrimitiveData& targetPrimitives = target.m_primitiveData;
+
+            const size_t vertexOffset = targetPrimitives.m_vertexBuffer.size();
+            const AuxGeomIndex indexOffset = aznumeric_cast<AuxGeomIndex>(targetPrimitives.m_indexBuffer.size());
+            const int32_t viewProjOverrideOffset = aznumeric_cast<int32_t>(target.m_viewProjOverrides.size());
+
+            // the draws of the first thread don't need any remapping, so take its buffers and leave the empty ones to the thread
+            if (vertexOffset == 0 && indexOffset == 0 && viewProjOverrideOffset == 0)
+            {
+                bool isTargetEmpty = targetPrimitives.m_primitiveBuffer.empty();
+                for (int drawStyle = 0; drawStyle < DrawStyle_Count && isTargetEmpty; ++drawStyle)
+                {
+                    isTargetEmpty = target.m_opaqueShapes[drawStyle].empty() && target.m_translucentShapes[drawStyle].empty() &&
+                        target.m_opaqueBoxes[drawStyle].empty() && target.m_translucentBoxes[drawStyle].empty();
+                }
+                if (isTargetEmpty)
+                {
+                    AZStd::swap(source, target);
+                    return;
+                }
+            }
+
+            const auto remapViewProjOverrideIndex = [viewProjOverrideOffset](int32_t viewProjOverrideIndex)
+            {
+                return viewProjOverrideIndex < 0 ? viewProjOverrideIndex : viewProjOverrideIndex + viewProjOverrideOffset;
+            };
+
+            if (vertexOffset + sourcePrimitives.m_vertexBuffer.size() > MaxDynamicVertexCount)
+            {
+                AZ_WarningOnce("AuxGeom", false, "Draw functions ignored, would exceed maximum allowed index of %d", MaxDynamicVertexCount);
+            }
+            else
+            {
+                targetPrimitives.m_vertexBuffer.insert(
+                    targetPrimitives.m_vertexBuffer.end(), sourcePrimitives.m_vertexBuffer.begin(), sourcePrimitives.m_vertexBuffer.end());
+
+                targetPrimitives.m_indexBuffer.reserve(targetPrimitives.m_indexBuffer.size() + sourcePrimitives.m_indexBuffer.size());
+                for (AuxGeomIndex index : sourcePrimitives.m_indexBuffer)
+                {
+                    targetPrimitives.m_indexBuffer.push_back(aznumeric_cast<AuxGeomIndex>(vertexOffset) + index);
+                }
+
+                targetPrimitives.m_primitiveBuffer.reserve(targetPrimitives.m_primitiveBuffer.size() + sourcePrimitives.m_primitiveBuffer.size());
+                for (const PrimitiveBufferEntry& sourcePrimitive : sourcePrimitives.m_primitiveBuffer)
+                {
+                    PrimitiveBufferEntry& primitive = targetPrimitives.m_primitiveBuffer.emplace_back(sourcePrimitive);
+                    primitive.m_indexOffset += indexOffset;
+                    primitive.m_viewProjOverrideIndex = remapViewProjOverrideIndex(primitive.m_viewProjOverrideIndex);
+                }
+            }
+
+            const auto appendRemapped = [&remapViewProjOverrideIndex](const auto& sourceEntries, auto& targetEntries)
+            {
+                for (const auto& sourceEntry : sourceEntries)
+                {
+                    auto& entry = targetEntries.emplace_back(sourceEntry);
+                    entry.m_viewProjOverrideIndex = remapViewProjOverrideIndex(entry.m_viewProjOverrideIndex);
+                }
+            };
+
+            for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
+            {
+                appendRemapped(source.m_opaqueShapes[drawStyle], target.m_opaqueShapes[drawStyle]);
+                appendRemapped(source.m_translucentShapes[drawStyle], target.m_translucentShapes[drawStyle]);
+                appendRemapped(source.m_opaqueBoxes[drawStyle], target.m_opaqueBoxes[drawStyle]);
+                appendRemapped(source.m_translucentBoxes[drawStyle], target.m_translucentBoxes[drawStyle]);
+            }
+
+            target.m_viewProjOverrides.insert(target.m_viewProjOverrides.end(), source.m_viewProjOverrides.begin(), source.m_viewProjOverrides.end());
+        }
+
         bool AuxGeomDrawQueue::ShouldBatchDraw(
             DynamicPrimitiveData& primBuffer, 
             AuxGeomPrimitiveType primType, 
@@ -649,10 +953,10 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(AzRender, "AuxGeomDrawQueue: DrawPrimitiveWithSharedVerticesCommon");
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // record into the buffer of this thread, a commit waits for the rest of this function to finish
+            ScopedRecording recording(*this);
+            AuxGeomBufferData& buffer = recording.GetBuffer();
+            ValidateViewProjOverrideIndex(buffer, viewProjOverrideIndex);
 
             // We have a separate PrimitiveBufferEntry for each AuxGeomDraw call
             DynamicPrimitiveData& primBuffer = buffer.m_primitiveData;
@@ -724,10 +1028,10 @@ namespace AZ
                 "Index count must be at least %d and must be a multiple of %d",
                 verticesPerPrimitiveType, verticesPerPrimitiveType);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // record into the buffer of this thread, a commit waits for the rest of this function to finish
+            ScopedRecording recording(*this);
+            AuxGeomBufferData& buffer = recording.GetBuffer();
+            ValidateViewProjOverrideIndex(buffer, viewProjOverrideIndex);
 
             // We have a separate PrimitiveBufferEntry for each AuxGeomDraw call
             DynamicPrimitiveData& primBuffer = buffer.m_primitiveData;
@@ -786,10 +1090,10 @@ namespace AZ
         {
             AuxGeomDrawStyle drawStyle = ConvertRPIDrawStyle(style);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // record into the buffer of this thread, a commit waits for the rest of this function to finish
+            ScopedRecording recording(*this);
+            AuxGeomBufferData& buffer = recording.GetBuffer();
+            ValidateViewProjOverrideIndex(buffer, shape.m_viewProjOverrideIndex);
 
             if (IsOpaque(shape.m_color))
             {
@@ -805,10 +1109,10 @@ namespace AZ
         {
             AuxGeomDrawStyle drawStyle = ConvertRPIDrawStyle(style);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // record into the buffer of this thread, a commit waits for the rest of this function to finish
+            ScopedRecording recording(*this);
+            AuxGeomBufferData& buffer = recording.GetBuffer();
+            ValidateViewProjOverrideIndex(buffer, box.m_viewProjOverrideIndex);
 
             if (IsOpaque(box.m_color))
             {
@@ -10,6 +10,8 @@
 
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Math/Transform.h>
 
@@ -31,6 +33,9 @@ namespace AZ
         /**
          * Class that stores up AuxGeom draw requests for one RPI scene.
          * This acts somewhat like a render proxy in that it stores data that is consumed by the feature processor.
+         *
+         * Each thread that draws records into its own buffers without taking a lock, and Commit merges the buffers of all the
+         * threads. The view projection override indices returned to a thread are only valid for the draws of that thread.
          */
         class AuxGeomDrawQueue final
             : public RPI::AuxGeomDraw
@@ -39,8 +44,8 @@ namespace AZ
 
             AZ_CLASS_ALLOCATOR(AuxGeomDrawQueue, AZ::SystemAllocator, 0);
 
-            AuxGeomDrawQueue() = default;
-            ~AuxGeomDrawQueue() override = default;
+            AuxGeomDrawQueue();
+            ~AuxGeomDrawQueue() override;
 
             // RPI::AuxGeomDraw
             int32_t AddViewProjOverride(const AZ::Matrix4x4& viewProj) override;
@@ -71,10 +76,71 @@ namespace AZ
             //! Switch clients of AuxGeom to using a different buffer and return the filled buffer for processing
             AuxGeomBufferData* Commit();
 
+            //! Returns the number of per thread buffers, which is the most threads that drew at the same time.
+            size_t GetThreadBuffersCount() const;
+
+            //! The buffers of a thread are freed for other threads after this many commits without draws from it.
+            static constexpr uint32_t FreeThreadBuffersAfterIdleCommits = 100;
+
+        private: // types
+
+            // We just toggle back and forth between two buffers, one being filled while the other is being merged by Commit.
+            static const int NumBuffers = 2;
+
+            //! The draws recorded by one thread. Commit frees the buffers of a thread that stopped drawing, e.g. because it
+            //! exited, and the next thread that needs buffers takes them over.
+            struct ThreadBuffers
+            {
+                AZ_CLASS_ALLOCATOR(ThreadBuffers, AZ::SystemAllocator, 0);
+
+                AuxGeomBufferData m_buffers[NumBuffers];
+
+                //! The thread that owns the buffers and the buffer it records into, see MakeRecordingState(). Commit only waits
+                //! for a draw that records into the buffer it merges, and only frees the buffers while the owner doesn't record.
+                AZStd::atomic_uint64_t m_recordingState{ 0 };
+
+                //! The depth of nested recordings and the buffer they record into, only accessed by the owner.
+                uint32_t m_recordingDepth = 0;
+                int m_recordingIndex = 0;
+
+                //! The number of commits in a row without draws in the merged buffer, only accessed by Commit.
+                uint32_t m_idleCommitCount = 0;
+
+                //! The buffers of the other threads. The list only grows until the queue is destroyed.
+                ThreadBuffers* m_next = nullptr;
+            };
+
+            //! Gives access to the current buffer of the calling thread for the lifetime of the scope.
+            class ScopedRecording
+            {
+            public:
+                explicit ScopedRecording(AuxGeomDrawQueue& drawQueue);
+                ~ScopedRecording();
+
+                AuxGeomBufferData& GetBuffer() { return *m_buffer; }
+
+            private:
+                ThreadBuffers* m_threadBuffers = nullptr;
+                AuxGeomBufferData* m_buffer = nullptr;
+            };
+
         private: // functions
 
-            //! Clear the current buffers
-            void ClearCurrentBufferData();
+            //! Returns the buffers of the calling thread, taking over free buffers or creating new ones on the first draw of the
+            //! thread. With findOwned, the per thread cache is skipped, for buffers that were freed since they were cached.
+            ThreadBuffers& GetThreadBuffers(bool findOwned = false);
+
+            //! Returns true if the buffer doesn't have any draws.
+            static bool IsBufferDataEmpty(const AuxGeomBufferData& data);
+
+            //! Asserts that a draw uses a view projection override index that the calling thread added to its current buffer.
+            static void ValidateViewProjOverrideIndex(const AuxGeomBufferData& buffer, int32_t viewProjOverrideIndex);
+
+            //! Clear the buffers
+            static void ClearBufferData(AuxGeomBufferData& data);
+
+            //! Moves the draws of a thread to the end of the merged draws, remapping their indices.
+            static void MergeBufferData(AuxGeomBufferData& source, AuxGeomBufferData& target);
 
             bool ShouldBatchDraw(
                 DynamicPrimitiveData& primBuffer, 
@@ -120,14 +186,16 @@ namespace AZ
 
         private: // data
 
-            // We just toggle back and forth between two buffers, one being filled while the other is being processed
-            // by the FeatureProcessor.
-            static const int NumBuffers = 2;
-            AuxGeomBufferData m_buffers[NumBuffers];
-            int m_currentBufferIndex = 0;
-            float m_pointSize = 3.0f;
+            //! Identifies the queue in the per thread cache of GetThreadBuffers. Unlike the address of the queue, it's never reused.
+            uint64_t m_queueId = 0;
+
+            AZStd::atomic<ThreadBuffers*> m_threadBuffers{ nullptr };
+            AZStd::atomic_int m_currentBufferIndex{ 0 };
 
-            AZStd::recursive_mutex m_buffersWriteLock;
+            //! The merged draws of all the threads, processed by the FeatureProcessor until the next Commit.
+            AuxGeomBufferData m_committedBuffer;
+
+            float m_pointSize = 3.0f;
         };
 
     } // namespace Render
@@ -205,6 +205,13 @@ namespace AZ
                 size_t lodIndex = 0;
                 for (const Data::Instance<AZ::RPI::ModelLod>& lod : model->GetLods())
                 {
+                    // Lods of a streamed model that are not resident are null.
+                    if (!lod)
+                    {
+                        ++lodIndex;
+                        continue;
+                    }
+
                     for (const AZ::RPI::ModelLod::Mesh& mesh : lod->GetMeshes())
                     {
                         if (mesh.m_material)
@@ -231,6 +238,11 @@ namespace AZ
             const MaterialAssignmentLodIndex lodIndex,
             const AZStd::string& labelFilter)
         {
+            if (!lod)
+            {
+                return MaterialAssignmentId();
+            }
+
             for (const AZ::RPI::ModelLod::Mesh& mesh : lod->GetMeshes())
             {
                 const AZ::RPI::ModelMaterialSlot& slot = model->GetModelAsset()->FindMaterialSlot(mesh.m_materialSlotStableId);
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! The list of meshes that changed since they were last updated, and the materials the meshes use, which are
+        //! checked for changes every time the list is taken so the meshes of a changed material are updated too.
+        //! MeshType must have a size_t m_dirtyIndex initialized to InvalidIndex and a MaterialList m_trackedMaterials,
+        //! both owned by this list. MaterialType must have the NeedsCompile() and GetCurrentChangeId() of RPI::Material.
+        //! All functions can be called from any thread.
+        template<typename MeshType, typename MaterialType>
+        class MeshDirtyList final
+        {
+        public:
+            using MaterialList = AZStd::vector<AZStd::intrusive_ptr<MaterialType>>;
+            using ChangeId = decltype(AZStd::declval<const MaterialType&>().GetCurrentChangeId());
+
+            static constexpr size_t InvalidIndex = static_cast<size_t>(-1);
+
+            //! Adds the mesh to the list, unless it's already in it.
+            void MarkDirty(MeshType& mesh)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                AddToList(mesh);
+            }
+
+            //! Removes the mesh from the list and stops tracking its materials, for meshes that are released.
+            void Remove(MeshType& mesh)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                const size_t dirtyIndex = mesh.m_dirtyIndex;
+                if (dirtyIndex != InvalidIndex)
+                {
+                    // Swap with the last dirty mesh, the order of the list doesn't matter.
+                    m_dirtyMeshes[dirtyIndex] = m_dirtyMeshes.back();
+                    m_dirtyMeshes[dirtyIndex]->m_dirtyIndex = dirtyIndex;
+                    m_dirtyMeshes.pop_back();
+                    mesh.m_dirtyIndex = InvalidIndex;
+                }
+                UntrackMaterialsLocked(mesh);
+            }
+
+            //! Replaces the tracked materials of the mesh. Null and duplicate materials are ignored.
+            void TrackMaterials(MeshType& mesh, const MaterialList& materials)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                UntrackMaterialsLocked(mesh);
+                for (const auto& material : materials)
+                {
+                    if (material && AZStd::find(mesh.m_trackedMaterials.begin(), mesh.m_trackedMaterials.end(), material) == mesh.m_trackedMaterials.end())
+                    {
+                        mesh.m_trackedMaterials.push_back(material);
+                        m_materialUsages[material.get()].m_meshes.insert(&mesh);
+                    }
+                }
+            }
+
+            void UntrackMaterials(MeshType& mesh)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                UntrackMaterialsLocked(mesh);
+            }
+
+            //! Marks the meshes of the materials that changed since the last call dirty, then moves the list to outMeshes.
+            //! Meshes marked dirty while outMeshes is processed are added to the next list.
+            void TakeDirtyMeshes(AZStd::vector<MeshType*>& outMeshes)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+                // Same as MeshDrawPacket::Update(), a change is only picked up once the material is compiled.
+                for (auto& [material, materialUsage] : m_materialUsages)
+                {
+                    if (material->NeedsCompile() || materialUsage.m_changeId == material->GetCurrentChangeId())
+                    {
+                        continue;
+                    }
+
+                    materialUsage.m_changeId = material->GetCurrentChangeId();
+                    for (MeshType* mesh : materialUsage.m_meshes)
+                    {
+                        AddToList(*mesh);
+                    }
+                }
+
+                outMeshes.clear();
+                AZStd::swap(outMeshes, m_dirtyMeshes);
+                for (MeshType* mesh : outMeshes)
+                {
+                    mesh->m_dirtyIndex = InvalidIndex;
+                }
+            }
+
+            //! Empties the list, for when every mesh is updated anyway.
+            void Clear()
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                for (MeshType* mesh : m_dirtyMeshes)
+                {
+                    mesh->m_dirtyIndex = InvalidIndex;
+                }
+                m_dirtyMeshes.clear();
+            }
+
+            //! Returns the number of distinct materials used by the tracked meshes.
+            size_t GetTrackedMaterialCount() const
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                return m_materialUsages.size();
+            }
+
+        private:
+            //! The meshes that use a material, and the change id of the material when they were last marked dirty for it.
+            //! A newly tracked material starts at the default change id, which a material never returns, so its meshes
+            //! are marked dirty again once it's compiled.
+            struct MaterialUsage
+            {
+                ChangeId m_changeId = {};
+                AZStd::unordered_set<MeshType*> m_meshes;
+            };
+
+            void AddToList(MeshType& mesh)
+            {
+                if (mesh.m_dirtyIndex == InvalidIndex)
+                {
+                    mesh.m_dirtyIndex = m_dirtyMeshes.size();
+                    m_dirtyMeshes.push_back(&mesh);
+                }
+            }
+
+            void UntrackMaterialsLocked(MeshType& mesh)
+            {
+                for (const auto& material : mesh.m_trackedMaterials)
+                {
+                    auto usageIt = m_materialUsages.find(material.get());
+                    if (usageIt != m_materialUsages.end())
+                    {
+                        usageIt->second.m_meshes.erase(&mesh);
+                        if (usageIt->second.m_meshes.empty())
+                        {
+                            m_materialUsages.erase(usageIt);
+                        }
+                    }
+                }
+                mesh.m_trackedMaterials.clear();
+            }
+
+            mutable AZStd::mutex m_mutex;
+            AZStd::vector<MeshType*> m_dirtyMeshes;
+            // The materials are kept alive by the m_trackedMaterials of the meshes.
+            AZStd::unordered_map<MaterialType*, MaterialUsage> m_materialUsages;
+        };
+    } // namespace Render
+} // namespace AZ
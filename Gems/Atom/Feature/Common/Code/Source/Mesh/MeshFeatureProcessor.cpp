@@ -12,6 +12,7 @@
 #include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
 #include <Atom/Feature/Mesh/ModelReloaderSystemInterface.h>
 #include <Atom/Feature/ReflectionProbe/ReflectionProbeFeatureProcessor.h>
+#include <Mesh/MeshUpdateTaskGraph.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Culling.h>
@@ -30,6 +31,7 @@
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Asset/AssetCommon.h>
 
@@ -47,6 +49,8 @@ namespace AZ
             }
         }
 
+        MeshFeatureProcessor::~MeshFeatureProcessor() = default;
+
         void MeshFeatureProcessor::Activate()
         {
             m_transformService = GetParentScene()->GetFeatureProcessor<TransformServiceFeatureProcessor>();
@@ -60,6 +64,12 @@ namespace AZ
             };
             RPI::ShaderSystemInterface::Get()->Connect(m_handleGlobalShaderOptionUpdate);
             EnableSceneNotification();
+
+            m_meshUpdateTaskGraph = AZStd::make_unique<MeshUpdateTaskGraph>(
+                [this](size_t begin, size_t end)
+                {
+                    UpdateMeshes(begin, end);
+                });
         }
 
         void MeshFeatureProcessor::Deactivate()
@@ -72,6 +82,7 @@ namespace AZ
             );
             m_transformService = nullptr;
             m_forceRebuildDrawPackets = false;
+            m_meshUpdateTaskGraph.reset();
         }
 
         void MeshFeatureProcessor::Simulate(const FeatureProcessor::SimulatePacket& packet)
@@ -81,59 +92,115 @@ namespace AZ
 
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
-            const auto iteratorRanges = m_meshData.GetParallelRanges();
-            AZ::JobCompletion jobCompletion;
-            for (const auto& iteratorRange : iteratorRanges)
+            PrepareMeshUpdates();
+            m_meshUpdateTaskGraph->ProcessWithJobs(m_meshesToUpdate.size());
+            FinishMeshUpdates();
+        }
+
+        void MeshFeatureProcessor::AddSimulateTasks(AZ::TaskGraph& simulateTaskGraph, [[maybe_unused]] const SimulatePacket& packet)
+        {
+            // The mesh updates are tasks of the scene's simulation graph between preparing and finishing them, waiting on a
+            // graph of their own isn't allowed in the task that runs Simulate.
+            static const AZ::TaskDescriptor prepareTaskDescriptor{ "AZ::Render::MeshFeatureProcessor::PrepareMeshUpdates", "Graphics" };
+            static const AZ::TaskDescriptor finishTaskDescriptor{ "AZ::Render::MeshFeatureProcessor::FinishMeshUpdates", "Graphics" };
+
+            AZ::TaskToken prepareTask = simulateTaskGraph.AddTask(
+                prepareTaskDescriptor,
+                [this]()
+                {
+                    m_meshDataChecker.soft_lock();
+                    PrepareMeshUpdates();
+                    m_meshUpdateTaskGraph->SetItemCount(m_meshesToUpdate.size());
+                });
+            AZ::TaskToken finishTask = simulateTaskGraph.AddTask(
+                finishTaskDescriptor,
+                [this]()
+                {
+                    FinishMeshUpdates();
+                    m_meshDataChecker.soft_unlock();
+                });
+            m_meshUpdateTaskGraph->AddTasks(simulateTaskGraph, prepareTask, finishTask, AZ::TaskExecutor::Instance().GetThreadCount());
+        }
+
+        void MeshFeatureProcessor::PrepareMeshUpdates()
+        {
+            // A rebuild requested while the meshes are updated is done by the next update.
+            m_rebuildDrawPackets = m_forceRebuildDrawPackets;
+            m_forceRebuildDrawPackets = false;
+
+            if (m_rebuildDrawPackets)
             {
-                const auto jobLambda = [&]() -> void
+                // Every draw packet is rebuilt, so every mesh is updated and the dirty list is discarded.
+                m_dirtyMeshes.Clear();
+
+                m_meshesToUpdate.clear();
+                m_meshesToUpdate.reserve(m_meshData.size());
+                for (MeshDataInstance& meshDataInstance : m_meshData)
                 {
-                    for (auto meshDataIter = iteratorRange.first; meshDataIter != iteratorRange.second; ++meshDataIter)
-                    {
-                        if (!meshDataIter->m_model)
-                        {
-                            continue;   // model not loaded yet
-                        }
+                    m_meshesToUpdate.push_back(&meshDataInstance);
+                }
+            }
+            else
+            {
+                // Meshes marked dirty while the list is processed are queued for the next frame.
+                m_dirtyMeshes.TakeDirtyMeshes(m_meshesToUpdate);
+            }
+        }
 
-                        if (!meshDataIter->m_visible)
-                        {
-                            continue;
-                        }
+        void MeshFeatureProcessor::UpdateMeshes(size_t begin, size_t end)
+        {
+            for (size_t meshIndex = begin; meshIndex < end; ++meshIndex)
+            {
+                MeshDataInstance& meshDataInstance = *m_meshesToUpdate[meshIndex];
+                if (!meshDataInstance.m_model)
+                {
+                    continue;   // model not loaded yet
+                }
 
-                        if (meshDataIter->m_objectSrgNeedsUpdate)
-                        {
-                            meshDataIter->UpdateObjectSrg();
-                        }
+                if (!meshDataInstance.m_visible)
+                {
+                    continue;   // updated when the mesh is made visible again
+                }
 
-                        // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
-                        // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
-                        // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
-                        // to check every one.
-                        meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
+                if (meshDataInstance.m_objectSrgNeedsUpdate)
+                {
+                    meshDataInstance.UpdateObjectSrg();
+                }
 
-                        if (meshDataIter->m_cullableNeedsRebuild)
-                        {
-                            meshDataIter->BuildCullable();
-                        }
-                    }
-                };
-                Job* executeGroupJob = aznew JobFunction<decltype(jobLambda)>(jobLambda, true, nullptr); // Auto-deletes
-                executeGroupJob->SetDependent(&jobCompletion);
-                executeGroupJob->Start();
-            }
-            jobCompletion.StartAndWaitForCompletion();
+                meshDataInstance.UpdateDrawPackets(m_rebuildDrawPackets);
 
-            m_forceRebuildDrawPackets = false;
+                if (meshDataInstance.m_cullableNeedsRebuild)
+                {
+                    meshDataInstance.BuildCullable();
+                }
+            }
+        }
 
+        void MeshFeatureProcessor::FinishMeshUpdates()
+        {
             // CullingSystem::RegisterOrUpdateCullable() is not threadsafe, so need to do those updates in a single thread
-            for (MeshDataInstance& meshDataInstance : m_meshData)
+            for (MeshDataInstance* meshDataInstance : m_meshesToUpdate)
             {
-                if (meshDataInstance.m_model && meshDataInstance.m_cullBoundsNeedsUpdate)
+                if (meshDataInstance->m_model && meshDataInstance->m_cullBoundsNeedsUpdate)
                 {
-                    meshDataInstance.UpdateCullBounds(m_transformService);
+                    meshDataInstance->UpdateCullBounds(m_transformService);
                 }
             }
         }
 
+        void MeshFeatureProcessor::TrackMeshMaterials(MeshDataInstance& meshDataInstance)
+        {
+            DirtyMeshList::MaterialList materials;
+            for (MeshDataInstance::DrawPacketList& drawPacketList : meshDataInstance.m_drawPacketListsByLod)
+            {
+                for (RPI::MeshDrawPacket& drawPacket : drawPacketList)
+                {
+                    materials.push_back(drawPacket.GetMaterial());
+                }
+            }
+            m_dirtyMeshes.TrackMaterials(meshDataInstance, materials);
+        }
+
         void MeshFeatureProcessor::OnBeginPrepareRender()
         {
             m_meshDataChecker.soft_lock();
@@ -155,6 +222,7 @@ namespace AZ
 
             meshDataHandle->m_descriptor = descriptor;
             meshDataHandle->m_scene = GetParentScene();
+            meshDataHandle->m_featureProcessor = this;
             meshDataHandle->m_materialAssignments = materials;
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
             meshDataHandle->m_originalModelAsset = descriptor.m_modelAsset;
@@ -180,6 +248,7 @@ namespace AZ
             {
                 meshHandle->m_meshLoader.reset();
                 meshHandle->DeInit();
+                m_dirtyMeshes.Remove(*meshHandle);
                 m_transformService->ReleaseObjectId(meshHandle->m_objectId);
 
                 AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
@@ -225,6 +294,7 @@ namespace AZ
             if (meshHandle.IsValid())
             {
                 meshHandle->m_objectSrgNeedsUpdate = true;
+                meshHandle->MarkDirty();
             }
         }
 
@@ -254,6 +324,7 @@ namespace AZ
                 }
 
                 meshHandle->m_objectSrgNeedsUpdate = true;
+                meshHandle->MarkDirty();
             }
         }
 
@@ -277,6 +348,7 @@ namespace AZ
                 MeshDataInstance& meshData = *meshHandle;
                 meshData.m_cullBoundsNeedsUpdate = true;
                 meshData.m_objectSrgNeedsUpdate = true;
+                meshData.MarkDirty();
 
                 m_transformService->SetTransformForId(meshHandle->m_objectId, transform, nonUniformScale);
 
@@ -296,6 +368,7 @@ namespace AZ
                 meshData.m_aabb = localAabb;
                 meshData.m_cullBoundsNeedsUpdate = true;
                 meshData.m_objectSrgNeedsUpdate = true;
+                meshData.MarkDirty();
             }
         };
 
@@ -443,7 +516,10 @@ namespace AZ
                     {
                         meshHandle->BuildDrawPacketList(modelLodIndex);
                     }
+                    TrackMeshMaterials(*meshHandle);
                 }
+
+                meshHandle->MarkDirty();
             }
         }
 
@@ -470,6 +546,7 @@ namespace AZ
                 if (meshInstance.m_descriptor.m_useForwardPassIblSpecular)
                 {
                     meshInstance.m_objectSrgNeedsUpdate = true;
+                    meshInstance.MarkDirty();
                 }
             }
         }
@@ -607,6 +684,8 @@ namespace AZ
 
             RemoveRayTracingData();
 
+            m_lodResidencyChangedHandler.Disconnect();
+            m_featureProcessor->m_dirtyMeshes.UntrackMaterials(*this);
             m_drawPacketListsByLod.clear();
             m_materialAssignments.clear();
             m_shaderResourceGroup = {};
@@ -641,15 +720,43 @@ namespace AZ
             m_cullableNeedsRebuild = true;
             m_cullBoundsNeedsUpdate = true;
             m_objectSrgNeedsUpdate = true;
+
+            if (m_model->IsLodStreamed())
+            {
+                m_model->ConnectLodResidencyChangedHandler(m_lodResidencyChangedHandler);
+            }
+
+            m_featureProcessor->TrackMeshMaterials(*this);
+            MarkDirty();
+        }
+
+        void MeshDataInstance::OnLodResidencyChanged()
+        {
+            const size_t modelLodCount = m_model->GetLodCount();
+            for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
+            {
+                BuildDrawPacketList(modelLodIndex);
+            }
+
+            m_featureProcessor->TrackMeshMaterials(*this);
+            m_cullableNeedsRebuild = true;
+            MarkDirty();
         }
 
         void MeshDataInstance::BuildDrawPacketList(size_t modelLodIndex)
         {
+            MeshDataInstance::DrawPacketList& drawPacketListOut = m_drawPacketListsByLod[modelLodIndex];
+            drawPacketListOut.clear();
+
+            // Lods of a streamed model that are not resident have no draw packets, the cullable draws a resident lod instead.
+            if (!m_model->IsLodResident(modelLodIndex))
+            {
+                return;
+            }
+
             RPI::ModelLod& modelLod = *m_model->GetLods()[modelLodIndex];
             const size_t meshCount = modelLod.GetMeshes().size();
 
-            MeshDataInstance::DrawPacketList& drawPacketListOut = m_drawPacketListsByLod[modelLodIndex];
-            drawPacketListOut.clear();
             drawPacketListOut.reserve(meshCount);
 
             m_hasForwardPassIblSpecularMaterial = false;
@@ -1023,6 +1130,13 @@ namespace AZ
         void MeshDataInstance::SetMeshLodConfiguration(RPI::Cullable::LodConfiguration meshLodConfig)
         {
             m_cullable.m_lodData.m_lodConfiguration = meshLodConfig;
+
+            // The screen coverage of the lods is computed from the configuration when the cullable is built.
+            if (m_model)
+            {
+                m_cullableNeedsRebuild = true;
+                MarkDirty();
+            }
         }
 
         RPI::Cullable::LodConfiguration MeshDataInstance::GetMeshLodConfiguration() const
@@ -1062,6 +1176,7 @@ namespace AZ
             AZ_Assert(lodAssets.size() == modelLodCount, "Number of asset lods must match number of model lods");
 
             lodData.m_lods.resize(modelLodCount);
+            lodData.m_streamedModel = m_model->IsLodStreamed() ? m_model.get() : nullptr;
             cullData.m_drawListMask.reset();
 
             const size_t lodCount = lodAssets.size();
@@ -1092,7 +1207,7 @@ namespace AZ
                 }
 
                 lod.m_drawPackets.clear();
-                for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
+                for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[m_model->GetResidentLodIndex(lodIndex)])
                 {
                     const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
 
@@ -1241,6 +1356,17 @@ namespace AZ
         {
             m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+
+            // Hidden meshes are skipped by the updates, so catch up on the changes they missed.
+            if (isVisible)
+            {
+                MarkDirty();
+            }
+        }
+
+        void MeshDataInstance::MarkDirty()
+        {
+            m_featureProcessor->m_dirtyMeshes.MarkDirty(*this);
         }
     } // namespace Render
 } // namespace AZ
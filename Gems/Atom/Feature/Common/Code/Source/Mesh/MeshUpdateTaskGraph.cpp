@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshUpdateTaskGraph.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        MeshUpdateTaskGraph::MeshUpdateTaskGraph(ProcessRangeFunction processRange)
+            : m_processRange(AZStd::move(processRange))
+        {
+        }
+
+        uint32_t MeshUpdateTaskGraph::GetRangeCount(size_t itemCount, uint32_t maxRangeCount)
+        {
+            const size_t rangeCount = AZStd::min<size_t>(itemCount / MinItemsPerTask, maxRangeCount);
+            return static_cast<uint32_t>(AZStd::max<size_t>(rangeCount, 1));
+        }
+
+        void MeshUpdateTaskGraph::AddTasks(TaskGraph& taskGraph, TaskToken& prepareTask, TaskToken& finishedTask, uint32_t taskCount)
+        {
+            m_taskCount = AZStd::max(taskCount, 1u);
+
+            static const TaskDescriptor meshUpdateTaskDescriptor{ "AZ::Render::MeshUpdateTaskGraph", "Graphics" };
+            for (uint32_t taskIndex = 0; taskIndex < m_taskCount; ++taskIndex)
+            {
+                TaskToken rangeTask = taskGraph.AddTask(
+                    meshUpdateTaskDescriptor,
+                    [this, taskIndex]()
+                    {
+                        ProcessRange(taskIndex);
+                    });
+                rangeTask.Follows(prepareTask);
+                rangeTask.Precedes(finishedTask);
+            }
+        }
+
+        void MeshUpdateTaskGraph::SetItemCount(size_t itemCount)
+        {
+            m_itemCount = itemCount;
+            m_rangeCount = itemCount > 0 ? GetRangeCount(itemCount, m_taskCount) : 0;
+        }
+
+        void MeshUpdateTaskGraph::ProcessWithJobs(size_t itemCount)
+        {
+            if (itemCount == 0)
+            {
+                return;
+            }
+
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            const uint32_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 1;
+            m_itemCount = itemCount;
+            m_rangeCount = GetRangeCount(itemCount, workerCount);
+            if (m_rangeCount == 1)
+            {
+                ProcessRange(0);
+                return;
+            }
+
+            AZ::JobCompletion jobCompletion;
+            for (uint32_t rangeIndex = 0; rangeIndex < m_rangeCount; ++rangeIndex)
+            {
+                const auto jobLambda = [this, rangeIndex]()
+                {
+                    ProcessRange(rangeIndex);
+                };
+                AZ::Job* rangeJob = AZ::CreateJobFunction(jobLambda, true, nullptr);
+                rangeJob->SetDependent(&jobCompletion);
+                rangeJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        void MeshUpdateTaskGraph::ProcessRange(uint32_t rangeIndex) const
+        {
+            if (rangeIndex < m_rangeCount)
+            {
+                const size_t begin = m_itemCount * rangeIndex / m_rangeCount;
+                const size_t end = m_itemCount * (rangeIndex + 1) / m_rangeCount;
+                m_processRange(begin, end);
+            }
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/function/function_template.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Processes a list of meshes in parallel, each task or job processing a contiguous range of the list.
+        //! In a task graph the ranges are tasks between the task that prepares the list and the task that uses the results,
+        //! so the list is processed without blocking a worker. Outside of a task graph the ranges are processed with jobs.
+        class MeshUpdateTaskGraph final
+        {
+        public:
+            //! Processes the items in [begin, end) of the list.
+            using ProcessRangeFunction = AZStd::function<void(size_t begin, size_t end)>;
+
+            //! Lists with less items per task are split in fewer ranges, down to a single range.
+            static constexpr size_t MinItemsPerTask = 32;
+
+            explicit MeshUpdateTaskGraph(ProcessRangeFunction processRange);
+            ~MeshUpdateTaskGraph() = default;
+            AZ_DISABLE_COPY_MOVE(MeshUpdateTaskGraph);
+
+            //! Adds taskCount tasks to the graph that process the list, after prepareTask and before finishedTask.
+            //! prepareTask must call SetItemCount() with the size of the list. Tasks beyond the range count of the list return right away.
+            void AddTasks(TaskGraph& taskGraph, TaskToken& prepareTask, TaskToken& finishedTask, uint32_t taskCount);
+
+            //! Sets the size of the list processed by the tasks added with AddTasks().
+            void SetItemCount(size_t itemCount);
+
+            //! Processes ranges that cover [0, itemCount) with jobs, or on the calling thread for short lists or without a
+            //! job context, and returns when they are all processed.
+            void ProcessWithJobs(size_t itemCount);
+
+            //! Returns the number of ranges a list of itemCount items is split into with up to maxRangeCount ranges.
+            static uint32_t GetRangeCount(size_t itemCount, uint32_t maxRangeCount);
+
+        private:
+            void ProcessRange(uint32_t rangeIndex) const;
+
+            ProcessRangeFunction m_processRange;
+            uint32_t m_taskCount = 1;
+
+            // The list of the current update, read by the tasks or jobs.
+            size_t m_itemCount = 0;
+            uint32_t m_rangeCount = 0;
+        };
+    } // namespace Render
+} // namespace AZ
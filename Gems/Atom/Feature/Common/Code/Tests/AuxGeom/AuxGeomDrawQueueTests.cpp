@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AuxGeom/AuxGeomDrawQueue.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class AuxGeomDrawQueueTests
+        : public AllocatorsTestFixture
+    {
+    public:
+        static constexpr uint32_t ThreadCount = 8;
+        static constexpr uint32_t LinesPerThread = 500;
+
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        //! Draws one line between two points at the height y, with a different depth test per line so they aren't batched.
+        static void DrawLine(AuxGeomDrawQueue& drawQueue, float y, int32_t viewProjOverrideIndex)
+        {
+            const Vector3 points[] = { Vector3(0.0f, y, 0.0f), Vector3(1.0f, y, 0.0f) };
+            const Color color = Color::CreateOne();
+
+            RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments args;
+            args.m_verts = points;
+            args.m_vertCount = 2;
+            args.m_colors = &color;
+            args.m_colorCount = 1;
+            args.m_depthTest = static_cast<int>(y) % 2 ? RPI::AuxGeomDraw::DepthTest::On : RPI::AuxGeomDraw::DepthTest::Off;
+            args.m_viewProjectionOverrideIndex = viewProjOverrideIndex;
+            drawQueue.DrawLines(args);
+        }
+
+        //! Expects the indices and primitives of the committed buffer to only reference its own vertices and indices.
+        static void ExpectValidPrimitiveData(const AuxGeomBufferData& bufferData)
+        {
+            const DynamicPrimitiveData& primitiveData = bufferData.m_primitiveData;
+            for (AuxGeomIndex index : primitiveData.m_indexBuffer)
+            {
+                EXPECT_LT(index, primitiveData.m_vertexBuffer.size());
+            }
+
+            size_t indexCount = 0;
+            for (const PrimitiveBufferEntry& primitive : primitiveData.m_primitiveBuffer)
+            {
+                EXPECT_EQ(primitive.m_indexOffset, indexCount);
+                EXPECT_LT(primitive.m_viewProjOverrideIndex, static_cast<int32_t>(bufferData.m_viewProjOverrides.size()));
+                indexCount += primitive.m_indexCount;
+            }
+            EXPECT_EQ(indexCount, primitiveData.m_indexBuffer.size());
+        }
+    };
+
+    TEST_F(AuxGeomDrawQueueTests, Commit_SingleThread_ReturnsDraws)
+    {
+        AuxGeomDrawQueue drawQueue;
+        for (uint32_t i = 0; i < LinesPerThread; ++i)
+        {
+            DrawLine(drawQueue, static_cast<float>(i), -1);
+        }
+        drawQueue.DrawSphere(Vector3::CreateZero(), 1.0f, Color::CreateOne(), RPI::AuxGeomDraw::DrawStyle::Solid,
+            RPI::AuxGeomDraw::DepthTest::On, RPI::AuxGeomDraw::DepthWrite::On, RPI::AuxGeomDraw::FaceCullMode::Back, -1);
+
+        const AuxGeomBufferData* bufferData = drawQueue.Commit();
+        ASSERT_NE(bufferData, nullptr);
+        EXPECT_EQ(bufferData->m_primitiveData.m_vertexBuffer.size(), 2 * LinesPerThread);
+        EXPECT_EQ(bufferData->m_primitiveData.m_primitiveBuffer.size(), LinesPerThread);
+        EXPECT_EQ(bufferData->m_opaqueShapes[DrawStyle_Solid].size(), 1u);
+        ExpectValidPrimitiveData(*bufferData);
+
+        // The draws only belong to the frame they were committed in.
+        bufferData = drawQueue.Commit();
+        EXPECT_TRUE(bufferData->m_primitiveData.m_vertexBuffer.empty());
+        EXPECT_TRUE(bufferData->m_primitiveData.m_primitiveBuffer.empty());
+        EXPECT_TRUE(bufferData->m_opaqueShapes[DrawStyle_Solid].empty());
+    }
+
+    TEST_F(AuxGeomDrawQueueTests, Commit_ManyThreads_MergesDrawsAndRemapsOverrides)
+    {
+        AuxGeomDrawQueue drawQueue;
+
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&drawQueue, threadIndex]()
+            {
+                // Each thread gets its own override, identified by its translation.
+                const int32_t viewProjOverrideIndex =
+                    drawQueue.AddViewProjOverride(Matrix4x4::CreateTranslation(Vector3(static_cast<float>(threadIndex))));
+                for (uint32_t i = 0; i < LinesPerThread; ++i)
+                {
+                    DrawLine(drawQueue, static_cast<float>(i), viewProjOverrideIndex);
+                }
+                drawQueue.DrawSphere(Vector3(static_cast<float>(threadIndex)), 1.0f, Color::CreateOne(), RPI::AuxGeomDraw::DrawStyle::Solid,
+                    RPI::AuxGeomDraw::DepthTest::On, RPI::AuxGeomDraw::DepthWrite::On, RPI::AuxGeomDraw::FaceCullMode::Back, viewProjOverrideIndex);
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        const AuxGeomBufferData* bufferData = drawQueue.Commit();
+        EXPECT_EQ(bufferData->m_primitiveData.m_vertexBuffer.size(), 2 * LinesPerThread * ThreadCount);
+        EXPECT_EQ(bufferData->m_primitiveData.m_primitiveBuffer.size(), LinesPerThread * ThreadCount);
+        EXPECT_EQ(bufferData->m_viewProjOverrides.size(), ThreadCount);
+        ExpectValidPrimitiveData(*bufferData);
+
+        const ShapeBuffer& spheres = bufferData->m_opaqueShapes[DrawStyle_Solid];
+        ASSERT_EQ(spheres.size(), ThreadCount);
+        for (const ShapeBufferEntry& sphere : spheres)
+        {
+            ASSERT_GE(sphere.m_viewProjOverrideIndex, 0);
+            ASSERT_LT(sphere.m_viewProjOverrideIndex, static_cast<int32_t>(ThreadCount));
+            const Matrix4x4& viewProj = bufferData->m_viewProjOverrides[sphere.m_viewProjOverrideIndex];
+            EXPECT_TRUE(viewProj.GetTranslation().IsClose(sphere.m_position));
+        }
+    }
+
+    TEST_F(AuxGeomDrawQueueTests, Draw_OverrideOfAnotherThreadOrFrame_Asserts)
+    {
+        AuxGeomDrawQueue drawQueue;
+        const int32_t viewProjOverrideIndex = drawQueue.GetOrAdd2DViewProjOverride();
+        DrawLine(drawQueue, 0.0f, viewProjOverrideIndex);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+
+        // The override only belongs to the draws of the thread that added it.
+        AZStd::thread otherThread([&drawQueue, viewProjOverrideIndex]()
+        {
+            DrawLine(drawQueue, 1.0f, viewProjOverrideIndex);
+        });
+        otherThread.join();
+
+        // And only until the draws of the frame are committed.
+        drawQueue.Commit();
+        DrawLine(drawQueue, 2.0f, viewProjOverrideIndex);
+
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(AuxGeomDrawQueueTests, Commit_WhileThreadsDraw_KeepsEveryDrawOnce)
+    {
+        // All the lines fit in one committed buffer, so none of them are dropped however the commits interleave.
+        static constexpr uint32_t LineCount = 40 * LinesPerThread;
+
+        AuxGeomDrawQueue drawQueue;
+        AZStd::atomic_uint32_t drawingThreadCount{ ThreadCount };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&]()
+            {
+                for (uint32_t i = 0; i < LineCount; ++i)
+                {
+                    DrawLine(drawQueue, static_cast<float>(i), -1);
+                }
+                --drawingThreadCount;
+            });
+        }
+
+        size_t committedVertexCount = 0;
+        while (drawingThreadCount > 0)
+        {
+            const AuxGeomBufferData* bufferData = drawQueue.Commit();
+            ExpectValidPrimitiveData(*bufferData);
+            committedVertexCount += bufferData->m_primitiveData.m_vertexBuffer.size();
+            AZStd::this_thread::yield();
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        committedVertexCount += drawQueue.Commit()->m_primitiveData.m_vertexBuffer.size();
+
+        EXPECT_EQ(committedVertexCount, 2 * LineCount * ThreadCount);
+    }
+
+    TEST_F(AuxGeomDrawQueueTests, Commit_ThreadsStoppedDrawing_BuffersReusedByNewThreads)
+    {
+        AuxGeomDrawQueue drawQueue;
+        auto drawFromExitingThreads = [&drawQueue]()
+        {
+            AZStd::vector<AZStd::thread> threads;
+            for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+            {
+                threads.emplace_back([&drawQueue, threadIndex]()
+                {
+                    DrawLine(drawQueue, static_cast<float>(threadIndex), -1);
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        };
+
+        drawFromExitingThreads();
+        EXPECT_EQ(drawQueue.Commit()->m_primitiveData.m_vertexBuffer.size(), 2 * ThreadCount);
+        EXPECT_EQ(drawQueue.GetThreadBuffersCount(), ThreadCount);
+
+        // Like a job system that replaces its worker threads, the buffers of the exited threads are freed once they stay idle.
+        for (uint32_t i = 0; i < AuxGeomDrawQueue::FreeThreadBuffersAfterIdleCommits; ++i)
+        {
+            EXPECT_TRUE(drawQueue.Commit()->m_primitiveData.m_vertexBuffer.empty());
+        }
+
+        drawFromExitingThreads();
+        EXPECT_EQ(drawQueue.Commit()->m_primitiveData.m_vertexBuffer.size(), 2 * ThreadCount);
+        EXPECT_EQ(drawQueue.GetThreadBuffersCount(), ThreadCount);
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    /*
+     * Records AuxGeom draws from as many job worker threads as the benchmark argument into one draw queue, then commits
+     * them like the feature processor does at the end of a frame. Every job draws single lines and spheres, the worst case
+     * for the draw queue since nothing is batched. The reported items are the recorded primitives.
+     */
+    class AuxGeomDrawQueueBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t PrimitivesPerThread = 4096;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(static_cast<uint32_t>(state.range(0)));
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(static_cast<uint32_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void internalSetUp(uint32_t threadCount)
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc jobManagerDesc;
+            JobManagerThreadDesc threadDesc;
+            for (uint32_t i = 0; i < threadCount; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = AZStd::make_unique<JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<JobContext>(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext.get());
+            m_threadCount = threadCount;
+
+            m_drawQueue = AZStd::make_unique<AuxGeomDrawQueue>();
+        }
+
+        void internalTearDown()
+        {
+            m_drawQueue.reset();
+
+            JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+
+        void RecordPrimitives()
+        {
+            const Color color = Color::CreateOne();
+            for (uint32_t i = 0; i < PrimitivesPerThread; ++i)
+            {
+                const float y = static_cast<float>(i);
+                if (i % 8)
+                {
+                    const Vector3 points[] = { Vector3(0.0f, y, 0.0f), Vector3(1.0f, y, 0.0f) };
+                    RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments args;
+                    args.m_verts = points;
+                    args.m_vertCount = 2;
+                    args.m_colors = &color;
+                    args.m_colorCount = 1;
+                    args.m_depthTest = i % 2 ? RPI::AuxGeomDraw::DepthTest::On : RPI::AuxGeomDraw::DepthTest::Off;
+                    m_drawQueue->DrawLines(args);
+                }
+                else
+                {
+                    m_drawQueue->DrawSphere(Vector3(0.0f, y, 0.0f), 0.5f, color, RPI::AuxGeomDraw::DrawStyle::Solid,
+                        RPI::AuxGeomDraw::DepthTest::On, RPI::AuxGeomDraw::DepthWrite::On, RPI::AuxGeomDraw::FaceCullMode::Back, -1);
+                }
+            }
+        }
+
+        AZStd::unique_ptr<JobManager> m_jobManager;
+        AZStd::unique_ptr<JobContext> m_jobContext;
+        AZStd::unique_ptr<AuxGeomDrawQueue> m_drawQueue;
+        uint32_t m_threadCount = 0;
+    };
+
+    BENCHMARK_DEFINE_F(AuxGeomDrawQueueBenchmarkFixture, RecordAndCommit)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            JobCompletion jobCompletion;
+            for (uint32_t i = 0; i < m_threadCount; ++i)
+            {
+                Job* job = CreateJobFunction([this]() { RecordPrimitives(); }, true, nullptr);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+
+            benchmark::DoNotOptimize(m_drawQueue->Commit());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_threadCount * PrimitivesPerThread);
+        state.counters["Threads"] = static_cast<double>(m_threadCount);
+    }
+
+    BENCHMARK_REGISTER_F(AuxGeomDrawQueueBenchmarkFixture, RecordAndCommit)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+} // namespace Benchmark
+#endif
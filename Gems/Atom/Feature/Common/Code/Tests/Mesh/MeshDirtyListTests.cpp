@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshDirtyList.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/smart_ptr/intrusive_refcount.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    //! A material with the change tracking of RPI::Material: every property change increments the change id, which is
+    //! picked up once the material is compiled.
+    class TestMaterial
+        : public AZStd::intrusive_refcount<uint32_t>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestMaterial, SystemAllocator, 0);
+
+        using ChangeId = size_t;
+
+        void SetProperty()
+        {
+            ++m_currentChangeId;
+        }
+
+        void Compile()
+        {
+            m_compiledChangeId = m_currentChangeId;
+        }
+
+        bool NeedsCompile() const
+        {
+            return m_compiledChangeId != m_currentChangeId;
+        }
+
+        ChangeId GetCurrentChangeId() const
+        {
+            return m_currentChangeId;
+        }
+
+    private:
+        ChangeId m_currentChangeId = 1;
+        ChangeId m_compiledChangeId = 1;
+    };
+
+    struct TestMesh
+    {
+        size_t m_dirtyIndex = static_cast<size_t>(-1);
+        AZStd::vector<AZStd::intrusive_ptr<TestMaterial>> m_trackedMaterials;
+    };
+
+    using TestMeshDirtyList = MeshDirtyList<TestMesh, TestMaterial>;
+
+    class MeshDirtyListTests
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            m_meshes.resize(4);
+            m_dirtyList = AZStd::make_unique<TestMeshDirtyList>();
+        }
+
+        void TearDown() override
+        {
+            for (TestMesh& mesh : m_meshes)
+            {
+                m_dirtyList->Remove(mesh);
+            }
+            m_dirtyList.reset();
+            m_meshes = {};
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        //! Takes the dirty list and returns the indices of its meshes in m_meshes, in increasing order.
+        AZStd::vector<size_t> TakeDirtyMeshIndices()
+        {
+            AZStd::vector<TestMesh*> dirtyMeshes;
+            m_dirtyList->TakeDirtyMeshes(dirtyMeshes);
+
+            AZStd::vector<size_t> meshIndices;
+            for (TestMesh* mesh : dirtyMeshes)
+            {
+                meshIndices.push_back(mesh - m_meshes.data());
+            }
+            AZStd::sort(meshIndices.begin(), meshIndices.end());
+            return meshIndices;
+        }
+
+        AZStd::vector<TestMesh> m_meshes;
+        AZStd::unique_ptr<TestMeshDirtyList> m_dirtyList;
+    };
+
+    TEST_F(MeshDirtyListTests, TakeDirtyMeshes_NothingChanged_IsEmpty)
+    {
+        EXPECT_TRUE(TakeDirtyMeshIndices().empty());
+    }
+
+    TEST_F(MeshDirtyListTests, TakeDirtyMeshes_MeshesMarkedDirty_OnlyTheseMeshesOnce)
+    {
+        m_dirtyList->MarkDirty(m_meshes[1]);
+        m_dirtyList->MarkDirty(m_meshes[3]);
+        m_dirtyList->MarkDirty(m_meshes[1]);
+
+        EXPECT_EQ(TakeDirtyMeshIndices(), AZStd::vector<size_t>({ 1, 3 }));
+
+        // The list is empty again until more meshes change.
+        EXPECT_TRUE(TakeDirtyMeshIndices().empty());
+    }
+
+    TEST_F(MeshDirtyListTests, TakeDirtyMeshes_MarkedDirtyAgainAfterTaking_InTheNextList)
+    {
+        // Like a mesh that changes again while the previous list is processed.
+        m_dirtyList->MarkDirty(m_meshes[2]);
+        EXPECT_EQ(TakeDirtyMeshIndices(), AZStd::vector<size_t>({ 2 }));
+
+        m_dirtyList->MarkDirty(m_meshes[2]);
+        EXPECT_EQ(TakeDirtyMeshIndices(), AZStd::vector<size_t>({ 2 }));
+    }
+
+    TEST_F(MeshDirtyListTests, Remove_DirtyMesh_NotInTheList)
+    {
+        m_dirtyList->MarkDirty(m_meshes[0]);
+        m_dirtyList->MarkDirty(m_meshes[1]);
+        m_dirtyList->MarkDirty(m_meshes[2]);
+        m_dirtyList->Remove(m_meshes[0]);
+
+        // The last mesh moved into the slot of the removed one must keep its index, so removing it works too.
+        m_dirtyList->Remove(m_meshes[2]);
+        EXPECT_EQ(TakeDirtyMeshIndices(), AZStd::vector<size_t>({ 1 }));
+    }
+
+    TEST_F(MeshDirtyListTests, Clear_DirtyMeshes_CanBeMarkedDirtyAgain)
+    {
+        // Like rebuilding every draw packet, which updates every mesh without the list.
+        m_dirtyList->MarkDirty(m_meshes[0]);
+        m_dirtyList->Clear();
+        EXPECT_TRUE(TakeDirtyMeshIndices().empty());
+
+        m_dirtyList->MarkDirty(m_meshes[0]);
+        EXPECT_EQ(TakeDirtyMeshIndices(), AZStd::vector<size_t>({ 0 }));
+    }
+
+    TEST_F(MeshDirtyListTests, TakeDirtyMeshes_MaterialChanged_OnlyMeshesOfTheMaterial)
+    {
+        AZStd::intrusive_ptr<TestMaterial> sharedMaterial = aznew TestMaterial();
+        AZStd::intrusive_ptr<TestMaterial> otherMaterial = aznew TestMaterial();
+        m_dirtyList->TrackMaterials(m_meshes[0], { sharedMaterial });
+        m_dirtyList->TrackMaterials(m_meshes[1], { sharedMaterial, otherMaterial });
+        m_dirtyList->TrackMaterials(m_meshes[2], { otherMaterial });
+        EXPECT_EQ(m_dirtyList->GetTrackedMaterialCount(), 2);
+
+        // Newly tracked materials are picked up once, like the first compile of a material.
+        TakeDirtyMeshIndices();
+
+        sharedMaterial->SetProperty();
+        sharedMaterial->Compile();
+        EXPECT_EQ(TakeDirtyMeshIndices(), AZStd::vector<size_t>({ 0, 1 }));
+        EXPECT_TRUE(TakeDirtyMeshIndices().empty());
+
+        otherMaterial->SetProperty();
+        otherMaterial->Compile();
+        EXPECT_EQ(TakeDirtyMeshIndices(), AZStd::vector<size_t>({ 1, 2 }));
+    }
+
+    TEST_F(MeshDirtyListTests, TakeDirtyMeshes_MaterialNotCompiled_PickedUpOnceCompiled)
+    {
+        AZStd::intrusive_ptr<TestMaterial> material = aznew TestMaterial();
+        m_dirtyList->TrackMaterials(m_meshes[0], { material });
+        TakeDirtyMeshIndices();
+
+        // Same as MeshDrawPacket::Update(), the draw packets can't use the change before the material is compiled.
+        material->SetProperty();
+        EXPECT_TRUE(TakeDirtyMeshIndices().empty());
+
+        material->Compile();
+        EXPECT_EQ(TakeDirtyMeshIndices(), AZStd::vector<size_t>({ 0 }));
+    }
+
+    TEST_F(MeshDirtyListTests, TrackMaterials_MaterialsReplaced_OldMaterialsNoLongerMarkMeshesDirty)
+    {
+        // Like a mesh whose draw packets are rebuilt with another material, e.g. for a newly resident lod.
+        AZStd::intrusive_ptr<TestMaterial> oldMaterial = aznew TestMaterial();
+        AZStd::intrusive_ptr<TestMaterial> newMaterial = aznew TestMaterial();
+        m_dirtyList->TrackMaterials(m_meshes[0], { oldMaterial, nullptr, oldMaterial });
+        EXPECT_EQ(m_meshes[0].m_trackedMaterials.size(), 1);
+
+        m_dirtyList->TrackMaterials(m_meshes[0], { newMaterial });
+        EXPECT_EQ(m_dirtyList->GetTrackedMaterialCount(), 1);
+        TakeDirtyMeshIndices();
+
+        oldMaterial->SetProperty();
+        oldMaterial->Compile();
+        EXPECT_TRUE(TakeDirtyMeshIndices().empty());
+
+        newMaterial->SetProperty();
+        newMaterial->Compile();
+        EXPECT_EQ(TakeDirtyMeshIndices(), AZStd::vector<size_t>({ 0 }));
+    }
+
+    TEST_F(MeshDirtyListTests, Remove_MeshWithMaterials_MaterialsReleased)
+    {
+        AZStd::intrusive_ptr<TestMaterial> material = aznew TestMaterial();
+        m_dirtyList->TrackMaterials(m_meshes[0], { material });
+        EXPECT_EQ(material->use_count(), 2);
+
+        m_dirtyList->Remove(m_meshes[0]);
+        EXPECT_EQ(material->use_count(), 1);
+        EXPECT_EQ(m_dirtyList->GetTrackedMaterialCount(), 0);
+
+        material->SetProperty();
+        material->Compile();
+        EXPECT_TRUE(TakeDirtyMeshIndices().empty());
+    }
+} // namespace UnitTest
@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshUpdateTaskGraph.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class MeshUpdateTaskGraphTests
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            m_executor = aznew TaskExecutor();
+            m_meshUpdateTaskGraph = AZStd::make_unique<MeshUpdateTaskGraph>(
+                [this](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        ++m_processCounts[i];
+                    }
+                    m_processThreadId = AZStd::this_thread::get_id();
+                });
+        }
+
+        void TearDown() override
+        {
+            m_meshUpdateTaskGraph.reset();
+            m_processCounts = {};
+            azdestroy(m_executor);
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        void ResetProcessCounts(size_t itemCount)
+        {
+            m_processCounts = AZStd::vector<AZStd::atomic_int>(itemCount);
+            for (AZStd::atomic_int& processCount : m_processCounts)
+            {
+                processCount = 0;
+            }
+        }
+
+        void ExpectEachItemOnce()
+        {
+            for (size_t i = 0; i < m_processCounts.size(); ++i)
+            {
+                EXPECT_EQ(m_processCounts[i], 1) << "Item " << i << " of " << m_processCounts.size();
+            }
+        }
+
+        //! Processes itemCount items in the tasks of a graph, like the simulation graph of the scene, and expects each of them
+        //! to be processed exactly once before the finished task runs.
+        void ProcessInTaskGraphAndExpectEachItemOnce(size_t itemCount)
+        {
+            ResetProcessCounts(itemCount);
+
+            const TaskDescriptor testTaskDescriptor{ "MeshUpdateTaskGraphTests", "Tests" };
+            AZStd::atomic_int processedBeforeFinished = 0;
+            TaskGraph taskGraph;
+            TaskToken prepareTask = taskGraph.AddTask(testTaskDescriptor,
+                [this, itemCount]()
+                {
+                    m_meshUpdateTaskGraph->SetItemCount(itemCount);
+                });
+            TaskToken finishedTask = taskGraph.AddTask(testTaskDescriptor,
+                [this, &processedBeforeFinished]()
+                {
+                    for (AZStd::atomic_int& processCount : m_processCounts)
+                    {
+                        processedBeforeFinished += processCount;
+                    }
+                });
+            m_meshUpdateTaskGraph->AddTasks(taskGraph, prepareTask, finishedTask, m_executor->GetThreadCount());
+
+            TaskGraphEvent finishedEvent;
+            taskGraph.SubmitOnExecutor(*m_executor, &finishedEvent);
+            finishedEvent.Wait();
+
+            ExpectEachItemOnce();
+            EXPECT_EQ(processedBeforeFinished, static_cast<int>(itemCount));
+        }
+
+        TaskExecutor* m_executor = nullptr;
+        AZStd::unique_ptr<MeshUpdateTaskGraph> m_meshUpdateTaskGraph;
+        AZStd::vector<AZStd::atomic_int> m_processCounts;
+        AZStd::thread_id m_processThreadId;
+    };
+
+    TEST_F(MeshUpdateTaskGraphTests, AddTasks_ProcessesEachItemOnceBeforeTheFinishedTask)
+    {
+        ProcessInTaskGraphAndExpectEachItemOnce(10000);
+    }
+
+    TEST_F(MeshUpdateTaskGraphTests, AddTasks_DifferentCountsEveryFrame_ProcessesEachItemOnce)
+    {
+        // The simulation graph is built again every frame with the same tasks, while the size of the list changes.
+        const size_t itemCounts[] = { 5000, 0, 1, 2 * MeshUpdateTaskGraph::MinItemsPerTask, 777, 5000 };
+        for (size_t itemCount : itemCounts)
+        {
+            ProcessInTaskGraphAndExpectEachItemOnce(itemCount);
+        }
+    }
+
+    TEST_F(MeshUpdateTaskGraphTests, GetRangeCount_SmallOrLargeLists_SplitByMinItemsAndMaxRanges)
+    {
+        EXPECT_EQ(MeshUpdateTaskGraph::GetRangeCount(1, 8), 1);
+        EXPECT_EQ(MeshUpdateTaskGraph::GetRangeCount(MeshUpdateTaskGraph::MinItemsPerTask - 1, 8), 1);
+        EXPECT_EQ(MeshUpdateTaskGraph::GetRangeCount(3 * MeshUpdateTaskGraph::MinItemsPerTask, 8), 3);
+        EXPECT_EQ(MeshUpdateTaskGraph::GetRangeCount(10000, 8), 8);
+        EXPECT_EQ(MeshUpdateTaskGraph::GetRangeCount(10000, 0), 1);
+    }
+
+    TEST_F(MeshUpdateTaskGraphTests, ProcessWithJobs_WithoutJobContext_ProcessesOnCallingThread)
+    {
+        ResetProcessCounts(10000);
+        m_meshUpdateTaskGraph->ProcessWithJobs(10000);
+        ExpectEachItemOnce();
+        EXPECT_EQ(m_processThreadId, AZStd::this_thread::get_id());
+    }
+
+    TEST_F(MeshUpdateTaskGraphTests, ProcessWithJobs_WithJobContext_ProcessesEachItemOnce)
+    {
+        JobManagerDesc jobManagerDesc;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            jobManagerDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+        }
+        JobManager jobManager(jobManagerDesc);
+        JobContext jobContext(jobManager);
+        JobContext::SetGlobalContext(&jobContext);
+
+        ResetProcessCounts(10000);
+        m_meshUpdateTaskGraph->ProcessWithJobs(10000);
+        ExpectEachItemOnce();
+
+        JobContext::SetGlobalContext(nullptr);
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    /*
+     * A synthetic version of the mesh feature processor update: 50000 static meshes of which 1% move every frame. Moving
+     * a mesh recomputes its world bounds, and every processed mesh checks its material change id like its draw packets do.
+     * The full scan visits every mesh with a new set of jobs every frame, like Simulate did before the dirty list, while
+     * the dirty list only visits the moved meshes in the tasks of a graph built every frame, like the simulation graph of
+     * the scene. The reported items are frames.
+     */
+    class MeshUpdateBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t MeshCount = 50000;
+        static constexpr size_t MovingMeshStride = 100;
+        static constexpr size_t MeshesPerJob = 1024;
+
+        struct SyntheticMesh
+        {
+            Transform m_transform = Transform::CreateIdentity();
+            Aabb m_localAabb = Aabb::CreateFromMinMax(Vector3(-1.0f), Vector3(1.0f));
+            Aabb m_worldAabb = Aabb::CreateNull();
+            size_t m_materialChangeId = 0;
+            const size_t* m_currentMaterialChangeId = nullptr;
+            bool m_boundsNeedUpdate = true;
+        };
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void internalSetUp()
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc jobManagerDesc;
+            JobManagerThreadDesc threadDesc;
+            for (uint32_t i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = AZStd::make_unique<JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<JobContext>(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_executor = aznew TaskExecutor();
+            m_meshUpdateTaskGraph = AZStd::make_unique<MeshUpdateTaskGraph>(
+                [this](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        UpdateMesh(*m_dirtyMeshes[i]);
+                    }
+                });
+
+            m_meshes.resize(MeshCount);
+            for (size_t meshIndex = 0; meshIndex < MeshCount; ++meshIndex)
+            {
+                SyntheticMesh& mesh = m_meshes[meshIndex];
+                mesh.m_transform.SetTranslation(Vector3(static_cast<float>(meshIndex % 256), static_cast<float>(meshIndex / 256), 0.0f));
+                mesh.m_currentMaterialChangeId = &m_materialChangeId;
+                UpdateMesh(mesh);
+            }
+            m_dirtyMeshes.reserve(MeshCount / MovingMeshStride);
+        }
+
+        void internalTearDown()
+        {
+            m_dirtyMeshes = {};
+            m_meshes = {};
+            m_meshUpdateTaskGraph.reset();
+            azdestroy(m_executor);
+            m_executor = nullptr;
+
+            JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+
+        static void UpdateMesh(SyntheticMesh& mesh)
+        {
+            if (mesh.m_materialChangeId != *mesh.m_currentMaterialChangeId)
+            {
+                mesh.m_materialChangeId = *mesh.m_currentMaterialChangeId;
+            }
+
+            if (mesh.m_boundsNeedUpdate)
+            {
+                mesh.m_worldAabb = mesh.m_localAabb.GetTransformedAabb(mesh.m_transform);
+                mesh.m_boundsNeedUpdate = false;
+            }
+        }
+
+        //! Moves 1% of the meshes, and adds them to the dirty list when useDirtyList is set.
+        void MoveMeshes(bool useDirtyList)
+        {
+            for (size_t meshIndex = m_frame % MovingMeshStride; meshIndex < MeshCount; meshIndex += MovingMeshStride)
+            {
+                SyntheticMesh& mesh = m_meshes[meshIndex];
+                mesh.m_transform.SetTranslation(mesh.m_transform.GetTranslation() + Vector3(0.0f, 0.0f, 0.01f));
+                mesh.m_boundsNeedUpdate = true;
+                if (useDirtyList)
+                {
+                    m_dirtyMeshes.push_back(&mesh);
+                }
+            }
+            ++m_frame;
+        }
+
+        AZStd::unique_ptr<JobManager> m_jobManager;
+        AZStd::unique_ptr<JobContext> m_jobContext;
+        TaskExecutor* m_executor = nullptr;
+        AZStd::unique_ptr<MeshUpdateTaskGraph> m_meshUpdateTaskGraph;
+
+        AZStd::vector<SyntheticMesh> m_meshes;
+        AZStd::vector<SyntheticMesh*> m_dirtyMeshes;
+        size_t m_materialChangeId = 1;
+        size_t m_frame = 0;
+    };
+
+    BENCHMARK_F(MeshUpdateBenchmarkFixture, FullScan_Jobs)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveMeshes(false);
+
+            JobCompletion jobCompletion;
+            for (size_t meshIndex = 0; meshIndex < MeshCount; meshIndex += MeshesPerJob)
+            {
+                const auto jobLambda = [this, meshIndex]()
+                {
+                    const size_t meshEnd = AZStd::min(meshIndex + MeshesPerJob, MeshCount);
+                    for (size_t i = meshIndex; i < meshEnd; ++i)
+                    {
+                        UpdateMesh(m_meshes[i]);
+                    }
+                };
+                Job* updateJob = CreateJobFunction(jobLambda, true, nullptr);
+                updateJob->SetDependent(&jobCompletion);
+                updateJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+        state.counters["Meshes"] = static_cast<double>(MeshCount);
+    }
+
+    BENCHMARK_F(MeshUpdateBenchmarkFixture, DirtyList_TaskGraph)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveMeshes(true);
+
+            const TaskDescriptor frameTaskDescriptor{ "MeshUpdateBenchmark", "Benchmarks" };
+            TaskGraph frameGraph;
+            TaskToken prepareTask = frameGraph.AddTask(frameTaskDescriptor,
+                [this]()
+                {
+                    m_meshUpdateTaskGraph->SetItemCount(m_dirtyMeshes.size());
+                });
+            TaskToken finishedTask = frameGraph.AddTask(frameTaskDescriptor, []() {});
+            m_meshUpdateTaskGraph->AddTasks(frameGraph, prepareTask, finishedTask, m_executor->GetThreadCount());
+
+            TaskGraphEvent finishedEvent;
+            frameGraph.SubmitOnExecutor(*m_executor, &finishedEvent);
+            finishedEvent.Wait();
+            m_dirtyMeshes.clear();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+        state.counters["Meshes"] = static_cast<double>(MeshCount);
+        state.counters["DirtyMeshes"] = static_cast<double>(MeshCount / MovingMeshStride);
+    }
+} // namespace Benchmark
+#endif
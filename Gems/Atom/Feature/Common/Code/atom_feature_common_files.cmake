@@ -169,7 +169,10 @@ set(FILES
     Source/Math/MathFilter.h
     Source/Math/MathFilter.cpp
     Source/Math/MathFilterDescriptor.h
+    Source/Mesh/MeshDirtyList.h
     Source/Mesh/MeshFeatureProcessor.cpp
+    Source/Mesh/MeshUpdateTaskGraph.cpp
+    Source/Mesh/MeshUpdateTaskGraph.h
     Source/Mesh/ModelReloader.cpp
     Source/Mesh/ModelReloader.h
     Source/Mesh/ModelReloaderSystem.cpp
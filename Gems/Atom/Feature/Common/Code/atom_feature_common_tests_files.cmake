@@ -8,10 +8,13 @@
 
 set(FILES
     Mocks/MockMeshFeatureProcessor.h
+    Tests/AuxGeom/AuxGeomDrawQueueTests.cpp
     Tests/CommonTest.cpp
     Tests/CoreLights/ShadowmapAtlasTest.cpp
     Tests/IndexedDataVectorTests.cpp
     Tests/IndexableListTests.cpp
+    Tests/Mesh/MeshDirtyListTests.cpp
+    Tests/Mesh/MeshUpdateTaskGraphTests.cpp
     Tests/SparseVectorTests.cpp
     Tests/SkinnedMesh/SkinnedMeshDispatchItemTests.cpp
     Tests/Decals/DecalTextureArrayTests.cpp
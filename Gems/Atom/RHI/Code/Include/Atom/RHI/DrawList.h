@@ -44,6 +44,22 @@ namespace AZ
         /// Uniformly partitions the draw list and returns the sub-list denoted by the provided index.
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount);
 
-        void SortDrawList(DrawList& drawList, DrawListSortType sortType);
+        /// The algorithm used to sort a draw list.
+        enum class DrawListSortAlgorithm : uint8_t
+        {
+            /// Uses the radix sort for draw lists with at least DrawListRadixSortThreshold items, the comparison sort otherwise.
+            Automatic = 0,
+            /// Comparison sort on the sort key and depth.
+            Comparison,
+            /// Stable least significant digit radix sort on the sort key and depth, packed into a single 96-bit key.
+            /// The order of items with equal keys is preserved, and passes on digits that are the same for all items are skipped.
+            Radix
+        };
+
+        /// The number of draw items from which the radix sort is faster than the comparison sort.
+        constexpr size_t DrawListRadixSortThreshold = 512;
+
+        /// Sorts the draw list using the sort type. Items with equal sort keys and depths can end up in any order.
+        void SortDrawList(DrawList& drawList, DrawListSortType sortType, DrawListSortAlgorithm algorithm = DrawListSortAlgorithm::Automatic);
     }
 }
@@ -7,11 +7,16 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/AttachmentEnums.h>
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/Utils/TypeHash.h>
 
 namespace AZ
 {
@@ -45,6 +50,26 @@ namespace AZ
             FrameSchedulerStatisticsFlags m_statisticsFlags = FrameSchedulerStatisticsFlags::None;
         };
 
+        /**
+         * @brief Statistics of the most recent FrameGraphCompiler::Compile call.
+         */
+        struct FrameGraphCompileStats
+        {
+            /// Hash of the scopes, scope attachments and transient attachment descriptors of the compiled graph.
+            HashValue64 m_topologyHash = HashValue64{ 0 };
+
+            /// True if the compile reused the queue graph and transient attachment schedule of the previous compile.
+            bool m_usedCachedTopology = false;
+
+            /// Number of compiles that reused or rebuilt the cached topology since the compiler was initialized.
+            uint32_t m_cacheHitCount = 0;
+            uint32_t m_cacheMissCount = 0;
+
+            /// CPU time of the platform-independent phases and of the whole compile, in microseconds.
+            uint64_t m_platformIndependentTimeMicroseconds = 0;
+            uint64_t m_compileTimeMicroseconds = 0;
+        };
+
         /**
          * FrameGraphCompiler controls compilation of FrameGraph each frame. FrameScheduler owns
          * and drives an instance of this class, so end-users should never need to interact with it directly.
@@ -99,6 +124,15 @@ namespace AZ
          * kept inside the compiler. The cache is big enough to avoid having to re-create views every frame, but
          * bounded in order to release entries old views.
          *
+         *      == Topology Cache ==
+         *
+         * The frame graph is usually identical from one frame to the next. The compiler hashes the scopes, the
+         * scope attachments and the transient attachment descriptors of the graph, and when the hash matches the
+         * previous compile it reapplies the cached queue-centric graph, transient attachment lifetimes and
+         * allocation schedule instead of deriving them again. Resources, views and the platform-specific data are
+         * still compiled every frame, since imported resources and transient allocations can change even when the
+         * topology does not. The cache can be disabled with FrameSchedulerCompileFlags::DisableTopologyCache.
+         *
          *      == Platform-Specific Compilation ==
          *
          * Finally, the compiler calls into the platform-specific compile method, which hands control over to the
@@ -125,6 +159,9 @@ namespace AZ
              */
             MessageOutcome Compile(const FrameGraphCompileRequest& request);
 
+            /// Returns the statistics of the most recent compile.
+            const FrameGraphCompileStats& GetCompileStats() const;
+
         protected:
             FrameGraphCompiler() = default;
 
@@ -146,10 +183,31 @@ namespace AZ
 
             MessageOutcome ValidateCompileRequest(const FrameGraphCompileRequest& request) const;
 
+            /// Controls how the platform-independent phases use the cached topology.
+            enum class TopologyCacheMode
+            {
+                /// The cache is disabled, everything is compiled from scratch.
+                Disabled = 0,
+
+                /// Everything is compiled from scratch and the results are stored in the cache.
+                Rebuild,
+
+                /// The results of the previous compile are reapplied to the frame graph.
+                Reuse
+            };
+
+            HashValue64 CalculateTopologyHash(const FrameGraphCompileRequest& request) const;
+
             void CompileQueueCentricScopeGraph(
                 FrameGraph& frameGraph,
                 FrameSchedulerCompileFlags compileFlags);
 
+            void CacheQueueCentricScopeGraph(const FrameGraph& frameGraph);
+
+            void ApplyCachedQueueCentricScopeGraph(
+                FrameGraph& frameGraph,
+                FrameSchedulerCompileFlags compileFlags);
+
             void ExtendTransientAttachmentAsyncQueueLifetimes(
                 FrameGraph& frameGraph,
                 FrameSchedulerCompileFlags compileFlags);
@@ -158,7 +216,8 @@ namespace AZ
                 FrameGraph& frameGraph,
                 TransientAttachmentPool& transientAttachmentPool,
                 FrameSchedulerCompileFlags compileFlags,
-                FrameSchedulerStatisticsFlags statisticsFlags);
+                FrameSchedulerStatisticsFlags statisticsFlags,
+                TopologyCacheMode topologyCacheMode);
 
             void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
 
@@ -171,6 +230,34 @@ namespace AZ
             ObjectCache<ImageView> m_imageViewCache;
             ObjectCache<BufferView> m_bufferViewCache;
 
+            /// Scope links of the queue-centric graph, stored as scope indices so they can be reapplied to the next frame graph.
+            struct CachedScopeLinks
+            {
+                AZStd::array<uint32_t, HardwareQueueClassCount> m_producersByQueueLast;
+                AZStd::array<uint32_t, HardwareQueueClassCount> m_producersByQueue;
+                AZStd::array<uint32_t, HardwareQueueClassCount> m_consumersByQueue;
+            };
+
+            /// The platform-independent compile results of the last compiled topology.
+            struct CachedTopology
+            {
+                bool m_isValid = false;
+                HashValue64 m_hash = HashValue64{ 0 };
+                AZStd::vector<CachedScopeLinks> m_scopeLinks;
+
+                /// First and last scope indices of the transient attachments after the async queue lifetime extension.
+                /// Buffers come first, followed by images, in attachment database order.
+                AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_transientLifetimes;
+
+                /// The sorted transient attachment activation / deactivation commands.
+                AZStd::vector<uint32_t> m_transientCommands;
+
+                /// Result of the statistics pass of the memory hint heap strategy.
+                AZStd::optional<TransientAttachmentStatistics::MemoryUsage> m_transientMemoryHint;
+            };
+
+            CachedTopology m_cachedTopology;
+            FrameGraphCompileStats m_compileStats;
         };
     }
 }
@@ -14,6 +14,7 @@ namespace AZ
     namespace RHI
     {
         class FrameGraph;
+        struct FrameGraphCompileStats;
 
         class FrameGraphLogger
         {
@@ -23,6 +24,9 @@ namespace AZ
 
             /// Dumps a graph-vis file of the current frame graph to the logs folder.
             static void DumpGraphVis(const FrameGraph& frameGraph);
+
+            /// Logs the compile time and topology cache usage of the frame graph compiler, with the specified verbosity.
+            static void LogCompileStats(const FrameGraphCompileStats& compileStats, FrameSchedulerLogVerbosity logVerbosity);
         };
     }
 }
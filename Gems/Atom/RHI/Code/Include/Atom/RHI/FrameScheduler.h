@@ -16,6 +16,7 @@
 #include <Atom/RHI/RayTracingShaderTable.h>
 #include <Atom/RHI/ScopeProducer.h>
 #include <Atom/RHI/ScopeProducerEmpty.h>
+#include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -26,7 +27,6 @@ namespace AZ
 
     namespace RHI
     {
-        class ShaderResourceGroupPool;
         class FrameGraphExecuteGroup;
 
         //! @brief Fill this descriptor when initializing a FrameScheduler instance.
@@ -54,10 +54,27 @@ namespace AZ
             /// Controls whether the phase is allowed to use jobs.
             JobPolicy m_jobPolicy = JobPolicy::Parallel;
 
-            /// Controls the number of ShaderResourceGroups compiled per job.
+            /// Controls the maximum number of ShaderResourceGroups compiled per job. Compiles from all pools
+            /// are balanced across the jobs, so a job may compile groups from several pools.
             uint32_t m_shaderResourceGroupCompilesPerJob = 256;
         };
 
+        //! @brief Statistics of the ShaderResourceGroup compiles of the most recent FrameScheduler::Compile call.
+        struct ShaderResourceGroupCompileStats
+        {
+            /// Number of pools with at least one group compiled.
+            uint32_t m_poolCount = 0;
+
+            /// Number of groups compiled.
+            uint32_t m_groupCount = 0;
+
+            /// Number of batches the compiles were split into. Each batch is compiled by one job.
+            uint32_t m_batchCount = 0;
+
+            /// CPU time of the group compiles, in microseconds.
+            uint64_t m_compileTimeMicroseconds = 0;
+        };
+
         //! == Overview ==
         //!
         //! The frame scheduler is a system for facilitating efficient GPU work submission. It provides a
@@ -173,6 +190,9 @@ namespace AZ
             /// Returns memory statistics for the previous frame.
             const MemoryStatistics* GetMemoryStatistics() const;
 
+            /// Returns the ShaderResourceGroup compile statistics for the previous frame.
+            const ShaderResourceGroupCompileStats& GetShaderResourceGroupCompileStats() const;
+
             /// Returns the implicit root scope id.
             ScopeId GetRootScopeId() const;
 
@@ -220,6 +240,11 @@ namespace AZ
 
             FrameSchedulerCompileRequest m_compileRequest;
 
+            // The pools and balanced compile batches of the ShaderResourceGroups compiled this frame. Kept to reuse the allocations.
+            AZStd::vector<ShaderResourceGroupPool*> m_shaderResourceGroupPoolsToCompile;
+            AZStd::vector<ShaderResourceGroupCompileBatch> m_shaderResourceGroupCompileBatches;
+            ShaderResourceGroupCompileStats m_shaderResourceGroupCompileStats;
+
             Scope* m_rootScope = nullptr;
             AZStd::unique_ptr<ScopeProducerEmpty> m_rootScopeProducer;
             AZStd::vector<ScopeProducer*> m_scopeProducers;
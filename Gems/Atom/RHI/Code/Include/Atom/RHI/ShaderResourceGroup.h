@@ -10,6 +10,8 @@
 #include <Atom/RHI/Resource.h>
 #include <Atom/RHI/ShaderResourceGroupData.h>
 
+#include <AzCore/std/parallel/atomic.h>
+
 namespace AZ
 {
     namespace RHI
@@ -64,8 +66,12 @@ namespace AZ
             // The binding slot cached from the layout.
             uint32_t m_bindingSlot = (uint32_t)-1;
 
-            // Gates the Compile() function so that the SRG is only queued once.
-            bool m_isQueuedForCompile = false;
+            // Gates the Compile() function so that the SRG is only queued once. Groups are queued from multiple
+            // threads without a lock, so the flag is claimed atomically.
+            AZStd::atomic_bool m_isQueuedForCompile{ false };
+
+            // The next group in the compile queue of the pool.
+            ShaderResourceGroup* m_nextQueuedForCompile = nullptr;
         };
     }
 }
@@ -19,6 +19,30 @@ namespace AZ
 {
     namespace RHI
     {
+        class ShaderResourceGroupPool;
+
+        //! A set of pool intervals that is compiled by a single job.
+        struct ShaderResourceGroupCompileBatch
+        {
+            struct PoolInterval
+            {
+                ShaderResourceGroupPool* m_pool = nullptr;
+                Interval m_interval;
+            };
+
+            AZStd::vector<PoolInterval> m_poolIntervals;
+            uint32_t m_compileCount = 0;
+        };
+
+        //! Splits the groups queued for compile on the pools into batches of about the same size, none larger than
+        //! compilesPerBatch. Pools with few groups share a batch and large pools are split across batches, so the
+        //! batches are balanced regardless of how the groups are spread over the pools. All pools must be within a
+        //! CompileGroups{Begin, End} region.
+        void PartitionShaderResourceGroupCompiles(
+            const AZStd::vector<ShaderResourceGroupPool*>& pools,
+            uint32_t compilesPerBatch,
+            AZStd::vector<ShaderResourceGroupCompileBatch>& batches);
+
          //! The platform-independent base class for ShaderResourceGroupPools. Platforms
          //! should inherit from this class to implement platform-dependent pooling of
          //! shader resource groups.
@@ -73,6 +97,9 @@ namespace AZ
             //! Returns whether groups in this pool have a sampler table.
             bool HasSamplerGroup() const;
 
+            //! Returns the number of groups queued for compile since the last compile. Approximate while other threads are queuing.
+            uint32_t GetQueuedGroupsCount() const;
+
         protected:
             ShaderResourceGroupPool();
 
@@ -83,16 +110,15 @@ namespace AZ
             //////////////////////////////////////////////////////////////////////////
 
         private:
-            // Queues the shader resource group for compile and provides a new data packet (takes a lock).
+            // Queues the shader resource group for compile and provides a new data packet. Does not take a lock.
+            // Must not be called on a group that is queued, including while the pool compiles it.
             void QueueForCompile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData);
 
-            // Queues the shader resource group for compile. Legal to call on a queued group. Takes a lock.
+            // Queues the shader resource group for compile. Legal to call on a queued group. Does not take a lock.
+            // Groups queued while the pool compiles are compiled by the next compile.
             void QueueForCompile(ShaderResourceGroup& group);
 
-            // Queues the shader resource group for compile. Legal to call on a queued group. Does NOT take a lock.
-            void QueueForCompileNoLock(ShaderResourceGroup& group);
-
-            // Un-queues the shader resource group for compile. Legal to call on an un-queued group. Takes a lock.
+            // Un-queues the shader resource group for compile. Legal to call on an un-queued group. Takes the compile lock.
             void UnqueueForCompile(ShaderResourceGroup& shaderResourceGroup);
 
             // Compiles an SRG synchronously. 
@@ -125,7 +151,16 @@ namespace AZ
             bool m_hasSamplerGroup = false;
             bool m_isCompiling = false;
 
-            mutable AZStd::shared_mutex m_groupsToCompileMutex;
+            // Held from CompileGroupsBegin to CompileGroupsEnd and while un-queuing, which are the only places that take
+            // groups out of the queue. Queuing a group does not take it.
+            AZStd::mutex m_groupsToCompileMutex;
+
+            // Lock-free compile queue. Groups are pushed with a compare-exchange on the head and linked
+            // through ShaderResourceGroup::m_nextQueuedForCompile, newest first.
+            AZStd::atomic<ShaderResourceGroup*> m_queuedGroupsHead{ nullptr };
+            AZStd::atomic_uint32_t m_queuedGroupsCount{ 0 };
+
+            // The queued groups in the order they were queued, gathered by CompileGroupsBegin.
             AZStd::vector<ShaderResourceGroup*> m_groupsToCompile;
 
             AZStd::mutex m_invalidateRegistryMutex;
@@ -7,12 +7,141 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // A draw item key for the radix sort, with the most significant word first, and the index of the draw item.
+            struct RadixSortItem
+            {
+                static constexpr uint32_t KeyWordCount = 3;
+                static constexpr uint32_t DigitCount = KeyWordCount * sizeof(uint32_t);
+
+                uint32_t m_key[KeyWordCount];
+                uint32_t m_index;
+            };
+
+            // Maps the float bits to an unsigned integer with the same ordering as the float values.
+            uint32_t GetSortableDepthBits(float depth)
+            {
+                // -0 and +0 are equal for the comparison sort
+                if (depth == 0.0f)
+                {
+                    depth = 0.0f;
+                }
+
+                uint32_t bits;
+                memcpy(&bits, &depth, sizeof(bits));
+                return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            }
+
+            void SetRadixSortKey(RadixSortItem& item, const DrawItemProperties& properties, DrawListSortType sortType)
+            {
+                // flipping the sign bit orders the signed sort keys as unsigned integers
+                const uint64_t sortKey = static_cast<uint64_t>(properties.m_sortKey) ^ (uint64_t(1) << 63);
+                const uint32_t sortKeyHigh = static_cast<uint32_t>(sortKey >> 32);
+                const uint32_t sortKeyLow = static_cast<uint32_t>(sortKey);
+                const uint32_t depth = GetSortableDepthBits(properties.m_depth);
+
+                switch (sortType)
+                {
+                case DrawListSortType::KeyThenDepth:
+                    item.m_key[0] = sortKeyHigh;
+                    item.m_key[1] = sortKeyLow;
+                    item.m_key[2] = depth;
+                    break;
+                case DrawListSortType::KeyThenReverseDepth:
+                    item.m_key[0] = sortKeyHigh;
+                    item.m_key[1] = sortKeyLow;
+                    item.m_key[2] = ~depth;
+                    break;
+                case DrawListSortType::DepthThenKey:
+                    item.m_key[0] = depth;
+                    item.m_key[1] = sortKeyHigh;
+                    item.m_key[2] = sortKeyLow;
+                    break;
+                case DrawListSortType::ReverseDepthThenKey:
+                    item.m_key[0] = ~depth;
+                    item.m_key[1] = sortKeyHigh;
+                    item.m_key[2] = sortKeyLow;
+                    break;
+                }
+            }
+
+            // Returns the 8-bit digit of the key, where digit 0 is the least significant one.
+            uint32_t GetRadixDigit(const RadixSortItem& item, uint32_t digit)
+            {
+                const uint32_t word = RadixSortItem::KeyWordCount - 1 - digit / sizeof(uint32_t);
+                const uint32_t shift = (digit % sizeof(uint32_t)) * 8;
+                return (item.m_key[word] >> shift) & 0xFF;
+            }
+
+            void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+            {
+                const size_t itemCount = drawList.size();
+                AZ_Assert(itemCount <= AZStd::numeric_limits<uint32_t>::max(), "Too many draw items for the radix sort");
+
+                AZStd::vector<RadixSortItem> items(itemCount);
+                AZStd::vector<RadixSortItem> scratchItems(itemCount);
+
+                // Build the keys and the histograms of all digits in a single pass
+                uint32_t histograms[RadixSortItem::DigitCount][256] = {};
+                for (size_t i = 0; i < itemCount; ++i)
+                {
+                    RadixSortItem& item = items[i];
+                    SetRadixSortKey(item, drawList[i], sortType);
+                    item.m_index = static_cast<uint32_t>(i);
+
+                    for (uint32_t digit = 0; digit < RadixSortItem::DigitCount; ++digit)
+                    {
+                        ++histograms[digit][GetRadixDigit(item, digit)];
+                    }
+                }
+
+                RadixSortItem* source = items.data();
+                RadixSortItem* destination = scratchItems.data();
+                for (uint32_t digit = 0; digit < RadixSortItem::DigitCount; ++digit)
+                {
+                    uint32_t* histogram = histograms[digit];
+
+                    // Skip the digit if it is the same for all items, which is common for the high bits of the sort keys
+                    if (histogram[GetRadixDigit(source[0], digit)] == itemCount)
+                    {
+                        continue;
+                    }
+
+                    // Turn the histogram into the offsets of the buckets
+                    uint32_t offset = 0;
+                    for (uint32_t bucket = 0; bucket < 256; ++bucket)
+                    {
+                        const uint32_t bucketSize = histogram[bucket];
+                        histogram[bucket] = offset;
+                        offset += bucketSize;
+                    }
+
+                    for (size_t i = 0; i < itemCount; ++i)
+                    {
+                        destination[histogram[GetRadixDigit(source[i], digit)]++] = source[i];
+                    }
+                    AZStd::swap(source, destination);
+                }
+
+                DrawList sortedDrawList;
+                sortedDrawList.reserve(itemCount);
+                for (size_t i = 0; i < itemCount; ++i)
+                {
+                    sortedDrawList.push_back(drawList[source[i].m_index]);
+                }
+                drawList.swap(sortedDrawList);
+            }
+        }
+
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
         {
             if (drawList.empty())
@@ -26,8 +155,20 @@ namespace AZ
             return DrawListView(&drawList[itemOffset], itemCount);
         }
 
-        void SortDrawList(DrawList& drawList, DrawListSortType sortType)
+        void SortDrawList(DrawList& drawList, DrawListSortType sortType, DrawListSortAlgorithm algorithm)
         {
+            if (drawList.size() < 2)
+            {
+                return;
+            }
+
+            if (algorithm == DrawListSortAlgorithm::Radix ||
+                (algorithm == DrawListSortAlgorithm::Automatic && drawList.size() >= DrawListRadixSortThreshold))
+            {
+                RadixSortDrawList(drawList, sortType);
+                return;
+            }
+
             switch (sortType)
             {
             case DrawListSortType::KeyThenDepth:
@@ -21,11 +21,82 @@
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            /**
+             * Builds a sortable key. It iterates each scope and performs deactivations
+             * followed by activations on each attachment.
+             */
+            const uint32_t ATTACHMENT_BIT_COUNT = 16;
+            const uint32_t SCOPE_BIT_COUNT = 14;
+
+            enum class Action
+            {
+                ActivateImage = 0,
+                ActivateBuffer,
+                DeactivateImage,
+                DeactivateBuffer,
+            };
+
+            struct Command
+            {
+                Command(uint32_t scopeIndex, Action action, uint32_t attachmentIndex)
+                {
+                    m_bits.m_scopeIndex = scopeIndex;
+                    m_bits.m_action = (uint32_t)action;
+                    m_bits.m_attachmentIndex = attachmentIndex;
+                }
+
+                /// Restores a command from its packed value, i.e. from the topology cache.
+                explicit Command(uint32_t command)
+                    : m_command(command)
+                {
+                }
+
+                bool operator < (Command rhs) const
+                {
+                    return m_command < rhs.m_command;
+                }
+
+                struct Bits
+                {
+                    /// Sort by attachment index last
+                    uint32_t m_attachmentIndex : ATTACHMENT_BIT_COUNT;
+
+                    /// Sort by the action after the scope. First by deactivations, then by activations.
+                    uint32_t m_action : 2;
+
+                    /// Sort by scope index first.
+                    uint32_t m_scopeIndex : SCOPE_BIT_COUNT;
+                };
+
+                union
+                {
+                    Bits m_bits;
+
+                    uint32_t m_command = 0;
+                };
+            };
+
+            const uint32_t InvalidScopeIndex = static_cast<uint32_t>(-1);
+
+            uint32_t GetScopeIndex(const Scope* scope)
+            {
+                return scope ? scope->GetIndex() : InvalidScopeIndex;
+            }
+
+            Scope* GetScope(const AZStd::vector<Scope*>& scopes, uint32_t scopeIndex)
+            {
+                return scopeIndex != InvalidScopeIndex ? scopes[scopeIndex] : nullptr;
+            }
+        }
+
         ResultCode FrameGraphCompiler::Init(Device& device)
         {
             if (Validation::IsEnabled())
@@ -61,6 +132,8 @@ namespace AZ
             {
                 m_imageViewCache.Clear();
                 m_bufferViewCache.Clear();
+                m_cachedTopology = {};
+                m_compileStats = {};
 
                 ShutdownInternal();
                 DeviceObject::Shutdown();
@@ -93,6 +166,75 @@ namespace AZ
             return AZ::Success();
         }
 
+        const FrameGraphCompileStats& FrameGraphCompiler::GetCompileStats() const
+        {
+            return m_compileStats;
+        }
+
+        HashValue64 FrameGraphCompiler::CalculateTopologyHash(const FrameGraphCompileRequest& request) const
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CalculateTopologyHash");
+
+            const FrameGraph& frameGraph = *request.m_frameGraph;
+            HashValue64 hash = TypeHash64(request.m_compileFlags);
+
+            if (const TransientAttachmentPool* transientAttachmentPool = request.m_transientAttachmentPool)
+            {
+                // The memory hint of the cached topology is only valid for the pool configuration it was gathered with.
+                const TransientAttachmentPoolDescriptor& poolDescriptor = transientAttachmentPool->GetDescriptor();
+                hash = TypeHash64(transientAttachmentPool, hash);
+                hash = TypeHash64(poolDescriptor.m_heapParameters.m_type, hash);
+                hash = TypeHash64(poolDescriptor.m_bufferBudgetInBytes, hash);
+                hash = TypeHash64(poolDescriptor.m_imageBudgetInBytes, hash);
+                hash = TypeHash64(poolDescriptor.m_renderTargetBudgetInBytes, hash);
+            }
+
+            // Scopes are topologically sorted, so the scope order, the consumers and the scope attachments
+            // describe the queue-centric graph and the transient attachment lifetimes.
+            for (const Scope* scope : frameGraph.GetScopes())
+            {
+                hash = TypeHash64(scope->GetId().GetHash(), hash);
+                hash = TypeHash64(scope->GetHardwareQueueClass(), hash);
+
+                const AZStd::vector<Scope*>& consumers = frameGraph.GetConsumers(*scope);
+                hash = TypeHash64(consumers.size(), hash);
+                for (const Scope* consumer : consumers)
+                {
+                    hash = TypeHash64(consumer->GetIndex(), hash);
+                }
+
+                hash = TypeHash64(scope->GetAttachments().size(), hash);
+                for (const ScopeAttachment* scopeAttachment : scope->GetAttachments())
+                {
+                    hash = TypeHash64(scopeAttachment->GetFrameAttachment().GetId().GetHash(), hash);
+                    for (const ScopeAttachmentUsageAndAccess& usageAndAccess : scopeAttachment->GetUsageAndAccess())
+                    {
+                        hash = TypeHash64(usageAndAccess.m_usage, hash);
+                        hash = TypeHash64(usageAndAccess.m_access, hash);
+                    }
+                }
+            }
+
+            // Transient attachments are allocated by index, so their order and descriptors are part of the topology.
+            // Imported attachments are not, their resources are bound when the views are compiled.
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+            for (const BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                hash = TypeHash64(transientBuffer->GetId().GetHash(), hash);
+                hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+            }
+
+            for (const ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+            {
+                hash = TypeHash64(transientImage->GetId().GetHash(), hash);
+                hash = transientImage->GetImageDescriptor().GetHash(hash);
+                hash = TypeHash64(transientImage->GetSupportedQueueMask(), hash);
+                hash = transientImage->GetOptimizedClearValue().GetHash(hash);
+            }
+
+            return hash;
+        }
+
         /**
          * The entry point for FrameGraph compilation. Frame Graph compilation is broken into several phases:
          * 
@@ -103,10 +245,13 @@ namespace AZ
          *          graph is split into tracks according to each hardware queue. Scopes are serialized onto each track according
          *          to the topological sort, and cross-track dependencies are generated.
          *
+         *          If the topology hash matches the previous compile, the cached graph is reapplied instead.
+         *
          *      2) Transient Attachment Compilation:
          *
          *          This phase takes the transient attachment set and acquires physical resources from the Transient
-         *          Attachment Pool. The resources are assigned to the attachments.
+         *          Attachment Pool. The resources are assigned to the attachments. With a matching topology hash, the cached
+         *          lifetimes and allocation schedule are replayed against the pool.
          *
          *      3) Resource View Compilation:
          *
@@ -128,10 +273,48 @@ namespace AZ
                 return outcome;
             }
 
+            const AZStd::sys_time_t compileStartTime = AZStd::GetTimeNowMicroSecond();
+
             FrameGraph& frameGraph = *request.m_frameGraph;
 
+            TopologyCacheMode topologyCacheMode = TopologyCacheMode::Disabled;
+            m_compileStats.m_topologyHash = HashValue64{ 0 };
+            if (CheckBitsAny(request.m_compileFlags, FrameSchedulerCompileFlags::DisableTopologyCache))
+            {
+                m_cachedTopology = {};
+            }
+            else
+            {
+                m_compileStats.m_topologyHash = CalculateTopologyHash(request);
+                if (m_cachedTopology.m_isValid && m_cachedTopology.m_hash == m_compileStats.m_topologyHash)
+                {
+                    topologyCacheMode = TopologyCacheMode::Reuse;
+                    ++m_compileStats.m_cacheHitCount;
+                }
+                else
+                {
+                    topologyCacheMode = TopologyCacheMode::Rebuild;
+                    m_cachedTopology = {};
+                    m_cachedTopology.m_hash = m_compileStats.m_topologyHash;
+                    ++m_compileStats.m_cacheMissCount;
+                }
+            }
+            m_compileStats.m_usedCachedTopology = topologyCacheMode == TopologyCacheMode::Reuse;
+
             /// [Phase 1] Compiles the cross-queue scope graph.
-            CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+            if (topologyCacheMode == TopologyCacheMode::Reuse)
+            {
+                ApplyCachedQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+            }
+            else
+            {
+                CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+
+                if (topologyCacheMode == TopologyCacheMode::Rebuild)
+                {
+                    CacheQueueCentricScopeGraph(frameGraph);
+                }
+            }
 
             // APC BEGIN
             // At this point all attachment should have scopes, else further phases will crash due to assuming the scopes exist
@@ -153,7 +336,14 @@ namespace AZ
                 frameGraph,
                 *request.m_transientAttachmentPool,
                 request.m_compileFlags,
-                request.m_statisticsFlags);
+                request.m_statisticsFlags,
+                topologyCacheMode);
+
+            // Only a fully compiled topology is reused. Failing the checks above leaves the cache invalid.
+            if (topologyCacheMode == TopologyCacheMode::Rebuild)
+            {
+                m_cachedTopology.m_isValid = true;
+            }
 
             /// [Phase 3] Compiles buffer / image views and assigns them to scope attachments.
             CompileResourceViews(frameGraph.GetAttachmentDatabase());
@@ -168,8 +358,13 @@ namespace AZ
                 }
             }
 
+            m_compileStats.m_platformIndependentTimeMicroseconds = static_cast<uint64_t>(AZStd::GetTimeNowMicroSecond() - compileStartTime);
+
             /// Perform platform-specific compilation.
-            return CompileInternal(request);
+            outcome = CompileInternal(request);
+
+            m_compileStats.m_compileTimeMicroseconds = static_cast<uint64_t>(AZStd::GetTimeNowMicroSecond() - compileStartTime);
+            return outcome;
         }
 
         void FrameGraphCompiler::CompileQueueCentricScopeGraph(
@@ -293,6 +488,51 @@ namespace AZ
             }
         }
 
+        void FrameGraphCompiler::CacheQueueCentricScopeGraph(const FrameGraph& frameGraph)
+        {
+            const auto& scopes = frameGraph.GetScopes();
+            m_cachedTopology.m_scopeLinks.resize(scopes.size());
+            for (size_t scopeIdx = 0; scopeIdx < scopes.size(); ++scopeIdx)
+            {
+                const Scope* scope = scopes[scopeIdx];
+                CachedScopeLinks& scopeLinks = m_cachedTopology.m_scopeLinks[scopeIdx];
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    scopeLinks.m_producersByQueueLast[hardwareQueueClassIdx] = GetScopeIndex(scope->m_producersByQueueLast[hardwareQueueClassIdx]);
+                    scopeLinks.m_producersByQueue[hardwareQueueClassIdx] = GetScopeIndex(scope->m_producersByQueue[hardwareQueueClassIdx]);
+                    scopeLinks.m_consumersByQueue[hardwareQueueClassIdx] = GetScopeIndex(scope->m_consumersByQueue[hardwareQueueClassIdx]);
+                }
+            }
+        }
+
+        void FrameGraphCompiler::ApplyCachedQueueCentricScopeGraph(
+            FrameGraph& frameGraph,
+            FrameSchedulerCompileFlags compileFlags)
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: ApplyCachedQueueCentricScopeGraph");
+
+            const bool disableAsyncQueues = CheckBitsAll(compileFlags, FrameSchedulerCompileFlags::DisableAsyncQueues);
+
+            const auto& scopes = frameGraph.GetScopes();
+            AZ_Assert(scopes.size() == m_cachedTopology.m_scopeLinks.size(), "The cached topology does not match the frame graph.");
+            for (size_t scopeIdx = 0; scopeIdx < scopes.size(); ++scopeIdx)
+            {
+                Scope* scope = scopes[scopeIdx];
+                if (disableAsyncQueues)
+                {
+                    scope->m_hardwareQueueClass = HardwareQueueClass::Graphics;
+                }
+
+                const CachedScopeLinks& scopeLinks = m_cachedTopology.m_scopeLinks[scopeIdx];
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    scope->m_producersByQueueLast[hardwareQueueClassIdx] = GetScope(scopes, scopeLinks.m_producersByQueueLast[hardwareQueueClassIdx]);
+                    scope->m_producersByQueue[hardwareQueueClassIdx] = GetScope(scopes, scopeLinks.m_producersByQueue[hardwareQueueClassIdx]);
+                    scope->m_consumersByQueue[hardwareQueueClassIdx] = GetScope(scopes, scopeLinks.m_consumersByQueue[hardwareQueueClassIdx]);
+                }
+            }
+        }
+
         void FrameGraphCompiler::ExtendTransientAttachmentAsyncQueueLifetimes(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags)
@@ -486,7 +726,8 @@ namespace AZ
             FrameGraph& frameGraph,
             TransientAttachmentPool& transientAttachmentPool,
             FrameSchedulerCompileFlags compileFlags,
-            FrameSchedulerStatisticsFlags statisticsFlags)
+            FrameSchedulerStatisticsFlags statisticsFlags,
+            TopologyCacheMode topologyCacheMode)
         {
             const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
             if (attachmentDatabase.GetTransientBufferAttachments().empty() && attachmentDatabase.GetTransientImageAttachments().empty())
@@ -496,57 +737,6 @@ namespace AZ
 
             AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachments");
 
-            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
-
-            /**
-             * Builds a sortable key. It iterates each scope and performs deactivations
-             * followed by activations on each attachment.
-             */
-            const uint32_t ATTACHMENT_BIT_COUNT = 16;
-            const uint32_t SCOPE_BIT_COUNT = 14;
-
-            enum class Action
-            {
-                ActivateImage = 0,
-                ActivateBuffer,
-                DeactivateImage,
-                DeactivateBuffer,
-            };
-
-            struct Command
-            {
-                Command(uint32_t scopeIndex, Action action, uint32_t attachmentIndex)
-                {
-                    m_bits.m_scopeIndex = scopeIndex;
-                    m_bits.m_action = (uint32_t)action;
-                    m_bits.m_attachmentIndex = attachmentIndex;
-                }
-
-                bool operator < (Command rhs) const
-                {
-                    return m_command < rhs.m_command;
-                }
-
-                struct Bits
-                {
-                    /// Sort by attachment index last
-                    uint32_t m_attachmentIndex : ATTACHMENT_BIT_COUNT;
-
-                    /// Sort by the action after the scope. First by deactivations, then by activations.
-                    uint32_t m_action : 2;
-
-                    /// Sort by scope index first.
-                    uint32_t m_scopeIndex : SCOPE_BIT_COUNT;
-                };
-
-                union
-                {
-                    Bits m_bits;
-
-                    uint32_t m_command = 0;
-                };
-            };
-
             const auto& scopes = frameGraph.GetScopes();
             const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
             const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
@@ -562,50 +752,93 @@ namespace AZ
             AZStd::vector<Command> commands;
             commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-            if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+            if (topologyCacheMode == TopologyCacheMode::Reuse)
             {
-                const uint32_t ScopeIndexFirst = 0;
-                const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
-
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                // Restore the extended lifetimes, then replay the cached schedule.
+                const size_t transientBufferCount = transientBufferGraphAttachments.size();
+                for (size_t attachmentIndex = 0; attachmentIndex < m_cachedTopology.m_transientLifetimes.size(); ++attachmentIndex)
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    FrameAttachment* transientAttachment = attachmentIndex < transientBufferCount
+                        ? static_cast<FrameAttachment*>(transientBufferGraphAttachments[attachmentIndex])
+                        : static_cast<FrameAttachment*>(transientImageGraphAttachments[attachmentIndex - transientBufferCount]);
+                    transientAttachment->m_firstScope = scopes[m_cachedTopology.m_transientLifetimes[attachmentIndex].first];
+                    transientAttachment->m_lastScope = scopes[m_cachedTopology.m_transientLifetimes[attachmentIndex].second];
                 }
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                for (uint32_t command : m_cachedTopology.m_transientCommands)
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    commands.emplace_back(command);
                 }
             }
             else
             {
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+
+                if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
                 {
-                    BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    const uint32_t ScopeIndexFirst = 0;
+                    const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
+
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
+                        commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
+                        commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    }
+                }
+                else
+                {
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
+                        commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
+                        commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
+                        commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
+                        commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    }
                 }
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                AZStd::sort(commands.begin(), commands.end());
+
+                if (topologyCacheMode == TopologyCacheMode::Rebuild)
                 {
-                    ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    m_cachedTopology.m_transientLifetimes.reserve(transientBufferGraphAttachments.size() + transientImageGraphAttachments.size());
+                    for (const BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
+                    {
+                        m_cachedTopology.m_transientLifetimes.emplace_back(transientBuffer->GetFirstScope()->GetIndex(), transientBuffer->GetLastScope()->GetIndex());
+                    }
+
+                    for (const ImageFrameAttachment* transientImage : transientImageGraphAttachments)
+                    {
+                        m_cachedTopology.m_transientLifetimes.emplace_back(transientImage->GetFirstScope()->GetIndex(), transientImage->GetLastScope()->GetIndex());
+                    }
+
+                    m_cachedTopology.m_transientCommands.reserve(commands.size());
+                    for (Command command : commands)
+                    {
+                        m_cachedTopology.m_transientCommands.push_back(command.m_command);
+                    }
                 }
             }
 
-            AZStd::sort(commands.begin(), commands.end());
-
             auto processCommands = [&](TransientAttachmentPoolCompileFlags compileFlags, TransientAttachmentStatistics::MemoryUsage* memoryHint = nullptr)
             {
                 transientAttachmentPool.Begin(compileFlags, memoryHint);
@@ -715,9 +948,22 @@ namespace AZ
             // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
             if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
             {
-                // First pass to calculate size needed.
-                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                if (topologyCacheMode == TopologyCacheMode::Reuse && m_cachedTopology.m_transientMemoryHint)
+                {
+                    // The first pass only depends on the topology, so its result is still valid.
+                    memoryUsage = m_cachedTopology.m_transientMemoryHint;
+                }
+                else
+                {
+                    // First pass to calculate size needed.
+                    processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                    memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+
+                    if (topologyCacheMode == TopologyCacheMode::Rebuild)
+                    {
+                        m_cachedTopology.m_transientMemoryHint = memoryUsage;
+                    }
+                }
             }
 
             // Second pass uses the information about memory usage
@@ -8,11 +8,13 @@
 
 #include <Atom/RHI/FrameGraphLogger.h>
 #include <Atom/RHI/FrameGraph.h>
+#include <Atom/RHI/FrameGraphCompiler.h>
 #include <Atom/RHI/FrameGraphAttachmentDatabase.h>
 #include <Atom/RHI/ImageScopeAttachment.h>
 #include <Atom/RHI/BufferScopeAttachment.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/IO/SystemFile.h>
+#include <cinttypes>
 
 namespace AZ
 {
@@ -133,6 +135,30 @@ namespace AZ
             DumpGraphVis(frameGraph);
         }
 
+        void FrameGraphLogger::LogCompileStats(
+            const FrameGraphCompileStats& compileStats,
+            FrameSchedulerLogVerbosity logVerbosity)
+        {
+            if (logVerbosity == FrameSchedulerLogVerbosity::None)
+            {
+                return;
+            }
+
+            AZ_Printf("FrameGraph", "FrameGraph Compile\n");
+            AZ_Printf("FrameGraph", "\tCompile Time: %" PRIu64 " us\n", compileStats.m_compileTimeMicroseconds);
+            AZ_Printf("FrameGraph", "\tPlatform-Independent Time: %" PRIu64 " us\n", compileStats.m_platformIndependentTimeMicroseconds);
+            AZ_Printf("FrameGraph", "\tUsed Cached Topology: %s\n", compileStats.m_usedCachedTopology ? "Yes" : "No");
+
+            if (logVerbosity != FrameSchedulerLogVerbosity::Detail)
+            {
+                return;
+            }
+
+            AZ_Printf("FrameGraph", "\tTopology Hash: %" PRIx64 "\n", static_cast<uint64_t>(compileStats.m_topologyHash));
+            AZ_Printf("FrameGraph", "\tTopology Cache Hits: %u\n", compileStats.m_cacheHitCount);
+            AZ_Printf("FrameGraph", "\tTopology Cache Misses: %u\n", compileStats.m_cacheMissCount);
+        }
+
         void FrameGraphLogger::DumpGraphVis(const FrameGraph& frameGraph)
         {
             const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
@@ -211,6 +211,7 @@ namespace AZ
                 }
 
                 FrameGraphLogger::Log(*m_frameGraph, compileRequest.m_logVerbosity);
+                FrameGraphLogger::LogCompileStats(m_frameGraphCompiler->GetCompileStats(), compileRequest.m_logVerbosity);
 
                 // Builds the scope execution schedule using the compiled graph.
                 m_frameGraphExecuter->Begin(*m_frameGraph);
@@ -268,114 +269,84 @@ namespace AZ
                 ResourceInvalidateBus::ExecuteQueuedEvents();
             }
 
-            const ResourcePoolDatabase& resourcePoolDatabase = m_device->GetResourcePoolDatabase();
+            const AZStd::sys_time_t compileStartTime = AZStd::GetTimeNowMicroSecond();
 
-            if (m_compileRequest.m_jobPolicy == JobPolicy::Parallel)
+            // Close the compile queues of all pools, so the compiles can be balanced across pools.
+            m_shaderResourceGroupPoolsToCompile.clear();
+            const auto compileGroupsBeginFunction = [this](ShaderResourceGroupPool* srgPool)
+            {
+                srgPool->CompileGroupsBegin();
+                m_shaderResourceGroupPoolsToCompile.push_back(srgPool);
+            };
+            m_device->GetResourcePoolDatabase().ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(compileGroupsBeginFunction);
+
+            const uint32_t compilesPerJob =
+                m_compileRequest.m_jobPolicy == JobPolicy::Parallel ? m_compileRequest.m_shaderResourceGroupCompilesPerJob : AZStd::numeric_limits<uint32_t>::max();
+            PartitionShaderResourceGroupCompiles(m_shaderResourceGroupPoolsToCompile, compilesPerJob, m_shaderResourceGroupCompileBatches);
+
+            const auto compileBatchFunction = [](const ShaderResourceGroupCompileBatch& batch)
+            {
+                AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileBatchLambda");
+                for (const ShaderResourceGroupCompileBatch::PoolInterval& poolInterval : batch.m_poolIntervals)
+                {
+                    poolInterval.m_pool->CompileGroupsForInterval(poolInterval.m_interval);
+                }
+            };
+
+            const uint32_t batchCount = static_cast<uint32_t>(m_shaderResourceGroupCompileBatches.size());
+            if (batchCount == 1)
+            {
+                compileBatchFunction(m_shaderResourceGroupCompileBatches.front());
+            }
+            else if (batchCount > 1)
             {
-                // Iterate over each SRG pool and fork jobs to compile SRGs.
-                const uint32_t compilesPerJob = m_compileRequest.m_shaderResourceGroupCompilesPerJob;
                 if (m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive())
                 {
                     AZ::TaskGraph taskGraph;
-
-                    const auto compileIntervalsFunction = [compilesPerJob, &taskGraph](ShaderResourceGroupPool* srgPool)
+                    AZ::TaskDescriptor srgCompileDesc{"SrgCompile", "Graphics"};
+                    for (const ShaderResourceGroupCompileBatch& batch : m_shaderResourceGroupCompileBatches)
                     {
-                        srgPool->CompileGroupsBegin();
-                        const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
-                        const uint32_t jobCount = DivideByMultiple(compilesInPool, compilesPerJob);
-                        AZ::TaskDescriptor srgCompileDesc{"SrgCompile", "Graphics"};
-                        AZ::TaskDescriptor srgCompileEndDesc{"SrgCompileEnd", "Graphics"};
-
-                        auto srgCompileEndTask = taskGraph.AddTask(
-                            srgCompileEndDesc,
-                            [srgPool]()
+                        taskGraph.AddTask(
+                            srgCompileDesc,
+                            [&compileBatchFunction, &batch]()
                             {
-                                srgPool->CompileGroupsEnd();
+                                compileBatchFunction(batch);
                             });
-
-                        for (uint32_t i = 0; i < jobCount; ++i)
-                        {
-                            Interval interval;
-                            interval.m_min = i * compilesPerJob;
-                            interval.m_max = AZStd::min(interval.m_min + compilesPerJob, compilesInPool);
-
-                            auto compileTask = taskGraph.AddTask(
-                                srgCompileDesc,
-                                [srgPool, interval]()
-                                {
-                                AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileGroupsForIntervalLambda");
-                                    srgPool->CompileGroupsForInterval(interval);
-                                });
-                                compileTask.Precedes(srgCompileEndTask);
-                        }
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileIntervalsFunction)>(AZStd::move(compileIntervalsFunction));
-                    if (!taskGraph.IsEmpty())
-                    {
-                        AZ::TaskGraphEvent finishedEvent;
-                        taskGraph.Submit(&finishedEvent);
-                        finishedEvent.Wait();
                     }
+
+                    AZ::TaskGraphEvent finishedEvent;
+                    taskGraph.Submit(&finishedEvent);
+                    finishedEvent.Wait();
                 }
                 else // use Job system
                 {
-                    const auto compileGroupsBeginFunction = [](ShaderResourceGroupPool* srgPool)
-                    {
-                        srgPool->CompileGroupsBegin();
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(compileGroupsBeginFunction);
-
-                    // Iterate over each SRG pool and fork jobs to compile SRGs.
                     AZ::JobCompletion jobCompletion;
-
-                    const auto compileIntervalsFunction = [compilesPerJob, &jobCompletion](ShaderResourceGroupPool* srgPool)
+                    for (const ShaderResourceGroupCompileBatch& batch : m_shaderResourceGroupCompileBatches)
                     {
-                        const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
-                        const uint32_t jobCount = DivideByMultiple(compilesInPool, compilesPerJob);
-
-                        for (uint32_t i = 0; i < jobCount; ++i)
+                        const auto compileBatchJobLambda = [&compileBatchFunction, &batch]()
                         {
-                            Interval interval;
-                            interval.m_min = i * compilesPerJob;
-                            interval.m_max = AZStd::min(interval.m_min + compilesPerJob, compilesInPool);
-
-                            const auto compileGroupsForIntervalLambda = [srgPool, interval]()
-                            {
-                                AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileGroupsForIntervalLambda");
-                                srgPool->CompileGroupsForInterval(interval);
-                            };
-
-                            AZ::Job* executeGroupJob = AZ::CreateJobFunction(AZStd::move(compileGroupsForIntervalLambda), true, nullptr);
-                            executeGroupJob->SetDependent(&jobCompletion);
-                            executeGroupJob->Start();
-                        }
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileIntervalsFunction)>(AZStd::move(compileIntervalsFunction));
+                            compileBatchFunction(batch);
+                        };
 
+                        AZ::Job* compileBatchJob = AZ::CreateJobFunction(AZStd::move(compileBatchJobLambda), true, nullptr);
+                        compileBatchJob->SetDependent(&jobCompletion);
+                        compileBatchJob->Start();
+                    }
                     jobCompletion.StartAndWaitForCompletion();
-
-                    const auto compileGroupsEndFunction = [](ShaderResourceGroupPool* srgPool)
-                    {
-                        srgPool->CompileGroupsEnd();
-                    };
-
-                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsEndFunction)>(compileGroupsEndFunction);
                 }
             }
-            else
-            {
-                const auto compileAllLambda = [](ShaderResourceGroupPool* srgPool)
-                {
-                    srgPool->CompileGroupsBegin();
-                    srgPool->CompileGroupsForInterval(Interval(0, srgPool->GetGroupsToCompileCount()));
-                    srgPool->CompileGroupsEnd();
-                };
 
-                resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileAllLambda)>(compileAllLambda);
+            m_shaderResourceGroupCompileStats = {};
+            m_shaderResourceGroupCompileStats.m_batchCount = batchCount;
+            for (ShaderResourceGroupPool* srgPool : m_shaderResourceGroupPoolsToCompile)
+            {
+                const uint32_t groupCount = srgPool->GetGroupsToCompileCount();
+                m_shaderResourceGroupCompileStats.m_poolCount += groupCount > 0 ? 1 : 0;
+                m_shaderResourceGroupCompileStats.m_groupCount += groupCount;
+                srgPool->CompileGroupsEnd();
             }
+            m_shaderResourceGroupPoolsToCompile.clear();
+            m_shaderResourceGroupCompileStats.m_compileTimeMicroseconds = static_cast<uint64_t>(AZStd::GetTimeNowMicroSecond() - compileStartTime);
 
             //It is possible for certain back ends to run out of SRG memory (due to fragmentation) in which case
             //we try to compact and re-compile SRGs.
@@ -584,6 +555,11 @@ namespace AZ
             return nullptr;
         }
 
+        const ShaderResourceGroupCompileStats& FrameScheduler::GetShaderResourceGroupCompileStats() const
+        {
+            return m_shaderResourceGroupCompileStats;
+        }
+
         const MemoryStatistics* FrameScheduler::GetMemoryStatistics() const
         {
             return
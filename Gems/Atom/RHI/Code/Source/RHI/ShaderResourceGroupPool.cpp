@@ -8,12 +8,59 @@
 #include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/ImageView.h>
+#include <Atom/RHI.Reflect/Bits.h>
 #include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        void PartitionShaderResourceGroupCompiles(
+            const AZStd::vector<ShaderResourceGroupPool*>& pools,
+            uint32_t compilesPerBatch,
+            AZStd::vector<ShaderResourceGroupCompileBatch>& batches)
+        {
+            AZ_Assert(compilesPerBatch > 0, "The number of compiles per batch must be greater than zero.");
+            batches.clear();
+
+            uint32_t compileCount = 0;
+            for (const ShaderResourceGroupPool* pool : pools)
+            {
+                compileCount += pool->GetGroupsToCompileCount();
+            }
+
+            if (compileCount == 0)
+            {
+                return;
+            }
+
+            // Use the fewest batches that respect the limit, then spread the compiles evenly over them.
+            const uint32_t batchCount = DivideByMultiple(compileCount, compilesPerBatch);
+            const uint32_t batchSize = DivideByMultiple(compileCount, batchCount);
+            batches.resize(batchCount);
+
+            uint32_t batchIndex = 0;
+            for (ShaderResourceGroupPool* pool : pools)
+            {
+                const uint32_t poolCompileCount = pool->GetGroupsToCompileCount();
+                uint32_t poolCompileIndex = 0;
+                while (poolCompileIndex < poolCompileCount)
+                {
+                    ShaderResourceGroupCompileBatch& batch = batches[batchIndex];
+                    const uint32_t intervalSize = AZStd::min(batchSize - batch.m_compileCount, poolCompileCount - poolCompileIndex);
+                    batch.m_poolIntervals.push_back({ pool, Interval(poolCompileIndex, poolCompileIndex + intervalSize) });
+                    batch.m_compileCount += intervalSize;
+                    poolCompileIndex += intervalSize;
+
+                    if (batch.m_compileCount == batchSize)
+                    {
+                        ++batchIndex;
+                    }
+                }
+            }
+        }
+
         ShaderResourceGroupPool::ShaderResourceGroupPool() {}
 
         ShaderResourceGroupPool::~ShaderResourceGroupPool() {}
@@ -109,39 +156,58 @@ namespace AZ
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
-
             AZ_Assert(!shaderResourceGroup.IsQueuedForCompile(), "Attempting to compile an SRG that's already been queued for compile. Only compile an SRG once per frame.");            
 
             CalculateGroupDataDiff(shaderResourceGroup, groupData);
 
             shaderResourceGroup.SetData(groupData);
 
-            QueueForCompileNoLock(shaderResourceGroup);
+            QueueForCompile(shaderResourceGroup);
         }
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& group)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
-            QueueForCompileNoLock(group);
-        }
-
-        void ShaderResourceGroupPool::QueueForCompileNoLock(ShaderResourceGroup& group)
-        {
-            if (!group.m_isQueuedForCompile)
+            // Only the thread that claims the flag links the group, so a group is in the queue at most once.
+            if (!group.m_isQueuedForCompile.exchange(true, AZStd::memory_order_acq_rel))
             {
-                group.m_isQueuedForCompile = true;
-                m_groupsToCompile.emplace_back(&group);
+                // Counted before it is linked, so the count never drops below the number of linked groups
+                // when CompileGroupsBegin subtracts the groups it takes.
+                m_queuedGroupsCount.fetch_add(1, AZStd::memory_order_relaxed);
+
+                ShaderResourceGroup* head = m_queuedGroupsHead.load(AZStd::memory_order_relaxed);
+                do
+                {
+                    group.m_nextQueuedForCompile = head;
+                } while (!m_queuedGroupsHead.compare_exchange_weak(head, &group, AZStd::memory_order_release, AZStd::memory_order_relaxed));
             }
         }
 
         void ShaderResourceGroupPool::UnqueueForCompile(ShaderResourceGroup& shaderResourceGroup)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+            AZStd::lock_guard<AZStd::mutex> lock(m_groupsToCompileMutex);
             if (shaderResourceGroup.m_isQueuedForCompile)
             {
+                // Other threads can still push groups, which only replaces the head. The links behind the head
+                // are only changed under the lock, so the group is unlinked in place once it is not the head.
+                ShaderResourceGroup* head = &shaderResourceGroup;
+                if (!m_queuedGroupsHead.compare_exchange_strong(
+                        head, shaderResourceGroup.m_nextQueuedForCompile, AZStd::memory_order_acq_rel, AZStd::memory_order_acquire))
+                {
+                    ShaderResourceGroup* previous = head;
+                    while (previous && previous->m_nextQueuedForCompile != &shaderResourceGroup)
+                    {
+                        previous = previous->m_nextQueuedForCompile;
+                    }
+                    AZ_Assert(previous, "Shader resource group is flagged as queued but is not in the compile queue of its pool.");
+                    if (previous)
+                    {
+                        previous->m_nextQueuedForCompile = shaderResourceGroup.m_nextQueuedForCompile;
+                    }
+                }
+
+                shaderResourceGroup.m_nextQueuedForCompile = nullptr;
                 shaderResourceGroup.m_isQueuedForCompile = false;
-                m_groupsToCompile.erase(AZStd::find(m_groupsToCompile.begin(), m_groupsToCompile.end(), &shaderResourceGroup));
+                m_queuedGroupsCount.fetch_sub(1, AZStd::memory_order_relaxed);
             }
         }
 
@@ -226,6 +292,21 @@ namespace AZ
             AZ_Assert(m_isCompiling == false, "Already compiling! Deadlock imminent.");
             m_groupsToCompileMutex.lock();
             m_isCompiling = true;
+
+            // Groups queued from now on start a new list, which is compiled by the next CompileGroupsBegin.
+            // The list is linked newest first, so it is reversed to compile the groups in the order they were queued.
+            ShaderResourceGroup* group = m_queuedGroupsHead.exchange(nullptr, AZStd::memory_order_acquire);
+            while (group)
+            {
+                m_groupsToCompile.push_back(group);
+
+                ShaderResourceGroup* nextGroup = group->m_nextQueuedForCompile;
+                group->m_nextQueuedForCompile = nullptr;
+                group = nextGroup;
+            }
+            AZStd::reverse(m_groupsToCompile.begin(), m_groupsToCompile.end());
+
+            m_queuedGroupsCount.fetch_sub(static_cast<uint32_t>(m_groupsToCompile.size()), AZStd::memory_order_relaxed);
         }
 
         void ShaderResourceGroupPool::CompileGroupsEnd()
@@ -236,6 +317,11 @@ namespace AZ
             m_groupsToCompileMutex.unlock();
         }
 
+        uint32_t ShaderResourceGroupPool::GetQueuedGroupsCount() const
+        {
+            return m_queuedGroupsCount.load(AZStd::memory_order_relaxed);
+        }
+
         uint32_t ShaderResourceGroupPool::GetGroupsToCompileCount() const
         {
             AZ_Assert(m_isCompiling, "You must call this function within a CompileGroups{Begin, End} region!");
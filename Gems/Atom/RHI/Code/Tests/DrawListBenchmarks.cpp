@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Atom/RHI/DrawList.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    /*
+     * Sorts a synthetic draw list per iteration, so the reported items are sorted draw items.
+     * The sort keys are drawn from a small set, similar to the per material and per pass keys in real draw lists,
+     * and the depths are spread over the view distance. The draw list size is the benchmark argument.
+     */
+    class DrawListSortBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            SimpleLcgRandom random(1234);
+            const size_t drawItemCount = static_cast<size_t>(state.range(0));
+            m_drawList.reserve(drawItemCount);
+            for (size_t i = 0; i < drawItemCount; ++i)
+            {
+                RHI::DrawItemProperties properties(nullptr, static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 64));
+                properties.m_depth = random.GetRandomFloat() * 1000.0f;
+                m_drawList.push_back(properties);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_drawList = {};
+        }
+
+        void RunSortBenchmark(::benchmark::State& state, RHI::DrawListSortType sortType, RHI::DrawListSortAlgorithm algorithm)
+        {
+            RHI::DrawList drawList;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                drawList = m_drawList;
+                state.ResumeTiming();
+
+                RHI::SortDrawList(drawList, sortType, algorithm);
+                benchmark::DoNotOptimize(drawList.data());
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_drawList.size());
+        }
+
+        RHI::DrawList m_drawList;
+    };
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, KeyThenDepth_Comparison)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, RHI::DrawListSortType::KeyThenDepth, RHI::DrawListSortAlgorithm::Comparison);
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, KeyThenDepth_Radix)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, RHI::DrawListSortType::KeyThenDepth, RHI::DrawListSortAlgorithm::Radix);
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, ReverseDepthThenKey_Comparison)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, RHI::DrawListSortType::ReverseDepthThenKey, RHI::DrawListSortAlgorithm::Comparison);
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmarkFixture, ReverseDepthThenKey_Radix)(benchmark::State& state)
+    {
+        RunSortBenchmark(state, RHI::DrawListSortType::ReverseDepthThenKey, RHI::DrawListSortAlgorithm::Radix);
+    }
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, KeyThenDepth_Comparison)->RangeMultiplier(4)->Range(256, 65536)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, KeyThenDepth_Radix)->RangeMultiplier(4)->Range(256, 65536)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, ReverseDepthThenKey_Comparison)->RangeMultiplier(4)->Range(256, 65536)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(DrawListSortBenchmarkFixture, ReverseDepthThenKey_Radix)->RangeMultiplier(4)->Range(256, 65536)->Unit(benchmark::kMicrosecond);
+} // namespace UnitTest
+#endif
@@ -418,6 +418,42 @@ namespace UnitTest
 
         delete drawPacket;
     }
+
+    TEST_F(DrawPacketTest, SortDrawListRadixMatchesComparison)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+
+        // Few distinct sort keys and depths, so there are many ties, and a few large and negative sort keys.
+        RHI::DrawList drawList;
+        for (size_t i = 0; i < 3000; ++i)
+        {
+            RHI::DrawItemProperties properties(nullptr, static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 16) - 8);
+            if (i % 10 == 0)
+            {
+                properties.m_sortKey = static_cast<RHI::DrawItemSortKey>(static_cast<uint64_t>(random.GetRandom()) << 32);
+            }
+            properties.m_depth = static_cast<float>(static_cast<int32_t>(random.GetRandom() % 200) - 100) * 0.25f;
+            drawList.push_back(properties);
+        }
+
+        for (RHI::DrawListSortType sortType : { RHI::DrawListSortType::KeyThenDepth, RHI::DrawListSortType::KeyThenReverseDepth,
+            RHI::DrawListSortType::DepthThenKey, RHI::DrawListSortType::ReverseDepthThenKey })
+        {
+            RHI::DrawList comparisonSorted = drawList;
+            RHI::SortDrawList(comparisonSorted, sortType, RHI::DrawListSortAlgorithm::Comparison);
+
+            RHI::DrawList radixSorted = drawList;
+            RHI::SortDrawList(radixSorted, sortType, RHI::DrawListSortAlgorithm::Radix);
+
+            // Items with equal keys can be in any order, so only compare the keys.
+            ASSERT_EQ(radixSorted.size(), comparisonSorted.size());
+            for (size_t i = 0; i < radixSorted.size(); ++i)
+            {
+                EXPECT_EQ(radixSorted[i].m_sortKey, comparisonSorted[i].m_sortKey);
+                EXPECT_EQ(radixSorted[i].m_depth, comparisonSorted[i].m_depth);
+            }
+        }
+    }
 }
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include "RHITestFixture.h"
+#include <Tests/FrameGraph.h>
+#include <Tests/Factory.h>
+#include <Tests/Device.h>
+#include <Atom/RHI/BufferFrameAttachment.h>
+#include <Atom/RHI/BufferPool.h>
+#include <Atom/RHI/BufferScopeAttachment.h>
+#include <Atom/RHI/TransientAttachmentPool.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    /*
+     * Compiles a frame graph of 128 scopes with the test RHI, one compile per iteration, so the reported items are
+     * compiled scopes. Each scope writes an imported buffer and a transient buffer that is read by the next scope,
+     * and every third scope runs on the compute queue. The graph is rebuilt outside of the timed region every iteration,
+     * like the frame scheduler does every frame. The transient attachment pool uses the memory hint heap strategy,
+     * so a full compile runs two transient allocation passes.
+     */
+    class FrameGraphCompileBenchmarkFixture
+        : public TestFixtureBenchmarkFixture<RHITestFixture>
+    {
+    public:
+        static constexpr uint32_t ScopeCount = 128;
+        static constexpr uint32_t BufferSize = 64;
+
+        void SetUpBenchmark() override
+        {
+            m_rootFactory.reset(aznew Factory());
+            RHI::Ptr<RHI::Device> device = MakeTestDevice();
+
+            m_bufferPool = RHI::Factory::Get().CreateBufferPool();
+            RHI::BufferPoolDescriptor bufferPoolDesc;
+            bufferPoolDesc.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite;
+            m_bufferPool->Init(*device, bufferPoolDesc);
+
+            m_buffers.resize(ScopeCount);
+            m_bufferIds.resize(ScopeCount);
+            m_transientBufferIds.resize(ScopeCount);
+            m_scopes.resize(ScopeCount);
+            for (uint32_t i = 0; i < ScopeCount; ++i)
+            {
+                m_buffers[i] = RHI::Factory::Get().CreateBuffer();
+
+                RHI::BufferInitRequest request;
+                request.m_descriptor = RHI::BufferDescriptor(RHI::BufferBindFlags::ShaderReadWrite, BufferSize);
+                request.m_buffer = m_buffers[i].get();
+                m_bufferPool->InitBuffer(request);
+
+                m_bufferIds[i] = RHI::AttachmentId(AZStd::string::format("B%d", i));
+                m_transientBufferIds[i] = RHI::AttachmentId(AZStd::string::format("T%d", i));
+
+                m_scopes[i] = RHI::Factory::Get().CreateScope();
+                m_scopes[i]->Init(RHI::ScopeId{ AZStd::string::format("S%d", i) });
+            }
+
+            RHI::TransientAttachmentPoolDescriptor transientPoolDesc;
+            transientPoolDesc.m_heapParameters = RHI::HeapAllocationParameters(RHI::HeapMemoryHintParameters());
+            m_transientAttachmentPool = RHI::Factory::Get().CreateTransientAttachmentPool();
+            m_transientAttachmentPool->Init(*device, transientPoolDesc);
+
+            m_frameGraphCompiler = RHI::Factory::Get().CreateFrameGraphCompiler();
+            m_frameGraphCompiler->Init(*device);
+
+            m_frameGraph = AZStd::make_unique<RHI::FrameGraph>();
+        }
+
+        void TearDownBenchmark() override
+        {
+            m_frameGraph.reset();
+            m_frameGraphCompiler = nullptr;
+            m_transientAttachmentPool = nullptr;
+            m_scopes = {};
+            m_buffers = {};
+            m_bufferIds = {};
+            m_transientBufferIds = {};
+            m_bufferPool = nullptr;
+            m_rootFactory.reset();
+        }
+
+        void BuildFrameGraph()
+        {
+            RHI::FrameGraph& frameGraph = *m_frameGraph;
+            RHI::BufferScopeAttachmentDescriptor bufferBindingDesc;
+            bufferBindingDesc.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+
+            frameGraph.Begin();
+
+            for (uint32_t i = 0; i < ScopeCount; ++i)
+            {
+                frameGraph.GetAttachmentDatabase().ImportBuffer(m_bufferIds[i], m_buffers[i]);
+            }
+
+            for (uint32_t scopeIdx = 0; scopeIdx < ScopeCount; ++scopeIdx)
+            {
+                frameGraph.BeginScope(*m_scopes[scopeIdx]);
+                frameGraph.SetHardwareQueueClass(scopeIdx % 3 == 2 ? RHI::HardwareQueueClass::Compute : RHI::HardwareQueueClass::Graphics);
+
+                bufferBindingDesc.m_attachmentId = m_bufferIds[scopeIdx];
+                frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+
+                frameGraph.GetAttachmentDatabase().CreateTransientBuffer(RHI::TransientBufferDescriptor{
+                    m_transientBufferIds[scopeIdx], RHI::BufferDescriptor(RHI::BufferBindFlags::ShaderReadWrite, BufferSize) });
+                bufferBindingDesc.m_attachmentId = m_transientBufferIds[scopeIdx];
+                frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+
+                if (scopeIdx > 0)
+                {
+                    bufferBindingDesc.m_attachmentId = m_transientBufferIds[scopeIdx - 1];
+                    frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::Read);
+                }
+
+                frameGraph.EndScope();
+            }
+
+            frameGraph.End();
+        }
+
+        void RunCompileBenchmark(::benchmark::State& state, RHI::FrameSchedulerCompileFlags compileFlags)
+        {
+            RHI::FrameGraphCompileRequest request;
+            request.m_frameGraph = m_frameGraph.get();
+            request.m_transientAttachmentPool = m_transientAttachmentPool.get();
+            request.m_compileFlags = compileFlags;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                BuildFrameGraph();
+                state.ResumeTiming();
+
+                m_frameGraphCompiler->Compile(request);
+            }
+
+            const RHI::FrameGraphCompileStats& compileStats = m_frameGraphCompiler->GetCompileStats();
+            state.SetItemsProcessed(state.iterations() * ScopeCount);
+            state.counters["CacheHits"] = static_cast<double>(compileStats.m_cacheHitCount);
+            state.counters["CacheMisses"] = static_cast<double>(compileStats.m_cacheMissCount);
+        }
+
+        AZStd::unique_ptr<Factory> m_rootFactory;
+        RHI::Ptr<RHI::BufferPool> m_bufferPool;
+        AZStd::vector<RHI::Ptr<RHI::Buffer>> m_buffers;
+        AZStd::vector<RHI::AttachmentId> m_bufferIds;
+        AZStd::vector<RHI::AttachmentId> m_transientBufferIds;
+        AZStd::vector<RHI::Ptr<RHI::Scope>> m_scopes;
+        RHI::Ptr<RHI::TransientAttachmentPool> m_transientAttachmentPool;
+        RHI::Ptr<RHI::FrameGraphCompiler> m_frameGraphCompiler;
+        AZStd::unique_ptr<RHI::FrameGraph> m_frameGraph;
+    };
+
+    BENCHMARK_F(FrameGraphCompileBenchmarkFixture, Compile_Uncached)(benchmark::State& state)
+    {
+        RunCompileBenchmark(state, RHI::FrameSchedulerCompileFlags::DisableTopologyCache);
+    }
+
+    BENCHMARK_F(FrameGraphCompileBenchmarkFixture, Compile_CachedTopology)(benchmark::State& state)
+    {
+        RunCompileBenchmark(state, RHI::FrameSchedulerCompileFlags::None);
+    }
+} // namespace UnitTest
+#endif
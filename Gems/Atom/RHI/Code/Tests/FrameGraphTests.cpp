@@ -437,6 +437,97 @@ namespace UnitTest
             }
         }
 
+        //! Builds a chain of scopes where each scope writes its own buffer and reads the buffer of the previous scope.
+        void BuildTopologyCacheGraph(RHI::FrameGraph& frameGraph, uint32_t scopeCount)
+        {
+            RHI::BufferScopeAttachmentDescriptor bufferBindingDesc;
+            bufferBindingDesc.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+
+            frameGraph.Begin();
+
+            for (uint32_t i = 0; i < scopeCount; ++i)
+            {
+                frameGraph.GetAttachmentDatabase().ImportBuffer(m_state->m_bufferAttachments[i].m_id, m_state->m_bufferAttachments[i].m_buffer);
+            }
+
+            for (uint32_t scopeIdx = 0; scopeIdx < scopeCount; ++scopeIdx)
+            {
+                frameGraph.BeginScope(*m_state->m_scopes[scopeIdx]);
+
+                // Every third scope runs on the compute queue, so the compiled graph has cross-queue edges.
+                frameGraph.SetHardwareQueueClass(scopeIdx % 3 == 2 ? RHI::HardwareQueueClass::Compute : RHI::HardwareQueueClass::Graphics);
+
+                bufferBindingDesc.m_attachmentId = m_state->m_bufferAttachments[scopeIdx].m_id;
+                frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+
+                if (scopeIdx > 0)
+                {
+                    bufferBindingDesc.m_attachmentId = m_state->m_bufferAttachments[scopeIdx - 1].m_id;
+                    frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::Read);
+                }
+
+                frameGraph.EndScope();
+            }
+
+            frameGraph.End();
+        }
+
+        void TestTopologyCache()
+        {
+            RHI::FrameGraph frameGraph;
+            RHI::FrameGraphCompiler& frameGraphCompiler = *m_state->m_frameGraphCompiler;
+            const RHI::FrameGraphCompileStats& compileStats = frameGraphCompiler.GetCompileStats();
+
+            // Compiles the graph and returns the queue-centric producers and consumers of each scope.
+            auto compileScopeLinks = [&](RHI::FrameSchedulerCompileFlags compileFlags)
+            {
+                RHI::FrameGraphCompileRequest request;
+                request.m_frameGraph = &frameGraph;
+                request.m_compileFlags = compileFlags;
+                frameGraphCompiler.Compile(request);
+
+                AZStd::vector<const RHI::Scope*> scopeLinks;
+                for (const RHI::Scope* scope : frameGraph.GetScopes())
+                {
+                    for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < RHI::HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                    {
+                        const RHI::HardwareQueueClass hardwareQueueClass = static_cast<RHI::HardwareQueueClass>(hardwareQueueClassIdx);
+                        scopeLinks.push_back(scope->GetProducerByQueue(hardwareQueueClass));
+                        scopeLinks.push_back(scope->GetConsumerByQueue(hardwareQueueClass));
+                    }
+                }
+                return scopeLinks;
+            };
+
+            BuildTopologyCacheGraph(frameGraph, TopologyCacheScopeCount);
+            const AZStd::vector<const RHI::Scope*> expectedScopeLinks = compileScopeLinks(RHI::FrameSchedulerCompileFlags::DisableTopologyCache);
+            EXPECT_FALSE(compileStats.m_usedCachedTopology);
+            EXPECT_EQ(compileStats.m_cacheMissCount, 0);
+
+            for (uint32_t frameIdx = 0; frameIdx < FrameIterationCount; ++frameIdx)
+            {
+                BuildTopologyCacheGraph(frameGraph, TopologyCacheScopeCount);
+                EXPECT_TRUE(compileScopeLinks(RHI::FrameSchedulerCompileFlags::None) == expectedScopeLinks);
+                EXPECT_EQ(compileStats.m_usedCachedTopology, frameIdx > 0);
+            }
+
+            EXPECT_EQ(compileStats.m_cacheHitCount, FrameIterationCount - 1);
+            EXPECT_EQ(compileStats.m_cacheMissCount, 1);
+
+            // A different topology is compiled from scratch.
+            BuildTopologyCacheGraph(frameGraph, TopologyCacheScopeCount - 1);
+            compileScopeLinks(RHI::FrameSchedulerCompileFlags::None);
+            EXPECT_FALSE(compileStats.m_usedCachedTopology);
+            EXPECT_NE(compileStats.m_topologyHash, AZ::HashValue64{ 0 });
+            EXPECT_EQ(compileStats.m_cacheMissCount, 2);
+
+            // Changing the compile flags changes the compiled graph, so it also invalidates the cache.
+            BuildTopologyCacheGraph(frameGraph, TopologyCacheScopeCount - 1);
+            compileScopeLinks(RHI::FrameSchedulerCompileFlags::DisableAsyncQueues);
+            EXPECT_FALSE(compileStats.m_usedCachedTopology);
+            EXPECT_EQ(compileStats.m_cacheMissCount, 3);
+        }
+
     private:
         static const uint32_t FrameIterationCount = 32;
         static const uint32_t ImageCount = 256;
@@ -444,6 +535,7 @@ namespace UnitTest
         static const uint32_t BufferSize = 64;
         static const uint32_t ImageSize = 16;
         static const uint32_t ScopeCount = 128;
+        static const uint32_t TopologyCacheScopeCount = 16;
 
         AZStd::unique_ptr<Factory> m_rootFactory;
 
@@ -493,4 +585,9 @@ namespace UnitTest
     {
         TestScopeGraph();
     }
+
+    TEST_F(FrameGraphTests, TestTopologyCache)
+    {
+        TestTopologyCache();
+    }
 }
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include "RHITestFixture.h"
+#include <Tests/Factory.h>
+#include <Tests/Device.h>
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/ShaderResourceGroupPool.h>
+#include <Atom/RHI.Reflect/Bits.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    /*
+     * Queues and compiles 8160 dynamic material SRGs with the test RHI, which has no platform compile cost, so the
+     * benchmarks measure the queuing and scheduling overhead. The SRGs are spread over 8 pools with 32 to 4096 groups
+     * each, like the per material pools of a scene with a few common materials and many rare ones. One frame worth of
+     * queuing or compiling runs per iteration, so the reported items are SRGs.
+     */
+    class ShaderResourceGroupCompileBenchmarkFixture
+        : public TestFixtureBenchmarkFixture<RHITestFixture>
+    {
+    public:
+        static constexpr uint32_t PoolCount = 8;
+        static constexpr uint32_t LargestPoolGroupCount = 4096;
+        static constexpr uint32_t CompilesPerJob = 256;
+
+        void SetUpBenchmark() override
+        {
+            JobManagerDesc jobManagerDesc;
+            JobManagerThreadDesc threadDesc;
+            for (uint32_t i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = AZStd::make_unique<JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<JobContext>(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_rootFactory.reset(aznew Factory());
+            RHI::Ptr<RHI::Device> device = MakeTestDevice();
+
+            RHI::Ptr<RHI::ShaderResourceGroupLayout> layout = RHI::ShaderResourceGroupLayout::Create();
+            layout->SetBindingSlot(0);
+            layout->AddShaderInput(RHI::ShaderInputConstantDescriptor{ AZ::Name("m_baseColor"), 0, 16, 0 });
+            layout->AddShaderInput(RHI::ShaderInputConstantDescriptor{ AZ::Name("m_roughness"), 16, 4, 0 });
+            layout->AddShaderInput(RHI::ShaderInputImageDescriptor{
+                AZ::Name("m_baseColorMap"), RHI::ShaderInputImageAccess::Read, RHI::ShaderInputImageType::Image2D, 1, 1 });
+            layout->Finalize();
+            m_layout = layout;
+
+            RHI::ShaderResourceGroupPoolDescriptor poolDescriptor;
+            poolDescriptor.m_layout = m_layout.get();
+
+            uint32_t groupCount = LargestPoolGroupCount;
+            for (uint32_t poolIndex = 0; poolIndex < PoolCount; ++poolIndex, groupCount /= 2)
+            {
+                RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+                srgPool->Init(*device, poolDescriptor);
+                m_pools.push_back(srgPool);
+                m_poolsToCompile.push_back(srgPool.get());
+
+                for (uint32_t i = 0; i < groupCount; ++i)
+                {
+                    RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+                    srgPool->InitGroup(*srg);
+                    m_groupData.emplace_back(*srg);
+                    m_groups.push_back(srg);
+                }
+            }
+
+            m_batches.reserve(RHI::DivideByMultiple(m_groups.size(), CompilesPerJob) + PoolCount);
+        }
+
+        void TearDownBenchmark() override
+        {
+            m_batches = {};
+            m_groupData = {};
+            m_groups = {};
+            m_poolsToCompile = {};
+            m_pools = {};
+            m_layout = nullptr;
+            m_rootFactory.reset();
+
+            JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+        }
+
+        //! Queues all groups for compile from jobs of CompilesPerJob groups each.
+        void QueueGroups()
+        {
+            JobCompletion jobCompletion;
+            const uint32_t groupCount = static_cast<uint32_t>(m_groups.size());
+            for (uint32_t groupIndex = 0; groupIndex < groupCount; groupIndex += CompilesPerJob)
+            {
+                const auto queueGroupsLambda = [this, groupIndex, groupCount]()
+                {
+                    const uint32_t groupEnd = AZStd::min(groupIndex + CompilesPerJob, groupCount);
+                    for (uint32_t i = groupIndex; i < groupEnd; ++i)
+                    {
+                        m_groups[i]->Compile(m_groupData[i]);
+                    }
+                };
+
+                Job* queueGroupsJob = CreateJobFunction(AZStd::move(queueGroupsLambda), true, nullptr);
+                queueGroupsJob->SetDependent(&jobCompletion);
+                queueGroupsJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        //! Compiles the batches with one job per batch.
+        void CompileBatches()
+        {
+            JobCompletion jobCompletion;
+            for (const RHI::ShaderResourceGroupCompileBatch& batch : m_batches)
+            {
+                const auto compileBatchLambda = [&batch]()
+                {
+                    for (const RHI::ShaderResourceGroupCompileBatch::PoolInterval& poolInterval : batch.m_poolIntervals)
+                    {
+                        poolInterval.m_pool->CompileGroupsForInterval(poolInterval.m_interval);
+                    }
+                };
+
+                Job* compileBatchJob = CreateJobFunction(AZStd::move(compileBatchLambda), true, nullptr);
+                compileBatchJob->SetDependent(&jobCompletion);
+                compileBatchJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        //! Splits every pool into its own intervals of CompilesPerJob groups, like the scheduler did before the
+        //! compiles were balanced across pools.
+        void PartitionPerPool()
+        {
+            m_batches.clear();
+            for (RHI::ShaderResourceGroupPool* srgPool : m_poolsToCompile)
+            {
+                const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
+                for (uint32_t compileIndex = 0; compileIndex < compilesInPool; compileIndex += CompilesPerJob)
+                {
+                    RHI::ShaderResourceGroupCompileBatch& batch = m_batches.emplace_back();
+                    const uint32_t compileEnd = AZStd::min(compileIndex + CompilesPerJob, compilesInPool);
+                    batch.m_poolIntervals.push_back({ srgPool, RHI::Interval(compileIndex, compileEnd) });
+                    batch.m_compileCount = compileEnd - compileIndex;
+                }
+            }
+        }
+
+        void RunCompileBenchmark(::benchmark::State& state, bool balanceAcrossPools)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                QueueGroups();
+                state.ResumeTiming();
+
+                for (RHI::ShaderResourceGroupPool* srgPool : m_poolsToCompile)
+                {
+                    srgPool->CompileGroupsBegin();
+                }
+
+                if (balanceAcrossPools)
+                {
+                    RHI::PartitionShaderResourceGroupCompiles(m_poolsToCompile, CompilesPerJob, m_batches);
+                }
+                else
+                {
+                    PartitionPerPool();
+                }
+                CompileBatches();
+
+                for (RHI::ShaderResourceGroupPool* srgPool : m_poolsToCompile)
+                {
+                    srgPool->CompileGroupsEnd();
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_groups.size());
+            state.counters["Pools"] = static_cast<double>(PoolCount);
+            state.counters["Batches"] = static_cast<double>(m_batches.size());
+        }
+
+        AZStd::unique_ptr<JobManager> m_jobManager;
+        AZStd::unique_ptr<JobContext> m_jobContext;
+        AZStd::unique_ptr<Factory> m_rootFactory;
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> m_layout;
+        AZStd::vector<RHI::Ptr<RHI::ShaderResourceGroupPool>> m_pools;
+        AZStd::vector<RHI::ShaderResourceGroupPool*> m_poolsToCompile;
+        AZStd::vector<RHI::Ptr<RHI::ShaderResourceGroup>> m_groups;
+        AZStd::vector<RHI::ShaderResourceGroupData> m_groupData;
+        AZStd::vector<RHI::ShaderResourceGroupCompileBatch> m_batches;
+    };
+
+    BENCHMARK_F(ShaderResourceGroupCompileBenchmarkFixture, QueueForCompile_Jobs)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            QueueGroups();
+
+            state.PauseTiming();
+            for (RHI::ShaderResourceGroupPool* srgPool : m_poolsToCompile)
+            {
+                srgPool->CompileGroupsBegin();
+                srgPool->CompileGroupsForInterval(RHI::Interval(0, srgPool->GetGroupsToCompileCount()));
+                srgPool->CompileGroupsEnd();
+            }
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_groups.size());
+    }
+
+    BENCHMARK_F(ShaderResourceGroupCompileBenchmarkFixture, Compile_PerPool)(benchmark::State& state)
+    {
+        RunCompileBenchmark(state, false);
+    }
+
+    BENCHMARK_F(ShaderResourceGroupCompileBenchmarkFixture, Compile_Balanced)(benchmark::State& state)
+    {
+        RunCompileBenchmark(state, true);
+    }
+} // namespace UnitTest
+#endif
@@ -21,6 +21,7 @@
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -222,6 +223,149 @@ namespace UnitTest
             RHI::Ptr<RHI::ShaderResourceGroup> noopShaderResourceGroup = RHI::Factory::Get().CreateShaderResourceGroup();
         }
 
+        void TestShaderResourceGroupCompileQueue()
+        {
+            RHI::Ptr<RHI::Device> device = MakeTestDevice();
+
+            RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+            // The pools have very different numbers of groups, like the per draw and per material pools of a scene.
+            const uint32_t groupCounts[] = { 600, 5, 300 };
+            const uint32_t poolCount = AZ_ARRAY_SIZE(groupCounts);
+
+            AZStd::vector<RHI::Ptr<RHI::ShaderResourceGroupPool>> srgPools;
+            AZStd::vector<AZStd::vector<RHI::Ptr<RHI::ShaderResourceGroup>>> srgs(poolCount);
+            for (uint32_t poolIndex = 0; poolIndex < poolCount; ++poolIndex)
+            {
+                RHI::ShaderResourceGroupPoolDescriptor descriptor;
+                descriptor.m_layout = srgLayout.get();
+
+                RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+                srgPool->Init(*device, descriptor);
+                srgPools.push_back(srgPool);
+
+                for (uint32_t i = 0; i < groupCounts[poolIndex]; ++i)
+                {
+                    RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+                    srgPool->InitGroup(*srg);
+                    srgs[poolIndex].push_back(srg);
+                }
+            }
+
+            // Queue the groups of the first pool from several threads at once.
+            const uint32_t threadCount = 4;
+            AZStd::vector<AZStd::thread> threads;
+            for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                threads.emplace_back([&srgs, threadIndex]()
+                {
+                    for (size_t i = threadIndex; i < srgs[0].size(); i += threadCount)
+                    {
+                        srgs[0][i]->Compile(RHI::ShaderResourceGroupData(*srgs[0][i]));
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (uint32_t poolIndex = 1; poolIndex < poolCount; ++poolIndex)
+            {
+                for (RHI::Ptr<RHI::ShaderResourceGroup>& srg : srgs[poolIndex])
+                {
+                    srg->Compile(RHI::ShaderResourceGroupData(*srg));
+                }
+            }
+
+            for (uint32_t poolIndex = 0; poolIndex < poolCount; ++poolIndex)
+            {
+                EXPECT_EQ(srgPools[poolIndex]->GetQueuedGroupsCount(), groupCounts[poolIndex]);
+            }
+
+            // Shutting down a queued group removes it from the compile queue.
+            srgs[0][300]->Shutdown();
+            EXPECT_FALSE(srgs[0][300]->IsQueuedForCompile());
+            EXPECT_EQ(srgPools[0]->GetQueuedGroupsCount(), groupCounts[0] - 1);
+
+            RHI::Ptr<RHI::ShaderResourceGroup> lateSrg = RHI::Factory::Get().CreateShaderResourceGroup();
+            srgPools[2]->InitGroup(*lateSrg);
+
+            AZStd::vector<RHI::ShaderResourceGroupPool*> poolsToCompile;
+            for (RHI::Ptr<RHI::ShaderResourceGroupPool>& srgPool : srgPools)
+            {
+                srgPool->CompileGroupsBegin();
+                poolsToCompile.push_back(srgPool.get());
+            }
+
+            EXPECT_EQ(srgPools[0]->GetGroupsToCompileCount(), groupCounts[0] - 1);
+            EXPECT_EQ(srgPools[1]->GetGroupsToCompileCount(), groupCounts[1]);
+            EXPECT_EQ(srgPools[2]->GetGroupsToCompileCount(), groupCounts[2]);
+            EXPECT_EQ(srgPools[0]->GetQueuedGroupsCount(), 0);
+
+            // Queuing does not wait for the compile of the pool, the group is queued for the next compile.
+            AZStd::thread lateThread([&lateSrg]()
+            {
+                lateSrg->Compile(RHI::ShaderResourceGroupData(*lateSrg));
+            });
+            lateThread.join();
+            EXPECT_TRUE(lateSrg->IsQueuedForCompile());
+            EXPECT_EQ(srgPools[2]->GetQueuedGroupsCount(), 1);
+            EXPECT_EQ(srgPools[2]->GetGroupsToCompileCount(), groupCounts[2]);
+
+            const uint32_t compilesPerBatch = 256;
+            const uint32_t compileCount = groupCounts[0] - 1 + groupCounts[1] + groupCounts[2];
+            AZStd::vector<RHI::ShaderResourceGroupCompileBatch> batches;
+            RHI::PartitionShaderResourceGroupCompiles(poolsToCompile, compilesPerBatch, batches);
+
+            // The fewest batches that respect the limit, filled evenly.
+            ASSERT_EQ(batches.size(), RHI::DivideByMultiple(compileCount, compilesPerBatch));
+            AZStd::vector<uint32_t> nextCompileIndices(poolCount, 0);
+            for (const RHI::ShaderResourceGroupCompileBatch& batch : batches)
+            {
+                EXPECT_LE(batch.m_compileCount, compilesPerBatch);
+                EXPECT_GE(batch.m_compileCount, compileCount / batches.size());
+
+                uint32_t batchCompileCount = 0;
+                for (const RHI::ShaderResourceGroupCompileBatch::PoolInterval& poolInterval : batch.m_poolIntervals)
+                {
+                    const size_t poolIndex = AZStd::distance(poolsToCompile.begin(), AZStd::find(poolsToCompile.begin(), poolsToCompile.end(), poolInterval.m_pool));
+                    ASSERT_LT(poolIndex, poolCount);
+
+                    // The intervals of a pool are contiguous and in order across the batches.
+                    EXPECT_EQ(poolInterval.m_interval.m_min, nextCompileIndices[poolIndex]);
+                    EXPECT_GT(poolInterval.m_interval.m_max, poolInterval.m_interval.m_min);
+                    nextCompileIndices[poolIndex] = poolInterval.m_interval.m_max;
+                    batchCompileCount += poolInterval.m_interval.m_max - poolInterval.m_interval.m_min;
+
+                    poolInterval.m_pool->CompileGroupsForInterval(poolInterval.m_interval);
+                }
+                EXPECT_EQ(batchCompileCount, batch.m_compileCount);
+            }
+
+            for (uint32_t poolIndex = 0; poolIndex < poolCount; ++poolIndex)
+            {
+                EXPECT_EQ(nextCompileIndices[poolIndex], srgPools[poolIndex]->GetGroupsToCompileCount());
+                srgPools[poolIndex]->CompileGroupsEnd();
+
+                for (RHI::Ptr<RHI::ShaderResourceGroup>& srg : srgs[poolIndex])
+                {
+                    EXPECT_FALSE(srg->IsQueuedForCompile());
+                }
+            }
+
+            EXPECT_TRUE(lateSrg->IsQueuedForCompile());
+
+            // Groups can be queued again after the compile.
+            srgs[2][0]->Compile(RHI::ShaderResourceGroupData(*srgs[2][0]));
+            EXPECT_TRUE(srgs[2][0]->IsQueuedForCompile());
+            EXPECT_EQ(srgPools[2]->GetQueuedGroupsCount(), 2);
+
+            lateSrg = nullptr;
+            srgs.clear();
+            srgPools.clear();
+        }
+
         void TestShaderResourceGroupReflection(const RHI::ConstPtr<RHI::ShaderResourceGroupLayout>& srgLayout)
         {
             EXPECT_EQ(srgLayout->GetGroupSizeForImages(), ImageReadCount + ImageReadWriteCount);
@@ -636,6 +780,11 @@ namespace UnitTest
         TestShaderResourceGroupPools();
     }
 
+    TEST_F(ShaderResourceGroupTests, TestShaderResourceGroupCompileQueue)
+    {
+        TestShaderResourceGroupCompileQueue();
+    }
+
 
     TEST_F(ShaderResourceGroupTests, SRGDataSetConstant_Vectors_ValidOutput)
     {
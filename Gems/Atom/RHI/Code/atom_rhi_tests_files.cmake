@@ -10,6 +10,9 @@ set(FILES
     Tests/RHITestFixture.h
     Tests/AllocatorTests.cpp
     Tests/BufferTests.cpp
+    Tests/DrawListBenchmarks.cpp
+    Tests/FrameGraphBenchmarks.cpp
+    Tests/ShaderResourceGroupCompileBenchmarks.cpp
     Tests/DrawPacketTests.cpp
     Tests/FrameGraphTests.cpp
     Tests/FrameSchedulerTests.cpp
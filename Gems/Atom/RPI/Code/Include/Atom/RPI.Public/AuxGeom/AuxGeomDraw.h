@@ -100,7 +100,14 @@ namespace AZ
 
             /////////////////////////////////////////////////////////////////////////////////////////////
             // manual override of the view projection transform
+
+            //! Adds a view projection override for the draws of the calling thread and returns its index.
+            //! Each thread records its draws separately, so the index is only valid for draws on the thread that added the
+            //! override, until the draws of the frame are committed. Don't cache the index and pass it to draws on another thread.
             virtual int32_t AddViewProjOverride(const AZ::Matrix4x4& viewProj) = 0;
+
+            //! Returns the index of the 2d view projection override of the calling thread, adding it for the first request of
+            //! the frame. Like AddViewProjOverride, the index is only valid for draws on the calling thread in the current frame.
             virtual int32_t GetOrAdd2DViewProjOverride() = 0;
             /////////////////////////////////////////////////////////////////////////////////////////////
             // control point size for fixed shapes
@@ -46,6 +46,7 @@ namespace AZ
 
     namespace RPI
     {
+        class Model;
         class Scene;
 
         struct Cullable
@@ -104,6 +105,9 @@ namespace AZ
                 float m_lodSelectionRadius = 1.0f;
 
                 LodConfiguration m_lodConfiguration;
+
+                //! The model of the lods, if its lods are streamed. The culling requests the lods it selects from the model.
+                Model* m_streamedModel = nullptr;
             };
             LodData m_lodData;
 
@@ -176,6 +180,23 @@ namespace AZ
                     m_numJobs = 0;
                     m_numVisibleCullables = 0;
                     m_numVisibleDrawPackets = 0;
+                    m_numTestedCullables = 0;
+                    m_numCulledCullables = 0;
+                    m_cullTimeMicroseconds = 0;
+                }
+
+                //! Returns the number of cullables that had their bounds tested per microsecond of cull job time.
+                float GetTestedCullablesPerMicrosecond() const
+                {
+                    const uint64_t cullTime = m_cullTimeMicroseconds;
+                    return cullTime > 0 ? static_cast<float>(m_numTestedCullables) / static_cast<float>(cullTime) : 0.0f;
+                }
+
+                //! Returns the number of cullables that were culled per microsecond of cull job time.
+                float GetCulledCullablesPerMicrosecond() const
+                {
+                    const uint64_t cullTime = m_cullTimeMicroseconds;
+                    return cullTime > 0 ? static_cast<float>(m_numCulledCullables) / static_cast<float>(cullTime) : 0.0f;
                 }
 
                 AZ::Name m_name;
@@ -183,6 +204,12 @@ namespace AZ
                 AZStd::atomic_uint32_t m_numJobs = 0;
                 AZStd::atomic_uint32_t m_numVisibleCullables = 0;
                 AZStd::atomic_uint32_t m_numVisibleDrawPackets = 0;
+                //! Cullables in partially visible nodes, which had their bounds tested against the frustum
+                AZStd::atomic_uint32_t m_numTestedCullables = 0;
+                //! Cullables rejected by the frustum or occlusion tests
+                AZStd::atomic_uint32_t m_numCulledCullables = 0;
+                //! Summed time spent in the cull jobs of this view, across all worker threads
+                AZStd::atomic_uint64_t m_cullTimeMicroseconds = 0;
             };
 
             CullingDebugContext() = default;
@@ -215,6 +242,62 @@ namespace AZ
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
 
+        //! Same as above, using a screen coverage that was already calculated with ModelLodUtils::ApproxScreenPercentage()
+        //! or ApproxScreenPercentages().
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view);
+
+        //! Requests the lod that would be selected for an object that covers lodSelectionMargin times more of the screen
+        //! from the streamed model of the lod data. Does nothing if the lods aren't streamed.
+        void RequestStreamedLod(const Cullable::LodData& lodData, float approxScreenPercentage, float lodSelectionMargin);
+
+        //! The bounds of a block of cullables in structure-of-arrays layout, so the frustum tests and the lod selection
+        //! can process four cullables at a time. The cull jobs gather the cullables of each visibility node into blocks,
+        //! which reads the scattered Cullable data only once per view.
+        struct CullableBlock
+        {
+            static constexpr uint32_t Capacity = 64;
+            static_assert(Capacity % 4 == 0, "The block is processed four cullables at a time");
+
+            void Add(Cullable* cullable, AzFramework::VisibilityEntry* visibilityEntry)
+            {
+                AZ_Assert(m_count < Capacity, "CullableBlock is full");
+                const Vector3& center = cullable->m_cullData.m_boundingSphere.GetCenter();
+                m_centerX[m_count] = center.GetX();
+                m_centerY[m_count] = center.GetY();
+                m_centerZ[m_count] = center.GetZ();
+                m_radius[m_count] = cullable->m_cullData.m_boundingSphere.GetRadius();
+                m_lodSelectionRadius[m_count] = cullable->m_lodData.m_lodSelectionRadius;
+                m_cullables[m_count] = cullable;
+                m_visibilityEntries[m_count] = visibilityEntry;
+                ++m_count;
+            }
+
+            bool IsFull() const { return m_count == Capacity; }
+            void Clear() { m_count = 0; }
+
+            // Bounding spheres and lod selection radii. The arrays are padded to a multiple of four entries and
+            // zero initialized, so the lanes past m_count always hold valid floats.
+            alignas(16) float m_centerX[Capacity] = {};
+            alignas(16) float m_centerY[Capacity] = {};
+            alignas(16) float m_centerZ[Capacity] = {};
+            alignas(16) float m_radius[Capacity] = {};
+            alignas(16) float m_lodSelectionRadius[Capacity] = {};
+
+            Cullable* m_cullables[Capacity];
+            AzFramework::VisibilityEntry* m_visibilityEntries[Capacity];
+            uint32_t m_count = 0;
+        };
+
+        //! Classifies the bounding spheres of the cullables in the block against the frustum, four at a time.
+        //! Gives the same results as ShapeIntersection::Classify() on each bounding sphere.
+        //! @param results Receives one result per cullable in the block.
+        void ClassifyBoundingSpheres(const Frustum& frustum, const CullableBlock& block, IntersectResult* results);
+
+        //! Calculates the approximate screen coverage of the lod selection spheres of the cullables in the block, four at a time.
+        //! Gives the same results as ModelLodUtils::ApproxScreenPercentage() on each cullable.
+        //! @param results Receives one screen percentage per cullable in the block.
+        void ApproxScreenPercentages(const CullableBlock& block, const Vector3& cameraPos, float yScale, bool isPerspective, float* results);
+
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
         //! access the CullingScene via their parent Scene.
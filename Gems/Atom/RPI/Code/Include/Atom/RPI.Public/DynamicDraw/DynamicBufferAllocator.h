@@ -16,6 +16,8 @@
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
 
+#include <AzCore/std/parallel/atomic.h>
+
 
 namespace AZ
 {
@@ -29,6 +31,7 @@ namespace AZ
         //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
         //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
         //!     to increase the ring buffer's size. 
+        //! Allocate is lock free and may be called from any thread. FrameEnd must not be called concurrently with itself.
         class DynamicBufferAllocator
         {
             AZ_RTTI(AZ::RPI::DynamicBufferAllocator, "{82B047B3-C845-4F77-9852-747E39C53081}");
@@ -63,12 +66,16 @@ namespace AZ
             // Get buffer's offset;
             uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
 
-            // The position where the buffer is available.
-            uint32_t m_currentPosition = 0;
+            // Pack and unpack the allocation state
+            static uint64_t PackAllocationState(uint32_t currentPosition, uint32_t currentAllocatedSize);
+            static uint32_t GetCurrentPosition(uint64_t allocationState);
+            static uint32_t GetCurrentAllocatedSize(uint64_t allocationState);
+
+            // The position where the buffer is available in the upper 32 bits, and the allocated buffer size of current frame
+            // in the lower 32 bits. They are packed so allocations can update both with a single compare and swap.
+            AZStd::atomic_uint64_t m_allocationState{ 0 };
             // The upper bound limit of the allocation of current frame 
-            uint32_t m_endPositionLimit = 0;
-            // The allocated buffer size of current frame
-            uint32_t m_currentAllocatedSize = 0;
+            AZStd::atomic_uint32_t m_endPositionLimit{ 0 };
 
             uint32_t m_ringBufferSize = 0;
             void* m_ringBufferStartAddress = 0;
@@ -26,6 +26,8 @@
 
 namespace AZ
 {
+    class TaskGraph;
+
     namespace RPI
     {
         //! @class FeatureProcessor
@@ -100,6 +102,13 @@ namespace AZ
             //!  - This may be called in parallel with other feature processors.
             virtual void Simulate(const SimulatePacket&) {}
 
+            //! Adds the tasks of the simulation to the scene's simulation task graph, used instead of Simulate() when the
+            //! task graph is active. The default adds a single task that calls Simulate(). Feature processors that split
+            //! their simulation in parallel work override this to add that work as tasks, since a task can't wait for
+            //! another task graph.
+            //!  - The packet and the feature processor outlive the tasks.
+            virtual void AddSimulateTasks(AZ::TaskGraph& simulateTaskGraph, const SimulatePacket& packet);
+
             //! The feature processor should enqueue draw packets to relevant draw lists.
             //! 
             //!  - This is called every frame.
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/BudgetedStreamingImageControllerAsset.h>
+
+#include <Atom/RPI.Public/Image/StreamingImageController.h>
+#include <Atom/RPI.Public/Image/StreamingImageContext.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Memory and residency counters of a BudgetedStreamingImageController, refreshed every update.
+        struct StreamingImageBudgetStats
+        {
+            //! The memory budget of the streamed mips in bytes, or 0 if the budget is unlimited.
+            size_t m_budgetInBytes = 0;
+
+            //! Memory of the mips that are resident on the GPU, in bytes. Expansions queued by the update are only
+            //! counted once they are uploaded.
+            size_t m_residentBytes = 0;
+
+            //! Memory of the mips that are resident or being streamed in, in bytes. This only exceeds the budget
+            //! when the mip chain tails of the images don't fit in it.
+            size_t m_committedBytes = 0;
+
+            //! Number of streamable images attached to the controller.
+            uint32_t m_imageCount = 0;
+
+            //! Number of images whose requested mip chain is resident or being streamed in.
+            uint32_t m_imagesAtTargetCount = 0;
+
+            //! Number of images that were expanded and trimmed in the last update.
+            uint32_t m_expandCount = 0;
+            uint32_t m_trimCount = 0;
+        };
+
+        //! A streaming image controller that keeps the mips of its images within a memory budget.
+        //!
+        //! Every update, the images are ranked by priority and the budget is handed out in that order. Images that
+        //! requested a mip with StreamingImage::SetTargetMip since the last update come first, the most detailed request
+        //! (the largest on screen) first and the most recently used next. Images that never requested a mip follow and
+        //! want their most detailed mip chain, like with the DefaultStreamingImageController. Images that were not used
+        //! since the last update come last and only keep the mips they already have while there is budget left. When
+        //! the budget runs out, the mips of the lowest priority images are evicted first.
+        //!
+        //! The mip chain tails are always resident and count against the budget.
+        class BudgetedStreamingImageController final
+            : public StreamingImageController
+        {
+            friend class ImageSystem;
+        public:
+            AZ_RTTI(BudgetedStreamingImageController, "{CAB61027-9938-4952-8AF5-A4D0D8F05BCA}", StreamingImageController)
+
+            //! Overrides the memory budget of the controller asset, in bytes. A budget of 0 uses the budget of the
+            //! streaming image pool, and no budget on either means the budget is unlimited. Applies from the next update.
+            void SetMemoryBudget(size_t budgetInBytes);
+
+            //! Returns the counters of the last update.
+            StreamingImageBudgetStats GetBudgetStats() const;
+
+        private:
+            // Standard init for InstanceData subclass
+            BudgetedStreamingImageController() = default;
+            static Data::Instance<BudgetedStreamingImageController> CreateInternal(Data::AssetData* assetData);
+            RHI::ResultCode Init(BudgetedStreamingImageControllerAsset& imageControllerAsset);
+
+            ///////////////////////////////////////////////////////////////////
+            // StreamingImageController Overrides
+            StreamingImageContextPtr CreateContextInternal() override;
+            void UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts) override;
+            ///////////////////////////////////////////////////////////////////
+
+            size_t GetEffectiveMemoryBudget() const;
+
+            class BudgetedStreamingImageContext;
+
+            struct ImageEntry
+            {
+                BudgetedStreamingImageContext* m_context = nullptr;
+                StreamingImage* m_image = nullptr;
+                uint32_t m_priorityClass = 0;
+                uint16_t m_targetMipLevel = 0;
+                size_t m_lastAccessTimestamp = 0;
+                size_t m_wantedMipChain = 0;
+                size_t m_committedMipChain = 0;
+                size_t m_allocatedMipChain = 0;
+            };
+
+            // Scratch list of the streamable images, reused every update.
+            AZStd::vector<ImageEntry> m_imageEntries;
+
+            AZStd::atomic_size_t m_memoryBudgetInBytes = {0};
+            uint32_t m_maxExpandsPerUpdate = 0;
+
+            mutable AZStd::mutex m_statsMutex;
+            StreamingImageBudgetStats m_stats;
+        };
+    }
+}
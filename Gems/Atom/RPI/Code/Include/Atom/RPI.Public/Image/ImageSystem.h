@@ -16,6 +16,7 @@
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Reflect/Asset/BuiltInAssetHandler.h>
+#include <Atom/RPI.Reflect/Image/BudgetedStreamingImageControllerAsset.h>
 #include <Atom/RPI.Reflect/Image/DefaultStreamingImageControllerAsset.h>
 #include <Atom/RPI.Reflect/Image/ImageSystemDescriptor.h>
 
@@ -74,6 +75,7 @@ namespace AZ
             Data::Instance<StreamingImagePool> m_assetStreamingPool;
 
             Data::Asset<DefaultStreamingImageControllerAsset> m_defaultStreamingImageControllerAsset;
+            Data::Asset<BudgetedStreamingImageControllerAsset> m_budgetedStreamingImageControllerAsset;
 
             AZStd::fixed_vector<Data::Instance<Image>, static_cast<uint32_t>(SystemImage::Count)> m_systemImages;
 
@@ -28,6 +28,7 @@ namespace AZ
     namespace RPI
     {
         class StreamingImage;
+        class StreamingImageAsset;
 
         class StreamingImageController
             : public Data::InstanceData
@@ -69,6 +70,11 @@ namespace AZ
             void QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
             void TrimToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
 
+            //! Streaming image state used for budgeting by derived StreamingImageController classes
+            static const StreamingImageAsset& GetImageAsset(const StreamingImage* image);
+            static size_t GetStreamingTargetMipChain(const StreamingImage* image);
+            const RHI::StreamingImagePool* GetRHIPool() const;
+
         private:
 
             ///////////////////////////////////////////////////////////////////
@@ -51,6 +51,11 @@ namespace AZ
 
             const RHI::StreamingImagePool* GetRHIPool() const;
 
+            //! Returns the streaming controller of the pool.
+            StreamingImageController* GetController();
+
+            const StreamingImageController* GetController() const;
+
         private:
             StreamingImagePool() = default;
 
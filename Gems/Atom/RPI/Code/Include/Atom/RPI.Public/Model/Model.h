@@ -17,8 +17,10 @@
 
 #include <AtomCore/Instance/InstanceData.h>
 
+#include <AzCore/EBus/Event.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -30,6 +32,7 @@ namespace AZ
             : public Data::InstanceData
         {
             friend class ModelSystem;
+            friend class ModelLodStreamingController;
 
         public:
             AZ_INSTANCE_DATA(Model, "{C30F5522-B381-4B38-BBAF-6E0B1885C8B9}");
@@ -41,7 +44,10 @@ namespace AZ
             //! This is a temporary function, that will be removed once the Model/ModelAsset classes no longer need it
             static void TEMPOrphanFromDatabase(const Data::Asset<ModelAsset>& modelAsset);
 
-            ~Model() = default;
+            //! Signaled when lods of a streamed model were made resident or evicted.
+            using LodResidencyChangedEvent = Event<>;
+
+            ~Model();
 
             //! Blocks the CPU until the streaming upload is complete. Returns immediately if no
             //! streaming upload is currently pending.
@@ -51,8 +57,26 @@ namespace AZ
             size_t GetLodCount() const;
 
             //! Returns the full list of Lods, where index 0 is the most detailed, and N-1 is the least.
+            //! The lods of a streamed model that are not resident are null.
             AZStd::array_view<Data::Instance<ModelLod>> GetLods() const;
 
+            //! Returns whether the lods of the model are streamed by the ModelLodStreamingInterface. Streamed models only
+            //! keep the lods the culling selects resident. The least detailed lod is always resident.
+            bool IsLodStreamed() const;
+
+            //! Returns whether the lod is resident. All lods are resident unless the model is streamed.
+            bool IsLodResident(size_t lodIndex) const;
+
+            //! Returns lodIndex if the lod is resident, or else the next less detailed lod that is resident.
+            size_t GetResidentLodIndex(size_t lodIndex) const;
+
+            //! Requests the lod and all less detailed lods of a streamed model to be resident. The culling calls this
+            //! for the lods it selects. Can be called from any thread.
+            void RequestLod(size_t lodIndex);
+
+            //! Connects a handler that is signaled when lods of the model were made resident or evicted.
+            void ConnectLodResidencyChangedHandler(LodResidencyChangedEvent::Handler& handler);
+
             //! Returns whether a buffer upload is pending.
             bool IsUploadPending() const;
 
@@ -99,9 +123,48 @@ namespace AZ
             static Data::Instance<Model> CreateInternal(const Data::Asset<ModelAsset>& modelAsset);
             RHI::ResultCode Init(const Data::Asset<ModelAsset>& modelAsset);
 
+            //! Creates the lod instance from its asset, and adds the names of its uv streams.
+            Data::Instance<ModelLod> CreateLod(size_t lodIndex);
+
+            // Lod streaming, used by the ModelLodStreamingController...
+
+            //! Returns the most detailed lod requested since the last call, or InvalidLodIndex if no lod was requested.
+            size_t TakeRequestedLod();
+
+            //! Returns the most detailed resident lod. All less detailed lods are resident as well.
+            size_t GetMostDetailedResidentLod() const;
+
+            //! Queues the load of the lod asset with the asset manager. Returns true once the asset is ready.
+            bool LoadLodAsset(size_t lodIndex);
+
+            //! Returns whether the lod asset failed to load.
+            bool IsLodAssetError(size_t lodIndex) const;
+
+            //! Returns the memory of the buffers of the lod in bytes, or 0 while the lod asset isn't loaded.
+            size_t GetLodByteCount(size_t lodIndex);
+
+            //! Makes the lod and all less detailed lods resident, and evicts the more detailed lods. The assets of the
+            //! lods that are made resident must be ready. The change is signaled separately with SignalLodResidencyChanged,
+            //! since the handlers may create or release models while the controller still iterates them.
+            void SetMostDetailedResidentLod(size_t lodIndex);
+
+            //! Signals the handlers connected with ConnectLodResidencyChangedHandler.
+            void SignalLodResidencyChanged();
+
+            static constexpr size_t InvalidLodIndex = static_cast<size_t>(-1);
+
             AZStd::fixed_vector<Data::Instance<ModelLod>, ModelLodAsset::LodCountMax> m_lods;
             Data::Asset<ModelAsset> m_modelAsset;
 
+            //! The lod assets of a streamed model, which are loaded with the asset manager when the lods are requested and
+            //! released when they are evicted.
+            AZStd::fixed_vector<Data::Asset<ModelLodAsset>, ModelLodAsset::LodCountMax> m_streamedLodAssets;
+            AZStd::fixed_vector<size_t, ModelLodAsset::LodCountMax> m_lodByteCounts;
+            bool m_isLodStreamed = false;
+            size_t m_mostDetailedResidentLod = 0;
+            AZStd::atomic_size_t m_requestedLod{ InvalidLodIndex };
+            LodResidencyChangedEvent m_lodResidencyChangedEvent;
+
             AZStd::unordered_set<AZ::Name> m_uvNames;
 
             // Tracks whether buffers have all been streamed up to the GPU.
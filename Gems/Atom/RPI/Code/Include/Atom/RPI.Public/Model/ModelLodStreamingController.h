@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Model/ModelLodStreamingInterface.h>
+#include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
+
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Streams the lods of the models that were created while lod streaming was enabled.
+        //!
+        //! Every update, the models are ranked by priority and the memory budget is handed out in that order, the same way
+        //! the BudgetedStreamingImageController hands out the budget of the image mips. Models whose lods the culling
+        //! requested within the eviction delay come first, the ones that requested the most detailed lod first. Their
+        //! wanted lod is the one they requested, the other models only want their least detailed lod. When the budget runs
+        //! out, the lods of the lowest priority models are evicted first.
+        //!
+        //! The resident lods of a model are always contiguous: a resident lod implies all the less detailed lods are
+        //! resident as well. The least detailed lod is always resident and counts against the budget.
+        class ModelLodStreamingController final
+            : public ModelLodStreamingInterface
+        {
+        public:
+            ModelLodStreamingController() = default;
+
+            void Init();
+            void Shutdown();
+
+            // ModelLodStreamingInterface overrides...
+            void SetConfiguration(const ModelLodStreamingConfiguration& configuration) override;
+            ModelLodStreamingConfiguration GetConfiguration() const override;
+            ModelLodStreamingStats GetStats() const override;
+            void Update() override;
+            void RegisterModel(Model& model) override;
+            void UnregisterModel(Model& model) override;
+
+        private:
+            struct ModelEntry
+            {
+                //! The most detailed lod the culling requested, and the update it was last requested in.
+                size_t m_requestedLod = 0;
+                size_t m_requestUpdateIndex = 0;
+                bool m_wasRequested = false;
+
+                // Scratch data of the current update...
+                bool m_isRequested = false;
+                size_t m_wantedLod = 0;
+                size_t m_residentLod = 0;
+                size_t m_allocatedLod = 0;
+
+                //! The memory of each lod and all less detailed lods, in bytes.
+                AZStd::fixed_vector<size_t, ModelLodAsset::LodCountMax + 1> m_lodTailBytes;
+            };
+
+            //! Expands the resident lods of the model up to the allocated lod, as far as the lod assets are loaded.
+            //! Returns whether the model was expanded.
+            static bool ExpandModel(Model& model, ModelEntry& entry, uint32_t& pendingLodLoadCount);
+
+            mutable AZStd::recursive_mutex m_mutex;
+            ModelLodStreamingConfiguration m_configuration;
+            ModelLodStreamingStats m_stats;
+
+            AZStd::unordered_map<Model*, ModelEntry> m_modelEntries;
+
+            //! Scratch list of the models in priority order, reused every update.
+            AZStd::vector<AZStd::pair<Model*, ModelEntry*>> m_prioritizedEntries;
+
+            //! Scratch list of the models whose resident lods changed in the current update. They're signaled after the
+            //! update is done with m_prioritizedEntries, because the handlers may release models.
+            AZStd::vector<Model*> m_residencyChangedModels;
+
+            size_t m_updateIndex = 0;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Model;
+
+        //! Settings of the model lod streaming.
+        struct ModelLodStreamingConfiguration
+        {
+            //! Models created while lod streaming is enabled only keep the lods they need resident. Models that were
+            //! created before keep all their lods resident.
+            bool m_enabled = false;
+
+            //! The memory budget of the buffers of the resident lods, in bytes. A budget of 0 means unlimited.
+            size_t m_memoryBudgetInBytes = 0;
+
+            //! The culling requests the lods it would select if objects covered this much more of the screen, so the
+            //! more detailed lods are streamed in before they're needed.
+            float m_lodSelectionMargin = 1.5f;
+
+            //! Number of updates the lods of a model stay resident after the culling last requested them.
+            uint32_t m_evictionDelayInUpdates = 60;
+
+            //! Maximum number of models whose resident lods are expanded per update.
+            uint32_t m_maxExpandsPerUpdate = 32;
+        };
+
+        //! Memory and residency counters of the model lod streaming, refreshed every update.
+        struct ModelLodStreamingStats
+        {
+            //! The memory budget of the resident lods in bytes, or 0 if the budget is unlimited.
+            size_t m_budgetInBytes = 0;
+
+            //! Memory of the buffers of the resident lods, in bytes. Only exceeds the budget when the least detailed lods
+            //! of the models don't fit in it.
+            size_t m_residentBytes = 0;
+
+            //! Number of streamed models, and their total and resident lods.
+            uint32_t m_modelCount = 0;
+            uint32_t m_lodCount = 0;
+            uint32_t m_residentLodCount = 0;
+
+            //! Number of models whose requested lods are all resident.
+            uint32_t m_modelsAtTargetCount = 0;
+
+            //! Number of lod assets that are being loaded by the asset manager.
+            uint32_t m_pendingLodLoadCount = 0;
+
+            //! Number of models that were expanded and trimmed in the last update.
+            uint32_t m_expandCount = 0;
+            uint32_t m_trimCount = 0;
+        };
+
+        //! Streams the lods of models based on the lods the culling selects, within a memory budget.
+        class ModelLodStreamingInterface
+        {
+        public:
+            AZ_RTTI(ModelLodStreamingInterface, "{12BF24A4-1A74-4C28-9949-AD987FABF5BB}");
+
+            ModelLodStreamingInterface() = default;
+            virtual ~ModelLodStreamingInterface() = default;
+
+            // Note that you have to delete these for safety reasons, you will trip a static_assert if you do not
+            AZ_DISABLE_COPY_MOVE(ModelLodStreamingInterface);
+
+            static ModelLodStreamingInterface* Get();
+
+            //! Changes the settings. Enabling or disabling the streaming only applies to models created afterwards.
+            virtual void SetConfiguration(const ModelLodStreamingConfiguration& configuration) = 0;
+            virtual ModelLodStreamingConfiguration GetConfiguration() const = 0;
+
+            //! Returns the counters of the last update.
+            virtual ModelLodStreamingStats GetStats() const = 0;
+
+            //! Loads and evicts lods based on the lods requested since the last update.
+            virtual void Update() = 0;
+
+            //! Called by streamed models when they are created and destroyed.
+            virtual void RegisterModel(Model& model) = 0;
+            virtual void UnregisterModel(Model& model) = 0;
+        };
+    } // namespace RPI
+} // namespace AZ
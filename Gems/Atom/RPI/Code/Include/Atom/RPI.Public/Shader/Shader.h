@@ -9,6 +9,7 @@
 
 #include <Atom/RPI.Public/Shader/ShaderVariant.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantLookupCache.h>
 
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
@@ -94,8 +95,13 @@ namespace AZ
             /// of the root variant.
             /// Callers should listen to ShaderReloadNotificationBus to get notified whenever the exact
             /// variant is loaded and available or if a variant changes, etc.
+            /// Results are cached per ShaderVariantId once the shader variant tree is loaded, so repeated
+            /// calls with the same ShaderVariantId don't search the tree again.
             ShaderVariantSearchResult FindVariantStableId(const ShaderVariantId& shaderVariantId) const;
 
+            /// Returns the FindVariantStableId() counters of this shader.
+            ShaderVariantLookupStats GetVariantLookupStats() const;
+
             /// Returns the variant associated with the provided StableId.
             /// You should call FindVariantStableId() which caches the variant, later
             /// when this function is called the variant is fetched from a local map.
@@ -162,7 +168,7 @@ namespace AZ
 
             ///////////////////////////////////////////////////////////////////
             /// ShaderVariantFinderNotificationBus overrides
-            void OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> /*shaderVariantTreeAsset*/, bool /*isError*/) override {};
+            void OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset, bool isError) override;
             void OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> shaderVariantAsset, bool IsError) override;
             ///////////////////////////////////////////////////////////////////
             
@@ -194,6 +200,9 @@ namespace AZ
             //! Used for thread safety for FindVariantStableId() and GetVariant().
             AZStd::shared_mutex m_variantCacheMutex;
 
+            //! Caches the results of FindVariantStableId(). Invalidated when the shader or its variant tree is reloaded.
+            mutable ShaderVariantLookupCache m_variantLookupCache;
+
             //! The root variant always exist.
             ShaderVariant m_rootVariant;
 
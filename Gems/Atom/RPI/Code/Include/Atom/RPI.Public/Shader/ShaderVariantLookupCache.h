@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Counters of a ShaderVariantLookupCache, accumulated since the cache was created.
+        struct ShaderVariantLookupStats
+        {
+            //! Number of ShaderVariantId lookups.
+            uint64_t m_lookupCount = 0;
+
+            //! Number of lookups answered by the cache, without searching the shader variant tree.
+            uint64_t m_hitCount = 0;
+
+            //! Number of shader variant tree searches and their accumulated CPU time, in nanoseconds.
+            uint64_t m_treeSearchCount = 0;
+            uint64_t m_treeSearchTimeNanoseconds = 0;
+        };
+
+        //! Caches the results of shader variant tree searches, so repeated lookups of the same ShaderVariantId are O(1).
+        //!
+        //! The cache is a fixed size table of slots that is indexed by the hash of the ShaderVariantId. A new entry replaces
+        //! the previous entry of its slot. Readers and writers never block: each slot is guarded by a sequence number, a
+        //! reader that races with a writer sees a miss, and a writer that races with another writer drops its entry.
+        //!
+        //! Invalidate() discards all entries by advancing the generation of the cache, so it's safe to call while other
+        //! threads look up variants. Results of searches that started before an invalidation are dropped as well, as long
+        //! as the caller passes the generation that was current when the search started.
+        class ShaderVariantLookupCache final
+        {
+        public:
+            //! Number of slots in the cache, must be a power of two. A shader rarely has more than a few dozen variants in use.
+            static constexpr uint32_t SlotCount = 256;
+
+            ShaderVariantLookupCache() = default;
+            AZ_DISABLE_COPY_MOVE(ShaderVariantLookupCache);
+
+            //! Returns the current generation, which must be passed to Insert.
+            uint32_t GetGeneration() const;
+
+            //! Finds the cached search result of the ShaderVariantId. Returns false on a miss.
+            bool Find(const ShaderVariantId& shaderVariantId, ShaderVariantSearchResult& searchResult) const;
+
+            //! Caches the search result of the ShaderVariantId. The result is dropped if the cache was invalidated since
+            //! the generation was acquired.
+            void Insert(const ShaderVariantId& shaderVariantId, const ShaderVariantSearchResult& searchResult, uint32_t generation);
+
+            //! Discards all cached results.
+            void Invalidate();
+
+            //! Adds a shader variant tree search to the counters. The time is in ticks of AZStd::GetTimeNowTicks().
+            void RecordTreeSearch(AZStd::sys_time_t searchTimeTicks);
+
+            //! Returns the lookup counters.
+            ShaderVariantLookupStats GetStats() const;
+
+        private:
+            static constexpr uint32_t KeyWordCount = ShaderVariantKeyBitCount / (8 * sizeof(ShaderVariantKey::word_t));
+
+            //! The key words followed by the mask words of a ShaderVariantId.
+            using IdWords = AZStd::array<ShaderVariantKey::word_t, 2 * KeyWordCount>;
+
+            struct Slot
+            {
+                //! Odd while the slot is written.
+                AZStd::atomic_uint32_t m_sequence{ 0 };
+
+                //! Generation of the cache the entry was inserted in. Generation 0 is never current, so empty slots never match.
+                AZStd::atomic_uint32_t m_generation{ 0 };
+
+                AZStd::atomic_uint32_t m_stableId{ 0 };
+                AZStd::atomic_uint32_t m_dynamicOptionCount{ 0 };
+                AZStd::array<AZStd::atomic<ShaderVariantKey::word_t>, 2 * KeyWordCount> m_idWords;
+            };
+
+            static IdWords GetIdWords(const ShaderVariantId& shaderVariantId);
+            static uint32_t GetSlotIndex(const IdWords& idWords);
+
+            AZStd::array<Slot, SlotCount> m_slots;
+            AZStd::atomic_uint32_t m_generation{ 1 };
+
+            mutable AZStd::atomic_uint64_t m_lookupCount{ 0 };
+            mutable AZStd::atomic_uint64_t m_hitCount{ 0 };
+            AZStd::atomic_uint64_t m_treeSearchCount{ 0 };
+            AZStd::atomic_uint64_t m_treeSearchTimeTicks{ 0 };
+        };
+    } // namespace RPI
+} // namespace AZ
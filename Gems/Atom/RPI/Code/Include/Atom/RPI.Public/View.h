@@ -138,6 +138,9 @@ namespace AZ
             //! Sorts the finalized draw lists in this view
             void SortFinalizedDrawLists();
 
+            //! Draw lists with at least this many items are sorted in their own job when there is more than one of them
+            static constexpr size_t ParallelSortMinDrawItemCount = 2048;
+
             //! Sorts a drawList using the sort function from a pass with the corresponding drawListTag
             void SortDrawList(RHI::DrawList& drawList, RHI::DrawListTag tag);
 
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/StreamingImageControllerAsset.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Configuration of a BudgetedStreamingImageController, which streams the mips of its images by priority
+        //! within a memory budget.
+        class BudgetedStreamingImageControllerAsset
+            : public StreamingImageControllerAsset
+        {
+        public:
+            AZ_RTTI(BudgetedStreamingImageControllerAsset, "{CBAF50B8-CD47-4893-9753-C8312B95104E}", StreamingImageControllerAsset);
+            AZ_CLASS_ALLOCATOR(BudgetedStreamingImageControllerAsset, SystemAllocator, 0);
+
+            //! The built-in asset uses the budget of the streaming image pool.
+            static const Data::AssetId BuiltInAssetId;
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            BudgetedStreamingImageControllerAsset();
+
+            //! Returns the memory budget of the streamed mips, in bytes. A budget of 0 uses the budget of the streaming image pool.
+            size_t GetMemoryBudgetInBytes() const;
+
+            //! Returns the maximum number of images whose mips are expanded per update.
+            uint32_t GetMaxExpandsPerUpdate() const;
+
+        private:
+            uint64_t m_memoryBudgetInBytes = 0;
+            uint32_t m_maxExpandsPerUpdate = 20;
+        };
+    }
+}
@@ -32,6 +32,10 @@ namespace AZ
             //! The maximum size of the image pool used for streaming images load from assets
             //! Check ImageSystemInterface::GetStreamingPool() for detail of this image pool
             uint64_t m_assetStreamingImagePoolSize = 2u * 1024u * 1024u * 1024u;
+
+            //! Streams the images loaded from assets by priority within m_assetStreamingImagePoolSize, using a
+            //! BudgetedStreamingImageController, instead of streaming in all their mips.
+            bool m_useBudgetedStreamingImageController = false;
         };
     } // namespace RPI
 } // namespace AZ
@@ -124,6 +124,11 @@ namespace AZ
             //! This function is thread safe.
             ShaderVariantSearchResult FindVariantStableId(const ShaderVariantId& shaderVariantId);
 
+            //! Returns true if FindVariantStableId() searches a loaded ShaderVariantTreeAsset, or if the shader has no options
+            //! to search. While this is false, FindVariantStableId() returns the root variant until the tree is loaded.
+            //! This function is thread safe.
+            bool IsShaderVariantTreeReady() const;
+
             //! Returns the variant asset associated with the provided StableId.
             //! The user should call FindVariantStableId() first to get a ShaderVariantStableId from a ShaderVariantId,
             //! Or better yet, call GetVariant(ShaderVariantId) for maximum convenience.
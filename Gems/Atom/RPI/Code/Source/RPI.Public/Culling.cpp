@@ -9,12 +9,15 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Model/ModelLodStreamingInterface.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/View.h>
 
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/std/parallel/lock.h>
@@ -286,6 +289,12 @@ namespace AZ
             const AZStd::shared_ptr<JobData> m_jobData;
             CullingScene::WorkListType m_worklist;
 
+            //lod selection parameters of the view
+            Vector3 m_cameraPos;
+            float m_yScale = 0.0f;
+            bool m_isPerspective = true;
+            float m_lodSelectionMargin = 1.0f;
+
         public:
             AddObjectsToViewJob(const AZStd::shared_ptr<AddObjectsToViewJob::JobData>& jobData, CullingScene::WorkListType& worklist)
                 : Job(true, nullptr)        //auto-deletes, no JobContext
@@ -299,87 +308,59 @@ namespace AZ
             {
                 AZ_PROFILE_SCOPE(RPI, "AddObjectsToViewJob: Process");
 
+                const AZStd::sys_time_t startTime = m_jobData->m_debugCtx->m_enableStats ? AZStd::GetTimeNowMicroSecond() : 0;
+
                 const View::UsageFlags viewFlags = m_jobData->m_view->GetUsageFlags();
                 const RHI::DrawListMask drawListMask = m_jobData->m_view->GetDrawListMask();
-                uint32_t numDrawPackets = 0;
-                uint32_t numVisibleCullables = 0;
+
+                const Matrix4x4& viewToClip = m_jobData->m_view->GetViewToClipMatrix();
+                m_yScale = viewToClip.GetElement(1, 1);
+                m_isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+                m_cameraPos = m_jobData->m_view->GetViewToWorldMatrix().GetTranslation();
+
+                if (ModelLodStreamingInterface* lodStreaming = ModelLodStreamingInterface::Get())
+                {
+                    m_lodSelectionMargin = lodStreaming->GetConfiguration().m_lodSelectionMargin;
+                }
+
+                CullCounters counters;
+                CullableBlock block;
 
                 for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
                 {
                     //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
                     bool nodeIsContainedInFrustum = ShapeIntersection::Contains(m_jobData->m_frustum, nodeData.m_bounds);
+                    const bool testBounds = !nodeIsContainedInFrustum && m_jobData->m_debugCtx->m_enableFrustumCulling;
 
 #ifdef AZ_CULL_PROFILE_VERBOSE
                     AZ_PROFILE_SCOPE(RPI, "process node (view: %s, skip fine cull: %d",
                         m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? 1 : 0);
 #endif
 
-                    if (nodeIsContainedInFrustum || !m_jobData->m_debugCtx->m_enableFrustumCulling)
+                    //Gather the cullables of this node into blocks, then do the fine-grained culling (if needed) and
+                    //the lod selection a block at a time before adding the objects to the view
+                    for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
                     {
-                        //Add all objects within this node to the view, without any extra culling
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
                         {
-                            {
-                                if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                                {
-                                    Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-
-                                    if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                        c->m_cullData.m_hideFlags & viewFlags ||
-                                        c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                        c->m_isHidden)
-                                    {
-                                        continue;
-                                    }
+                            Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
 
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
-                                    {
-                                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
-                                        ++numVisibleCullables;
-                                        c->m_isVisible = true;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                    else
-                    {
-                        //Do fine-grained culling before adding objects to the view
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
-                        {
-                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                            if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                                c->m_cullData.m_hideFlags & viewFlags ||
+                                c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                                c->m_isHidden)
                             {
-                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-
-                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                    c->m_cullData.m_hideFlags & viewFlags ||
-                                    c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                    c->m_isHidden)
-                                {
-                                    continue;
-                                }
+                                continue;
+                            }
 
-                                IntersectResult res = ShapeIntersection::Classify(m_jobData->m_frustum, c->m_cullData.m_boundingSphere);
-                                if (res == IntersectResult::Exterior)
-                                {
-                                    continue;
-                                }
-                                else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
-                                {
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
-                                    {
-                                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
-                                        ++numVisibleCullables;
-                                        c->m_isVisible = true;
-                                    }
-                                }
+                            block.Add(c, visibleEntry);
+                            if (block.IsFull())
+                            {
+                                ProcessBlock(block, testBounds, counters);
                             }
                         }
                     }
+                    ProcessBlock(block, testBounds, counters);
 
                     if (m_jobData->m_debugCtx->m_debugDraw && (m_jobData->m_view->GetName() == m_jobData->m_debugCtx->m_currentViewSelectionName))
                     {
@@ -439,12 +420,78 @@ namespace AZ
                     CullingDebugContext::CullStats& cullStats = m_jobData->m_debugCtx->GetCullStatsForView(m_jobData->m_view);
 
                     //no need for mutex here since these are all atomics
-                    cullStats.m_numVisibleDrawPackets += numDrawPackets;
-                    cullStats.m_numVisibleCullables += numVisibleCullables;
+                    cullStats.m_numVisibleDrawPackets += counters.m_numDrawPackets;
+                    cullStats.m_numVisibleCullables += counters.m_numVisibleCullables;
+                    cullStats.m_numTestedCullables += counters.m_numTestedCullables;
+                    cullStats.m_numCulledCullables += counters.m_numCulledCullables;
+                    cullStats.m_cullTimeMicroseconds += static_cast<uint64_t>(AZStd::GetTimeNowMicroSecond() - startTime);
                     ++cullStats.m_numJobs;
                 }
             }
 
+        private:
+            struct CullCounters
+            {
+                uint32_t m_numDrawPackets = 0;
+                uint32_t m_numVisibleCullables = 0;
+                uint32_t m_numTestedCullables = 0;
+                uint32_t m_numCulledCullables = 0;
+            };
+
+            //Culls the cullables in the block, adds the visible ones to the view and clears the block
+            void ProcessBlock(CullableBlock& block, bool testBounds, CullCounters& counters)
+            {
+                if (block.m_count == 0)
+                {
+                    return;
+                }
+
+#ifdef AZ_CULL_PROFILE_DETAILED
+                AZ_PROFILE_SCOPE(RPI, "process block: %u", block.m_count);
+#endif
+
+                IntersectResult intersectResults[CullableBlock::Capacity];
+                if (testBounds)
+                {
+                    ClassifyBoundingSpheres(m_jobData->m_frustum, block, intersectResults);
+                    counters.m_numTestedCullables += block.m_count;
+                }
+
+                float approxScreenPercentages[CullableBlock::Capacity];
+                ApproxScreenPercentages(block, m_cameraPos, m_yScale, m_isPerspective, approxScreenPercentages);
+
+                for (uint32_t i = 0; i < block.m_count; ++i)
+                {
+                    Cullable* c = block.m_cullables[i];
+
+                    if (testBounds)
+                    {
+                        const IntersectResult res = intersectResults[i];
+                        if (res == IntersectResult::Exterior ||
+                            (res == IntersectResult::Overlaps && !ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb)))
+                        {
+                            ++counters.m_numCulledCullables;
+                            continue;
+                        }
+                    }
+
+#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
+                    if (TestOcclusionCulling(block.m_visibilityEntries[i]) != MaskedOcclusionCulling::CullingResult::VISIBLE)
+                    {
+                        ++counters.m_numCulledCullables;
+                        continue;
+                    }
+#endif
+
+                    counters.m_numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, approxScreenPercentages[i], *m_jobData->m_view);
+                    RequestStreamedLod(c->m_lodData, approxScreenPercentages[i], m_lodSelectionMargin);
+                    ++counters.m_numVisibleCullables;
+                    c->m_isVisible = true;
+                }
+
+                block.Clear();
+            }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling::CullingResult TestOcclusionCulling(AzFramework::VisibilityEntry* visibleEntry)
             {
@@ -642,10 +689,6 @@ namespace AZ
 
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
         {
-#ifdef AZ_CULL_PROFILE_DETAILED
-            AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
-#endif
-
             const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
             //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
             //which is used to determine the (vertical) projected size in screen space
@@ -656,6 +699,15 @@ namespace AZ
             const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
                 pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+            return AddLodDataToView(pos, lodData, approxScreenPercentage, view);
+        }
+
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view)
+        {
+#ifdef AZ_CULL_PROFILE_DETAILED
+            AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
+#endif
+
             uint32_t numVisibleDrawPackets = 0;
 
             auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
@@ -694,6 +746,128 @@ namespace AZ
             return numVisibleDrawPackets;
         }
 
+        void RequestStreamedLod(const Cullable::LodData& lodData, float approxScreenPercentage, float lodSelectionMargin)
+        {
+            if (!lodData.m_streamedModel || lodData.m_lods.empty())
+            {
+                return;
+            }
+
+            size_t requestedLod = lodData.m_lods.size() - 1;
+            switch (lodData.m_lodConfiguration.m_lodType)
+            {
+                case Cullable::LodType::SpecificLod:
+                    requestedLod = AZStd::min<size_t>(lodData.m_lodConfiguration.m_lodOverride, requestedLod);
+                    break;
+                case Cullable::LodType::ScreenCoverage:
+                default:
+                {
+                    // The lods are ordered from the most detailed, so the first lod whose range starts below the coverage is
+                    // the most detailed lod that could be selected.
+                    const float screenPercentage = approxScreenPercentage * lodSelectionMargin;
+                    for (size_t lodIndex = 0; lodIndex < lodData.m_lods.size(); ++lodIndex)
+                    {
+                        if (screenPercentage >= lodData.m_lods[lodIndex].m_screenCoverageMin)
+                        {
+                            requestedLod = lodIndex;
+                            break;
+                        }
+                    }
+                    break;
+                }
+            }
+
+            lodData.m_streamedModel->RequestLod(requestedLod);
+        }
+
+        void ClassifyBoundingSpheres(const Frustum& frustum, const CullableBlock& block, IntersectResult* results)
+        {
+            using namespace Simd;
+
+            Vec4::FloatType planeX[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeY[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeZ[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeW[Frustum::PlaneId::MAX];
+            for (Frustum::PlaneId i = Frustum::PlaneId::Near; i < Frustum::PlaneId::MAX; ++i)
+            {
+                const Vector4 plane = frustum.GetPlane(i).GetPlaneEquationCoefficients();
+                planeX[i] = Vec4::Splat(plane.GetX());
+                planeY[i] = Vec4::Splat(plane.GetY());
+                planeZ[i] = Vec4::Splat(plane.GetZ());
+                planeW[i] = Vec4::Splat(plane.GetW());
+            }
+
+            for (uint32_t first = 0; first < block.m_count; first += 4)
+            {
+                const Vec4::FloatType centerX = Vec4::LoadAligned(&block.m_centerX[first]);
+                const Vec4::FloatType centerY = Vec4::LoadAligned(&block.m_centerY[first]);
+                const Vec4::FloatType centerZ = Vec4::LoadAligned(&block.m_centerZ[first]);
+                const Vec4::FloatType radius = Vec4::LoadAligned(&block.m_radius[first]);
+                const Vec4::FloatType negRadius = Vec4::Sub(Vec4::ZeroFloat(), radius);
+
+                Vec4::FloatType exterior = Vec4::ZeroFloat();
+                Vec4::FloatType intersects = Vec4::ZeroFloat();
+                for (Frustum::PlaneId i = Frustum::PlaneId::Near; i < Frustum::PlaneId::MAX; ++i)
+                {
+                    const Vec4::FloatType distance = Vec4::Madd(centerX, planeX[i], Vec4::Madd(centerY, planeY[i], Vec4::Madd(centerZ, planeZ[i], planeW[i])));
+                    exterior = Vec4::Or(exterior, Vec4::CmpLt(distance, negRadius));
+                    intersects = Vec4::Or(intersects, Vec4::CmpLt(Vec4::Abs(distance), radius));
+                }
+
+                alignas(16) int32_t exteriorMask[4];
+                alignas(16) int32_t intersectsMask[4];
+                Vec4::StoreAligned(exteriorMask, Vec4::CastToInt(exterior));
+                Vec4::StoreAligned(intersectsMask, Vec4::CastToInt(intersects));
+
+                const uint32_t count = AZStd::min(block.m_count - first, 4u);
+                for (uint32_t lane = 0; lane < count; ++lane)
+                {
+                    results[first + lane] = exteriorMask[lane] ? IntersectResult::Exterior
+                        : (intersectsMask[lane] ? IntersectResult::Overlaps : IntersectResult::Interior);
+                }
+            }
+        }
+
+        void ApproxScreenPercentages(const CullableBlock& block, const Vector3& cameraPos, float yScale, bool isPerspective, float* results)
+        {
+            using namespace Simd;
+
+            // See ModelLodUtils::ApproxScreenPercentage() for the derivation
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType yScaleSplat = Vec4::Splat(yScale);
+            const Vec4::FloatType cameraX = Vec4::Splat(cameraPos.GetX());
+            const Vec4::FloatType cameraY = Vec4::Splat(cameraPos.GetY());
+            const Vec4::FloatType cameraZ = Vec4::Splat(cameraPos.GetZ());
+
+            for (uint32_t first = 0; first < block.m_count; first += 4)
+            {
+                const Vec4::FloatType projectedSize = Vec4::Mul(yScaleSplat, Vec4::LoadAligned(&block.m_lodSelectionRadius[first]));
+
+                Vec4::FloatType screenPercentage;
+                if (isPerspective)
+                {
+                    const Vec4::FloatType toCenterX = Vec4::Sub(cameraX, Vec4::LoadAligned(&block.m_centerX[first]));
+                    const Vec4::FloatType toCenterY = Vec4::Sub(cameraY, Vec4::LoadAligned(&block.m_centerY[first]));
+                    const Vec4::FloatType toCenterZ = Vec4::Sub(cameraZ, Vec4::LoadAligned(&block.m_centerZ[first]));
+                    const Vec4::FloatType lengthSq = Vec4::Madd(toCenterX, toCenterX, Vec4::Madd(toCenterY, toCenterY, Vec4::Mul(toCenterZ, toCenterZ)));
+                    screenPercentage = Vec4::Min(Vec4::Div(projectedSize, Vec4::Sqrt(lengthSq)), one);
+                }
+                else
+                {
+                    screenPercentage = Vec4::Min(projectedSize, one);
+                }
+
+                alignas(16) float screenPercentages[4];
+                Vec4::StoreAligned(screenPercentages, screenPercentage);
+
+                const uint32_t count = AZStd::min(block.m_count - first, 4u);
+                for (uint32_t lane = 0; lane < count; ++lane)
+                {
+                    results[first + lane] = screenPercentages[lane];
+                }
+            }
+        }
+
         void CullingScene::Activate(const Scene* parentScene)
         {
             m_parentScene = parentScene;
@@ -40,7 +40,7 @@ namespace AZ
             m_ringBufferSize = ringBufferSize;
             m_ringBufferStartAddress = m_ringBuffer->Map(m_ringBufferSize, 0);
             
-            m_currentPosition = 0;
+            m_allocationState = 0;
             m_endPositionLimit = 0;
             m_currentFrame = 0;
             for (uint32_t frame = 0; frame < AZ::RHI::Limits::Device::FrameCountMax; frame++)
@@ -74,53 +74,66 @@ namespace AZ
                 return nullptr;
             }
 
-            // Return if the allocation of current frame has reached limit
-            if (m_endPositionLimit == m_currentPosition && m_currentAllocatedSize > 0)
-            {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer is available");
-                return nullptr;
-            }
+            const uint32_t endPositionLimit = m_endPositionLimit.load(AZStd::memory_order_acquire);
 
-            if (m_endPositionLimit > m_currentPosition)
+            // Threads allocate concurrently, so the new position is computed from a snapshot of the allocation state and
+            // only committed if no other thread changed the state in between.
+            uint64_t allocationState = m_allocationState.load(AZStd::memory_order_relaxed);
+            uint64_t newAllocationState = 0;
+            do
             {
-                if (m_endPositionLimit - m_currentPosition >= size)
-                {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
-                }
-                else
+                const uint32_t currentPosition = GetCurrentPosition(allocationState);
+                const uint32_t currentAllocatedSize = GetCurrentAllocatedSize(allocationState);
+                uint32_t newPosition = 0;
+
+                // Return if the allocation of current frame has reached limit
+                if (endPositionLimit == currentPosition && currentAllocatedSize > 0)
                 {
-                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit - m_currentPosition);
+                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer is available");
                     return nullptr;
                 }
-            }
-            else
-            {
-                if (m_ringBufferSize - m_currentPosition >= size)
+
+                if (endPositionLimit > currentPosition)
                 {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
-                    if (m_ringBufferSize == m_currentPosition)
+                    if (endPositionLimit - currentPosition >= size)
                     {
-                        m_currentPosition = 0;
+                        allocatePosition = currentPosition;
+                        newPosition = currentPosition + size;
+                    }
+                    else
+                    {
+                        AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, endPositionLimit - currentPosition);
+                        return nullptr;
                     }
                 }
                 else
                 {
-                    if (m_endPositionLimit >= size)
+                    if (m_ringBufferSize - currentPosition >= size)
                     {
-                        allocatePosition = 0;
-                        m_currentPosition = size;
+                        allocatePosition = currentPosition;
+                        newPosition = currentPosition + size;
+                        if (m_ringBufferSize == newPosition)
+                        {
+                            newPosition = 0;
+                        }
                     }
                     else
                     {
-                        AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit);
-                        return nullptr;
+                        if (endPositionLimit >= size)
+                        {
+                            allocatePosition = 0;
+                            newPosition = size;
+                        }
+                        else
+                        {
+                            AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, endPositionLimit);
+                            return nullptr;
+                        }
                     }
                 }
-            }
 
-            m_currentAllocatedSize += size;
+                newAllocationState = PackAllocationState(newPosition, currentAllocatedSize + size);
+            } while (!m_allocationState.compare_exchange_weak(allocationState, newAllocationState, AZStd::memory_order_relaxed, AZStd::memory_order_relaxed));
 
             RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
             allocatedBuffer->m_address = (uint8_t*)m_ringBufferStartAddress + allocatePosition;
@@ -164,15 +177,31 @@ namespace AZ
             uint32_t nextFrame = (m_currentFrame + 1) % AZ::RHI::Limits::Device::FrameCountMax;
 
             // The saved frame start position will become available since it's old than FrameCountMax. The saved start position of next frame is the new limit
-            m_endPositionLimit = m_frameStartPositions[nextFrame];
+            m_endPositionLimit.store(m_frameStartPositions[nextFrame], AZStd::memory_order_release);
 
-            // Save start position for current frame
-            m_frameStartPositions[m_currentFrame] = m_currentPosition;
+            // Save start position for current frame, and reset the allocated size of the frame
+            uint64_t allocationState = m_allocationState.load(AZStd::memory_order_relaxed);
+            while (!m_allocationState.compare_exchange_weak(allocationState, PackAllocationState(GetCurrentPosition(allocationState), 0), AZStd::memory_order_relaxed, AZStd::memory_order_relaxed))
+            {
+            }
+            m_frameStartPositions[m_currentFrame] = GetCurrentPosition(allocationState);
 
             m_currentFrame = nextFrame;
+        }
 
-            m_currentAllocatedSize = 0;
+        uint64_t DynamicBufferAllocator::PackAllocationState(uint32_t currentPosition, uint32_t currentAllocatedSize)
+        {
+            return (static_cast<uint64_t>(currentPosition) << 32) | currentAllocatedSize;
+        }
+
+        uint32_t DynamicBufferAllocator::GetCurrentPosition(uint64_t allocationState)
+        {
+            return static_cast<uint32_t>(allocationState >> 32);
+        }
 
+        uint32_t DynamicBufferAllocator::GetCurrentAllocatedSize(uint64_t allocationState)
+        {
+            return static_cast<uint32_t>(allocationState);
         }
     }
 }
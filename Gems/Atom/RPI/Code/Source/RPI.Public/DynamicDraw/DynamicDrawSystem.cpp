@@ -49,7 +49,7 @@ namespace AZ
 
         RHI::Ptr<DynamicBuffer> DynamicDrawSystem::GetDynamicBuffer(uint32_t size, uint32_t alignment)
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
+            // The allocator is lock free, so threads recording dynamic draws don't contend here.
             return m_bufferAlloc->Allocate(size, alignment);
         }
 
@@ -123,10 +123,7 @@ namespace AZ
 
         void DynamicDrawSystem::FrameEnd()
         {
-            {
-                AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
-                m_bufferAlloc->FrameEnd();
-            }
+            m_bufferAlloc->FrameEnd();
 
             // Clean up released dynamic draw contexts (which use count is 1)
             {
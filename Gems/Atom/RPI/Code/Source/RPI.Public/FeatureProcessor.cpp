@@ -9,10 +9,23 @@
 #include <Atom/RPI.Public/FeatureProcessor.h>
 #include <Atom/RPI.Public/Scene.h>
 
+#include <AzCore/Task/TaskGraph.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        void FeatureProcessor::AddSimulateTasks(AZ::TaskGraph& simulateTaskGraph, const SimulatePacket& packet)
+        {
+            static const AZ::TaskDescriptor simulateTaskDescriptor{ "RPI::Scene::Simulate", "Graphics" };
+            simulateTaskGraph.AddTask(
+                simulateTaskDescriptor,
+                [this, &packet]()
+                {
+                    Simulate(packet);
+                });
+        }
+
         void FeatureProcessor::EnableSceneNotification()
         {
             if (m_parentScene && !m_parentScene->GetId().IsNull())
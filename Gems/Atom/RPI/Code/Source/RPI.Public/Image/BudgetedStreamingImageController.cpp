@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/BudgetedStreamingImageController.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
+
+#include <Atom/RHI/StreamingImagePool.h>
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+
+#include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class BudgetedStreamingImageController::BudgetedStreamingImageContext
+            : public StreamingImageContext
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(BudgetedStreamingImageContext, AZ::ThreadPoolAllocator, 0);
+
+            //! The memory of each mip and all less detailed mips, in bytes. Built on the first update of the image.
+            AZStd::fixed_vector<size_t, RHI::Limits::Image::MipCountMax + 1> m_mipTailBytes;
+
+            //! Whether the image ever requested a target mip.
+            bool m_wasRequested = false;
+        };
+
+        namespace
+        {
+            // Priority classes of the images, in the order the budget is handed out.
+            enum PriorityClass : uint32_t
+            {
+                Requested = 0,
+                NeverRequested,
+                Unused
+            };
+
+            void BuildMipTailBytes(const RHI::ImageDescriptor& imageDescriptor, AZStd::fixed_vector<size_t, RHI::Limits::Image::MipCountMax + 1>& mipTailBytes)
+            {
+                const uint16_t mipLevels = AZStd::min<uint16_t>(imageDescriptor.m_mipLevels, RHI::Limits::Image::MipCountMax);
+                mipTailBytes.resize(mipLevels + 1);
+                mipTailBytes[mipLevels] = 0;
+                for (uint16_t mipLevel = mipLevels; mipLevel-- > 0;)
+                {
+                    const RHI::ImageSubresourceLayout layout = RHI::GetImageSubresourceLayout(imageDescriptor, RHI::ImageSubresource(mipLevel, 0));
+                    const size_t mipBytes = static_cast<size_t>(layout.m_bytesPerImage) * layout.m_size.m_depth * imageDescriptor.m_arraySize;
+                    mipTailBytes[mipLevel] = mipTailBytes[mipLevel + 1] + mipBytes;
+                }
+            }
+        }
+
+        AZ::Data::Instance<BudgetedStreamingImageController> BudgetedStreamingImageController::CreateInternal(Data::AssetData* assetData)
+        {
+            BudgetedStreamingImageControllerAsset* specificAsset = azrtti_cast<BudgetedStreamingImageControllerAsset*>(assetData);
+            if (!specificAsset)
+            {
+                AZ_Error("BudgetedStreamingImageController", false, "BudgetedStreamingImageController instance requires a BudgetedStreamingImageControllerAsset.");
+                return nullptr;
+            }
+
+            Data::Instance<BudgetedStreamingImageController> instance = aznew BudgetedStreamingImageController();
+
+            const RHI::ResultCode resultCode = instance->Init(*specificAsset);
+            if (resultCode == RHI::ResultCode::Success)
+            {
+                return instance;
+            }
+
+            return nullptr;
+        }
+
+        RHI::ResultCode BudgetedStreamingImageController::Init(BudgetedStreamingImageControllerAsset& imageControllerAsset)
+        {
+            m_memoryBudgetInBytes = imageControllerAsset.GetMemoryBudgetInBytes();
+            m_maxExpandsPerUpdate = AZStd::max(imageControllerAsset.GetMaxExpandsPerUpdate(), 1u);
+            return RHI::ResultCode::Success;
+        }
+
+        void BudgetedStreamingImageController::SetMemoryBudget(size_t budgetInBytes)
+        {
+            m_memoryBudgetInBytes = budgetInBytes;
+        }
+
+        StreamingImageBudgetStats BudgetedStreamingImageController::GetBudgetStats() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+            return m_stats;
+        }
+
+        size_t BudgetedStreamingImageController::GetEffectiveMemoryBudget() const
+        {
+            const size_t budgetInBytes = m_memoryBudgetInBytes;
+            if (budgetInBytes == 0)
+            {
+                if (const RHI::StreamingImagePool* rhiPool = GetRHIPool())
+                {
+                    return static_cast<size_t>(rhiPool->GetDescriptor().m_budgetInBytes);
+                }
+            }
+            return budgetInBytes;
+        }
+
+        StreamingImageContextPtr BudgetedStreamingImageController::CreateContextInternal()
+        {
+            return aznew BudgetedStreamingImageContext();
+        }
+
+        void BudgetedStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
+        {
+            AZ_TRACE_METHOD();
+            AZ_UNUSED(timestamp);
+
+            m_imageEntries.clear();
+
+            // Gather the streamable images and the mip chain each of them wants.
+            size_t committedBytes = 0;
+            for (const StreamingImageContext& context : contexts)
+            {
+                StreamingImage* image = context.TryGetImage();
+                if (!image || !image->IsStreamable())
+                {
+                    continue;
+                }
+
+                // The list only holds contexts created by this controller.
+                auto& budgetedContext = static_cast<BudgetedStreamingImageContext&>(const_cast<StreamingImageContext&>(context));
+                if (budgetedContext.m_mipTailBytes.empty())
+                {
+                    BuildMipTailBytes(image->GetDescriptor(), budgetedContext.m_mipTailBytes);
+                }
+
+                const StreamingImageAsset& imageAsset = GetImageAsset(image);
+                const size_t mipChainTailIndex = imageAsset.GetMipChainCount() - 1;
+
+                ImageEntry& entry = m_imageEntries.emplace_back();
+                entry.m_context = &budgetedContext;
+                entry.m_image = image;
+                entry.m_targetMipLevel = context.GetTargetMip();
+                entry.m_lastAccessTimestamp = context.GetLastAccessTimestamp();
+                entry.m_committedMipChain = GetStreamingTargetMipChain(image);
+
+                if (entry.m_targetMipLevel != RHI::Limits::Image::MipCountMax)
+                {
+                    budgetedContext.m_wasRequested = true;
+                    entry.m_priorityClass = PriorityClass::Requested;
+                    const size_t lastMipLevel = budgetedContext.m_mipTailBytes.size() - 2;
+                    entry.m_wantedMipChain = imageAsset.GetMipChainIndex(AZStd::min<size_t>(entry.m_targetMipLevel, lastMipLevel));
+                }
+                else if (!budgetedContext.m_wasRequested)
+                {
+                    entry.m_priorityClass = PriorityClass::NeverRequested;
+                    entry.m_wantedMipChain = 0;
+                }
+                else
+                {
+                    entry.m_priorityClass = PriorityClass::Unused;
+                    entry.m_wantedMipChain = mipChainTailIndex;
+                }
+
+                // The mip chain tail can't be evicted, so it's always part of the budget.
+                entry.m_allocatedMipChain = mipChainTailIndex;
+                committedBytes += budgetedContext.m_mipTailBytes[imageAsset.GetMipLevel(mipChainTailIndex)];
+            }
+
+            AZStd::sort(m_imageEntries.begin(), m_imageEntries.end(),
+                [](const ImageEntry& lhs, const ImageEntry& rhs)
+                {
+                    if (lhs.m_priorityClass != rhs.m_priorityClass)
+                    {
+                        return lhs.m_priorityClass < rhs.m_priorityClass;
+                    }
+                    if (lhs.m_targetMipLevel != rhs.m_targetMipLevel)
+                    {
+                        return lhs.m_targetMipLevel < rhs.m_targetMipLevel;
+                    }
+                    if (lhs.m_lastAccessTimestamp != rhs.m_lastAccessTimestamp)
+                    {
+                        return lhs.m_lastAccessTimestamp > rhs.m_lastAccessTimestamp;
+                    }
+                    // Prefer the images that already have more mips, so equal images don't trade places every update.
+                    return lhs.m_committedMipChain < rhs.m_committedMipChain;
+                });
+
+            const size_t budgetInBytes = GetEffectiveMemoryBudget();
+            const size_t budgetLimit = budgetInBytes ? budgetInBytes : AZStd::numeric_limits<size_t>::max();
+
+            // Returns the memory an image needs on top of its allocation to hold the mip chain.
+            const auto getAdditionalBytes = [](const ImageEntry& entry, size_t mipChainIndex)
+            {
+                const StreamingImageAsset& imageAsset = GetImageAsset(entry.m_image);
+                const auto& mipTailBytes = entry.m_context->m_mipTailBytes;
+                return mipTailBytes[imageAsset.GetMipLevel(mipChainIndex)] - mipTailBytes[imageAsset.GetMipLevel(entry.m_allocatedMipChain)];
+            };
+
+            // Hands out the budget in priority order. Each image gets the most detailed mip chain that fits, up to the
+            // mip chain it wants, or up to the mip chain it already has when keepCommitted is set.
+            const auto allocateBudget = [&](bool keepCommitted)
+            {
+                for (ImageEntry& entry : m_imageEntries)
+                {
+                    const size_t mipChainLimit = keepCommitted ? entry.m_committedMipChain : entry.m_wantedMipChain;
+                    for (size_t mipChainIndex = mipChainLimit; mipChainIndex < entry.m_allocatedMipChain; ++mipChainIndex)
+                    {
+                        const size_t additionalBytes = getAdditionalBytes(entry, mipChainIndex);
+                        if (committedBytes <= budgetLimit && additionalBytes <= budgetLimit - committedBytes)
+                        {
+                            committedBytes += additionalBytes;
+                            entry.m_allocatedMipChain = mipChainIndex;
+                            break;
+                        }
+                    }
+                }
+            };
+
+            // First serve the mips the images want, then keep the mips they already have while the budget allows it.
+            allocateBudget(false);
+            allocateBudget(true);
+
+            // Evict the mips that lost their budget, lowest priority first, so memory is released before expanding.
+            uint32_t trimCount = 0;
+            for (auto it = m_imageEntries.rbegin(); it != m_imageEntries.rend(); ++it)
+            {
+                if (it->m_allocatedMipChain > it->m_committedMipChain)
+                {
+                    TrimToMipChainLevel(it->m_image, it->m_allocatedMipChain);
+                    ++trimCount;
+                }
+            }
+
+            uint32_t expandCount = 0;
+            for (const ImageEntry& entry : m_imageEntries)
+            {
+                if (expandCount >= m_maxExpandsPerUpdate)
+                {
+                    break;
+                }
+                if (entry.m_allocatedMipChain < entry.m_committedMipChain)
+                {
+                    QueueExpandToMipChainLevel(entry.m_image, entry.m_allocatedMipChain);
+                    ++expandCount;
+                }
+            }
+
+            StreamingImageBudgetStats stats;
+            stats.m_budgetInBytes = budgetInBytes;
+            stats.m_imageCount = static_cast<uint32_t>(m_imageEntries.size());
+            stats.m_expandCount = expandCount;
+            stats.m_trimCount = trimCount;
+            for (const ImageEntry& entry : m_imageEntries)
+            {
+                const StreamingImageAsset& imageAsset = GetImageAsset(entry.m_image);
+                const auto& mipTailBytes = entry.m_context->m_mipTailBytes;
+                const size_t streamingTargetMipChain = GetStreamingTargetMipChain(entry.m_image);
+                const size_t residentMipLevel = AZStd::min<size_t>(entry.m_image->GetResidentMipLevel(), mipTailBytes.size() - 1);
+
+                stats.m_committedBytes += mipTailBytes[imageAsset.GetMipLevel(streamingTargetMipChain)];
+                stats.m_residentBytes += mipTailBytes[residentMipLevel];
+                if (streamingTargetMipChain <= entry.m_wantedMipChain)
+                {
+                    ++stats.m_imagesAtTargetCount;
+                }
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+            m_stats = stats;
+        }
+    }
+}
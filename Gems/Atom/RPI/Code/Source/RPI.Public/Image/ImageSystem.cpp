@@ -12,6 +12,7 @@
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
+#include <Atom/RPI.Public/Image/BudgetedStreamingImageController.h>
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Reflect/Image/AttachmentImageAssetCreator.h>
@@ -53,6 +54,7 @@ namespace AZ
             StreamingImagePoolAsset::Reflect(context);
             StreamingImageControllerAsset::Reflect(context);
             DefaultStreamingImageControllerAsset::Reflect(context);
+            BudgetedStreamingImageControllerAsset::Reflect(context);
             AttachmentImageAsset::Reflect(context);
         }
 
@@ -65,6 +67,9 @@ namespace AZ
             assetHandlers.emplace_back(MakeAssetHandler<BuiltInAssetHandler>(
                 azrtti_typeid<DefaultStreamingImageControllerAsset>(),
                 []() { return aznew DefaultStreamingImageControllerAsset(); }));
+            assetHandlers.emplace_back(MakeAssetHandler<BuiltInAssetHandler>(
+                azrtti_typeid<BudgetedStreamingImageControllerAsset>(),
+                []() { return aznew BudgetedStreamingImageControllerAsset(); }));
         }
 
         void ImageSystem::Init(const ImageSystemDescriptor& desc)
@@ -131,7 +136,14 @@ namespace AZ
             // Register streaming image controller instance database.
             {
                 Data::InstanceHandler<StreamingImageController> handler;
-                handler.m_createFunction = DefaultStreamingImageController::CreateInternal;
+                handler.m_createFunction = [](Data::AssetData* controllerAsset) -> Data::Instance<StreamingImageController>
+                {
+                    if (azrtti_istypeof<BudgetedStreamingImageControllerAsset>(controllerAsset))
+                    {
+                        return BudgetedStreamingImageController::CreateInternal(controllerAsset);
+                    }
+                    return DefaultStreamingImageController::CreateInternal(controllerAsset);
+                };
                 Data::InstanceDatabase<StreamingImageController>::Create(azrtti_typeid<StreamingImageControllerAsset>(), handler);
             }
 
@@ -139,6 +151,10 @@ namespace AZ
                 Data::AssetManager::Instance().CreateAsset<DefaultStreamingImageControllerAsset>(
                     DefaultStreamingImageControllerAsset::BuiltInAssetId, AZ::Data::AssetLoadBehavior::PreLoad);
 
+            m_budgetedStreamingImageControllerAsset =
+                Data::AssetManager::Instance().CreateAsset<BudgetedStreamingImageControllerAsset>(
+                    BudgetedStreamingImageControllerAsset::BuiltInAssetId, AZ::Data::AssetLoadBehavior::PreLoad);
+
             CreateDefaultResources(desc);
 
             Interface<ImageSystemInterface>::Register(this);
@@ -155,6 +171,7 @@ namespace AZ
             Interface<ImageSystemInterface>::Unregister(this);
 
             m_defaultStreamingImageControllerAsset.Release();
+            m_budgetedStreamingImageControllerAsset.Release();
             m_systemImages.clear();
             m_systemStreamingPool = nullptr;
             m_systemAttachmentPool = nullptr;
@@ -271,7 +288,14 @@ namespace AZ
                 StreamingImagePoolAssetCreator poolAssetCreator;
                 poolAssetCreator.Begin(assetStreamingPoolDescriptor.m_assetId);
                 poolAssetCreator.SetPoolDescriptor(AZStd::move(imagePoolDescriptor));
-                poolAssetCreator.SetControllerAsset(m_defaultStreamingImageControllerAsset);
+                if (desc.m_useBudgetedStreamingImageController)
+                {
+                    poolAssetCreator.SetControllerAsset(m_budgetedStreamingImageControllerAsset);
+                }
+                else
+                {
+                    poolAssetCreator.SetControllerAsset(m_defaultStreamingImageControllerAsset);
+                }
                 poolAssetCreator.SetPoolName(assetStreamingPoolDescriptor.m_name);
                 [[maybe_unused]] const bool created = poolAssetCreator.End(poolAsset);
                 AZ_Assert(created, "Failed to build streaming image pool for assets");
@@ -172,6 +172,21 @@ namespace AZ
             image->TrimToMipChainLevel(mipChainIndex);
         }
 
+        const StreamingImageAsset& StreamingImageController::GetImageAsset(const StreamingImage* image)
+        {
+            return *image->m_imageAsset;
+        }
+
+        size_t StreamingImageController::GetStreamingTargetMipChain(const StreamingImage* image)
+        {
+            return image->m_state.m_streamingTarget;
+        }
+
+        const RHI::StreamingImagePool* StreamingImageController::GetRHIPool() const
+        {
+            return m_pool;
+        }
+
         StreamingImageContextPtr StreamingImageController::CreateContextInternal()
         {
             return aznew StreamingImageContext();
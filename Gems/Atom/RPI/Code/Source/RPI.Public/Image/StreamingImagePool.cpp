@@ -101,5 +101,15 @@ namespace AZ
         {
             return m_pool.get();
         }
+
+        StreamingImageController* StreamingImagePool::GetController()
+        {
+            return m_controller.get();
+        }
+
+        const StreamingImageController* StreamingImagePool::GetController() const
+        {
+            return m_controller.get();
+        }
     }
 }
@@ -7,6 +7,7 @@
  */
 
 #include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Model/ModelLodStreamingInterface.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 
 #include <Atom/RHI/Factory.h>
@@ -53,6 +54,17 @@ namespace AZ
                 Data::InstanceId::CreateFromAssetId(modelAsset.GetId()));
         }
 
+        Model::~Model()
+        {
+            if (m_isLodStreamed)
+            {
+                if (ModelLodStreamingInterface* lodStreaming = ModelLodStreamingInterface::Get())
+                {
+                    lodStreaming->UnregisterModel(*this);
+                }
+            }
+        }
+
         size_t Model::GetLodCount() const
         {
             return m_lods.size();
@@ -81,49 +93,229 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(RPI, "Model: Init");
 
+            m_modelAsset = modelAsset;
             m_lods.resize(modelAsset->GetLodAssets().size());
 
-            for (size_t lodIndex = 0; lodIndex < m_lods.size(); ++lodIndex)
+            ModelLodStreamingInterface* lodStreaming = ModelLodStreamingInterface::Get();
+            m_isLodStreamed = lodStreaming && lodStreaming->GetConfiguration().m_enabled && m_lods.size() > 1;
+
+            if (m_isLodStreamed)
+            {
+                // Only the least detailed lod is created up front, the others are streamed in when the culling requests them.
+                m_streamedLodAssets.assign(modelAsset->GetLodAssets().begin(), modelAsset->GetLodAssets().end());
+                m_lodByteCounts.resize(m_lods.size(), 0);
+                m_mostDetailedResidentLod = m_lods.size() - 1;
+
+                Data::Asset<ModelLodAsset>& lastLodAsset = m_streamedLodAssets.back();
+                if (!lastLodAsset.IsReady())
+                {
+                    lastLodAsset.QueueLoad();
+                    lastLodAsset.BlockUntilLoadComplete();
+                }
+            }
+
+            for (size_t lodIndex = m_isLodStreamed ? m_lods.size() - 1 : 0; lodIndex < m_lods.size(); ++lodIndex)
             {
                 const Data::Asset<ModelLodAsset>& lodAsset = modelAsset->GetLodAssets()[lodIndex];
 
-                if (!lodAsset)
+                if (!lodAsset && !m_isLodStreamed)
                 {
                     AZ_Error("Model", false, "Invalid Operation: Last ModelLod is not loaded.");
                     return RHI::ResultCode::Fail;
                 }
 
-                Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(lodAsset, modelAsset);
+                Data::Instance<ModelLod> lodInstance = CreateLod(lodIndex);
                 if (lodInstance == nullptr)
                 {
                     return RHI::ResultCode::Fail;
                 }
 
-                for (const AZ::RPI::ModelLod::Mesh& mesh : lodInstance->GetMeshes())
+                m_lods[lodIndex] = AZStd::move(lodInstance);
+            }
+
+            if (m_isLodStreamed)
+            {
+                lodStreaming->RegisterModel(*this);
+            }
+
+            m_isUploadPending = true;
+            return RHI::ResultCode::Success;
+        }
+
+        Data::Instance<ModelLod> Model::CreateLod(size_t lodIndex)
+        {
+            const Data::Asset<ModelLodAsset>& lodAsset = m_isLodStreamed ? m_streamedLodAssets[lodIndex] : m_modelAsset->GetLodAssets()[lodIndex];
+            if (!lodAsset.IsReady())
+            {
+                AZ_Error("Model", false, "Invalid Operation: ModelLod %zu is not loaded.", lodIndex);
+                return nullptr;
+            }
+
+            Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(lodAsset, m_modelAsset);
+            if (lodInstance == nullptr)
+            {
+                return nullptr;
+            }
+
+            for (const AZ::RPI::ModelLod::Mesh& mesh : lodInstance->GetMeshes())
+            {
+                for (const AZ::RPI::ModelLod::StreamBufferInfo& stream : mesh.m_streamInfo)
                 {
-                    for (const AZ::RPI::ModelLod::StreamBufferInfo& stream : mesh.m_streamInfo)
+                    if (stream.m_semantic.m_name.GetStringView().starts_with(RHI::ShaderSemantic::UvStreamSemantic))
                     {
-                        if (stream.m_semantic.m_name.GetStringView().starts_with(RHI::ShaderSemantic::UvStreamSemantic))
+                        // For unnamed UVs, use the semantic instead.
+                        if (stream.m_customName.IsEmpty())
+                        {
+                            m_uvNames.insert(AZ::Name(stream.m_semantic.ToString()));
+                        }
+                        else
                         {
-                            // For unnamed UVs, use the semantic instead.
-                            if (stream.m_customName.IsEmpty())
-                            {
-                                m_uvNames.insert(AZ::Name(stream.m_semantic.ToString()));
-                            }
-                            else
-                            {
-                                m_uvNames.insert(stream.m_customName);
-                            }
+                            m_uvNames.insert(stream.m_customName);
                         }
                     }
                 }
+            }
 
-                m_lods[lodIndex] = AZStd::move(lodInstance);
+            return lodInstance;
+        }
+
+        bool Model::IsLodStreamed() const
+        {
+            return m_isLodStreamed;
+        }
+
+        bool Model::IsLodResident(size_t lodIndex) const
+        {
+            return lodIndex < m_lods.size() && (!m_isLodStreamed || lodIndex >= m_mostDetailedResidentLod);
+        }
+
+        size_t Model::GetResidentLodIndex(size_t lodIndex) const
+        {
+            return m_isLodStreamed ? AZStd::max(lodIndex, m_mostDetailedResidentLod) : lodIndex;
+        }
+
+        void Model::RequestLod(size_t lodIndex)
+        {
+            size_t requestedLod = m_requestedLod.load(AZStd::memory_order_relaxed);
+            while (lodIndex < requestedLod && !m_requestedLod.compare_exchange_weak(requestedLod, lodIndex, AZStd::memory_order_relaxed))
+            {
             }
+        }
 
-            m_modelAsset = modelAsset;
-            m_isUploadPending = true;
-            return RHI::ResultCode::Success;
+        void Model::ConnectLodResidencyChangedHandler(LodResidencyChangedEvent::Handler& handler)
+        {
+            handler.Connect(m_lodResidencyChangedEvent);
+        }
+
+        size_t Model::TakeRequestedLod()
+        {
+            const size_t requestedLod = m_requestedLod.exchange(InvalidLodIndex, AZStd::memory_order_relaxed);
+            return requestedLod < m_lods.size() ? requestedLod : InvalidLodIndex;
+        }
+
+        size_t Model::GetMostDetailedResidentLod() const
+        {
+            return m_isLodStreamed ? m_mostDetailedResidentLod : 0;
+        }
+
+        bool Model::LoadLodAsset(size_t lodIndex)
+        {
+            Data::Asset<ModelLodAsset>& lodAsset = m_streamedLodAssets[lodIndex];
+            if (lodAsset.IsReady())
+            {
+                return true;
+            }
+
+            if (lodAsset.GetStatus() == Data::AssetData::AssetStatus::NotLoaded)
+            {
+                lodAsset.QueueLoad();
+            }
+            return false;
+        }
+
+        bool Model::IsLodAssetError(size_t lodIndex) const
+        {
+            return m_streamedLodAssets[lodIndex].IsError();
+        }
+
+        size_t Model::GetLodByteCount(size_t lodIndex)
+        {
+            if (m_lodByteCounts[lodIndex] == 0 && m_streamedLodAssets[lodIndex].IsReady())
+            {
+                // The meshes of a lod usually share their buffers, so only count each buffer once.
+                AZStd::fixed_vector<Data::AssetId, 64> countedBuffers;
+                size_t byteCount = 0;
+                const auto countBuffer = [&](const BufferAssetView& bufferAssetView)
+                {
+                    const Data::Asset<BufferAsset>& bufferAsset = bufferAssetView.GetBufferAsset();
+                    if (!bufferAsset.IsReady() ||
+                        AZStd::find(countedBuffers.begin(), countedBuffers.end(), bufferAsset.GetId()) != countedBuffers.end())
+                    {
+                        return;
+                    }
+                    if (countedBuffers.size() < countedBuffers.capacity())
+                    {
+                        countedBuffers.push_back(bufferAsset.GetId());
+                    }
+                    byteCount += bufferAsset->GetBuffer().size();
+                };
+
+                for (const ModelLodAsset::Mesh& mesh : m_streamedLodAssets[lodIndex]->GetMeshes())
+                {
+                    countBuffer(mesh.GetIndexBufferAssetView());
+                    for (const ModelLodAsset::Mesh::StreamBufferInfo& streamBufferInfo : mesh.GetStreamBufferInfoList())
+                    {
+                        countBuffer(streamBufferInfo.m_bufferAssetView);
+                    }
+                }
+                m_lodByteCounts[lodIndex] = byteCount;
+            }
+            return m_lodByteCounts[lodIndex];
+        }
+
+        void Model::SetMostDetailedResidentLod(size_t lodIndex)
+        {
+            AZ_Assert(m_isLodStreamed, "Only the lods of streamed models can be made resident or evicted.");
+            lodIndex = AZStd::min(lodIndex, m_lods.size() - 1);
+            if (lodIndex == m_mostDetailedResidentLod)
+            {
+                return;
+            }
+
+            for (size_t expandLodIndex = lodIndex; expandLodIndex < m_mostDetailedResidentLod; ++expandLodIndex)
+            {
+                m_lods[expandLodIndex] = CreateLod(expandLodIndex);
+                if (!m_lods[expandLodIndex])
+                {
+                    // Keep the lods contiguous, so the lods up to the one that failed stay evicted.
+                    for (size_t failedLodIndex = lodIndex; failedLodIndex <= expandLodIndex; ++failedLodIndex)
+                    {
+                        m_lods[failedLodIndex] = {};
+                    }
+                    lodIndex = expandLodIndex + 1;
+                }
+            }
+
+            for (size_t evictLodIndex = m_mostDetailedResidentLod; evictLodIndex < lodIndex; ++evictLodIndex)
+            {
+                // Meshes keep the lod alive until they rebuild their draw packets, the buffers are released after that.
+                m_lods[evictLodIndex] = {};
+
+                // Releases the lod asset, unless the model asset preloaded it.
+                Data::Asset<ModelLodAsset>& lodAsset = m_streamedLodAssets[evictLodIndex];
+                lodAsset = Data::Asset<ModelLodAsset>(lodAsset.GetId(), lodAsset.GetType(), lodAsset.GetHint());
+            }
+
+            if (lodIndex != m_mostDetailedResidentLod)
+            {
+                m_mostDetailedResidentLod = lodIndex;
+                m_isUploadPending = true;
+            }
+        }
+
+        void Model::SignalLodResidencyChanged()
+        {
+            m_lodResidencyChangedEvent.Signal();
         }
 
         void Model::WaitForUpload()
@@ -133,7 +325,10 @@ namespace AZ
                 AZ_PROFILE_SCOPE(RPI, "Model::WaitForUpload - %s", GetDatabaseName());
                 for (const Data::Instance<ModelLod>& lod : m_lods)
                 {
-                    lod->WaitForUpload();
+                    if (lod)
+                    {
+                        lod->WaitForUpload();
+                    }
                 }
                 m_isUploadPending = false;
             }
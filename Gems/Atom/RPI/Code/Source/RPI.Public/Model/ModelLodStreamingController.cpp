@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
+#include <Atom/RPI.Public/Model/Model.h>
+
+#include <AzCore/Debug/EventTrace.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        ModelLodStreamingInterface* ModelLodStreamingInterface::Get()
+        {
+            return Interface<ModelLodStreamingInterface>::Get();
+        }
+
+        void ModelLodStreamingController::Init()
+        {
+            Interface<ModelLodStreamingInterface>::Register(this);
+        }
+
+        void ModelLodStreamingController::Shutdown()
+        {
+            Interface<ModelLodStreamingInterface>::Unregister(this);
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+            AZ_Warning("ModelLodStreamingController", m_modelEntries.empty(), "%zu streamed models are still alive.", m_modelEntries.size());
+            m_modelEntries.clear();
+            m_prioritizedEntries = {};
+            m_residencyChangedModels = {};
+        }
+
+        void ModelLodStreamingController::SetConfiguration(const ModelLodStreamingConfiguration& configuration)
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+            m_configuration = configuration;
+        }
+
+        ModelLodStreamingConfiguration ModelLodStreamingController::GetConfiguration() const
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+            return m_configuration;
+        }
+
+        ModelLodStreamingStats ModelLodStreamingController::GetStats() const
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+            return m_stats;
+        }
+
+        void ModelLodStreamingController::RegisterModel(Model& model)
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+            ModelEntry& entry = m_modelEntries[&model];
+            entry.m_requestedLod = model.GetLodCount() - 1;
+        }
+
+        void ModelLodStreamingController::UnregisterModel(Model& model)
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+            m_modelEntries.erase(&model);
+        }
+
+        void ModelLodStreamingController::Update()
+        {
+            AZ_PROFILE_SCOPE(RPI, "ModelLodStreamingController: Update");
+
+            // The residency changes are signaled while the lock is held, and the handlers may create or release other models.
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+
+            ++m_updateIndex;
+            m_prioritizedEntries.clear();
+            m_prioritizedEntries.reserve(m_modelEntries.size());
+
+            // Gather the lods the models want, and the memory of their lods.
+            size_t committedBytes = 0;
+            for (auto& [model, entry] : m_modelEntries)
+            {
+                const size_t lastLodIndex = model->GetLodCount() - 1;
+
+                const size_t requestedLod = model->TakeRequestedLod();
+                if (requestedLod != Model::InvalidLodIndex)
+                {
+                    entry.m_requestedLod = requestedLod;
+                    entry.m_requestUpdateIndex = m_updateIndex;
+                    entry.m_wasRequested = true;
+                }
+
+                entry.m_isRequested = entry.m_wasRequested && m_updateIndex - entry.m_requestUpdateIndex <= m_configuration.m_evictionDelayInUpdates;
+                entry.m_wantedLod = entry.m_isRequested ? entry.m_requestedLod : lastLodIndex;
+                entry.m_residentLod = model->GetMostDetailedResidentLod();
+
+                // The size of a lod is only known once its asset is loaded, so the tail is rebuilt every update.
+                entry.m_lodTailBytes.resize(lastLodIndex + 2);
+                entry.m_lodTailBytes[lastLodIndex + 1] = 0;
+                for (size_t lodIndex = lastLodIndex + 1; lodIndex-- > 0;)
+                {
+                    entry.m_lodTailBytes[lodIndex] = entry.m_lodTailBytes[lodIndex + 1] + model->GetLodByteCount(lodIndex);
+                }
+
+                // The least detailed lod can't be evicted, so it's always part of the budget.
+                entry.m_allocatedLod = lastLodIndex;
+                committedBytes += entry.m_lodTailBytes[lastLodIndex];
+
+                m_prioritizedEntries.emplace_back(model, &entry);
+            }
+
+            AZStd::sort(m_prioritizedEntries.begin(), m_prioritizedEntries.end(),
+                [](const AZStd::pair<Model*, ModelEntry*>& lhsPair, const AZStd::pair<Model*, ModelEntry*>& rhsPair)
+                {
+                    const ModelEntry& lhs = *lhsPair.second;
+                    const ModelEntry& rhs = *rhsPair.second;
+                    if (lhs.m_isRequested != rhs.m_isRequested)
+                    {
+                        return lhs.m_isRequested;
+                    }
+                    if (lhs.m_wantedLod != rhs.m_wantedLod)
+                    {
+                        return lhs.m_wantedLod < rhs.m_wantedLod;
+                    }
+                    if (lhs.m_requestUpdateIndex != rhs.m_requestUpdateIndex)
+                    {
+                        return lhs.m_requestUpdateIndex > rhs.m_requestUpdateIndex;
+                    }
+                    // Prefer the models that already have more lods, so equal models don't trade places every update.
+                    return lhs.m_residentLod < rhs.m_residentLod;
+                });
+
+            const size_t budgetInBytes = m_configuration.m_memoryBudgetInBytes;
+            const size_t budgetLimit = budgetInBytes ? budgetInBytes : AZStd::numeric_limits<size_t>::max();
+
+            // Hands out the budget in priority order. Each model gets the most detailed lod that fits, up to the lod it
+            // wants, or up to the lod it already has when keepResident is set.
+            const auto allocateBudget = [&](bool keepResident)
+            {
+                for (auto& [model, entry] : m_prioritizedEntries)
+                {
+                    const size_t lodLimit = keepResident ? entry->m_residentLod : entry->m_wantedLod;
+                    for (size_t lodIndex = lodLimit; lodIndex < entry->m_allocatedLod; ++lodIndex)
+                    {
+                        const size_t additionalBytes = entry->m_lodTailBytes[lodIndex] - entry->m_lodTailBytes[entry->m_allocatedLod];
+                        if (committedBytes <= budgetLimit && additionalBytes <= budgetLimit - committedBytes)
+                        {
+                            committedBytes += additionalBytes;
+                            entry->m_allocatedLod = lodIndex;
+                            break;
+                        }
+                    }
+                }
+            };
+
+            // First serve the lods the models want, then keep the lods they already have while the budget allows it.
+            allocateBudget(false);
+            allocateBudget(true);
+
+            // Evict the lods that lost their budget, lowest priority first, so memory is released before expanding.
+            uint32_t trimCount = 0;
+            for (auto it = m_prioritizedEntries.rbegin(); it != m_prioritizedEntries.rend(); ++it)
+            {
+                if (it->second->m_allocatedLod > it->second->m_residentLod)
+                {
+                    it->first->SetMostDetailedResidentLod(it->second->m_allocatedLod);
+                    ++trimCount;
+                }
+            }
+
+            uint32_t expandCount = 0;
+            uint32_t pendingLodLoadCount = 0;
+            for (auto& [model, entry] : m_prioritizedEntries)
+            {
+                if (expandCount >= m_configuration.m_maxExpandsPerUpdate)
+                {
+                    break;
+                }
+                if (entry->m_allocatedLod < entry->m_residentLod && ExpandModel(*model, *entry, pendingLodLoadCount))
+                {
+                    ++expandCount;
+                }
+            }
+
+            m_residencyChangedModels.clear();
+            ModelLodStreamingStats stats;
+            stats.m_budgetInBytes = budgetInBytes;
+            stats.m_modelCount = static_cast<uint32_t>(m_prioritizedEntries.size());
+            stats.m_pendingLodLoadCount = pendingLodLoadCount;
+            stats.m_expandCount = expandCount;
+            stats.m_trimCount = trimCount;
+            for (const auto& [model, entry] : m_prioritizedEntries)
+            {
+                const size_t residentLod = model->GetMostDetailedResidentLod();
+                stats.m_residentBytes += entry->m_lodTailBytes[residentLod];
+                stats.m_lodCount += static_cast<uint32_t>(model->GetLodCount());
+                stats.m_residentLodCount += static_cast<uint32_t>(model->GetLodCount() - residentLod);
+                if (residentLod <= entry->m_wantedLod)
+                {
+                    ++stats.m_modelsAtTargetCount;
+                }
+                if (residentLod != entry->m_residentLod)
+                {
+                    m_residencyChangedModels.push_back(model);
+                }
+            }
+            m_stats = stats;
+            m_prioritizedEntries.clear();
+
+            // Signal the changes last, the handlers may release models, which removes their entries.
+            for (Model* model : m_residencyChangedModels)
+            {
+                // A handler already released this model.
+                if (m_modelEntries.find(model) == m_modelEntries.end())
+                {
+                    continue;
+                }
+                model->SignalLodResidencyChanged();
+            }
+            m_residencyChangedModels.clear();
+        }
+
+        bool ModelLodStreamingController::ExpandModel(Model& model, ModelEntry& entry, uint32_t& pendingLodLoadCount)
+        {
+            // Lods are made resident from the least detailed one, so only the lods whose less detailed lods are all
+            // loaded can be made resident.
+            size_t expandedLod = entry.m_residentLod;
+            bool lessDetailedLodsLoaded = true;
+            for (size_t lodIndex = entry.m_residentLod; lodIndex-- > entry.m_allocatedLod;)
+            {
+                if (model.LoadLodAsset(lodIndex))
+                {
+                    if (lessDetailedLodsLoaded)
+                    {
+                        expandedLod = lodIndex;
+                    }
+                }
+                else if (model.IsLodAssetError(lodIndex))
+                {
+                    // The lods that failed to load and all the more detailed lods can't be made resident.
+                    break;
+                }
+                else
+                {
+                    lessDetailedLodsLoaded = false;
+                    ++pendingLodLoadCount;
+                }
+            }
+
+            if (expandedLod == entry.m_residentLod)
+            {
+                return false;
+            }
+
+            model.SetMostDetailedResidentLod(expandedLod);
+            return model.GetMostDetailedResidentLod() < entry.m_residentLod;
+        }
+    } // namespace RPI
+} // namespace AZ
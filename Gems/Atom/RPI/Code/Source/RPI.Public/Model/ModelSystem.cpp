@@ -18,10 +18,47 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        namespace
+        {
+            void UpdateLodStreamingConfiguration(const AZStd::function<void(ModelLodStreamingConfiguration&)>& update)
+            {
+                if (ModelLodStreamingInterface* lodStreaming = ModelLodStreamingInterface::Get())
+                {
+                    ModelLodStreamingConfiguration configuration = lodStreaming->GetConfiguration();
+                    update(configuration);
+                    lodStreaming->SetConfiguration(configuration);
+                }
+            }
+        }
+
+        AZ_CVAR(bool,
+            r_modelLodStreaming,
+            false,
+            [](const bool& value)
+            {
+                UpdateLodStreamingConfiguration([value](ModelLodStreamingConfiguration& configuration) { configuration.m_enabled = value; });
+            },
+            ConsoleFunctorFlags::Null,
+            "Only keeps the lods the culling selects resident, for the models loaded after this is enabled."
+        );
+
+        AZ_CVAR(uint32_t,
+            r_modelLodStreamingBudgetMB,
+            0,
+            [](const uint32_t& value)
+            {
+                UpdateLodStreamingConfiguration([value](ModelLodStreamingConfiguration& configuration) { configuration.m_memoryBudgetInBytes = size_t{ value } * 1024 * 1024; });
+            },
+            ConsoleFunctorFlags::Null,
+            "The memory budget of the streamed model lods in MB, or 0 for no budget."
+        );
+
         void ModelSystem::Reflect(AZ::ReflectContext* context)
         {
             ModelLodAsset::Reflect(context);
@@ -56,12 +93,26 @@ namespace AZ
                 return Model::CreateInternal(Data::Asset<ModelAsset>{modelAsset, AZ::Data::AssetLoadBehavior::PreLoad});
             };
             Data::InstanceDatabase<Model>::Create(azrtti_typeid<ModelAsset>(), modelInstanceHandler);
+
+            m_lodStreamingController.Init();
+
+            ModelLodStreamingConfiguration lodStreamingConfiguration;
+            lodStreamingConfiguration.m_enabled = r_modelLodStreaming;
+            lodStreamingConfiguration.m_memoryBudgetInBytes = size_t{ static_cast<uint32_t>(r_modelLodStreamingBudgetMB) } * 1024 * 1024;
+            m_lodStreamingController.SetConfiguration(lodStreamingConfiguration);
         }
 
         void ModelSystem::Shutdown()
         {
             Data::InstanceDatabase<Model>::Destroy();
             Data::InstanceDatabase<ModelLod>::Destroy();
+
+            m_lodStreamingController.Shutdown();
+        }
+
+        void ModelSystem::Update()
+        {
+            m_lodStreamingController.Update();
         }
     } // namespace RPI
 } // namespace AZ
@@ -237,6 +237,7 @@ namespace AZ
 
             // Image system update is using system tick but not game tick so it can stream images in background even game is pausing
             m_imageSystem.Update();
+            m_modelSystem.Update();
         }
 
         void RPISystem::SimulationTick()
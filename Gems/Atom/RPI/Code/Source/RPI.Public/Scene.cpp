@@ -357,18 +357,11 @@ namespace AZ
 
         void Scene::SimulateTaskGraph()
         {
-            static const AZ::TaskDescriptor simulationTGDesc{"RPI::Scene::Simulate", "Graphics"};
             AZ::TaskGraph simulationTG;
 
             for (FeatureProcessorPtr& fp : m_featureProcessors)
             {
-                FeatureProcessor* featureProcessor = fp.get();
-                simulationTG.AddTask(
-                    simulationTGDesc,
-                    [this, featureProcessor]()
-                    {
-                        featureProcessor->Simulate(m_simulatePacket);
-                    });
+                fp->AddSimulateTasks(simulationTG, m_simulatePacket);
             }
             simulationTG.Detach();
             m_simulationFinishedWorkActive = true;
@@ -112,6 +112,7 @@ namespace AZ
                 AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
                 m_shaderVariants.clear();
             }
+            m_variantLookupCache.Invalidate();
             m_rootVariant.Init(Data::Asset<ShaderAsset>{&shaderAsset, AZ::Data::AssetLoadBehavior::PreLoad}, shaderAsset.GetRootVariant(m_supervariantIndex), m_supervariantIndex);
 
             if (m_pipelineLibraryHandle.IsNull())
@@ -194,6 +195,14 @@ namespace AZ
 
         ///////////////////////////////////////////////////////////////////
         /// ShaderVariantFinderNotificationBus overrides
+        void Shader::OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset, bool /*isError*/)
+        {
+            ShaderReloadDebugTracker::ScopedSection reloadSection("{%p}->Shader::OnShaderVariantTreeAssetReady %s", this, shaderVariantTreeAsset.GetHint().c_str());
+
+            // The cached StableIds were found in the previous tree.
+            m_variantLookupCache.Invalidate();
+        }
+
         void Shader::OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> shaderVariantAsset, bool isError)
         {
             ShaderReloadDebugTracker::ScopedSection reloadSection("{%p}->Shader::OnShaderVariantAssetReady %s", this, shaderVariantAsset.GetHint().c_str());
@@ -315,10 +324,33 @@ namespace AZ
 
         ShaderVariantSearchResult Shader::FindVariantStableId(const ShaderVariantId& shaderVariantId) const
         {
-            ShaderVariantSearchResult variantSearchResult = m_asset->FindVariantStableId(shaderVariantId);
+            ShaderVariantSearchResult variantSearchResult{ RootShaderVariantStableId, 0 };
+            if (m_variantLookupCache.Find(shaderVariantId, variantSearchResult))
+            {
+                return variantSearchResult;
+            }
+
+            // The root variant is returned while the variant tree loads, so only the results of searches in a loaded tree are cached.
+            // The generation is acquired before the search, so a result found in a tree that is replaced meanwhile isn't cached.
+            const uint32_t generation = m_variantLookupCache.GetGeneration();
+            const bool isVariantTreeReady = m_asset->IsShaderVariantTreeReady();
+
+            const AZStd::sys_time_t searchStartTime = AZStd::GetTimeNowTicks();
+            variantSearchResult = m_asset->FindVariantStableId(shaderVariantId);
+            m_variantLookupCache.RecordTreeSearch(AZStd::GetTimeNowTicks() - searchStartTime);
+
+            if (isVariantTreeReady)
+            {
+                m_variantLookupCache.Insert(shaderVariantId, variantSearchResult, generation);
+            }
             return variantSearchResult;
         }
 
+        ShaderVariantLookupStats Shader::GetVariantLookupStats() const
+        {
+            return m_variantLookupCache.GetStats();
+        }
+
         const ShaderVariant& Shader::GetVariant(ShaderVariantStableId shaderVariantStableId)
         {
             if (!shaderVariantStableId.IsValid() || shaderVariantStableId == ShaderAsset::RootShaderVariantStableId)
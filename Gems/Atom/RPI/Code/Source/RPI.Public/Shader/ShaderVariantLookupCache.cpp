@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RPI.Public/Shader/ShaderVariantLookupCache.h>
+
+#include <AzCore/Utils/TypeHash.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        static_assert((ShaderVariantLookupCache::SlotCount & (ShaderVariantLookupCache::SlotCount - 1)) == 0, "SlotCount must be a power of two.");
+
+        uint32_t ShaderVariantLookupCache::GetGeneration() const
+        {
+            return m_generation.load(AZStd::memory_order_acquire);
+        }
+
+        bool ShaderVariantLookupCache::Find(const ShaderVariantId& shaderVariantId, ShaderVariantSearchResult& searchResult) const
+        {
+            m_lookupCount.fetch_add(1, AZStd::memory_order_relaxed);
+
+            const IdWords idWords = GetIdWords(shaderVariantId);
+            const Slot& slot = m_slots[GetSlotIndex(idWords)];
+
+            const uint32_t sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+            if (sequence & 1)
+            {
+                return false;
+            }
+
+            bool isMatch = slot.m_generation.load(AZStd::memory_order_relaxed) == GetGeneration();
+            for (uint32_t i = 0; i < idWords.size() && isMatch; ++i)
+            {
+                isMatch = slot.m_idWords[i].load(AZStd::memory_order_relaxed) == idWords[i];
+            }
+            const uint32_t stableId = slot.m_stableId.load(AZStd::memory_order_relaxed);
+            const uint32_t dynamicOptionCount = slot.m_dynamicOptionCount.load(AZStd::memory_order_relaxed);
+
+            // The entry is only valid if no writer touched the slot while it was read.
+            AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+            if (!isMatch || slot.m_sequence.load(AZStd::memory_order_relaxed) != sequence)
+            {
+                return false;
+            }
+
+            searchResult = ShaderVariantSearchResult(ShaderVariantStableId{ stableId }, dynamicOptionCount);
+            m_hitCount.fetch_add(1, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        void ShaderVariantLookupCache::Insert(const ShaderVariantId& shaderVariantId, const ShaderVariantSearchResult& searchResult, uint32_t generation)
+        {
+            const IdWords idWords = GetIdWords(shaderVariantId);
+            Slot& slot = m_slots[GetSlotIndex(idWords)];
+
+            // Claim the slot by making its sequence odd. If another thread is writing the slot, drop the entry.
+            uint32_t sequence = slot.m_sequence.load(AZStd::memory_order_relaxed);
+            if ((sequence & 1) || !slot.m_sequence.compare_exchange_strong(sequence, sequence + 1, AZStd::memory_order_acquire, AZStd::memory_order_relaxed))
+            {
+                return;
+            }
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+
+            slot.m_generation.store(generation, AZStd::memory_order_relaxed);
+            for (uint32_t i = 0; i < idWords.size(); ++i)
+            {
+                slot.m_idWords[i].store(idWords[i], AZStd::memory_order_relaxed);
+            }
+            slot.m_stableId.store(searchResult.GetStableId().GetIndex(), AZStd::memory_order_relaxed);
+            slot.m_dynamicOptionCount.store(searchResult.GetDynamicOptionCount(), AZStd::memory_order_relaxed);
+
+            slot.m_sequence.store(sequence + 2, AZStd::memory_order_release);
+        }
+
+        void ShaderVariantLookupCache::Invalidate()
+        {
+            // Generation 0 marks empty slots, so skip it when the counter wraps around.
+            uint32_t generation = m_generation.load(AZStd::memory_order_relaxed);
+            uint32_t nextGeneration;
+            do
+            {
+                nextGeneration = generation + 1 == 0 ? 1 : generation + 1;
+            } while (!m_generation.compare_exchange_weak(generation, nextGeneration, AZStd::memory_order_acq_rel, AZStd::memory_order_relaxed));
+        }
+
+        void ShaderVariantLookupCache::RecordTreeSearch(AZStd::sys_time_t searchTimeTicks)
+        {
+            m_treeSearchCount.fetch_add(1, AZStd::memory_order_relaxed);
+            m_treeSearchTimeTicks.fetch_add(static_cast<uint64_t>(searchTimeTicks), AZStd::memory_order_relaxed);
+        }
+
+        ShaderVariantLookupStats ShaderVariantLookupCache::GetStats() const
+        {
+            ShaderVariantLookupStats stats;
+            stats.m_lookupCount = m_lookupCount.load(AZStd::memory_order_relaxed);
+            stats.m_hitCount = m_hitCount.load(AZStd::memory_order_relaxed);
+            stats.m_treeSearchCount = m_treeSearchCount.load(AZStd::memory_order_relaxed);
+
+            const double treeSearchTimeTicks = static_cast<double>(m_treeSearchTimeTicks.load(AZStd::memory_order_relaxed));
+            stats.m_treeSearchTimeNanoseconds = static_cast<uint64_t>(treeSearchTimeTicks * 1.0e9 / static_cast<double>(AZStd::GetTimeTicksPerSecond()));
+            return stats;
+        }
+
+        ShaderVariantLookupCache::IdWords ShaderVariantLookupCache::GetIdWords(const ShaderVariantId& shaderVariantId)
+        {
+            IdWords idWords;
+            for (uint32_t i = 0; i < KeyWordCount; ++i)
+            {
+                idWords[i] = shaderVariantId.m_key.data()[i];
+                idWords[KeyWordCount + i] = shaderVariantId.m_mask.data()[i];
+            }
+            return idWords;
+        }
+
+        uint32_t ShaderVariantLookupCache::GetSlotIndex(const IdWords& idWords)
+        {
+            const HashValue64 hash = TypeHash64(reinterpret_cast<const uint8_t*>(idWords.data()), sizeof(IdWords));
+            return static_cast<uint32_t>(static_cast<uint64_t>(hash)) & (SlotCount - 1);
+        }
+    } // namespace RPI
+} // namespace AZ
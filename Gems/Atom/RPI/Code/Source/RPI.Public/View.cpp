@@ -17,6 +17,9 @@
 
 #include <AzCore/Casting/lossy_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Atom_RPI_Traits_Platform.h>
@@ -246,15 +249,50 @@ namespace AZ
 
         void View::SortFinalizedDrawLists()
         {
+            AZ_PROFILE_SCOPE(RPI, "View: SortFinalizedDrawLists");
             RHI::DrawListsByTag& drawListsByTag = m_drawListContext.GetMergedDrawListsByTag();
 
+            //The draw lists of different tags are independent, so when there are multiple large ones they are sorted in parallel
+            size_t numLargeDrawLists = 0;
+            for (const RHI::DrawList& drawList : drawListsByTag)
+            {
+                if (drawList.size() >= ParallelSortMinDrawItemCount)
+                {
+                    ++numLargeDrawLists;
+                }
+            }
+            const bool sortInParallel = numLargeDrawLists > 1 && AZ::JobContext::GetGlobalContext();
+
+            AZ::JobCompletion sortCompletion;
             for (size_t idx = 0; idx < drawListsByTag.size(); ++idx)
             {
-                if (drawListsByTag[idx].size() > 1)
+                RHI::DrawList& drawList = drawListsByTag[idx];
+                if (drawList.size() <= 1)
+                {
+                    continue;
+                }
+
+                if (sortInParallel && drawList.size() >= ParallelSortMinDrawItemCount)
+                {
+                    const auto sortLambda = [this, &drawList, idx]()
+                    {
+                        SortDrawList(drawList, RHI::DrawListTag(idx));
+                    };
+
+                    AZ::Job* sortJob = AZ::CreateJobFunction(AZStd::move(sortLambda), true, nullptr);
+                    sortJob->SetDependent(&sortCompletion);
+                    sortJob->Start();
+                }
+                else
                 {
-                    SortDrawList(drawListsByTag[idx], RHI::DrawListTag(idx));
+                    SortDrawList(drawList, RHI::DrawListTag(idx));
                 }
             }
+
+            if (sortInParallel)
+            {
+                sortCompletion.StartAndWaitForCompletion();
+            }
         }
 
         void View::SortDrawList(RHI::DrawList& drawList, RHI::DrawListTag tag)
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Image/BudgetedStreamingImageControllerAsset.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        const Data::AssetId BudgetedStreamingImageControllerAsset::BuiltInAssetId("{C7EE5371-0D65-4927-A385-980F4E60F669}");
+
+        BudgetedStreamingImageControllerAsset::BudgetedStreamingImageControllerAsset()
+        {
+            m_status = AssetStatus::Ready;
+        }
+
+        void BudgetedStreamingImageControllerAsset::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<BudgetedStreamingImageControllerAsset, StreamingImageControllerAsset>()
+                    ->Version(0)
+                    ->Field("MemoryBudgetInBytes", &BudgetedStreamingImageControllerAsset::m_memoryBudgetInBytes)
+                    ->Field("MaxExpandsPerUpdate", &BudgetedStreamingImageControllerAsset::m_maxExpandsPerUpdate)
+                    ;
+            }
+        }
+
+        size_t BudgetedStreamingImageControllerAsset::GetMemoryBudgetInBytes() const
+        {
+            return static_cast<size_t>(m_memoryBudgetInBytes);
+        }
+
+        uint32_t BudgetedStreamingImageControllerAsset::GetMaxExpandsPerUpdate() const
+        {
+            return m_maxExpandsPerUpdate;
+        }
+    }
+}
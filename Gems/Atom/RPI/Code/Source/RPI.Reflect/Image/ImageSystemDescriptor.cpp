@@ -24,6 +24,7 @@ namespace AZ
                     ->Field("AssetStreamingImagePoolSize", &ImageSystemDescriptor::m_assetStreamingImagePoolSize)
                     ->Field("SystemStreamingImagePoolSize", &ImageSystemDescriptor::m_systemStreamingImagePoolSize)
                     ->Field("SystemAttachmentImagePoolSize", &ImageSystemDescriptor::m_systemAttachmentImagePoolSize)
+                    ->Field("UseBudgetedStreamingImageController", &ImageSystemDescriptor::m_useBudgetedStreamingImageController)
                     ;
             }
         }
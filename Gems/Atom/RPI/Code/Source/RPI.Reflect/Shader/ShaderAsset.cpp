@@ -227,6 +227,17 @@ namespace AZ
             return m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
         }
 
+        bool ShaderAsset::IsShaderVariantTreeReady() const
+        {
+            if (GetShaderOptionGroupLayout()->GetShaderOptions().empty())
+            {
+                return true;
+            }
+
+            AZStd::shared_lock<decltype(m_variantTreeMutex)> lock(m_variantTreeMutex);
+            return m_shaderVariantTree.Get() != nullptr;
+        }
+
         Data::Asset<ShaderVariantAsset> ShaderAsset::GetVariant(
             ShaderVariantStableId shaderVariantStableId, SupervariantIndex supervariantIndex) const
         {
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/ShapeIntersection.h>
+
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+#include <Common/RPITestFixture.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    /*
+     * Frustum tests and lod selection of 16384 cullables spread around the camera, one full pass per iteration,
+     * so the reported items are tested cullables. This is the per cullable work of the cull jobs, without the
+     * octree traversal and without adding draw packets to the view.
+     */
+    class CullingBenchmarkFixture
+        : public TestFixtureBenchmarkFixture<RPITestFixture>
+    {
+    public:
+        static constexpr uint32_t NumCullables = 16384;
+
+        void SetUpBenchmark() override
+        {
+            Matrix4x4 viewToClip;
+            MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 1.5f, 0.1f, 100.0f);
+            m_frustum = Frustum::CreateFromMatrixColumnMajor(viewToClip);
+            m_yScale = viewToClip.GetElement(1, 1);
+
+            SimpleLcgRandom random(1234);
+            m_cullables.resize(NumCullables);
+            for (Cullable& cullable : m_cullables)
+            {
+                const Vector3 center(
+                    random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f);
+                cullable.m_cullData.m_boundingSphere = Sphere(center, 0.1f + random.GetRandomFloat() * 5.0f);
+                cullable.m_lodData.m_lodSelectionRadius = 0.1f + random.GetRandomFloat() * 2.0f;
+            }
+        }
+
+        void TearDownBenchmark() override
+        {
+            m_cullables = {};
+        }
+
+        AZStd::vector<Cullable> m_cullables;
+        Frustum m_frustum;
+        float m_yScale = 1.0f;
+    };
+
+    BENCHMARK_F(CullingBenchmarkFixture, CullCullables_Scalar)(benchmark::State& state)
+    {
+        const Vector3 cameraPos = Vector3::CreateZero();
+        uint32_t numCulled = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (Cullable& cullable : m_cullables)
+            {
+                const Sphere& sphere = cullable.m_cullData.m_boundingSphere;
+                if (ShapeIntersection::Classify(m_frustum, sphere) == IntersectResult::Exterior)
+                {
+                    ++numCulled;
+                    continue;
+                }
+
+                float screenPercentage = ModelLodUtils::ApproxScreenPercentage(
+                    sphere.GetCenter(), cullable.m_lodData.m_lodSelectionRadius, cameraPos, m_yScale, true);
+                benchmark::DoNotOptimize(screenPercentage);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * NumCullables);
+        state.counters["CulledPerIteration"] = ::benchmark::Counter(static_cast<double>(numCulled), ::benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_F(CullingBenchmarkFixture, CullCullables_Block)(benchmark::State& state)
+    {
+        const Vector3 cameraPos = Vector3::CreateZero();
+        CullableBlock block;
+        IntersectResult intersectResults[CullableBlock::Capacity];
+        float screenPercentages[CullableBlock::Capacity];
+        uint32_t numCulled = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (Cullable& cullable : m_cullables)
+            {
+                block.Add(&cullable, &cullable.m_cullData.m_visibilityEntry);
+                if (!block.IsFull())
+                {
+                    continue;
+                }
+
+                ClassifyBoundingSpheres(m_frustum, block, intersectResults);
+                ApproxScreenPercentages(block, cameraPos, m_yScale, true, screenPercentages);
+                for (uint32_t i = 0; i < block.m_count; ++i)
+                {
+                    numCulled += intersectResults[i] == IntersectResult::Exterior ? 1 : 0;
+                }
+                benchmark::DoNotOptimize(screenPercentages);
+                block.Clear();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * NumCullables);
+        state.counters["CulledPerIteration"] = ::benchmark::Counter(static_cast<double>(numCulled), ::benchmark::Counter::kAvgIterations);
+    }
+
+    /*
+     * Culls a scene of 16384 cullables spread around a camera view with CullingScene::ProcessCullables, one frame per
+     * iteration, so the reported items are cullables in the scene. This covers the octree traversal, the cull jobs and the
+     * lod selection, like Scene does every frame. The cullables have lods without draw packets, since the stub RHI can't
+     * build them, so adding draw packets to the view isn't measured.
+     */
+    class CullingSceneBenchmarkFixture
+        : public TestFixtureBenchmarkFixture<RPITestFixture>
+    {
+    public:
+        static constexpr uint32_t NumCullables = 16384;
+
+        void SetUpBenchmark() override
+        {
+            m_octreeSystemComponent = AZStd::make_unique<AzFramework::OctreeSystemComponent>();
+
+            m_scene = Scene::CreateScene(SceneDescriptor());
+            m_scene->Activate();
+            m_cullingScene = m_scene->GetCullingScene();
+            m_cullingScene->GetDebugContext().m_enableStats = true;
+
+            RHI::DrawListMask drawListMask;
+            drawListMask.set(0);
+
+            Matrix4x4 viewToClip;
+            MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 1.5f, 0.1f, 100.0f);
+            ViewPtr view = View::CreateView(AZ::Name("CullingBenchmarkView"), View::UsageCamera);
+            view->SetViewToClipMatrix(viewToClip);
+            view->SetCameraTransform(Matrix3x4::CreateIdentity());
+            view->SetDrawListMask(drawListMask);
+            m_views.push_back(view);
+
+            // The octree keeps pointers to the visibility entries, so the cullables are not moved once they are registered.
+            SimpleLcgRandom random(1234);
+            m_cullables.resize(NumCullables);
+            for (Cullable& cullable : m_cullables)
+            {
+                const Vector3 center(
+                    random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f);
+                const float radius = 0.1f + random.GetRandomFloat() * 5.0f;
+                const Aabb bounds = Aabb::CreateCenterRadius(center, radius);
+
+                cullable.m_cullData.m_boundingSphere = Sphere(center, radius);
+                cullable.m_cullData.m_boundingObb = Obb::CreateFromAabb(bounds);
+                cullable.m_cullData.m_drawListMask = drawListMask;
+                cullable.m_cullData.m_scene = m_scene.get();
+                cullable.m_lodData.m_lodSelectionRadius = radius * 0.5f;
+                cullable.m_lodData.m_lods.resize(3);
+                cullable.m_lodData.m_lods[0].m_screenCoverageMin = 0.1f;
+                cullable.m_lodData.m_lods[0].m_screenCoverageMax = 1.0f;
+                cullable.m_lodData.m_lods[1].m_screenCoverageMin = 0.01f;
+                cullable.m_lodData.m_lods[1].m_screenCoverageMax = 0.1f;
+                cullable.m_lodData.m_lods[2].m_screenCoverageMin = 0.0f;
+                cullable.m_lodData.m_lods[2].m_screenCoverageMax = 0.01f;
+
+                cullable.m_cullData.m_visibilityEntry.m_boundingVolume = bounds;
+                cullable.m_cullData.m_visibilityEntry.m_userData = &cullable;
+                cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
+                m_cullingScene->RegisterOrUpdateCullable(cullable);
+            }
+        }
+
+        void TearDownBenchmark() override
+        {
+            for (Cullable& cullable : m_cullables)
+            {
+                m_cullingScene->UnregisterCullable(cullable);
+            }
+            m_cullables = {};
+            m_views = {};
+            m_cullingScene = nullptr;
+            m_scene = nullptr;
+            m_octreeSystemComponent.reset();
+        }
+
+        //! Culls the view of the scene the same way Scene does it with parallel octree traversal.
+        void ProcessCullables()
+        {
+            m_cullingScene->BeginCulling(m_views);
+
+            AZ::JobCompletion processCullablesCompletion;
+            for (ViewPtr& viewPtr : m_views)
+            {
+                AZ::Job* processCullablesJob = AZ::CreateJobFunction([this, &viewPtr](AZ::Job& thisJob)
+                    {
+                        m_cullingScene->ProcessCullables(*m_scene, *viewPtr, thisJob);
+                    },
+                    true, nullptr);
+                processCullablesJob->SetDependent(&processCullablesCompletion);
+                processCullablesJob->Start();
+            }
+            processCullablesCompletion.StartAndWaitForCompletion();
+
+            m_cullingScene->EndCulling();
+        }
+
+        AZStd::unique_ptr<AzFramework::OctreeSystemComponent> m_octreeSystemComponent;
+        ScenePtr m_scene;
+        CullingScene* m_cullingScene = nullptr;
+        AZStd::vector<ViewPtr> m_views;
+        AZStd::vector<Cullable> m_cullables;
+    };
+
+    BENCHMARK_F(CullingSceneBenchmarkFixture, ProcessCullables)(benchmark::State& state)
+    {
+        uint64_t numVisible = 0;
+        uint64_t numTested = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ProcessCullables();
+
+            const CullingDebugContext::CullStats& cullStats = m_cullingScene->GetDebugContext().GetCullStatsForView(m_views.front().get());
+            numVisible += cullStats.m_numVisibleCullables;
+            numTested += cullStats.m_numTestedCullables;
+        }
+
+        state.SetItemsProcessed(state.iterations() * NumCullables);
+        state.counters["VisiblePerIteration"] = ::benchmark::Counter(static_cast<double>(numVisible), ::benchmark::Counter::kAvgIterations);
+        state.counters["TestedPerIteration"] = ::benchmark::Counter(static_cast<double>(numTested), ::benchmark::Counter::kAvgIterations);
+    }
+} // namespace UnitTest
+#endif
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
+
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class CullingTests
+        : public RPITestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+
+            // The camera looks down -z, the frustum spans the center of the random cullables.
+            Matrix4x4 viewToClip;
+            MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 1.5f, 0.1f, 40.0f);
+            m_frustum = Frustum::CreateFromMatrixColumnMajor(viewToClip);
+            m_yScale = viewToClip.GetElement(1, 1);
+        }
+
+        void TearDown() override
+        {
+            m_cullables = {};
+            RPITestFixture::TearDown();
+        }
+
+        //! Creates cullables with random bounding spheres around the camera and adds them to the block.
+        void CreateCullables(CullableBlock& block, uint32_t count)
+        {
+            SimpleLcgRandom random(1234);
+            m_cullables.resize(count);
+            for (Cullable& cullable : m_cullables)
+            {
+                const Vector3 center(
+                    random.GetRandomFloat() * 60.0f - 30.0f, random.GetRandomFloat() * 60.0f - 30.0f, random.GetRandomFloat() * 60.0f - 30.0f);
+                cullable.m_cullData.m_boundingSphere = Sphere(center, 0.1f + random.GetRandomFloat() * 5.0f);
+                cullable.m_lodData.m_lodSelectionRadius = 0.1f + random.GetRandomFloat() * 2.0f;
+                block.Add(&cullable, &cullable.m_cullData.m_visibilityEntry);
+            }
+        }
+
+        AZStd::vector<Cullable> m_cullables;
+        Frustum m_frustum;
+        float m_yScale = 1.0f;
+    };
+
+    TEST_F(CullingTests, ClassifyBoundingSpheres_MatchesScalarClassify)
+    {
+        // Not a multiple of four, so the last lanes of the block are unused.
+        CullableBlock block;
+        CreateCullables(block, CullableBlock::Capacity - 3);
+
+        IntersectResult results[CullableBlock::Capacity];
+        ClassifyBoundingSpheres(m_frustum, block, results);
+
+        uint32_t numExterior = 0;
+        uint32_t numInterior = 0;
+        for (uint32_t i = 0; i < block.m_count; ++i)
+        {
+            const IntersectResult expected = ShapeIntersection::Classify(m_frustum, m_cullables[i].m_cullData.m_boundingSphere);
+            EXPECT_EQ(results[i], expected) << "Cullable " << i;
+
+            numExterior += expected == IntersectResult::Exterior ? 1 : 0;
+            numInterior += expected == IntersectResult::Interior ? 1 : 0;
+        }
+
+        // Make sure the random cullables cover more than one case.
+        EXPECT_GT(numExterior, 0);
+        EXPECT_GT(numInterior, 0);
+    }
+
+    TEST_F(CullingTests, ApproxScreenPercentages_MatchesScalarApproxScreenPercentage)
+    {
+        CullableBlock block;
+        CreateCullables(block, CullableBlock::Capacity - 1);
+
+        const Vector3 cameraPos(1.0f, 2.0f, 3.0f);
+        float results[CullableBlock::Capacity];
+        for (bool isPerspective : { true, false })
+        {
+            ApproxScreenPercentages(block, cameraPos, m_yScale, isPerspective, results);
+            for (uint32_t i = 0; i < block.m_count; ++i)
+            {
+                const float expected = ModelLodUtils::ApproxScreenPercentage(
+                    m_cullables[i].m_cullData.m_boundingSphere.GetCenter(), m_cullables[i].m_lodData.m_lodSelectionRadius,
+                    cameraPos, m_yScale, isPerspective);
+                EXPECT_NEAR(results[i], expected, 0.0001f) << "Cullable " << i;
+            }
+        }
+    }
+
+    TEST_F(CullingTests, CullableBlock_AddAndClear)
+    {
+        CullableBlock block;
+        EXPECT_EQ(block.m_count, 0);
+
+        CreateCullables(block, CullableBlock::Capacity);
+        EXPECT_TRUE(block.IsFull());
+        EXPECT_EQ(block.m_cullables[5], &m_cullables[5]);
+        EXPECT_EQ(block.m_centerY[5], m_cullables[5].m_cullData.m_boundingSphere.GetCenter().GetY());
+        EXPECT_EQ(block.m_radius[5], m_cullables[5].m_cullData.m_boundingSphere.GetRadius());
+
+        block.Clear();
+        EXPECT_EQ(block.m_count, 0);
+        EXPECT_FALSE(block.IsFull());
+    }
+} // namespace UnitTest
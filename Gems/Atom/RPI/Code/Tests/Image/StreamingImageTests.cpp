@@ -16,12 +16,14 @@
 #include <Atom/RPI.Reflect/Image/StreamingImagePoolAsset.h>
 #include <Atom/RPI.Reflect/Image/StreamingImagePoolAssetCreator.h>
 #include <Atom/RPI.Reflect/Image/DefaultStreamingImageControllerAsset.h>
+#include <Atom/RPI.Reflect/Image/BudgetedStreamingImageControllerAsset.h>
 #include <Atom/RPI.Reflect/Asset/BuiltInAssetHandler.h>
 
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
+#include <Atom/RPI.Public/Image/BudgetedStreamingImageController.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
@@ -413,17 +415,25 @@ namespace UnitTest
         {
             using namespace AZ;
 
+            return BuildImagePoolAsset(
+                budgetInBytes,
+                Data::AssetManager::Instance().GetAsset<RPI::DefaultStreamingImageControllerAsset>(
+                    m_testControllerAssetId,
+                    Data::AssetLoadBehavior::PreLoad));
+        }
+
+        AZ::Data::Asset<AZ::RPI::StreamingImagePoolAsset> BuildImagePoolAsset(
+            size_t budgetInBytes, const AZ::Data::Asset<AZ::RPI::StreamingImageControllerAsset>& controllerAsset)
+        {
+            using namespace AZ;
+
             RPI::StreamingImagePoolAssetCreator assetCreator;
 
             assetCreator.Begin(Data::AssetId(Uuid::CreateRandom()));
 
             assetCreator.SetPoolDescriptor(AZStd::make_unique<TestStreamingImagePoolDescriptor>(budgetInBytes));
 
-            assetCreator.SetControllerAsset(
-                Data::AssetManager::Instance().GetAsset<RPI::DefaultStreamingImageControllerAsset>(
-                    m_testControllerAssetId,
-                    Data::AssetLoadBehavior::PreLoad)
-            );
+            assetCreator.SetControllerAsset(controllerAsset);
 
             Data::Asset<RPI::StreamingImagePoolAsset> poolAsset;
             EXPECT_TRUE(assetCreator.End(poolAsset));
@@ -434,6 +444,11 @@ namespace UnitTest
         }
 
         AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage()
+        {
+            return BuildTestImage(m_defaultPool->GetAssetId());
+        }
+
+        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage(const AZ::Data::AssetId& poolAssetId)
         {
             using namespace AZ;
 
@@ -460,7 +475,7 @@ namespace UnitTest
             assetCreator.AddMipChainAsset(*mipHead.Get());
             assetCreator.AddMipChainAsset(*mipMiddle.Get());
             assetCreator.AddMipChainAsset(*mipTail.Get());
-            assetCreator.SetPoolAssetId(m_defaultPool->GetAssetId());
+            assetCreator.SetPoolAssetId(poolAssetId);
 
             Data::Asset<RPI::StreamingImageAsset> imageAsset;
             EXPECT_TRUE(assetCreator.End(imageAsset));
@@ -726,4 +741,91 @@ namespace UnitTest
 
         RPI::ImageSystemInterface::Get()->Update();
     }
+
+    TEST_F(StreamingImageTests, BudgetedControllerStreamsByPriorityWithinBudget)
+    {
+        using namespace AZ;
+
+        const size_t poolBudgetInBytes = 16 * 1024 * 1024;
+        Data::Asset<RPI::StreamingImagePoolAsset> poolAsset = BuildImagePoolAsset(
+            poolBudgetInBytes,
+            Data::AssetManager::Instance().GetAsset<RPI::BudgetedStreamingImageControllerAsset>(
+                RPI::BudgetedStreamingImageControllerAsset::BuiltInAssetId,
+                Data::AssetLoadBehavior::PreLoad));
+        Data::Instance<RPI::StreamingImagePool> pool = RPI::StreamingImagePool::FindOrCreate(poolAsset);
+        ASSERT_NE(pool, nullptr);
+
+        auto* controller = azrtti_cast<RPI::BudgetedStreamingImageController*>(pool->GetController());
+        ASSERT_NE(controller, nullptr);
+
+        // The test images are 64x64 RGBA8 arrays of 2 slices, with a mip chain of mip 0, mips 1-2 and mips 3-5.
+        const size_t mipChainTailBytes = (8 * 8 + 4 * 4 + 2 * 2) * 4 * 2;
+        const size_t mipChainMiddleBytes = (32 * 32 + 16 * 16) * 4 * 2;
+        const size_t mipChainHeadBytes = 64 * 64 * 4 * 2;
+
+        AZStd::array<Data::Asset<RPI::StreamingImageAsset>, 3> imageAssets;
+        AZStd::array<Data::Instance<RPI::StreamingImage>, 3> images;
+        for (size_t i = 0; i < images.size(); ++i)
+        {
+            imageAssets[i] = BuildTestImage(poolAsset.GetId());
+            images[i] = RPI::StreamingImage::FindOrCreate(imageAssets[i]);
+            ASSERT_NE(images[i], nullptr);
+        }
+
+        const uint16_t mipLevelTail = static_cast<uint16_t>(imageAssets[0]->GetMipLevel(2));
+
+        // Room for the tails and one fully resident image.
+        const size_t budgetInBytes = 3 * mipChainTailBytes + mipChainMiddleBytes + mipChainHeadBytes;
+        controller->SetMemoryBudget(budgetInBytes);
+
+        // The first image is the largest on screen and takes all the budget. The second one doesn't fit, and the third
+        // one never requested a mip so it comes last.
+        images[0]->SetTargetMip(0);
+        images[1]->SetTargetMip(1);
+        RPI::ImageSystemInterface::Get()->Update();
+
+        EXPECT_EQ(images[0]->GetResidentMipLevel(), 0);
+        EXPECT_EQ(images[1]->GetResidentMipLevel(), mipLevelTail);
+        EXPECT_EQ(images[2]->GetResidentMipLevel(), mipLevelTail);
+
+        RPI::StreamingImageBudgetStats stats = controller->GetBudgetStats();
+        EXPECT_EQ(stats.m_budgetInBytes, budgetInBytes);
+        EXPECT_EQ(stats.m_committedBytes, budgetInBytes);
+        EXPECT_EQ(stats.m_imageCount, 3u);
+        EXPECT_EQ(stats.m_imagesAtTargetCount, 1u);
+        EXPECT_EQ(stats.m_expandCount, 1u);
+        EXPECT_EQ(stats.m_trimCount, 0u);
+
+        // The second image moves closer while the first one goes out of view, so the first image's mips are evicted
+        // to make room.
+        images[1]->SetTargetMip(0);
+        RPI::ImageSystemInterface::Get()->Update();
+
+        EXPECT_EQ(images[0]->GetResidentMipLevel(), mipLevelTail);
+        EXPECT_EQ(images[1]->GetResidentMipLevel(), 0);
+        EXPECT_EQ(images[2]->GetResidentMipLevel(), mipLevelTail);
+
+        stats = controller->GetBudgetStats();
+        EXPECT_EQ(stats.m_committedBytes, budgetInBytes);
+        EXPECT_EQ(stats.m_expandCount, 1u);
+        EXPECT_EQ(stats.m_trimCount, 1u);
+        EXPECT_LE(stats.m_residentBytes, budgetInBytes);
+
+        // Falling back to the budget of the pool leaves room for everything. The image that never requested a mip
+        // is streamed in, and the unused first image keeps its mip chain tail.
+        controller->SetMemoryBudget(0);
+        RPI::ImageSystemInterface::Get()->Update();
+
+        EXPECT_EQ(images[0]->GetResidentMipLevel(), mipLevelTail);
+        EXPECT_EQ(images[1]->GetResidentMipLevel(), 0);
+        EXPECT_EQ(images[2]->GetResidentMipLevel(), 0);
+
+        stats = controller->GetBudgetStats();
+        EXPECT_EQ(stats.m_budgetInBytes, poolBudgetInBytes);
+        EXPECT_EQ(stats.m_committedBytes, 3 * mipChainTailBytes + 2 * (mipChainMiddleBytes + mipChainHeadBytes));
+        EXPECT_EQ(stats.m_trimCount, 0u);
+
+        images = {};
+        pool = nullptr;
+    }
 }
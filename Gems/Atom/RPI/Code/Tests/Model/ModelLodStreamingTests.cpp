@@ -0,0 +1,488 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Model/ModelLodStreamingInterface.h>
+#include <Atom/RPI.Reflect/Buffer/BufferAssetCreator.h>
+#include <Atom/RPI.Reflect/Model/ModelAssetCreator.h>
+#include <Atom/RPI.Reflect/Model/ModelLodAssetCreator.h>
+#include <Atom/RPI.Reflect/ResourcePoolAssetCreator.h>
+
+#include <AzTest/AzTest.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class ModelLodStreamingTests
+        : public RPITestFixture
+    {
+    protected:
+        static constexpr uint32_t LodCount = 3;
+
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+
+            m_lodStreaming = ModelLodStreamingInterface::Get();
+            ASSERT_NE(m_lodStreaming, nullptr);
+
+            m_originalConfiguration = m_lodStreaming->GetConfiguration();
+
+            ModelLodStreamingConfiguration configuration;
+            configuration.m_enabled = true;
+            m_lodStreaming->SetConfiguration(configuration);
+        }
+
+        void TearDown() override
+        {
+            m_lodStreaming->SetConfiguration(m_originalConfiguration);
+            m_lodStreaming = nullptr;
+
+            RPITestFixture::TearDown();
+        }
+
+        void SetMemoryBudget(size_t budgetInBytes, uint32_t evictionDelayInUpdates = 0)
+        {
+            ModelLodStreamingConfiguration configuration = m_lodStreaming->GetConfiguration();
+            configuration.m_memoryBudgetInBytes = budgetInBytes;
+            configuration.m_evictionDelayInUpdates = evictionDelayInUpdates;
+            m_lodStreaming->SetConfiguration(configuration);
+        }
+
+        //! Each lod has a quarter of the vertices of the previous lod.
+        static uint32_t GetLodVertexCount(uint32_t lodIndex)
+        {
+            return 256u >> (2 * lodIndex);
+        }
+
+        //! The memory of the index and position buffers of the lod.
+        static size_t GetLodBytes(uint32_t lodIndex)
+        {
+            return GetLodVertexCount(lodIndex) * (sizeof(uint32_t) + sizeof(float) * 3);
+        }
+
+        //! The memory of the lod and all less detailed lods.
+        static size_t GetLodTailBytes(uint32_t lodIndex)
+        {
+            size_t byteCount = 0;
+            for (; lodIndex < LodCount; ++lodIndex)
+            {
+                byteCount += GetLodBytes(lodIndex);
+            }
+            return byteCount;
+        }
+
+        static Data::Asset<BufferAsset> BuildBuffer(uint32_t elementCount, uint32_t elementSize, const Data::Asset<ResourcePoolAsset>& bufferPoolAsset)
+        {
+            AZStd::vector<uint8_t> bufferData(elementCount * elementSize, 0);
+
+            RHI::BufferDescriptor bufferDescriptor;
+            bufferDescriptor.m_bindFlags = RHI::BufferBindFlags::InputAssembly;
+            bufferDescriptor.m_byteCount = bufferData.size();
+
+            BufferAssetCreator creator;
+            creator.Begin(Uuid::CreateRandom());
+            creator.SetPoolAsset(bufferPoolAsset);
+            creator.SetBuffer(bufferData.data(), bufferDescriptor.m_byteCount, bufferDescriptor);
+            creator.SetBufferViewDescriptor(RHI::BufferViewDescriptor::CreateStructured(0, elementCount, elementSize));
+
+            Data::Asset<BufferAsset> asset;
+            EXPECT_TRUE(creator.End(asset));
+            return asset;
+        }
+
+        Data::Asset<ModelAsset> BuildModelAsset()
+        {
+            if (!m_bufferPoolAsset)
+            {
+                auto bufferPoolDesc = AZStd::make_unique<RHI::BufferPoolDescriptor>();
+                bufferPoolDesc->m_bindFlags = RHI::BufferBindFlags::InputAssembly;
+                bufferPoolDesc->m_heapMemoryLevel = RHI::HeapMemoryLevel::Host;
+
+                ResourcePoolAssetCreator creator;
+                creator.Begin(Uuid::CreateRandom());
+                creator.SetPoolDescriptor(AZStd::move(bufferPoolDesc));
+                creator.SetPoolName("TestPool");
+                EXPECT_TRUE(creator.End(m_bufferPoolAsset));
+            }
+
+            ModelAssetCreator modelCreator;
+            modelCreator.Begin(Data::AssetId(Uuid::CreateRandom()));
+            modelCreator.SetName("StreamedModel");
+
+            for (uint32_t lodIndex = 0; lodIndex < LodCount; ++lodIndex)
+            {
+                const uint32_t vertexCount = GetLodVertexCount(lodIndex);
+
+                ModelLodAssetCreator lodCreator;
+                lodCreator.Begin(Data::AssetId(Uuid::CreateRandom()));
+
+                Data::Asset<BufferAsset> indexBuffer = BuildBuffer(vertexCount, sizeof(uint32_t), m_bufferPoolAsset);
+                Data::Asset<BufferAsset> positionBuffer = BuildBuffer(vertexCount, sizeof(float) * 3, m_bufferPoolAsset);
+
+                lodCreator.BeginMesh();
+                lodCreator.SetMeshAabb(Aabb::CreateFromMinMax(Vector3(-1.0f), Vector3(1.0f)));
+                lodCreator.SetMeshIndexBuffer({ indexBuffer, RHI::BufferViewDescriptor::CreateStructured(0, vertexCount, sizeof(uint32_t)) });
+                lodCreator.AddMeshStreamBuffer(
+                    RHI::ShaderSemantic(Name("POSITION")), Name(),
+                    { positionBuffer, RHI::BufferViewDescriptor::CreateStructured(0, vertexCount, sizeof(float) * 3) });
+                lodCreator.EndMesh();
+
+                Data::Asset<ModelLodAsset> lodAsset;
+                EXPECT_TRUE(lodCreator.End(lodAsset));
+                modelCreator.AddLodAsset(AZStd::move(lodAsset));
+            }
+
+            Data::Asset<ModelAsset> modelAsset;
+            EXPECT_TRUE(modelCreator.End(modelAsset));
+            return modelAsset;
+        }
+
+        Data::Instance<Model> CreateModel()
+        {
+            Data::Instance<Model> model = Model::FindOrCreate(BuildModelAsset());
+            EXPECT_NE(model, nullptr);
+            return model;
+        }
+
+        static size_t GetMostDetailedResidentLod(const Model& model)
+        {
+            return model.GetResidentLodIndex(0);
+        }
+
+        ModelLodStreamingInterface* m_lodStreaming = nullptr;
+        ModelLodStreamingConfiguration m_originalConfiguration;
+        Data::Asset<ResourcePoolAsset> m_bufferPoolAsset;
+    };
+
+    TEST_F(ModelLodStreamingTests, CreateModel_OnlyLeastDetailedLodIsResident)
+    {
+        Data::Instance<Model> model = CreateModel();
+        ASSERT_NE(model, nullptr);
+
+        EXPECT_TRUE(model->IsLodStreamed());
+        EXPECT_EQ(model->GetLodCount(), LodCount);
+        EXPECT_FALSE(model->IsLodResident(0));
+        EXPECT_FALSE(model->IsLodResident(1));
+        EXPECT_TRUE(model->IsLodResident(2));
+        EXPECT_EQ(model->GetLods()[0], nullptr);
+        EXPECT_NE(model->GetLods()[2], nullptr);
+        EXPECT_EQ(model->GetResidentLodIndex(0), 2u);
+
+        m_lodStreaming->Update();
+
+        const ModelLodStreamingStats stats = m_lodStreaming->GetStats();
+        EXPECT_EQ(stats.m_modelCount, 1u);
+        EXPECT_EQ(stats.m_lodCount, LodCount);
+        EXPECT_EQ(stats.m_residentLodCount, 1u);
+        EXPECT_EQ(stats.m_residentBytes, GetLodTailBytes(2));
+    }
+
+    TEST_F(ModelLodStreamingTests, CreateModel_StreamingDisabled_AllLodsAreResident)
+    {
+        ModelLodStreamingConfiguration configuration = m_lodStreaming->GetConfiguration();
+        configuration.m_enabled = false;
+        m_lodStreaming->SetConfiguration(configuration);
+
+        Data::Instance<Model> model = CreateModel();
+        ASSERT_NE(model, nullptr);
+
+        EXPECT_FALSE(model->IsLodStreamed());
+        for (size_t lodIndex = 0; lodIndex < LodCount; ++lodIndex)
+        {
+            EXPECT_TRUE(model->IsLodResident(lodIndex));
+            EXPECT_NE(model->GetLods()[lodIndex], nullptr);
+        }
+
+        m_lodStreaming->Update();
+        EXPECT_EQ(m_lodStreaming->GetStats().m_modelCount, 0u);
+    }
+
+    TEST_F(ModelLodStreamingTests, RequestLod_LodAndLessDetailedLodsBecomeResident)
+    {
+        Data::Instance<Model> model = CreateModel();
+        ASSERT_NE(model, nullptr);
+
+        uint32_t residencyChangedCount = 0;
+        Model::LodResidencyChangedEvent::Handler handler([&residencyChangedCount]() { ++residencyChangedCount; });
+        model->ConnectLodResidencyChangedHandler(handler);
+
+        model->RequestLod(1);
+        m_lodStreaming->Update();
+
+        EXPECT_FALSE(model->IsLodResident(0));
+        EXPECT_TRUE(model->IsLodResident(1));
+        EXPECT_TRUE(model->IsLodResident(2));
+        EXPECT_NE(model->GetLods()[1], nullptr);
+        EXPECT_EQ(model->GetResidentLodIndex(0), 1u);
+        EXPECT_EQ(residencyChangedCount, 1u);
+
+        const ModelLodStreamingStats stats = m_lodStreaming->GetStats();
+        EXPECT_EQ(stats.m_residentLodCount, 2u);
+        EXPECT_EQ(stats.m_residentBytes, GetLodTailBytes(1));
+        EXPECT_EQ(stats.m_modelsAtTargetCount, 1u);
+        EXPECT_EQ(stats.m_expandCount, 1u);
+        EXPECT_EQ(stats.m_trimCount, 0u);
+    }
+
+    TEST_F(ModelLodStreamingTests, RequestLod_SeveralRequests_MostDetailedLodIsKept)
+    {
+        Data::Instance<Model> model = CreateModel();
+        ASSERT_NE(model, nullptr);
+
+        // Several views request lods of the same model in a frame.
+        model->RequestLod(1);
+        model->RequestLod(0);
+        model->RequestLod(2);
+        m_lodStreaming->Update();
+
+        EXPECT_TRUE(model->IsLodResident(0));
+        EXPECT_EQ(m_lodStreaming->GetStats().m_residentBytes, GetLodTailBytes(0));
+    }
+
+    TEST_F(ModelLodStreamingTests, Update_OverBudget_LowerPriorityModelIsNotExpanded)
+    {
+        Data::Instance<Model> nearModel = CreateModel();
+        Data::Instance<Model> farModel = CreateModel();
+        ASSERT_NE(nearModel, nullptr);
+        ASSERT_NE(farModel, nullptr);
+
+        // Only one of the models can have a detailed lod on top of the least detailed lods of both.
+        const size_t budget = GetLodTailBytes(0) + GetLodTailBytes(2);
+        SetMemoryBudget(budget);
+
+        nearModel->RequestLod(0);
+        farModel->RequestLod(1);
+        m_lodStreaming->Update();
+
+        EXPECT_EQ(GetMostDetailedResidentLod(*nearModel), 0u);
+        EXPECT_EQ(GetMostDetailedResidentLod(*farModel), 2u);
+
+        const ModelLodStreamingStats stats = m_lodStreaming->GetStats();
+        EXPECT_EQ(stats.m_budgetInBytes, budget);
+        EXPECT_LE(stats.m_residentBytes, budget);
+        EXPECT_EQ(stats.m_modelsAtTargetCount, 1u);
+    }
+
+    TEST_F(ModelLodStreamingTests, Update_RequestExpired_LodsAreTrimmedForOtherModels)
+    {
+        Data::Instance<Model> firstModel = CreateModel();
+        Data::Instance<Model> secondModel = CreateModel();
+        ASSERT_NE(firstModel, nullptr);
+        ASSERT_NE(secondModel, nullptr);
+
+        const uint32_t evictionDelay = 3;
+        SetMemoryBudget(GetLodTailBytes(0) + GetLodTailBytes(2), evictionDelay);
+
+        firstModel->RequestLod(0);
+        m_lodStreaming->Update();
+        EXPECT_EQ(GetMostDetailedResidentLod(*firstModel), 0u);
+
+        // The first model keeps its lods while its request is recent, even though it doesn't request them anymore.
+        for (uint32_t i = 0; i < evictionDelay; ++i)
+        {
+            secondModel->RequestLod(1);
+            m_lodStreaming->Update();
+            EXPECT_EQ(GetMostDetailedResidentLod(*firstModel), 0u);
+            EXPECT_EQ(GetMostDetailedResidentLod(*secondModel), 2u);
+        }
+
+        // Then the second model takes the budget, and the first model keeps the lods that still fit.
+        secondModel->RequestLod(1);
+        m_lodStreaming->Update();
+        EXPECT_EQ(GetMostDetailedResidentLod(*firstModel), 1u);
+        EXPECT_EQ(GetMostDetailedResidentLod(*secondModel), 1u);
+        EXPECT_EQ(firstModel->GetLods()[0], nullptr);
+
+        const ModelLodStreamingStats stats = m_lodStreaming->GetStats();
+        EXPECT_EQ(stats.m_trimCount, 1u);
+        EXPECT_EQ(stats.m_expandCount, 1u);
+        EXPECT_EQ(stats.m_residentBytes, 2 * GetLodTailBytes(1));
+    }
+
+    TEST_F(ModelLodStreamingTests, Update_EvictedLodRequestedAgain_LodBecomesResident)
+    {
+        Data::Instance<Model> model = CreateModel();
+        ASSERT_NE(model, nullptr);
+
+        SetMemoryBudget(GetLodTailBytes(0) + GetLodTailBytes(2));
+
+        model->RequestLod(0);
+        m_lodStreaming->Update();
+        EXPECT_EQ(GetMostDetailedResidentLod(*model), 0u);
+
+        // Another model takes the budget while this one isn't requested.
+        Data::Instance<Model> otherModel = CreateModel();
+        ASSERT_NE(otherModel, nullptr);
+        otherModel->RequestLod(0);
+        m_lodStreaming->Update();
+        EXPECT_EQ(GetMostDetailedResidentLod(*otherModel), 0u);
+        EXPECT_EQ(GetMostDetailedResidentLod(*model), 2u);
+
+        otherModel = nullptr;
+
+        // The evicted lod asset is reloaded when the model is requested again.
+        model->RequestLod(0);
+        for (uint32_t i = 0; i < 4 && !model->IsLodResident(0); ++i)
+        {
+            m_lodStreaming->Update();
+        }
+        EXPECT_TRUE(model->IsLodResident(0));
+        EXPECT_NE(model->GetLods()[0], nullptr);
+    }
+
+    TEST_F(ModelLodStreamingTests, ReleaseModel_ModelIsUnregistered)
+    {
+        Data::Instance<Model> model = CreateModel();
+        ASSERT_NE(model, nullptr);
+
+        m_lodStreaming->Update();
+        EXPECT_EQ(m_lodStreaming->GetStats().m_modelCount, 1u);
+
+        model = nullptr;
+        m_lodStreaming->Update();
+        EXPECT_EQ(m_lodStreaming->GetStats().m_modelCount, 0u);
+        EXPECT_EQ(m_lodStreaming->GetStats().m_residentBytes, 0u);
+    }
+
+    TEST_F(ModelLodStreamingTests, Update_ResidencyHandlerReleasesModel_OtherModelIsNotSignaled)
+    {
+        Data::Instance<Model> firstModel = CreateModel();
+        Data::Instance<Model> secondModel = CreateModel();
+        ASSERT_NE(firstModel, nullptr);
+        ASSERT_NE(secondModel, nullptr);
+
+        // Both models change their residency in the same update, and whichever is signaled first releases the other one.
+        uint32_t residencyChangedCount = 0;
+        Model::LodResidencyChangedEvent::Handler firstHandler([&residencyChangedCount, &secondModel]()
+        {
+            ++residencyChangedCount;
+            secondModel = nullptr;
+        });
+        Model::LodResidencyChangedEvent::Handler secondHandler([&residencyChangedCount, &firstModel]()
+        {
+            ++residencyChangedCount;
+            firstModel = nullptr;
+        });
+        firstModel->ConnectLodResidencyChangedHandler(firstHandler);
+        secondModel->ConnectLodResidencyChangedHandler(secondHandler);
+
+        firstModel->RequestLod(0);
+        secondModel->RequestLod(0);
+        m_lodStreaming->Update();
+
+        EXPECT_EQ(residencyChangedCount, 1u);
+        EXPECT_NE(firstModel == nullptr, secondModel == nullptr);
+        EXPECT_EQ(m_lodStreaming->GetStats().m_expandCount, 2u);
+
+        m_lodStreaming->Update();
+        EXPECT_EQ(m_lodStreaming->GetStats().m_modelCount, 1u);
+        EXPECT_EQ(m_lodStreaming->GetStats().m_residentBytes, GetLodTailBytes(0));
+    }
+
+    TEST_F(ModelLodStreamingTests, RequestStreamedLod_ScreenCoverage_RequestsLodWithMargin)
+    {
+        Data::Instance<Model> model = CreateModel();
+        ASSERT_NE(model, nullptr);
+
+        Cullable::LodData lodData;
+        lodData.m_lodConfiguration.m_lodType = Cullable::LodType::ScreenCoverage;
+        lodData.m_lods.resize(LodCount);
+        lodData.m_lods[0].m_screenCoverageMin = 0.5f;
+        lodData.m_lods[0].m_screenCoverageMax = 1.0f;
+        lodData.m_lods[1].m_screenCoverageMin = 0.25f;
+        lodData.m_lods[1].m_screenCoverageMax = 0.5f;
+        lodData.m_lods[2].m_screenCoverageMin = 0.01f;
+        lodData.m_lods[2].m_screenCoverageMax = 0.25f;
+
+        // The lods of non streamed lod data are never requested.
+        RequestStreamedLod(lodData, 1.0f, 1.0f);
+        m_lodStreaming->Update();
+        EXPECT_EQ(GetMostDetailedResidentLod(*model), 2u);
+
+        lodData.m_streamedModel = model.get();
+
+        // An object that selects the least detailed lod requests the next lod when it's within the margin.
+        RequestStreamedLod(lodData, 0.2f, 1.0f);
+        m_lodStreaming->Update();
+        EXPECT_EQ(GetMostDetailedResidentLod(*model), 2u);
+
+        RequestStreamedLod(lodData, 0.2f, 1.5f);
+        m_lodStreaming->Update();
+        EXPECT_EQ(GetMostDetailedResidentLod(*model), 1u);
+
+        // Objects too small to be drawn still request the least detailed lod.
+        RequestStreamedLod(lodData, 0.001f, 1.0f);
+        RequestStreamedLod(lodData, 0.6f, 1.0f);
+        m_lodStreaming->Update();
+        EXPECT_EQ(GetMostDetailedResidentLod(*model), 0u);
+    }
+
+    TEST_F(ModelLodStreamingTests, RequestStreamedLod_SpecificLod_RequestsLodOverride)
+    {
+        Data::Instance<Model> model = CreateModel();
+        ASSERT_NE(model, nullptr);
+
+        Cullable::LodData lodData;
+        lodData.m_lodConfiguration.m_lodType = Cullable::LodType::SpecificLod;
+        lodData.m_lodConfiguration.m_lodOverride = 1;
+        lodData.m_lods.resize(LodCount);
+        lodData.m_streamedModel = model.get();
+
+        RequestStreamedLod(lodData, 1.0f, 1.0f);
+        m_lodStreaming->Update();
+        EXPECT_EQ(GetMostDetailedResidentLod(*model), 1u);
+    }
+
+    TEST_F(ModelLodStreamingTests, Update_LargeScene_ResidentMemoryStaysWithinBudget)
+    {
+        // A synthetic scene where the models request more detailed lods the closer they are to the camera.
+        const uint32_t modelCount = 512;
+        AZStd::vector<Data::Instance<Model>> models;
+        models.reserve(modelCount);
+        for (uint32_t i = 0; i < modelCount; ++i)
+        {
+            models.push_back(CreateModel());
+            ASSERT_NE(models.back(), nullptr);
+        }
+
+        // Enough for a tenth of the models to have their most detailed lod.
+        const size_t budget = modelCount * GetLodTailBytes(2) + (modelCount / 10) * (GetLodTailBytes(0) - GetLodTailBytes(2));
+        SetMemoryBudget(budget);
+
+        for (uint32_t frame = 0; frame < 8; ++frame)
+        {
+            for (uint32_t i = 0; i < modelCount; ++i)
+            {
+                // Move the camera through the scene, so the requests change every frame.
+                const uint32_t distance = (i + frame * 37) % modelCount;
+                models[i]->RequestLod(distance < modelCount / 8 ? 0 : (distance < modelCount / 2 ? 1 : 2));
+            }
+            m_lodStreaming->Update();
+
+            const ModelLodStreamingStats stats = m_lodStreaming->GetStats();
+            EXPECT_EQ(stats.m_modelCount, modelCount);
+            EXPECT_EQ(stats.m_lodCount, modelCount * LodCount);
+            EXPECT_LE(stats.m_residentBytes, budget);
+            EXPECT_GE(stats.m_residentLodCount, modelCount);
+            EXPECT_LT(stats.m_modelsAtTargetCount, modelCount);
+        }
+
+        size_t residentBytes = 0;
+        for (const Data::Instance<Model>& model : models)
+        {
+            residentBytes += GetLodTailBytes(static_cast<uint32_t>(GetMostDetailedResidentLod(*model)));
+        }
+        EXPECT_EQ(residentBytes, m_lodStreaming->GetStats().m_residentBytes);
+    }
+}
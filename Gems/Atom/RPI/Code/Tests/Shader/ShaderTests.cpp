@@ -1827,5 +1827,51 @@ namespace UnitTest
         EXPECT_FALSE(shaderVariantAsset->IsFullyBaked());
         EXPECT_FALSE(ShaderOptionGroup(m_shaderOptionGroupLayoutForAsset, shaderVariantAsset->GetShaderVariantId()).IsFullySpecified());
     }
-}
 
+    TEST_F(ShaderTests, ShaderVariantLookupCache_FindInsertInvalidate)
+    {
+        using namespace AZ;
+        using namespace AZ::RPI;
+
+        ShaderOptionGroup shaderOptionsA{m_shaderOptionGroupLayoutForAsset};
+        shaderOptionsA.SetValue(AZ::Name{"Color"}, AZ::Name{"Yellow"});
+        const ShaderVariantId variantIdA = shaderOptionsA.GetShaderVariantId();
+
+        // Same key as A, but with an option specified, so only the mask differs.
+        ShaderOptionGroup shaderOptionsB{m_shaderOptionGroupLayoutForAsset};
+        shaderOptionsB.SetValue(AZ::Name{"Color"}, AZ::Name{"Yellow"});
+        shaderOptionsB.SetValue(AZ::Name{"Raytracing"}, AZ::Name{"Off"});
+        const ShaderVariantId variantIdB = shaderOptionsB.GetShaderVariantId();
+        EXPECT_NE(variantIdA, variantIdB);
+
+        AZStd::unique_ptr<ShaderVariantLookupCache> cache = AZStd::make_unique<ShaderVariantLookupCache>();
+
+        ShaderVariantSearchResult result{RootShaderVariantStableId, 0};
+        EXPECT_FALSE(cache->Find(variantIdA, result));
+
+        cache->Insert(variantIdA, ShaderVariantSearchResult{ShaderVariantStableId{3}, 2}, cache->GetGeneration());
+        EXPECT_TRUE(cache->Find(variantIdA, result));
+        EXPECT_EQ(result.GetStableId().GetIndex(), 3);
+        EXPECT_EQ(result.GetDynamicOptionCount(), 2);
+        EXPECT_FALSE(cache->Find(variantIdB, result));
+
+        // A search that started before an invalidation isn't cached.
+        const uint32_t staleGeneration = cache->GetGeneration();
+        cache->Invalidate();
+        cache->Insert(variantIdB, ShaderVariantSearchResult{ShaderVariantStableId{4}, 0}, staleGeneration);
+        EXPECT_FALSE(cache->Find(variantIdB, result));
+        EXPECT_FALSE(cache->Find(variantIdA, result));
+
+        cache->Insert(variantIdB, ShaderVariantSearchResult{ShaderVariantStableId{4}, 0}, cache->GetGeneration());
+        EXPECT_TRUE(cache->Find(variantIdB, result));
+        EXPECT_EQ(result.GetStableId().GetIndex(), 4);
+        EXPECT_TRUE(result.IsFullyBaked());
+
+        cache->RecordTreeSearch(AZStd::GetTimeTicksPerSecond());
+        const ShaderVariantLookupStats stats = cache->GetStats();
+        EXPECT_EQ(stats.m_lookupCount, 6);
+        EXPECT_EQ(stats.m_hitCount, 2);
+        EXPECT_EQ(stats.m_treeSearchCount, 1);
+        EXPECT_NEAR(static_cast<double>(stats.m_treeSearchTimeNanoseconds), 1.0e9, 1.0);
+    }
+}
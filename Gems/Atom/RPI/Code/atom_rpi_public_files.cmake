@@ -41,6 +41,7 @@ set(FILES
     Include/Atom/RPI.Public/DynamicDraw/DynamicDrawInterface.h
     Include/Atom/RPI.Public/Image/AttachmentImage.h
     Include/Atom/RPI.Public/Image/AttachmentImagePool.h
+    Include/Atom/RPI.Public/Image/BudgetedStreamingImageController.h
     Include/Atom/RPI.Public/Image/DefaultStreamingImageController.h
     Include/Atom/RPI.Public/Image/ImageSystem.h
     Include/Atom/RPI.Public/Image/ImageSystemInterface.h
@@ -53,6 +54,8 @@ set(FILES
     Include/Atom/RPI.Public/Material/MaterialSystem.h
     Include/Atom/RPI.Public/Model/Model.h
     Include/Atom/RPI.Public/Model/ModelLod.h
+    Include/Atom/RPI.Public/Model/ModelLodStreamingController.h
+    Include/Atom/RPI.Public/Model/ModelLodStreamingInterface.h
     Include/Atom/RPI.Public/Model/ModelLodUtils.h
     Include/Atom/RPI.Public/Model/ModelSystem.h
     Include/Atom/RPI.Public/Model/UvStreamTangentBitmask.h
@@ -83,6 +86,7 @@ set(FILES
     Include/Atom/RPI.Public/Shader/Shader.h
     Include/Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h
     Include/Atom/RPI.Public/Shader/ShaderVariant.h
+    Include/Atom/RPI.Public/Shader/ShaderVariantLookupCache.h
     Include/Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h
     Include/Atom/RPI.Public/Shader/ShaderResourceGroup.h
     Include/Atom/RPI.Public/Shader/ShaderResourceGroupPool.h
@@ -121,6 +125,7 @@ set(FILES
     Source/RPI.Public/DynamicDraw/DynamicDrawSystem.cpp
     Source/RPI.Public/Image/AttachmentImage.cpp
     Source/RPI.Public/Image/AttachmentImagePool.cpp
+    Source/RPI.Public/Image/BudgetedStreamingImageController.cpp
     Source/RPI.Public/Image/DefaultStreamingImageController.cpp
     Source/RPI.Public/Image/ImageSystem.cpp
     Source/RPI.Public/Image/StreamingImage.cpp
@@ -131,6 +136,7 @@ set(FILES
     Source/RPI.Public/Material/MaterialSystem.cpp
     Source/RPI.Public/Model/Model.cpp
     Source/RPI.Public/Model/ModelLod.cpp
+    Source/RPI.Public/Model/ModelLodStreamingController.cpp
     Source/RPI.Public/Model/ModelLodUtils.cpp
     Source/RPI.Public/Model/ModelSystem.cpp
     Source/RPI.Public/Model/UvStreamTangentBitmask.cpp
@@ -158,6 +164,7 @@ set(FILES
     Source/RPI.Public/Pass/Specific/SwapChainPass.cpp
     Source/RPI.Public/Shader/Shader.cpp
     Source/RPI.Public/Shader/ShaderVariant.cpp
+    Source/RPI.Public/Shader/ShaderVariantLookupCache.cpp
     Source/RPI.Public/Shader/ShaderReloadDebugTracker.cpp
     Source/RPI.Public/Shader/ShaderResourceGroup.cpp
     Source/RPI.Public/Shader/ShaderResourceGroupPool.cpp
@@ -28,6 +28,8 @@ set(FILES
     Tests/Common/RHI/Stubs.h
     Tests/Common/ShaderAssetTestUtils.cpp
     Tests/Common/ShaderAssetTestUtils.h
+    Tests/Culling/CullingBenchmarks.cpp
+    Tests/Culling/CullingTests.cpp
     Tests/Image/StreamingImageTests.cpp
     Tests/Material/LuaMaterialFunctorTests.cpp
     Tests/Material/MaterialTypeAssetTests.cpp
@@ -41,6 +43,7 @@ set(FILES
     Tests/Material/MaterialFunctorSourceDataSerializerTests.cpp
     Tests/Material/MaterialPropertyValueSourceDataTests.cpp
     Tests/Material/MaterialTests.cpp
+    Tests/Model/ModelLodStreamingTests.cpp
     Tests/Model/ModelTests.cpp
     Tests/Pass/PassTests.cpp
     Tests/Shader/ShaderTests.cpp
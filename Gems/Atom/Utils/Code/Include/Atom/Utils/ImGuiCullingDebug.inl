@@ -60,6 +60,9 @@ namespace AZ
                 uint32_t totalVisibleCullables = 0;
                 uint32_t totalVisibleDrawPackets = 0;
                 uint32_t totalCullJobs = 0;
+                uint32_t totalTestedCullables = 0;
+                uint32_t totalCulledCullables = 0;
+                uint64_t totalCullTimeMicroseconds = 0;
                 size_t numViews = 0;
 
                 auto& perViewCullStats = debugCtx.LockAndGetAllCullStats();
@@ -96,9 +99,12 @@ namespace AZ
                     totalVisibleCullables += cullStats->m_numVisibleCullables;
                     totalVisibleDrawPackets += cullStats->m_numVisibleDrawPackets;
                     totalCullJobs += cullStats->m_numJobs;
+                    totalTestedCullables += cullStats->m_numTestedCullables;
+                    totalCulledCullables += cullStats->m_numCulledCullables;
+                    totalCullTimeMicroseconds += cullStats->m_cullTimeMicroseconds;
                 }
 
-                if (ImGui::BeginChild("Totals", ImVec2(0, 120.0f), true, ImGuiWindowFlags_None))
+                if (ImGui::BeginChild("Totals", ImVec2(0, 160.0f), true, ImGuiWindowFlags_None))
                 {
                     ImGui::Text("Totals:");
                     ImGui::Separator();
@@ -106,6 +112,10 @@ namespace AZ
                     ImGui::Text("   %u Cull Jobs", totalCullJobs);
                     ImGui::Text("   %d/%d Visible Cullables", totalVisibleCullables, totalCullables);
                     ImGui::Text("   %d Submitted DrawPackets", totalVisibleDrawPackets);
+                    ImGui::Text("   %u Tested/%u Culled Cullables", totalTestedCullables, totalCulledCullables);
+                    ImGui::Text("   %.1f Tested/%.1f Culled per microsecond of cull job time",
+                        totalCullTimeMicroseconds > 0 ? static_cast<float>(totalTestedCullables) / static_cast<float>(totalCullTimeMicroseconds) : 0.0f,
+                        totalCullTimeMicroseconds > 0 ? static_cast<float>(totalCulledCullables) / static_cast<float>(totalCullTimeMicroseconds) : 0.0f);
                 }                
                 ImGui::EndChild();
 
@@ -135,6 +145,11 @@ namespace AZ
                         m(1,0), m(1,1), m(1,2), m(1,3),
                         m(2,0), m(2,1), m(2,2), m(2,3),
                         m(3,0), m(3,1), m(3,2), m(3,3));
+                    ImGui::Text("Selected View's Culling: %u tested, %u culled, %.1f tested/us, %.1f culled/us",
+                        static_cast<uint32_t>(cullStats->m_numTestedCullables),
+                        static_cast<uint32_t>(cullStats->m_numCulledCullables),
+                        cullStats->GetTestedCullablesPerMicrosecond(),
+                        cullStats->GetCulledCullablesPerMicrosecond());
                 }
                 else
                 {
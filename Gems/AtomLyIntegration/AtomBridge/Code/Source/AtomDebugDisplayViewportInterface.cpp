@@ -174,7 +174,6 @@ namespace // unnamed namespace to hold copies of Cry AuxGeom state enum's, this
 
 namespace AZ::AtomBridge
 {
-
     ////////////////////////////////////////////////////////////////////////
     SingleColorDynamicSizeLineHelper::SingleColorDynamicSizeLineHelper(
         int estimatedNumLineSegments
@@ -208,7 +207,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = rendState.m_opacityType;
             drawArgs.m_depthTest = rendState.m_depthTest;
             drawArgs.m_depthWrite = rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(auxGeomDrawPtr, rendState);
             auxGeomDrawPtr->DrawLines( drawArgs );
         }
     }
@@ -383,7 +382,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawTriangles(drawArgs);
         }
     }
@@ -404,7 +403,7 @@ namespace AZ::AtomBridge
             m_rendState.m_depthTest,
             m_rendState.m_depthWrite,
             m_rendState.m_faceCullMode,
-            m_rendState.m_viewProjOverrideIndex);
+            GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState));
     }
 
     void AtomDebugDisplayViewportInterface::DrawWireQuad(
@@ -424,7 +423,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawPolylines(drawArgs, AZ::RPI::AuxGeomDraw::PolylineEnd::Closed);
         }
     }
@@ -445,7 +444,7 @@ namespace AZ::AtomBridge
             m_rendState.m_depthTest,
             m_rendState.m_depthWrite,
             m_rendState.m_faceCullMode,
-            m_rendState.m_viewProjOverrideIndex);
+            GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState));
     }
 
     void AtomDebugDisplayViewportInterface::DrawQuadGradient(
@@ -475,7 +474,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawTriangles(drawArgs);
         }
     }
@@ -493,7 +492,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawTriangles(drawArgs);
         }
     }
@@ -511,7 +510,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawTriangles(drawArgs);
         }
     }
@@ -534,7 +533,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawTriangles(drawArgs);
         }
     }
@@ -551,7 +550,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
                 );
         }
     }
@@ -568,7 +567,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex);
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState));
         }
     }
 
@@ -591,7 +590,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex);
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState));
         }
     }
 
@@ -614,7 +613,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex);
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState));
         }
     }
 
@@ -632,7 +631,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawPoints(drawArgs);
         }
     }
@@ -651,7 +650,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawLines(drawArgs);
         }
     }
@@ -671,7 +670,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawLines(drawArgs);
         }
     }
@@ -690,7 +689,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawLines(drawArgs);
         }
     }
@@ -714,7 +713,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             m_auxGeomPtr->DrawPolylines(drawArgs, polylineEnd);
         }
     }
@@ -941,7 +940,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
             );
         }
     }
@@ -962,7 +961,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
             );
         }
     }
@@ -984,7 +983,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
             );
         }
     }
@@ -1011,7 +1010,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
             );
         }
     }
@@ -1118,7 +1117,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
             );
         }
     }
@@ -1194,7 +1193,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
                 );
         }
     }
@@ -1215,7 +1214,7 @@ namespace AZ::AtomBridge
                 m_rendState.m_depthTest,
                 m_rendState.m_depthWrite,
                 m_rendState.m_faceCullMode,
-                m_rendState.m_viewProjOverrideIndex
+                GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
                 );
         }
     }
@@ -1243,7 +1242,7 @@ namespace AZ::AtomBridge
             drawArgs.m_opacityType = m_rendState.m_opacityType;
             drawArgs.m_depthTest = m_rendState.m_depthTest;
             drawArgs.m_depthWrite = m_rendState.m_depthWrite;
-            drawArgs.m_viewProjectionOverrideIndex = m_rendState.m_viewProjOverrideIndex;
+            drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState);
             if (!dualEndedArrow)
             {
                 verts[1] -= dir * arrowLen;
@@ -1258,7 +1257,7 @@ namespace AZ::AtomBridge
                     m_rendState.m_depthTest,
                     m_rendState.m_depthWrite,
                     m_rendState.m_faceCullMode,
-                    m_rendState.m_viewProjOverrideIndex
+                    GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
                     );
             }
             else
@@ -1276,7 +1275,7 @@ namespace AZ::AtomBridge
                     m_rendState.m_depthTest,
                     m_rendState.m_depthWrite,
                     m_rendState.m_faceCullMode,
-                    m_rendState.m_viewProjOverrideIndex
+                    GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
                     );
                 m_auxGeomPtr->DrawCone(
                     verts[1], 
@@ -1288,7 +1287,7 @@ namespace AZ::AtomBridge
                     m_rendState.m_depthTest,
                     m_rendState.m_depthWrite,
                     m_rendState.m_faceCullMode,
-                    m_rendState.m_viewProjOverrideIndex
+                    GetViewProjOverrideIndex(m_auxGeomPtr, m_rendState)
                     );
             }
         }
@@ -1455,7 +1454,8 @@ namespace AZ::AtomBridge
             if (state & e_Mode2D)
             {
                 AZ_Assert((currentState & e_DrawInFrontOn) == 0 && (changedState & e_DrawInFrontOn) == 0, "Atom doesnt support Draw In Front and 2d at the same time");
-                m_rendState.m_viewProjOverrideIndex = m_auxGeomPtr->GetOrAdd2DViewProjOverride();
+                // the 2d view projection override is requested by each draw, see GetViewProjOverrideIndex
+                m_rendState.m_viewProjOverrideIndex = -1;
                 m_rendState.m_2dMode = true;
             }
             else // switch back to mode 3d
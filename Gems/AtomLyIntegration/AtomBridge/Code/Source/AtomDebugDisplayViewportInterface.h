@@ -38,13 +38,20 @@ namespace AZ::AtomBridge
         AZ::RPI::AuxGeomDraw::DepthTest m_depthTest = AZ::RPI::AuxGeomDraw::DepthTest::On;
         AZ::RPI::AuxGeomDraw::DepthWrite m_depthWrite = AZ::RPI::AuxGeomDraw::DepthWrite::On;
         AZ::RPI::AuxGeomDraw::FaceCullMode m_faceCullMode = AZ::RPI::AuxGeomDraw::FaceCullMode::Back;
-        int32_t m_viewProjOverrideIndex = -1; // will be used to implement SetDrawInFrontMode & 2D mode
+        int32_t m_viewProjOverrideIndex = -1; // will be used to implement SetDrawInFrontMode, 2D mode requests its override per draw
 
         // separate tracking for Cry only state
         bool m_drawInFront = false;
         bool m_2dMode = false;
     };
 
+    //! The 2d view projection override index is only valid for draws on the thread that requested it, so it's requested
+    //! again for every draw instead of being cached in the render state, which debug draws on other threads can use too.
+    inline int32_t GetViewProjOverrideIndex(const AZ::RPI::AuxGeomDrawPtr& auxGeomDrawPtr, const RenderState& rendState)
+    {
+        return rendState.m_2dMode ? auxGeomDrawPtr->GetOrAdd2DViewProjOverride() : rendState.m_viewProjOverrideIndex;
+    }
+
     //! Utility class to collect line segments when the number of segments is known at compile time.
     template <int MaxNumLines> 
     struct SingleColorStaticSizeLineHelper
@@ -73,7 +80,7 @@ namespace AZ::AtomBridge
                 drawArgs.m_opacityType = rendState.m_opacityType;
                 drawArgs.m_depthTest = rendState.m_depthTest;
                 drawArgs.m_depthWrite = rendState.m_depthWrite;
-                drawArgs.m_viewProjectionOverrideIndex = rendState.m_viewProjOverrideIndex;
+                drawArgs.m_viewProjectionOverrideIndex = GetViewProjOverrideIndex(auxGeomDrawPtr, rendState);
                 auxGeomDrawPtr->DrawLines( drawArgs );
             }
         }
@@ -188,6 +188,23 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataMeshComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const AZ::EntityId entityId = GetEntityId();
+        for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+        {
+            AZ::Vector3 hitPosition;
+            AZ::Vector3 hitNormal;
+            if (DoRayTrace(inPositions[inputIndex], hitPosition, hitNormal))
+            {
+                const size_t pointIndex = surfacePoints.AddSurfacePoint(inputIndex, entityId, hitPosition, hitNormal);
+                surfacePoints.AddMaxValueForTags(pointIndex, m_configuration.m_tags, 1.0f);
+            }
+        }
+    }
+
     AZ::Aabb SurfaceDataMeshComponent::GetSurfaceAabb() const
     {
         return m_meshBounds;
@@ -31,6 +31,7 @@
 #include <EMotionFX/Source/MotionData/MotionDataFactory.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/QuantizedMotionData.h>
 #include <EMotionFX/Source/MotionData/UniformMotionData.h>
 #include <MCore/Source/AzCoreConversions.h>
 
@@ -88,6 +89,12 @@ namespace EMotionFX
             optimizeSettings.m_jointIgnoreList = rootJoints; // Skip optimizing root joints, as that makes the feet jitter.
             optimizeSettings.m_updateDuration = samplingRule ? !samplingRule->GetKeepDuration() : false;
             finalMotionData->Optimize(optimizeSettings);
+
+            // The exported data isn't optimized again, so the samples the quantized keys were fitted from aren't needed anymore.
+            if (QuantizedMotionData* quantizedMotionData = azrtti_cast<QuantizedMotionData*>(finalMotionData))
+            {
+                quantizedMotionData->ReleaseSourceSamples();
+            }
         }
 
         // Automatically determine what produces the smallest memory footprint motion data, either UniformMotionData or NonUniformMotionData.
@@ -276,7 +276,16 @@ namespace EMotionFX
                 UpdateWorldTransform();
                 if (updateJointTransforms && sampleMotions)
                 {
-                    m_animGraphInstance->Output(m_transformData->GetCurrentPose());
+                    if (m_poseSharingSource)
+                    {
+                        // the pose source is in the same anim graph state and has already calculated its output pose this frame
+                        // copy the pose it calculated rather than its current pose, which may already be interpolated
+                        m_transformData->GetCurrentPose()->InitFromPose(m_poseSharingSource->GetUpdateRateLodState().GetUpdatedPose(m_poseSharingSource));
+                    }
+                    else
+                    {
+                        m_animGraphInstance->Output(m_transformData->GetCurrentPose());
+                    }
 
                     if (m_ragdollInstance)
                     {
@@ -1695,6 +1704,47 @@ namespace EMotionFX
         return m_motionSamplingRate;
     }
 
+    void ActorInstance::SetUpdateRateLodSettings(const UpdateRateLodSettings& settings)
+    {
+        m_updateRateLodSettings = settings;
+        m_updateRateLodState.Reset();
+    }
+
+    const UpdateRateLodSettings& ActorInstance::GetUpdateRateLodSettings() const
+    {
+        return m_updateRateLodSettings;
+    }
+
+    UpdateRateLodState& ActorInstance::GetUpdateRateLodState()
+    {
+        return m_updateRateLodState;
+    }
+
+    const UpdateRateLodState& ActorInstance::GetUpdateRateLodState() const
+    {
+        return m_updateRateLodState;
+    }
+
+    void ActorInstance::SetPoseSharingEnabled(bool enabled)
+    {
+        m_poseSharingEnabled = enabled;
+    }
+
+    bool ActorInstance::GetPoseSharingEnabled() const
+    {
+        return m_poseSharingEnabled;
+    }
+
+    void ActorInstance::SetPoseSharingSource(ActorInstance* sourceActorInstance)
+    {
+        m_poseSharingSource = sourceActorInstance;
+    }
+
+    ActorInstance* ActorInstance::GetPoseSharingSource() const
+    {
+        return m_poseSharingSource;
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         m_numAttachmentRefs += numToIncreaseWith;
@@ -22,6 +22,7 @@
 #include "Actor.h"
 #include "Transform.h"
 #include "AnimGraphPosePool.h"
+#include "ActorUpdateRateLod.h"
 
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 
@@ -856,6 +857,34 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Set the update rate LOD settings, which control how often the actor instance is updated based on its screen size or distance.
+         * Changing the settings resets the update rate LOD state, so the actor instance is updated the next frame.
+         * @param settings The update rate LOD settings.
+         */
+        void SetUpdateRateLodSettings(const UpdateRateLodSettings& settings);
+        const UpdateRateLodSettings& GetUpdateRateLodSettings() const;
+        UpdateRateLodState& GetUpdateRateLodState();
+        const UpdateRateLodState& GetUpdateRateLodState() const;
+
+        /**
+         * Enable or disable anim graph pose sharing for this actor instance.
+         * When enabled, the actor instance reuses the output pose of another actor instance that is in the same anim graph state
+         * in the same frame, instead of calculating it. Its anim graph is still updated, so motion events and root motion stay per
+         * actor instance. Pose sharing is disabled by default, see AnimGraphPoseSharing for details.
+         * @param enabled Set to true to allow the actor instance to share its pose.
+         */
+        void SetPoseSharingEnabled(bool enabled);
+        bool GetPoseSharingEnabled() const;
+
+        /**
+         * Set the actor instance to copy the output pose from during the current update.
+         * This is assigned by the scheduler each frame and cleared again after the update.
+         * @param sourceActorInstance The actor instance whose output pose gets copied, or nullptr to calculate the own output pose.
+         */
+        void SetPoseSharingSource(ActorInstance* sourceActorInstance);
+        ActorInstance* GetPoseSharingSource() const;
+
         MCORE_INLINE size_t GetNumNodes() const         { return m_actor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -891,6 +920,10 @@ namespace EMotionFX
         float                   m_boundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   m_motionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   m_motionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        UpdateRateLodSettings   m_updateRateLodSettings; /**< The update rate LOD settings. */
+        UpdateRateLodState      m_updateRateLodState;    /**< The update rate LOD state, as decided by the scheduler each frame. */
+        ActorInstance*          m_poseSharingSource = nullptr; /**< The actor instance to copy the output pose from during the current update, or nullptr. */
+        bool                    m_poseSharingEnabled = false;  /**< Allow reusing the output pose of actor instances in the same anim graph state? */
         float                   m_visualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         size_t                  m_lodLevel;              /**< The current LOD level, where 0 is the highest detail. */
         size_t                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
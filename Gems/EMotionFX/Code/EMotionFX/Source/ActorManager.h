@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/vector.h>
 #include "EMotionFXConfig.h"
 #include "BaseObject.h"
+#include "AnimGraphPoseSharing.h"
 #include "MemoryCategories.h"
 #include <MCore/Source/MultiThreadManager.h>
 #include <AzCore/std/containers/vector.h>
@@ -233,6 +234,14 @@ namespace EMotionFX
          */
         void SetScheduler(ActorUpdateScheduler* scheduler, bool delExisting = true);
 
+        /**
+         * Get the anim graph pose sharing, which lets actor instances in the same anim graph state reuse one evaluated pose.
+         * Actor instances opt in using ActorInstance::SetPoseSharingEnabled().
+         * @result The anim graph pose sharing.
+         */
+        AnimGraphPoseSharing& GetPoseSharing()                                  { return m_poseSharing; }
+        const AnimGraphPoseSharing& GetPoseSharing() const                      { return m_poseSharing; }
+
         /**
          * Update the actor instance status for a given actor instance.
          * This checks if the actor instance is still a root actor instance or not and it makes sure that it is
@@ -262,6 +271,7 @@ namespace EMotionFX
         AZStd::vector<ActorAssetData>   m_actorAssets;
         AZStd::vector<ActorInstance*>   m_rootActorInstances;    /**< Root actor instances (roots of all attachment chains). */
         ActorUpdateScheduler*           m_scheduler;             /**< The update scheduler to use. */
+        AnimGraphPoseSharing            m_poseSharing;           /**< Groups actor instances that can share their anim graph output pose. */
         MCore::MutexRecursive           m_actorLock;             /**< The multithread lock for touching the actors array. */
         MCore::MutexRecursive           m_actorInstanceLock;     /**< The multithread lock for touching the actor instances array. */
 
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateRateLod.h>
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/Attachment.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(UpdateRateLodSettings, ActorAllocator, 0)
+    AZ_CLASS_ALLOCATOR_IMPL(UpdateRateLodState, ActorUpdateAllocator, 0)
+    AZ_CLASS_ALLOCATOR_IMPL(ActorUpdateRateLod, ActorUpdateAllocator, 0)
+
+    AZ::u32 UpdateRateLodSettings::CalcFrameInterval(float metricValue) const
+    {
+        const AZ::u32 numThresholds = aznumeric_caster(m_thresholds.size());
+        for (AZ::u32 i = 0; i < numThresholds; ++i)
+        {
+            const bool qualifies = (m_metric == Metric::ScreenSize) ? (metricValue >= m_thresholds[i]) : (metricValue <= m_thresholds[i]);
+            if (qualifies)
+            {
+                return AZStd::min(i + 1, AZStd::max(m_maxFrameInterval, 1u));
+            }
+        }
+
+        return AZStd::max(m_maxFrameInterval, 1u);
+    }
+
+
+    void UpdateRateLodSettings::Reflect(AZ::ReflectContext* context)
+    {
+        AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
+        if (!serializeContext)
+        {
+            return;
+        }
+
+        serializeContext->Class<UpdateRateLodSettings>()
+            ->Version(1)
+            ->Field("enabled", &UpdateRateLodSettings::m_enabled)
+            ->Field("metric", &UpdateRateLodSettings::m_metric)
+            ->Field("thresholds", &UpdateRateLodSettings::m_thresholds)
+            ->Field("maxFrameInterval", &UpdateRateLodSettings::m_maxFrameInterval)
+            ->Field("invisibleFrameInterval", &UpdateRateLodSettings::m_invisibleFrameInterval)
+            ->Field("interpolateSkippedFrames", &UpdateRateLodSettings::m_interpolateSkippedFrames)
+            ;
+
+        AZ::EditContext* editContext = serializeContext->GetEditContext();
+        if (!editContext)
+        {
+            return;
+        }
+
+        editContext->Class<UpdateRateLodSettings>("Update rate LOD", "Update distant or small actor instances at a reduced rate")
+            ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &UpdateRateLodSettings::m_enabled, "Enabled",
+                "Only update the actor instance every Nth frame, based on its screen size or distance to the camera.")
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+            ->DataElement(AZ::Edit::UIHandlers::ComboBox, &UpdateRateLodSettings::m_metric, "Metric",
+                "Screen size uses the projected bounding sphere diameter as fraction of the viewport height, distance uses the distance to the camera in meters.")
+                ->EnumAttribute(Metric::ScreenSize, "Screen size")
+                ->EnumAttribute(Metric::Distance, "Distance")
+                ->Attribute(AZ::Edit::Attributes::Visibility, &UpdateRateLodSettings::m_enabled)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &UpdateRateLodSettings::m_thresholds, "Thresholds",
+                "The first threshold the metric passes selects the frame interval, the first entry updates every frame, the second every other frame and so on.")
+                ->Attribute(AZ::Edit::Attributes::Visibility, &UpdateRateLodSettings::m_enabled)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &UpdateRateLodSettings::m_maxFrameInterval, "Max frame interval",
+                "The frame interval used when the metric passes none of the thresholds.")
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &UpdateRateLodSettings::m_enabled)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &UpdateRateLodSettings::m_invisibleFrameInterval, "Invisible frame interval",
+                "The frame interval used while the actor instance is not visible.")
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &UpdateRateLodSettings::m_enabled)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &UpdateRateLodSettings::m_interpolateSkippedFrames, "Interpolate skipped frames",
+                "Blend between the last two updated poses on frames where the actor instance is not updated. This adds one update of latency.")
+                ->Attribute(AZ::Edit::Attributes::Visibility, &UpdateRateLodSettings::m_enabled)
+            ;
+    }
+
+    //-----------------------------------------------------------------------------------------------------------------
+
+    UpdateRateLodState::UpdateRateLodState() = default;
+    UpdateRateLodState::~UpdateRateLodState() = default;
+
+
+    void UpdateRateLodState::Reset()
+    {
+        m_accumulatedTime = 0.0f;
+        m_updateTimeDelta = 0.0f;
+        m_frameInterval = 1;
+        m_framesSinceUpdate = 0;
+        m_updateThisFrame = true;
+        m_hasPoses = false;
+        m_hasUpdated = false;
+    }
+
+
+    void UpdateRateLodState::Schedule(bool update, AZ::u32 frameInterval, float timePassedInSeconds)
+    {
+        m_accumulatedTime += timePassedInSeconds;
+        m_frameInterval = frameInterval;
+        m_updateThisFrame = update;
+
+        if (update)
+        {
+            m_updateTimeDelta = m_accumulatedTime;
+            m_accumulatedTime = 0.0f;
+            m_framesSinceUpdate = 0;
+            m_hasUpdated = true;
+        }
+        else
+        {
+            m_updateTimeDelta = 0.0f;
+            m_framesSinceUpdate++;
+        }
+    }
+
+
+    void UpdateRateLodState::StoreUpdatedPose(ActorInstance* actorInstance, bool interpolate)
+    {
+        // Actor instances running at full rate don't keep any pose history, so we start fresh once they slow down.
+        if (!interpolate || m_frameInterval <= 1)
+        {
+            m_hasPoses = false;
+            return;
+        }
+
+        if (!m_targetPose)
+        {
+            m_previousPose = AZStd::make_unique<Pose>();
+            m_targetPose = AZStd::make_unique<Pose>();
+        }
+
+        const Pose* currentPose = actorInstance->GetTransformData()->GetCurrentPose();
+        if (m_hasPoses)
+        {
+            AZStd::swap(m_previousPose, m_targetPose);
+        }
+        else
+        {
+            m_previousPose->LinkToActorInstance(actorInstance);
+            m_targetPose->LinkToActorInstance(actorInstance);
+            m_previousPose->InitFromPose(currentPose);
+        }
+        m_targetPose->InitFromPose(currentPose);
+        m_hasPoses = true;
+
+        BlendPoses(actorInstance, 1.0f / static_cast<float>(m_frameInterval));
+    }
+
+
+    const Pose* UpdateRateLodState::GetUpdatedPose(const ActorInstance* actorInstance) const
+    {
+        if (m_hasPoses)
+        {
+            return m_targetPose.get();
+        }
+
+        return actorInstance->GetTransformData()->GetCurrentPose();
+    }
+
+
+    bool UpdateRateLodState::ApplyInterpolatedPose(ActorInstance* actorInstance)
+    {
+        if (!m_hasPoses)
+        {
+            return false;
+        }
+
+        // The pose of the update is shown one update late, spread over the frames until the next update.
+        // Deferred updates keep showing the target pose until the actor instance gets updated again.
+        const float weight = AZ::GetMin(static_cast<float>(m_framesSinceUpdate + 1) / static_cast<float>(AZStd::max(m_frameInterval, 1u)), 1.0f);
+        BlendPoses(actorInstance, weight);
+        return true;
+    }
+
+
+    void UpdateRateLodState::BlendPoses(ActorInstance* actorInstance, float weight)
+    {
+        Pose* currentPose = actorInstance->GetTransformData()->GetCurrentPose();
+        currentPose->InitFromPose(m_previousPose.get());
+        currentPose->Blend(m_targetPose.get(), weight);
+        currentPose->InvalidateAllModelSpaceTransforms();
+
+        actorInstance->UpdateSkinningMatrices();
+        actorInstance->UpdateAttachments();
+    }
+
+    //-----------------------------------------------------------------------------------------------------------------
+
+    void ActorUpdateRateLod::SetViewer(const AZ::Vector3& position, float verticalFovRadians)
+    {
+        m_viewerPosition = position;
+        m_tanHalfFov = tanf(verticalFovRadians * 0.5f);
+        m_hasViewer = true;
+    }
+
+
+    void ActorUpdateRateLod::ClearViewer()
+    {
+        m_hasViewer = false;
+    }
+
+
+    float ActorUpdateRateLod::CalcMetric(const ActorInstance* actorInstance, UpdateRateLodSettings::Metric metric) const
+    {
+        const AZ::Aabb& aabb = actorInstance->GetAabb();
+        const bool hasBounds = aabb.IsValid();
+        const AZ::Vector3 center = hasBounds ? aabb.GetCenter() : actorInstance->GetWorldSpaceTransform().m_position;
+        const float distance = center.GetDistance(m_viewerPosition);
+
+        if (metric == UpdateRateLodSettings::Metric::Distance)
+        {
+            return distance;
+        }
+
+        // Without bounds or when the viewer is inside of them, the actor instance is considered to cover the whole screen.
+        const float radius = hasBounds ? aabb.GetExtents().GetLength() * 0.5f : 0.0f;
+        if (!hasBounds || distance <= radius || m_tanHalfFov <= 0.0f)
+        {
+            return AZStd::numeric_limits<float>::max();
+        }
+
+        return radius / (distance * m_tanHalfFov);
+    }
+
+
+    AZ::u32 ActorUpdateRateLod::CalcFrameInterval(const ActorInstance* actorInstance) const
+    {
+        const UpdateRateLodSettings& settings = actorInstance->GetUpdateRateLodSettings();
+        if (!actorInstance->GetIsVisible())
+        {
+            return AZStd::max(settings.m_invisibleFrameInterval, 1u);
+        }
+
+        if (!m_hasViewer)
+        {
+            return 1;
+        }
+
+        return settings.CalcFrameInterval(CalcMetric(actorInstance, settings.m_metric));
+    }
+
+
+    void ActorUpdateRateLod::RecursiveSchedule(ActorInstance* actorInstance, bool update, AZ::u32 frameInterval, float timePassedInSeconds)
+    {
+        actorInstance->GetUpdateRateLodState().Schedule(update, frameInterval, timePassedInSeconds);
+
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment && attachment->GetIsEnabled())
+            {
+                RecursiveSchedule(attachment, update, frameInterval, timePassedInSeconds);
+            }
+        }
+    }
+
+
+    void ActorUpdateRateLod::Evaluate(const ActorManager& actorManager, float timePassedInSeconds)
+    {
+        m_numSkipped = 0;
+        m_numDeferred = 0;
+        m_candidates.clear();
+
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+
+            // Enabled attachments of disabled actor instances are still executed by the scheduler, so they run at full rate.
+            if (!m_enabled || !rootInstance->GetIsEnabled() || !rootInstance->GetUpdateRateLodSettings().m_enabled)
+            {
+                RecursiveSchedule(rootInstance, true, 1, timePassedInSeconds);
+                continue;
+            }
+
+            const AZ::u32 frameInterval = CalcFrameInterval(rootInstance);
+            // Actor instances that have not been updated yet are due right away, so they never show their bind pose for a whole interval.
+            const UpdateRateLodState& state = rootInstance->GetUpdateRateLodState();
+            const AZ::u32 framesSinceUpdate = state.GetHasUpdated() ? (state.GetFramesSinceUpdate() + 1) : AZStd::max(state.GetFramesSinceUpdate() + 1, frameInterval);
+            if (framesSinceUpdate < frameInterval)
+            {
+                RecursiveSchedule(rootInstance, false, frameInterval, timePassedInSeconds);
+                m_numSkipped++;
+                continue;
+            }
+
+            if (m_maxUpdatesPerFrame == 0)
+            {
+                RecursiveSchedule(rootInstance, true, frameInterval, timePassedInSeconds);
+                continue;
+            }
+
+            m_candidates.push_back({ rootInstance, frameInterval, framesSinceUpdate - frameInterval });
+        }
+
+        if (m_candidates.empty())
+        {
+            return;
+        }
+
+        // Only rank the due actor instances when they don't fit the budget. The most overdue ones go first so deferred
+        // actor instances can't starve, and on a tie the most detailed ones go first.
+        if (m_candidates.size() > m_maxUpdatesPerFrame)
+        {
+            AZStd::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& a, const Candidate& b)
+                {
+                    if (a.m_overdueFrames != b.m_overdueFrames)
+                    {
+                        return a.m_overdueFrames > b.m_overdueFrames;
+                    }
+                    return a.m_frameInterval < b.m_frameInterval;
+                });
+        }
+
+        const size_t numCandidates = m_candidates.size();
+        for (size_t i = 0; i < numCandidates; ++i)
+        {
+            const Candidate& candidate = m_candidates[i];
+            const bool update = (i < m_maxUpdatesPerFrame);
+            RecursiveSchedule(candidate.m_actorInstance, update, candidate.m_frameInterval, timePassedInSeconds);
+            if (!update)
+            {
+                m_numSkipped++;
+                m_numDeferred++;
+            }
+        }
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+    class ActorManager;
+    class Pose;
+
+
+    /**
+     * The update rate LOD settings of an actor instance.
+     * Actor instances that are small on screen or far away from the viewer do not need their anim graph and motions to be
+     * evaluated every frame. Based on a per frame metric, the actor instance gets assigned a frame interval N, after which
+     * it is only fully updated every Nth frame, with the accumulated time passed since its last update.
+     * On the frames in between, the pose can be interpolated between the two most recently updated poses.
+     */
+    class EMFX_API UpdateRateLodSettings
+    {
+    public:
+        AZ_TYPE_INFO(EMotionFX::UpdateRateLodSettings, "{6B3D1A64-2F09-4E77-9D0B-7A2C5E8B4F13}")
+        AZ_CLASS_ALLOCATOR_DECL
+
+        enum class Metric : AZ::u8
+        {
+            ScreenSize = 0,     /**< The projected bounding sphere diameter as fraction of the viewport height. Larger values mean more detail. */
+            Distance = 1        /**< The distance in meters between the viewer and the bounding box center. Smaller values mean more detail. */
+        };
+
+        /**
+         * Calculate the frame interval for a given metric value.
+         * Threshold i maps to a frame interval of i+1. The first threshold the metric qualifies for is used, where screen sizes
+         * qualify when they are at least the threshold, and distances qualify when they are at most the threshold.
+         * When no threshold qualifies, the maximum frame interval is returned.
+         * @param metricValue The screen size or distance, depending on the metric.
+         * @result The frame interval, which is 1 when the actor instance has to be updated every frame.
+         */
+        AZ::u32 CalcFrameInterval(float metricValue) const;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZStd::vector<float>    m_thresholds = { 0.4f, 0.2f, 0.1f, 0.05f };  /**< The metric thresholds per frame interval, sorted from most to least detailed. */
+        Metric                  m_metric = Metric::ScreenSize;               /**< The metric used to pick the frame interval. */
+        AZ::u32                 m_maxFrameInterval = 8;                      /**< The frame interval used when the metric passes all thresholds. */
+        AZ::u32                 m_invisibleFrameInterval = 8;                /**< The frame interval used for actor instances that are not visible. */
+        bool                    m_enabled = false;                           /**< Update rate LOD is opt-in, so existing actors keep updating every frame. */
+        bool                    m_interpolateSkippedFrames = true;           /**< Interpolate the pose of visible actor instances on frames where they are not updated. */
+    };
+
+
+    /**
+     * The runtime update rate LOD state of an actor instance.
+     * This is written by ActorUpdateRateLod on the main thread before the schedule executes, and read by the update job of the
+     * actor instance. It also holds the two most recently updated poses, used to interpolate skipped frames.
+     */
+    class EMFX_API UpdateRateLodState
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+
+        UpdateRateLodState();
+        ~UpdateRateLodState();
+
+        /**
+         * Register the update decision for the current frame.
+         * @param update True when the actor instance has to be updated this frame, false when it is skipped.
+         * @param frameInterval The frame interval the actor instance is running at.
+         * @param timePassedInSeconds The time passed since the previous frame.
+         */
+        void Schedule(bool update, AZ::u32 frameInterval, float timePassedInSeconds);
+
+        /**
+         * Store the current pose of the actor instance as interpolation target, after a full update.
+         * When the actor instance runs at a frame interval higher than one, the current pose gets replaced with the first
+         * interpolation step, so that the interpolated poses lag exactly one update behind.
+         * @param actorInstance The actor instance that just got updated.
+         * @param interpolate True when the skipped frames of the actor instance will be interpolated.
+         */
+        void StoreUpdatedPose(ActorInstance* actorInstance, bool interpolate);
+
+        /**
+         * Get the pose the most recent update calculated, before it got replaced by the first interpolation step.
+         * Actor instances that share the pose of this one copy this pose, and interpolate it themselves.
+         * @param actorInstance The actor instance this state belongs to.
+         * @result The updated pose, which is the current pose of the actor instance when it doesn't interpolate.
+         */
+        const Pose* GetUpdatedPose(const ActorInstance* actorInstance) const;
+
+        /**
+         * Write the interpolated pose into the current pose of the actor instance, on a skipped frame.
+         * This also updates the skinning matrices and the attachments.
+         * @param actorInstance The actor instance that is skipped this frame.
+         * @result True when an interpolated pose was applied, false when there are no poses to interpolate between yet.
+         */
+        bool ApplyInterpolatedPose(ActorInstance* actorInstance);
+
+        /**
+         * Reset the state, after which the actor instance will be updated the next frame.
+         */
+        void Reset();
+
+        bool GetUpdateThisFrame() const                 { return m_updateThisFrame; }
+        float GetUpdateTimeDelta() const                { return m_updateTimeDelta; }
+        AZ::u32 GetFrameInterval() const                { return m_frameInterval; }
+        AZ::u32 GetFramesSinceUpdate() const            { return m_framesSinceUpdate; }
+        bool GetHasUpdated() const                      { return m_hasUpdated; }
+
+    private:
+        void BlendPoses(ActorInstance* actorInstance, float weight);
+
+        AZStd::unique_ptr<Pose> m_previousPose;     /**< The pose of the update before the most recent one. */
+        AZStd::unique_ptr<Pose> m_targetPose;       /**< The pose of the most recent update. */
+        float                   m_accumulatedTime = 0.0f;
+        float                   m_updateTimeDelta = 0.0f;
+        AZ::u32                 m_frameInterval = 1;
+        AZ::u32                 m_framesSinceUpdate = 0;
+        bool                    m_updateThisFrame = true;
+        bool                    m_hasPoses = false;
+        bool                    m_hasUpdated = false;       /**< False until the first full update, or after a reset. */
+    };
+
+
+    /**
+     * Decides which actor instances are updated each frame, based on their update rate LOD settings.
+     * Evaluate is called by the scheduler before it executes, so the decisions are made in a single pass on the calling thread
+     * and the update jobs only have to read them. Attachments always follow the decision of the root actor instance they are
+     * attached to, as they depend on the pose of their parent.
+     * Optionally a maximum number of full updates per frame can be set. Actor instances that are due beyond that budget are
+     * deferred to the next frame, most overdue first, so the cost of the animation update stays flat for large crowds.
+     * Actor instances that do not use update rate LOD are never deferred.
+     */
+    class EMFX_API ActorUpdateRateLod
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+
+        /**
+         * Set the viewer used to calculate the screen size and distance metrics.
+         * When no viewer has been set, visible actor instances are updated every frame.
+         * @param position The world space position of the viewer.
+         * @param verticalFovRadians The vertical field of view of the viewer, in radians.
+         */
+        void SetViewer(const AZ::Vector3& position, float verticalFovRadians);
+        void ClearViewer();
+
+        void SetEnabled(bool enabled)                           { m_enabled = enabled; }
+        bool GetEnabled() const                                 { return m_enabled; }
+
+        void SetMaxUpdatesPerFrame(size_t maxUpdates)           { m_maxUpdatesPerFrame = maxUpdates; }
+        size_t GetMaxUpdatesPerFrame() const                    { return m_maxUpdatesPerFrame; }
+
+        /**
+         * Decide for all enabled root actor instances and their attachments whether they are updated this frame.
+         * @param actorManager The actor manager holding the root actor instances.
+         * @param timePassedInSeconds The time passed since the previous frame.
+         */
+        void Evaluate(const ActorManager& actorManager, float timePassedInSeconds);
+
+        /**
+         * Calculate the metric value of an actor instance, as used to pick its frame interval.
+         * @param actorInstance The actor instance to calculate the metric for.
+         * @param metric The metric to calculate.
+         * @result The screen size or distance of the actor instance.
+         */
+        float CalcMetric(const ActorInstance* actorInstance, UpdateRateLodSettings::Metric metric) const;
+
+        size_t GetNumSkippedActorInstances() const              { return m_numSkipped; }
+        size_t GetNumDeferredActorInstances() const             { return m_numDeferred; }
+
+    private:
+        struct Candidate
+        {
+            ActorInstance*  m_actorInstance;
+            AZ::u32         m_frameInterval;
+            AZ::u32         m_overdueFrames;
+        };
+
+        AZ::u32 CalcFrameInterval(const ActorInstance* actorInstance) const;
+        void RecursiveSchedule(ActorInstance* actorInstance, bool update, AZ::u32 frameInterval, float timePassedInSeconds);
+
+        AZStd::vector<Candidate>    m_candidates;
+        AZ::Vector3                 m_viewerPosition = AZ::Vector3::CreateZero();
+        float                       m_tanHalfFov = 0.0f;
+        size_t                      m_maxUpdatesPerFrame = 0;   /**< The maximum number of full updates per frame, or 0 for no limit. */
+        size_t                      m_numSkipped = 0;
+        size_t                      m_numDeferred = 0;
+        bool                        m_hasViewer = false;
+        bool                        m_enabled = true;
+    };
+}   // namespace EMotionFX
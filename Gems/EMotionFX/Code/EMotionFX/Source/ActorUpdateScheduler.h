@@ -83,11 +83,15 @@ namespace EMotionFX
         size_t GetNumUpdatedActorInstances() const                  { return m_numUpdated.GetValue(); }
         size_t GetNumVisibleActorInstances() const                  { return m_numVisible.GetValue(); }
         size_t GetNumSampledActorInstances() const                  { return m_numSampled.GetValue(); }
+        size_t GetNumSkippedActorInstances() const                  { return m_numSkipped.GetValue(); }
+        size_t GetNumSharedPoseActorInstances() const               { return m_numSharedPoses.GetValue(); }
 
     protected:
         MCore::AtomicSizeT m_numUpdated;
         MCore::AtomicSizeT m_numVisible;
         MCore::AtomicSizeT m_numSampled;
+        MCore::AtomicSizeT m_numSkipped;
+        MCore::AtomicSizeT m_numSharedPoses;
 
         /**
          * The constructor.
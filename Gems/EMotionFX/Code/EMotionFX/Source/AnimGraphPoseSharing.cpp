@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/hash.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphNode.h>
+#include <EMotionFX/Source/AnimGraphNodeData.h>
+#include <EMotionFX/Source/AnimGraphPoseSharing.h>
+#include <MCore/Source/AttributeBool.h>
+#include <MCore/Source/AttributeFloat.h>
+#include <MCore/Source/AttributeInt32.h>
+#include <MCore/Source/AttributeQuaternion.h>
+#include <MCore/Source/AttributeVector2.h>
+#include <MCore/Source/AttributeVector3.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(AnimGraphPoseSharing, ActorUpdateAllocator, 0)
+
+    namespace
+    {
+        AZ::s64 Quantize(float value, float tolerance)
+        {
+            if (tolerance > 0.0f)
+            {
+                return static_cast<AZ::s64>(AZStd::floor(value / tolerance + 0.5f));
+            }
+
+            // without a tolerance the exact value is compared
+            AZ::u32 bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        // marks the nodes without unique data in the node states
+        constexpr AZ::s64 NoNodeData = AZStd::numeric_limits<AZ::s64>::min();
+    } // namespace
+
+
+    bool AnimGraphPoseSharing::StateKey::operator==(const StateKey& other) const
+    {
+        return m_actor == other.m_actor &&
+            m_animGraph == other.m_animGraph &&
+            m_motionSet == other.m_motionSet &&
+            m_lodLevel == other.m_lodLevel &&
+            m_timeDelta == other.m_timeDelta &&
+            m_values == other.m_values;
+    }
+
+
+    bool AnimGraphPoseSharing::GetIsEligible(const ActorInstance* actorInstance) const
+    {
+        if (!actorInstance->GetPoseSharingEnabled() ||
+            !actorInstance->GetAnimGraphInstance() ||
+            !actorInstance->GetIsEnabled() ||
+            !actorInstance->GetIsVisible() ||
+            actorInstance->GetIsAttachment())
+        {
+            return false;
+        }
+
+        const UpdateRateLodState& lodState = actorInstance->GetUpdateRateLodState();
+        if (!lodState.GetUpdateThisFrame())
+        {
+            return false;
+        }
+
+        // the same test as the scheduler uses to decide whether the output pose gets calculated this frame
+        return (actorInstance->GetMotionSamplingTimer() + lodState.GetUpdateTimeDelta()) >= actorInstance->GetMotionSamplingRate();
+    }
+
+
+    void AnimGraphPoseSharing::BuildStateKey(const ActorInstance* actorInstance, StateKey& outState) const
+    {
+        AnimGraphInstance* animGraphInstance = actorInstance->GetAnimGraphInstance();
+        const AnimGraph* animGraph = animGraphInstance->GetAnimGraph();
+
+        outState.m_actor = actorInstance->GetActor();
+        outState.m_animGraph = animGraph;
+        outState.m_motionSet = animGraphInstance->GetMotionSet();
+        outState.m_lodLevel = actorInstance->GetLODLevel();
+        outState.m_timeDelta = actorInstance->GetUpdateRateLodState().GetUpdateTimeDelta();
+        outState.m_values.clear();
+
+        // parameter values
+        const size_t numParameters = animGraph->GetNumValueParameters();
+        for (size_t i = 0; i < numParameters; ++i)
+        {
+            const MCore::Attribute* attribute = animGraphInstance->GetParameterValue(i);
+            if (!attribute)
+            {
+                continue;
+            }
+
+            outState.m_values.emplace_back(attribute->GetType());
+            switch (attribute->GetType())
+            {
+            case MCore::AttributeFloat::TYPE_ID:
+                outState.m_values.emplace_back(Quantize(static_cast<const MCore::AttributeFloat*>(attribute)->GetValue(), m_valueTolerance));
+                break;
+            case MCore::AttributeBool::TYPE_ID:
+                outState.m_values.emplace_back(static_cast<const MCore::AttributeBool*>(attribute)->GetValue());
+                break;
+            case MCore::AttributeInt32::TYPE_ID:
+                outState.m_values.emplace_back(static_cast<const MCore::AttributeInt32*>(attribute)->GetValue());
+                break;
+            case MCore::AttributeVector2::TYPE_ID:
+            {
+                const AZ::Vector2& value = static_cast<const MCore::AttributeVector2*>(attribute)->GetValue();
+                outState.m_values.emplace_back(Quantize(value.GetX(), m_valueTolerance));
+                outState.m_values.emplace_back(Quantize(value.GetY(), m_valueTolerance));
+                break;
+            }
+            case MCore::AttributeVector3::TYPE_ID:
+            {
+                const AZ::Vector3& value = static_cast<const MCore::AttributeVector3*>(attribute)->GetValue();
+                outState.m_values.emplace_back(Quantize(value.GetX(), m_valueTolerance));
+                outState.m_values.emplace_back(Quantize(value.GetY(), m_valueTolerance));
+                outState.m_values.emplace_back(Quantize(value.GetZ(), m_valueTolerance));
+                break;
+            }
+            case MCore::AttributeQuaternion::TYPE_ID:
+            {
+                const AZ::Quaternion& value = static_cast<const MCore::AttributeQuaternion*>(attribute)->GetValue();
+                outState.m_values.emplace_back(Quantize(value.GetX(), m_valueTolerance));
+                outState.m_values.emplace_back(Quantize(value.GetY(), m_valueTolerance));
+                outState.m_values.emplace_back(Quantize(value.GetZ(), m_valueTolerance));
+                outState.m_values.emplace_back(Quantize(value.GetW(), m_valueTolerance));
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        // the playback state of all nodes, which includes the active states and the transition progress of state machines
+        const size_t numNodes = animGraph->GetNumNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const AnimGraphNode* node = animGraph->GetNode(i);
+            const AnimGraphNodeData* nodeData = static_cast<const AnimGraphNodeData*>(animGraphInstance->GetUniqueObjectData(node->GetObjectIndex()));
+            if (!nodeData)
+            {
+                outState.m_values.emplace_back(NoNodeData);
+                continue;
+            }
+
+            outState.m_values.emplace_back(Quantize(nodeData->GetCurrentPlayTime(), m_timeTolerance));
+            outState.m_values.emplace_back(Quantize(nodeData->GetPlaySpeed(), m_valueTolerance));
+            outState.m_values.emplace_back(Quantize(nodeData->GetGlobalWeight(), m_valueTolerance));
+        }
+    }
+
+
+    size_t AnimGraphPoseSharing::CalcStateKeyHash(const StateKey& state)
+    {
+        size_t hash = 0;
+        AZStd::hash_combine(hash, state.m_actor);
+        AZStd::hash_combine(hash, state.m_animGraph);
+        AZStd::hash_combine(hash, state.m_motionSet);
+        AZStd::hash_combine(hash, state.m_lodLevel);
+        AZStd::hash_combine(hash, state.m_timeDelta);
+        for (const AZ::s64 value : state.m_values)
+        {
+            AZStd::hash_combine(hash, value);
+        }
+        return hash;
+    }
+
+
+    size_t AnimGraphPoseSharing::CalcStateHash(const ActorInstance* actorInstance) const
+    {
+        StateKey state;
+        BuildStateKey(actorInstance, state);
+        return CalcStateKeyHash(state);
+    }
+
+
+    bool AnimGraphPoseSharing::GetHasEqualState(const ActorInstance* actorInstanceA, const ActorInstance* actorInstanceB) const
+    {
+        StateKey stateA;
+        StateKey stateB;
+        BuildStateKey(actorInstanceA, stateA);
+        BuildStateKey(actorInstanceB, stateB);
+        return stateA == stateB;
+    }
+
+
+    size_t AnimGraphPoseSharing::AssignPoseSources(const AZStd::vector<ActorInstance*>& actorInstances)
+    {
+        m_poseSourceIndices.clear();
+        m_numPoseSources = 0;
+
+        size_t numShared = 0;
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->SetPoseSharingSource(nullptr);
+            if (!m_enabled || !GetIsEligible(actorInstance))
+            {
+                continue;
+            }
+
+            BuildStateKey(actorInstance, m_tempState);
+            const size_t hash = CalcStateKeyHash(m_tempState);
+
+            // find the pose source in the same state, the hash only narrows down the candidates
+            size_t* firstIndex = nullptr;
+            auto hashIt = m_poseSourceIndices.find(hash);
+            if (hashIt != m_poseSourceIndices.end())
+            {
+                size_t sourceIndex = hashIt->second;
+                while (sourceIndex != InvalidIndex && !(m_poseSources[sourceIndex].m_state == m_tempState))
+                {
+                    sourceIndex = m_poseSources[sourceIndex].m_nextWithSameHash;
+                }
+
+                if (sourceIndex != InvalidIndex)
+                {
+                    actorInstance->SetPoseSharingSource(m_poseSources[sourceIndex].m_actorInstance);
+                    numShared++;
+                    continue;
+                }
+
+                firstIndex = &hashIt->second;
+            }
+
+            // this actor instance becomes a new pose source
+            if (m_numPoseSources == m_poseSources.size())
+            {
+                m_poseSources.emplace_back();
+            }
+            PoseSource& poseSource = m_poseSources[m_numPoseSources];
+            poseSource.m_actorInstance = actorInstance;
+            AZStd::swap(poseSource.m_state, m_tempState);
+            if (firstIndex)
+            {
+                poseSource.m_nextWithSameHash = *firstIndex;
+                *firstIndex = m_numPoseSources;
+            }
+            else
+            {
+                poseSource.m_nextWithSameHash = InvalidIndex;
+                m_poseSourceIndices.emplace(hash, m_numPoseSources);
+            }
+            m_numPoseSources++;
+        }
+
+        return numShared;
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+namespace EMotionFX
+{
+    // forward declarations
+    class Actor;
+    class ActorInstance;
+    class AnimGraph;
+    class MotionSet;
+
+
+    /**
+     * Shares the evaluated anim graph pose between actor instances that are in the same anim graph state.
+     * Crowds of background characters often run the same anim graph with the same parameters and in the same motion phase,
+     * in which case evaluating the output pose of every instance separately produces the same pose over and over again.
+     * Actor instances that opted in using ActorInstance::SetPoseSharingEnabled() are grouped by their anim graph state, using
+     * a hash of the state to find the group and comparing the full state to rule out hash collisions. The first actor instance of each group evaluates its anim graph as usual and becomes the pose source, while the
+     * others still update their anim graph, so that their events and root motion stay their own, but copy the output pose of
+     * the pose source instead of calculating it.
+     * Grouping happens per schedule step, on the calling thread, before the update jobs of that step are started.
+     * Anim graph state that is not part of the hash, such as random choices made during the update, can make the poses
+     * within a group diverge for a frame, so only enable sharing on actor instances where that is acceptable.
+     */
+    class EMFX_API AnimGraphPoseSharing
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+
+        void SetEnabled(bool enabled)                           { m_enabled = enabled; }
+        bool GetEnabled() const                                 { return m_enabled; }
+
+        /**
+         * Set the tolerance used to quantize node play times before hashing them.
+         * Actor instances whose play times differ less than this end up sharing their pose.
+         * @param seconds The play time tolerance, in seconds.
+         */
+        void SetTimeTolerance(float seconds)                    { m_timeTolerance = seconds; }
+        float GetTimeTolerance() const                          { return m_timeTolerance; }
+
+        /**
+         * Set the tolerance used to quantize float based parameter values and node weights before hashing them.
+         * @param tolerance The value tolerance.
+         */
+        void SetValueTolerance(float tolerance)                 { m_valueTolerance = tolerance; }
+        float GetValueTolerance() const                         { return m_valueTolerance; }
+
+        /**
+         * Check if an actor instance can share its pose this frame.
+         * This requires pose sharing to be enabled on the actor instance, an anim graph instance, and a visible actor instance
+         * that is updated and samples its motions this frame. Attachments never share their pose.
+         * @param actorInstance The actor instance to check.
+         * @result True when the actor instance can be a pose source or copy the pose of one.
+         */
+        bool GetIsEligible(const ActorInstance* actorInstance) const;
+
+        /**
+         * Calculate the hash of the anim graph state of an actor instance, before it is updated.
+         * The hash combines the actor, anim graph, motion set, LOD level and the time passed, the quantized parameter values,
+         * and the quantized play time, play speed and weight of every node that has unique data.
+         * @param actorInstance The actor instance to calculate the hash for, which must have an anim graph instance.
+         * @result The anim graph state hash.
+         */
+        size_t CalcStateHash(const ActorInstance* actorInstance) const;
+
+        /**
+         * Check if two actor instances are in the same anim graph state, comparing everything CalcStateHash() hashes.
+         * @param actorInstanceA The first actor instance, which must have an anim graph instance.
+         * @param actorInstanceB The second actor instance, which must have an anim graph instance.
+         * @result True when the actor instances can share their pose.
+         */
+        bool GetHasEqualState(const ActorInstance* actorInstanceA, const ActorInstance* actorInstanceB) const;
+
+        /**
+         * Assign the pose sources for the actor instances of a schedule step.
+         * Eligible actor instances in the same anim graph state get the first of them assigned as pose source, all others
+         * get their pose source cleared.
+         * @param actorInstances The actor instances in the schedule step.
+         * @result The number of actor instances that copy their pose from a pose source.
+         */
+        size_t AssignPoseSources(const AZStd::vector<ActorInstance*>& actorInstances);
+
+    private:
+        /**
+         * The anim graph state of an actor instance, with the parameter values and node states quantized by the tolerances.
+         */
+        struct StateKey
+        {
+            bool operator==(const StateKey& other) const;
+
+            const Actor*            m_actor = nullptr;
+            const AnimGraph*        m_animGraph = nullptr;
+            const MotionSet*        m_motionSet = nullptr;
+            size_t                  m_lodLevel = 0;
+            float                   m_timeDelta = 0.0f;
+            AZStd::vector<AZ::s64>  m_values;           /**< The quantized parameter values and node states, in parameter and node order. */
+        };
+
+        /**
+         * A pose source of the current schedule step.
+         */
+        struct PoseSource
+        {
+            ActorInstance*  m_actorInstance = nullptr;
+            StateKey        m_state;
+            size_t          m_nextWithSameHash = InvalidIndex;  /**< The next pose source with the same state hash. */
+        };
+
+        void BuildStateKey(const ActorInstance* actorInstance, StateKey& outState) const;
+        static size_t CalcStateKeyHash(const StateKey& state);
+
+        AZStd::unordered_map<size_t, size_t>            m_poseSourceIndices;            /**< The index of the first pose source per state hash. */
+        AZStd::vector<PoseSource>                       m_poseSources;                  /**< The pose sources, reused between steps to avoid allocations. */
+        size_t                                          m_numPoseSources = 0;
+        StateKey                                        m_tempState;
+        float                                           m_timeTolerance = 0.001f;
+        float                                           m_valueTolerance = 0.001f;
+        bool                                            m_enabled = true;
+    };
+}   // namespace EMotionFX
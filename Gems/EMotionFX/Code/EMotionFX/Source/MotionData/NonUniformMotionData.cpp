@@ -707,6 +707,33 @@ namespace EMotionFX
         return m_floatData[floatDataIndex].m_track.m_times.size();
     }
 
+    size_t NonUniformMotionData::CalcSampleDataSizeInBytes() const
+    {
+        auto calcTrackSize = [](const auto& track)
+        {
+            return track.m_times.size() * sizeof(float) + track.m_values.size() * sizeof(typename AZStd::decay_t<decltype(track.m_values)>::value_type);
+        };
+
+        size_t numBytes = m_jointData.size() * sizeof(JointData) + (m_morphData.size() + m_floatData.size()) * sizeof(FloatData);
+        for (const JointData& jointData : m_jointData)
+        {
+            numBytes += calcTrackSize(jointData.m_positionTrack);
+            numBytes += calcTrackSize(jointData.m_rotationTrack);
+#ifndef EMFX_SCALE_DISABLED
+            numBytes += calcTrackSize(jointData.m_scaleTrack);
+#endif
+        }
+        for (const FloatData& morphData : m_morphData)
+        {
+            numBytes += calcTrackSize(morphData.m_track);
+        }
+        for (const FloatData& floatData : m_floatData)
+        {
+            numBytes += calcTrackSize(floatData.m_track);
+        }
+        return numBytes;
+    }
+
     bool NonUniformMotionData::VerifyKeyTrackTimeIntegrity(const AZStd::vector<float>& timeValues)
     {
         if (timeValues.empty())
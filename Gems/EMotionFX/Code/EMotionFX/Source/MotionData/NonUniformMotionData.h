@@ -106,6 +106,9 @@ namespace EMotionFX
         size_t GetNumMorphSamples(size_t morphDataIndex) const;
         size_t GetNumFloatSamples(size_t floatDataIndex) const;
 
+        // The number of bytes used by the key tracks, excluding the static data shared by all motion data types.
+        size_t CalcSampleDataSizeInBytes() const;
+
         const Vector3Track& GetJointPositionTrack(size_t jointDataIndex) const;
         const QuaternionTrack& GetJointRotationTrack(size_t jointDataIndex) const;
         const FloatTrack& GetMorphTrack(size_t morphDataIndex) const;
@@ -0,0 +1,1415 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/QuantizedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        // The error used when initializing from other motion data. AddTrack raises the tolerance of each component to half a
+        // quantization step, so this only removes the keys that interpolating the quantized keys reproduces as well as storing them.
+        constexpr float LosslessMaxError = 0.0f;
+        // Samples this close to the static value don't need a track, even at the lossless error.
+        constexpr float StaticValueTolerance = 0.00001f;
+        constexpr float MaxQuantizedValue = 65535.0f;
+
+        bool IsInIgnoreList(const AZStd::vector<size_t>& ignoreList, size_t index)
+        {
+            return AZStd::find(ignoreList.begin(), ignoreList.end(), index) != ignoreList.end();
+        }
+    } // namespace
+
+    QuantizedMotionData::~QuantizedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* QuantizedMotionData::CreateNew() const
+    {
+        return aznew QuantizedMotionData();
+    }
+
+    const char* QuantizedMotionData::GetSceneSettingsName() const
+    {
+        return "Quantized Keyframes (smallest, curve fitted)";
+    }
+
+    void QuantizedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        Clear();
+        CopyBaseMotionData(motionData);
+
+        // Calculate the uniform sample grid the keys are fitted on.
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+        float sampleSpacing = 0.0f;
+        MotionData::CalculateSampleInformation(m_duration, sampleRate, m_numSamples, sampleSpacing);
+        if (m_numSamples > MaxNumSamples)
+        {
+            AZ_Warning("EMotionFX", false, "Motion requires %zu samples at %.2f fps, which is more than the %zu supported by quantized motion data. Lowering the sample rate.",
+                m_numSamples, sampleRate, MaxNumSamples);
+            sampleRate = static_cast<float>(MaxNumSamples - 1) / m_duration;
+            MotionData::CalculateSampleInformation(m_duration, sampleRate, m_numSamples, sampleSpacing);
+            m_numSamples = AZStd::min(m_numSamples, MaxNumSamples);
+        }
+        SetSampleRate(sampleRate);
+
+        if (m_numSamples == 0)
+        {
+            UpdateDuration();
+            return;
+        }
+
+        // Joints.
+        TrackSamples positions;
+        TrackSamples rotations;
+#ifndef EMFX_SCALE_DISABLED
+        TrackSamples scales;
+#endif
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            const bool posAnimated = motionData->IsJointPositionAnimated(i);
+            const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+            positions.resize(posAnimated ? m_numSamples * 3 : 0);
+            rotations.resize(rotAnimated ? m_numSamples * 4 : 0);
+#ifndef EMFX_SCALE_DISABLED
+            const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+            scales.resize(scaleAnimated ? m_numSamples * 3 : 0);
+#endif
+
+            // Keep consecutive rotations in the same hemisphere, so that interpolating the components matches a normalized lerp.
+            AZ::Quaternion previousRotation = m_staticJointData[i].m_staticTransform.m_rotation;
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float keyTime = s * sampleSpacing;
+                const Transform transform = motionData->SampleJointTransform(keyTime, i);
+                if (posAnimated)
+                {
+                    transform.m_position.StoreToFloat3(&positions[s * 3]);
+                }
+                if (rotAnimated)
+                {
+                    AZ::Quaternion rotation = transform.m_rotation.GetNormalized();
+                    if (rotation.Dot(previousRotation) < 0.0f)
+                    {
+                        rotation = -rotation;
+                    }
+                    rotation.StoreToFloat4(&rotations[s * 4]);
+                    previousRotation = rotation;
+                }
+                EMFX_SCALECODE
+                (
+                    if (scaleAnimated)
+                    {
+                        transform.m_scale.StoreToFloat3(&scales[s * 3]);
+                    }
+                )
+            }
+
+            const Transform& staticTransform = m_staticJointData[i].m_staticTransform;
+            JointTracks& jointTracks = m_jointTracks[i];
+            if (posAnimated)
+            {
+                float staticValue[3];
+                staticTransform.m_position.StoreToFloat3(staticValue);
+                jointTracks.m_position = AddTrack(positions, 3, staticValue, LosslessMaxError);
+            }
+            if (rotAnimated)
+            {
+                float staticValue[4];
+                staticTransform.m_rotation.StoreToFloat4(staticValue);
+                jointTracks.m_rotation = AddTrack(rotations, 4, staticValue, LosslessMaxError);
+            }
+            EMFX_SCALECODE
+            (
+                if (scaleAnimated)
+                {
+                    float staticValue[3];
+                    staticTransform.m_scale.StoreToFloat3(staticValue);
+                    jointTracks.m_scale = AddTrack(scales, 3, staticValue, LosslessMaxError);
+                }
+            )
+        }
+
+        // Morphs.
+        TrackSamples values(m_numSamples);
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            if (!motionData->IsMorphAnimated(i))
+            {
+                continue;
+            }
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                values[s] = motionData->SampleMorph(s * sampleSpacing, i);
+            }
+            m_morphTracks[i] = AddTrack(values, 1, &m_staticMorphData[i].m_staticValue, LosslessMaxError);
+        }
+
+        // Floats.
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            if (!motionData->IsFloatAnimated(i))
+            {
+                continue;
+            }
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                values[s] = motionData->SampleFloat(s * sampleSpacing, i);
+            }
+            m_floatTracks[i] = AddTrack(values, 1, &m_staticFloatData[i].m_staticValue, LosslessMaxError);
+        }
+
+        UpdateDuration();
+    }
+
+    AZ::u32 QuantizedMotionData::AddTrack(TrackSamples samples, size_t numComponents, const float* staticValue, float maxError)
+    {
+        AZ_Assert(numComponents > 0 && numComponents <= MaxNumComponents, "Expected between 1 and %zu components.", MaxNumComponents);
+        const size_t numSamples = samples.size() / numComponents;
+        AZ_Assert(numSamples <= MaxNumSamples, "Expected at most %zu samples.", MaxNumSamples);
+        if (numSamples == 0)
+        {
+            return InvalidTrack;
+        }
+
+        // Tracks that never leave their static value don't need to be stored.
+        const float staticTolerance = AZStd::max(maxError, StaticValueTolerance);
+        bool isStatic = true;
+        for (size_t i = 0; i < samples.size() && isStatic; ++i)
+        {
+            isStatic = AZ::IsClose(samples[i], staticValue[i % numComponents], staticTolerance);
+        }
+        if (isStatic)
+        {
+            return InvalidTrack;
+        }
+
+        // Quantize all samples relative to the value range of each component.
+        Track track;
+        float componentMaxError[MaxNumComponents];
+        track.m_numComponents = static_cast<AZ::u32>(numComponents);
+        for (size_t c = 0; c < numComponents; ++c)
+        {
+            float minValue = samples[c];
+            float maxValue = samples[c];
+            for (size_t s = 1; s < numSamples; ++s)
+            {
+                minValue = AZStd::min(minValue, samples[s * numComponents + c]);
+                maxValue = AZStd::max(maxValue, samples[s * numComponents + c]);
+            }
+            track.m_rangeMin[c] = minValue;
+            track.m_rangeScale[c] = (maxValue - minValue) / MaxQuantizedValue;
+
+            // Every key is already off by up to half a quantization step, so a smaller tolerance would keep all keys without getting
+            // any closer to the samples. The few float epsilons of headroom cover the rounding of dequantizing and interpolating.
+            const float roundingError = 4.0f * AZ::Constants::FloatEpsilon * AZStd::max(AZ::GetAbs(minValue), AZ::GetAbs(maxValue));
+            componentMaxError[c] = AZStd::max(maxError, 0.5f * track.m_rangeScale[c] + roundingError);
+        }
+
+        AZStd::vector<AZ::u16> quantized(samples.size());
+        TrackSamples dequantized(samples.size());
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            for (size_t c = 0; c < numComponents; ++c)
+            {
+                const size_t index = s * numComponents + c;
+                const float normalized = (track.m_rangeScale[c] > 0.0f) ? (samples[index] - track.m_rangeMin[c]) / track.m_rangeScale[c] : 0.0f;
+                quantized[index] = static_cast<AZ::u16>(AZ::GetClamp(normalized + 0.5f, 0.0f, MaxQuantizedValue));
+                dequantized[index] = track.m_rangeMin[c] + track.m_rangeScale[c] * quantized[index];
+            }
+        }
+
+        // Check if all samples in between two keys are within the error tolerance when linearly interpolating the quantized keys.
+        auto isSegmentWithinError = [&](size_t keyA, size_t keyB)
+        {
+            const float invNumFrames = 1.0f / static_cast<float>(keyB - keyA);
+            for (size_t s = keyA + 1; s < keyB; ++s)
+            {
+                const float t = static_cast<float>(s - keyA) * invNumFrames;
+                for (size_t c = 0; c < numComponents; ++c)
+                {
+                    const float interpolated = AZ::Lerp(dequantized[keyA * numComponents + c], dequantized[keyB * numComponents + c], t);
+                    if (!AZ::IsClose(interpolated, samples[s * numComponents + c], componentMaxError[c]))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+
+        // Greedily fit linear segments, extending each one as long as the samples it skips stay within the tolerance.
+        track.m_firstKey = static_cast<AZ::u32>(m_keyFrames.size());
+        track.m_firstValue = static_cast<AZ::u32>(m_keyValues.size());
+        auto addKey = [this, &track, &quantized, numComponents](size_t sampleIndex)
+        {
+            m_keyFrames.emplace_back(static_cast<AZ::u16>(sampleIndex));
+            m_keyValues.insert(m_keyValues.end(), quantized.begin() + sampleIndex * numComponents, quantized.begin() + (sampleIndex + 1) * numComponents);
+            track.m_numKeys++;
+        };
+
+        addKey(0);
+        size_t keyA = 0;
+        while (keyA + 1 < numSamples)
+        {
+            size_t keyB = keyA + 1;
+            while (keyB + 1 < numSamples && isSegmentWithinError(keyA, keyB + 1))
+            {
+                ++keyB;
+            }
+            addKey(keyB);
+            keyA = keyB;
+        }
+
+        m_tracks.emplace_back(track);
+        m_sourceSamples.emplace_back(AZStd::move(samples));
+        return static_cast<AZ::u32>(m_tracks.size() - 1);
+    }
+
+    void QuantizedMotionData::InterpolateKeys(const Track& track, const AZ::u16* keyFrames, const AZ::u16* keyValues, float sampleFrame, float* outValues)
+    {
+        const AZ::u16* frames = keyFrames + track.m_firstKey;
+        const AZ::u16* values = keyValues + track.m_firstValue;
+        const size_t numComponents = track.m_numComponents;
+
+        if (track.m_numKeys == 1)
+        {
+            for (size_t c = 0; c < numComponents; ++c)
+            {
+                outValues[c] = track.m_rangeMin[c] + track.m_rangeScale[c] * values[c];
+            }
+            return;
+        }
+
+        // Find the first key after the sample frame, the frames are sorted and only 16 bits each, so this stays within a few cache lines.
+        const AZ::u16* upper = AZStd::upper_bound(frames, frames + track.m_numKeys, sampleFrame, [](float frame, AZ::u16 keyFrame) { return frame < keyFrame; });
+        const size_t keyB = AZ::GetClamp<size_t>(upper - frames, 1, track.m_numKeys - 1);
+        const size_t keyA = keyB - 1;
+        const float t = AZ::GetClamp((sampleFrame - frames[keyA]) / static_cast<float>(frames[keyB] - frames[keyA]), 0.0f, 1.0f);
+
+        const AZ::u16* valuesA = values + keyA * numComponents;
+        const AZ::u16* valuesB = values + keyB * numComponents;
+        for (size_t c = 0; c < numComponents; ++c)
+        {
+            outValues[c] = track.m_rangeMin[c] + track.m_rangeScale[c] * AZ::Lerp(static_cast<float>(valuesA[c]), static_cast<float>(valuesB[c]), t);
+        }
+    }
+
+    void QuantizedMotionData::DecodeTrack(const Track& track, const AZ::u16* keyFrames, const AZ::u16* keyValues, size_t numSamples, TrackSamples& outSamples)
+    {
+        outSamples.resize(numSamples * track.m_numComponents);
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            InterpolateKeys(track, keyFrames, keyValues, static_cast<float>(s), &outSamples[s * track.m_numComponents]);
+        }
+    }
+
+    void QuantizedMotionData::RebuildTracks(const OptimizeSettings* optimizeSettings)
+    {
+        AZStd::vector<Track> oldTracks;
+        AZStd::vector<AZ::u16> oldKeyFrames;
+        AZStd::vector<AZ::u16> oldKeyValues;
+        AZStd::vector<TrackSamples> oldSourceSamples;
+        oldTracks.swap(m_tracks);
+        oldKeyFrames.swap(m_keyFrames);
+        oldKeyValues.swap(m_keyValues);
+        oldSourceSamples.swap(m_sourceSamples);
+        m_tracks.reserve(oldTracks.size());
+        m_keyFrames.reserve(oldKeyFrames.size());
+        m_keyValues.reserve(oldKeyValues.size());
+        m_sourceSamples.reserve(oldSourceSamples.size());
+
+        // Copy the track as it is when no error is given, otherwise fit it again from its source samples.
+        // Tracks without source samples were read from a stream, their decoded keys become the source samples from now on.
+        auto rebuildTrack = [&](AZ::u32& trackIndex, const float* staticValue, const float* maxError)
+        {
+            if (trackIndex == InvalidTrack)
+            {
+                return;
+            }
+
+            const Track& oldTrack = oldTracks[trackIndex];
+            TrackSamples sourceSamples;
+            if (trackIndex < oldSourceSamples.size())
+            {
+                sourceSamples = AZStd::move(oldSourceSamples[trackIndex]);
+            }
+
+            if (maxError)
+            {
+                if (sourceSamples.empty())
+                {
+                    DecodeTrack(oldTrack, oldKeyFrames.data(), oldKeyValues.data(), m_numSamples, sourceSamples);
+                }
+                trackIndex = AddTrack(AZStd::move(sourceSamples), oldTrack.m_numComponents, staticValue, *maxError);
+                return;
+            }
+
+            Track track = oldTrack;
+            track.m_firstKey = static_cast<AZ::u32>(m_keyFrames.size());
+            track.m_firstValue = static_cast<AZ::u32>(m_keyValues.size());
+            m_keyFrames.insert(m_keyFrames.end(), oldKeyFrames.begin() + oldTrack.m_firstKey, oldKeyFrames.begin() + oldTrack.m_firstKey + oldTrack.m_numKeys);
+            m_keyValues.insert(m_keyValues.end(),
+                oldKeyValues.begin() + oldTrack.m_firstValue,
+                oldKeyValues.begin() + oldTrack.m_firstValue + oldTrack.m_numKeys * oldTrack.m_numComponents);
+            m_tracks.emplace_back(track);
+            m_sourceSamples.emplace_back(AZStd::move(sourceSamples));
+            trackIndex = static_cast<AZ::u32>(m_tracks.size() - 1);
+        };
+
+        // Joints.
+        for (size_t i = 0; i < m_jointTracks.size(); ++i)
+        {
+            const float* maxPosError = optimizeSettings ? &optimizeSettings->m_maxPosError : nullptr;
+            const float* maxRotError = optimizeSettings ? &optimizeSettings->m_maxRotError : nullptr;
+            const float* maxScaleError = optimizeSettings ? &optimizeSettings->m_maxScaleError : nullptr;
+            if (optimizeSettings && IsInIgnoreList(optimizeSettings->m_jointIgnoreList, i))
+            {
+                maxPosError = &LosslessMaxError;
+                maxRotError = &LosslessMaxError;
+                maxScaleError = &LosslessMaxError;
+            }
+
+            const Transform& staticTransform = m_staticJointData[i].m_staticTransform;
+            float staticPos[3];
+            float staticRot[4];
+            float staticScale[3];
+            staticTransform.m_position.StoreToFloat3(staticPos);
+            staticTransform.m_rotation.StoreToFloat4(staticRot);
+            staticTransform.m_scale.StoreToFloat3(staticScale);
+
+            JointTracks& jointTracks = m_jointTracks[i];
+            rebuildTrack(jointTracks.m_position, staticPos, maxPosError);
+            rebuildTrack(jointTracks.m_rotation, staticRot, maxRotError);
+            rebuildTrack(jointTracks.m_scale, staticScale, maxScaleError);
+        }
+
+        // Morphs.
+        for (size_t i = 0; i < m_morphTracks.size(); ++i)
+        {
+            const bool optimize = optimizeSettings && !IsInIgnoreList(optimizeSettings->m_morphIgnoreList, i);
+            rebuildTrack(m_morphTracks[i], &m_staticMorphData[i].m_staticValue, optimize ? &optimizeSettings->m_maxMorphError : nullptr);
+        }
+
+        // Floats.
+        for (size_t i = 0; i < m_floatTracks.size(); ++i)
+        {
+            const bool optimize = optimizeSettings && !IsInIgnoreList(optimizeSettings->m_floatIgnoreList, i);
+            rebuildTrack(m_floatTracks[i], &m_staticFloatData[i].m_staticValue, optimize ? &optimizeSettings->m_maxFloatError : nullptr);
+        }
+
+        m_tracks.shrink_to_fit();
+        m_keyFrames.shrink_to_fit();
+        m_keyValues.shrink_to_fit();
+    }
+
+    void QuantizedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        RebuildTracks(&settings);
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    float QuantizedMotionData::CalcSampleFrame(float sampleTime) const
+    {
+        if (m_numSamples < 2)
+        {
+            return 0.0f;
+        }
+
+        return AZ::GetClamp(sampleTime * m_sampleRate, 0.0f, static_cast<float>(m_numSamples - 1));
+    }
+
+    void QuantizedMotionData::SampleTrack(AZ::u32 trackIndex, float sampleFrame, float* outValues) const
+    {
+        InterpolateKeys(m_tracks[trackIndex], m_keyFrames.data(), m_keyValues.data(), sampleFrame, outValues);
+    }
+
+    AZ::Vector3 QuantizedMotionData::SampleVector3Track(AZ::u32 trackIndex, float sampleFrame, const AZ::Vector3& staticValue) const
+    {
+        if (trackIndex == InvalidTrack)
+        {
+            return staticValue;
+        }
+
+        float values[3];
+        SampleTrack(trackIndex, sampleFrame, values);
+        return AZ::Vector3::CreateFromFloat3(values);
+    }
+
+    AZ::Quaternion QuantizedMotionData::SampleQuaternionTrack(AZ::u32 trackIndex, float sampleFrame, const AZ::Quaternion& staticValue) const
+    {
+        if (trackIndex == InvalidTrack)
+        {
+            return staticValue;
+        }
+
+        float values[4];
+        SampleTrack(trackIndex, sampleFrame, values);
+        return AZ::Quaternion::CreateFromFloat4(values).GetNormalized();
+    }
+
+    float QuantizedMotionData::SampleFloatTrack(AZ::u32 trackIndex, float sampleFrame, float staticValue) const
+    {
+        if (trackIndex == InvalidTrack)
+        {
+            return staticValue;
+        }
+
+        float value;
+        SampleTrack(trackIndex, sampleFrame, &value);
+        return value;
+    }
+
+    Transform QuantizedMotionData::SampleJointData(size_t jointDataIndex, float sampleFrame) const
+    {
+        const JointTracks& jointTracks = m_jointTracks[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+
+        Transform result;
+        result.m_position = SampleVector3Track(jointTracks.m_position, sampleFrame, staticTransform.m_position);
+        result.m_rotation = SampleQuaternionTrack(jointTracks.m_rotation, sampleFrame, staticTransform.m_rotation);
+#ifndef EMFX_SCALE_DISABLED
+        result.m_scale = SampleVector3Track(jointTracks.m_scale, sampleFrame, staticTransform.m_scale);
+#endif
+        return result;
+    }
+
+    Transform QuantizedMotionData::SampleJointTransform(const SampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const bool inPlace = (settings.m_inPlace && skeleton->GetNode(jointSkeletonIndex)->GetIsRootNode());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex && !inPlace)
+        {
+            result = SampleJointData(jointDataIndex, CalcSampleFrame(settings.m_sampleTime));
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void QuantizedMotionData::SamplePose(const SampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // All tracks share the same sample grid, so the frame only has to be calculated once for the whole pose.
+        const float sampleFrame = CalcSampleFrame(settings.m_sampleTime);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeleton->GetNode(skeletonJointIndex)->GetIsRootNode());
+
+            // Sample the interpolated data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                result = SampleJointData(jointDataIndex, sampleFrame);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                outputPose->SetMorphWeight(i, SampleFloatTrack(m_morphTracks[realIndex], sampleFrame, m_staticMorphData[realIndex].m_staticValue));
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float QuantizedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        return SampleFloatTrack(m_morphTracks[morphDataIndex], CalcSampleFrame(sampleTime), m_staticMorphData[morphDataIndex].m_staticValue);
+    }
+
+    float QuantizedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        return SampleFloatTrack(m_floatTracks[floatDataIndex], CalcSampleFrame(sampleTime), m_staticFloatData[floatDataIndex].m_staticValue);
+    }
+
+    Transform QuantizedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleJointData(jointDataIndex, CalcSampleFrame(sampleTime));
+    }
+
+    AZ::Vector3 QuantizedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleVector3Track(m_jointTracks[jointDataIndex].m_position, CalcSampleFrame(sampleTime), m_staticJointData[jointDataIndex].m_staticTransform.m_position);
+    }
+
+    AZ::Quaternion QuantizedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleQuaternionTrack(m_jointTracks[jointDataIndex].m_rotation, CalcSampleFrame(sampleTime), m_staticJointData[jointDataIndex].m_staticTransform.m_rotation);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 QuantizedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleVector3Track(m_jointTracks[jointDataIndex].m_scale, CalcSampleFrame(sampleTime), m_staticJointData[jointDataIndex].m_staticTransform.m_scale);
+    }
+#endif
+
+    void QuantizedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        const bool removesTracks = (numJoints < m_jointTracks.size() || numMorphs < m_morphTracks.size() || numFloats < m_floatTracks.size());
+        m_jointTracks.resize(numJoints);
+        m_morphTracks.resize(numMorphs, InvalidTrack);
+        m_floatTracks.resize(numFloats, InvalidTrack);
+        if (removesTracks)
+        {
+            RebuildTracks(nullptr);
+        }
+    }
+
+    void QuantizedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointTracks.size(), "Expected the size of the jointTracks vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointTracks.emplace_back();
+    }
+
+    void QuantizedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphTracks.size(), "Expected the size of the morphTracks vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphTracks.emplace_back(InvalidTrack);
+    }
+
+    void QuantizedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatTracks.size(), "Expected the size of the floatTracks vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatTracks.emplace_back(InvalidTrack);
+    }
+
+    void QuantizedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        m_jointTracks.erase(m_jointTracks.begin() + jointDataIndex);
+        RebuildTracks(nullptr);
+    }
+
+    void QuantizedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphTracks.erase(m_morphTracks.begin() + morphDataIndex);
+        RebuildTracks(nullptr);
+    }
+
+    void QuantizedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatTracks.erase(m_floatTracks.begin() + floatDataIndex);
+        RebuildTracks(nullptr);
+    }
+
+    void QuantizedMotionData::ClearAllData()
+    {
+        m_jointTracks.clear();
+        m_jointTracks.shrink_to_fit();
+        m_morphTracks.clear();
+        m_morphTracks.shrink_to_fit();
+        m_floatTracks.clear();
+        m_floatTracks.shrink_to_fit();
+        m_tracks.clear();
+        m_tracks.shrink_to_fit();
+        m_keyFrames.clear();
+        m_keyFrames.shrink_to_fit();
+        m_keyValues.clear();
+        m_keyValues.shrink_to_fit();
+        m_sourceSamples.clear();
+        m_sourceSamples.shrink_to_fit();
+
+        m_numSamples = 0;
+    }
+
+    void QuantizedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the range scales all dequantized positions, without having to touch the keys.
+        for (const JointTracks& jointTracks : m_jointTracks)
+        {
+            if (jointTracks.m_position == InvalidTrack)
+            {
+                continue;
+            }
+
+            Track& track = m_tracks[jointTracks.m_position];
+            for (size_t c = 0; c < track.m_numComponents; ++c)
+            {
+                track.m_rangeMin[c] *= scaleFactor;
+                track.m_rangeScale[c] *= scaleFactor;
+            }
+            for (float& sample : m_sourceSamples[jointTracks.m_position])
+            {
+                sample *= scaleFactor;
+            }
+        }
+    }
+
+    void QuantizedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0 && m_sampleRate > 0.0f) ? (m_numSamples - 1) / m_sampleRate : 0.0f;
+    }
+
+    void QuantizedMotionData::ClearAllJointTransformSamples()
+    {
+        for (JointTracks& jointTracks : m_jointTracks)
+        {
+            jointTracks = JointTracks();
+        }
+        RebuildTracks(nullptr);
+    }
+
+    void QuantizedMotionData::ClearAllMorphSamples()
+    {
+        AZStd::fill(m_morphTracks.begin(), m_morphTracks.end(), InvalidTrack);
+        RebuildTracks(nullptr);
+    }
+
+    void QuantizedMotionData::ClearAllFloatSamples()
+    {
+        AZStd::fill(m_floatTracks.begin(), m_floatTracks.end(), InvalidTrack);
+        RebuildTracks(nullptr);
+    }
+
+    void QuantizedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex].m_position = InvalidTrack;
+        RebuildTracks(nullptr);
+    }
+
+    void QuantizedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex].m_rotation = InvalidTrack;
+        RebuildTracks(nullptr);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void QuantizedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex].m_scale = InvalidTrack;
+        RebuildTracks(nullptr);
+    }
+#endif
+
+    void QuantizedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex] = JointTracks();
+        RebuildTracks(nullptr);
+    }
+
+    void QuantizedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphTracks[morphDataIndex] = InvalidTrack;
+        RebuildTracks(nullptr);
+    }
+
+    void QuantizedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatTracks[floatDataIndex] = InvalidTrack;
+        RebuildTracks(nullptr);
+    }
+
+    bool QuantizedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_position != InvalidTrack;
+    }
+
+    bool QuantizedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_rotation != InvalidTrack;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool QuantizedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_scale != InvalidTrack;
+    }
+#endif
+
+    bool QuantizedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+        const JointTracks& jointTracks = m_jointTracks[jointDataIndex];
+
+#ifndef EMFX_SCALE_DISABLED
+        return (jointTracks.m_position != InvalidTrack || jointTracks.m_rotation != InvalidTrack || jointTracks.m_scale != InvalidTrack);
+#else
+        return (jointTracks.m_position != InvalidTrack || jointTracks.m_rotation != InvalidTrack);
+#endif
+    }
+
+    bool QuantizedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphTracks[morphDataIndex] != InvalidTrack;
+    }
+
+    bool QuantizedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatTracks[floatDataIndex] != InvalidTrack;
+    }
+
+    size_t QuantizedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    size_t QuantizedMotionData::GetNumTracks() const
+    {
+        return m_tracks.size();
+    }
+
+    size_t QuantizedMotionData::GetNumKeys() const
+    {
+        return m_keyFrames.size();
+    }
+
+    size_t QuantizedMotionData::GetNumJointPositionKeys(size_t jointDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_jointTracks[jointDataIndex].m_position;
+        return (trackIndex != InvalidTrack) ? m_tracks[trackIndex].m_numKeys : 0;
+    }
+
+    size_t QuantizedMotionData::GetNumJointRotationKeys(size_t jointDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_jointTracks[jointDataIndex].m_rotation;
+        return (trackIndex != InvalidTrack) ? m_tracks[trackIndex].m_numKeys : 0;
+    }
+
+    size_t QuantizedMotionData::CalcSampleDataSizeInBytes() const
+    {
+        size_t numBytes = m_jointTracks.size() * sizeof(JointTracks) +
+            m_morphTracks.size() * sizeof(AZ::u32) +
+            m_floatTracks.size() * sizeof(AZ::u32) +
+            m_tracks.size() * sizeof(Track) +
+            m_keyFrames.size() * sizeof(AZ::u16) +
+            m_keyValues.size() * sizeof(AZ::u16) +
+            m_sourceSamples.size() * sizeof(TrackSamples);
+        for (const TrackSamples& samples : m_sourceSamples)
+        {
+            numBytes += samples.size() * sizeof(float);
+        }
+        return numBytes;
+    }
+
+    void QuantizedMotionData::ReleaseSourceSamples()
+    {
+        // Keep one empty entry per track, like tracks read from a stream.
+        for (TrackSamples& samples : m_sourceSamples)
+        {
+            samples = TrackSamples();
+        }
+    }
+
+    bool QuantizedMotionData::VerifyIntegrity() const
+    {
+        if (m_jointTracks.size() != GetNumJoints() || m_morphTracks.size() != GetNumMorphs() || m_floatTracks.size() != GetNumFloats())
+        {
+            AZ_Error("EMotionFX", false, "The number of joint, morph or float tracks is out of sync with the static data.");
+            return false;
+        }
+
+        auto isValidTrackIndex = [this](AZ::u32 trackIndex)
+        {
+            return trackIndex == InvalidTrack || trackIndex < m_tracks.size();
+        };
+        for (const JointTracks& jointTracks : m_jointTracks)
+        {
+            if (!isValidTrackIndex(jointTracks.m_position) || !isValidTrackIndex(jointTracks.m_rotation) || !isValidTrackIndex(jointTracks.m_scale))
+            {
+                AZ_Error("EMotionFX", false, "Joint track index is out of range.");
+                return false;
+            }
+        }
+        if (!AZStd::all_of(m_morphTracks.begin(), m_morphTracks.end(), isValidTrackIndex) ||
+            !AZStd::all_of(m_floatTracks.begin(), m_floatTracks.end(), isValidTrackIndex))
+        {
+            AZ_Error("EMotionFX", false, "Morph or float track index is out of range.");
+            return false;
+        }
+
+        for (const Track& track : m_tracks)
+        {
+            if (track.m_numKeys == 0 ||
+                track.m_numComponents == 0 || track.m_numComponents > MaxNumComponents ||
+                static_cast<size_t>(track.m_firstKey) + track.m_numKeys > m_keyFrames.size() ||
+                static_cast<size_t>(track.m_firstValue) + track.m_numKeys * track.m_numComponents > m_keyValues.size())
+            {
+                AZ_Error("EMotionFX", false, "Track key range is out of bounds.");
+                return false;
+            }
+
+            const AZ::u16* frames = &m_keyFrames[track.m_firstKey];
+            for (size_t k = 1; k < track.m_numKeys; ++k)
+            {
+                if (frames[k] <= frames[k - 1])
+                {
+                    AZ_Error("EMotionFX", false, "Track key frames are not sorted.");
+                    return false;
+                }
+            }
+            if (frames[track.m_numKeys - 1] >= m_numSamples)
+            {
+                AZ_Error("EMotionFX", false, "Track key frame is out of range (frame=%d, numSamples=%zu).", frames[track.m_numKeys - 1], m_numSamples);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        struct File_QuantizedMotionData_Info
+        {
+            AZ::u32 m_numJoints = 0;
+            AZ::u32 m_numMorphs = 0;
+            AZ::u32 m_numFloats = 0;
+            AZ::u32 m_numSamples = 0;
+            AZ::u32 m_numTracks = 0;
+            AZ::u32 m_numKeys = 0;
+            AZ::u32 m_numValues = 0;
+            float m_sampleRate = 30.0f;
+
+            // Followed by:
+            // File_QuantizedMotionData_Joint[m_numJoints]
+            // File_QuantizedMotionData_Float[m_numMorphs]
+            // File_QuantizedMotionData_Float[m_numFloats]
+            // File_QuantizedMotionData_Track[m_numTracks]
+            // AZ::u16[m_numKeys]   : The key frames of all tracks.
+            // AZ::u16[m_numValues] : The quantized key values of all tracks.
+        };
+
+        struct File_QuantizedMotionData_Joint
+        {
+            FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+            FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+            FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+            FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+            FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+            FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+            AZ::u32                         m_positionTrack = InvalidIndex32;        // The track index, or InvalidIndex32 when not animated.
+            AZ::u32                         m_rotationTrack = InvalidIndex32;        // The track index, or InvalidIndex32 when not animated.
+            AZ::u32                         m_scaleTrack = InvalidIndex32;           // The track index, or InvalidIndex32 when not animated.
+
+            // Followed by:
+            // string : The name of the joint.
+        };
+
+        struct File_QuantizedMotionData_Float
+        {
+            float m_staticValue = 0.0f;         // The static (first frame) value.
+            AZ::u32 m_track = InvalidIndex32;   // The track index, or InvalidIndex32 when not animated.
+
+            // Followed by:
+            // String: The name of the channel.
+        };
+
+        struct File_QuantizedMotionData_Track
+        {
+            float m_rangeMin[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float m_rangeScale[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            AZ::u32 m_firstKey = 0;
+            AZ::u32 m_firstValue = 0;
+            AZ::u32 m_numKeys = 0;
+            AZ::u32 m_numComponents = 0;
+        };
+
+        bool SaveQuantizedFloat(MCore::Stream* stream, const AZStd::string& channelName, float staticValue, AZ::u32 trackIndex, const MotionData::SaveSettings& saveSettings)
+        {
+            if (channelName.empty())
+            {
+                MCore::LogError("Cannot save morph or float channel with empty name.");
+                return false;
+            }
+
+            File_QuantizedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = staticValue;
+            floatChunk.m_track = trackIndex;
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("    - Channel: '%s'", channelName.c_str());
+                MCore::LogDetailedInfo("       + Static Weight = %f", floatChunk.m_staticValue);
+                MCore::LogDetailedInfo("       + IsAnimated    = %s", (trackIndex != InvalidIndex32) ? "Yes" : "No");
+            }
+
+            const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&floatChunk.m_track, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_QuantizedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(channelName, stream, targetEndianType);
+            return true;
+        }
+
+        bool SaveQuantizedKeys(MCore::Stream* stream, const AZStd::vector<AZ::u16>& values, const MotionData::SaveSettings& saveSettings)
+        {
+            if (values.empty())
+            {
+                return true;
+            }
+
+            AZStd::vector<AZ::u16> converted = values;
+            for (AZ::u16& value : converted)
+            {
+                ExporterLib::ConvertUnsignedShort(&value, saveSettings.m_targetEndianType);
+            }
+            return stream->Write(converted.data(), converted.size() * sizeof(AZ::u16)) != 0;
+        }
+    } // namespace
+
+    size_t QuantizedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_QuantizedMotionData_Info);
+
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            numBytes += sizeof(File_QuantizedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            numBytes += sizeof(File_QuantizedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+        }
+
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            numBytes += sizeof(File_QuantizedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+        }
+
+        numBytes += m_tracks.size() * sizeof(File_QuantizedMotionData_Track);
+        numBytes += m_keyFrames.size() * sizeof(AZ::u16);
+        numBytes += m_keyValues.size() * sizeof(AZ::u16);
+        return numBytes;
+    }
+
+    AZ::u32 QuantizedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool QuantizedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+
+        // Write the info chunk.
+        File_QuantizedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_numTracks = static_cast<AZ::u32>(m_tracks.size());
+        info.m_numKeys = static_cast<AZ::u32>(m_keyFrames.size());
+        info.m_numValues = static_cast<AZ::u32>(m_keyValues.size());
+        info.m_sampleRate = GetSampleRate();
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numTracks, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numKeys, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numValues, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_QuantizedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            const StaticJointData& staticJointData = m_staticJointData[i];
+            File_QuantizedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(staticJointData.m_staticTransform.m_position));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, MCore::Compressed16BitQuaternion(staticJointData.m_staticTransform.m_rotation));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(staticJointData.m_bindTransform.m_position));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, MCore::Compressed16BitQuaternion(staticJointData.m_bindTransform.m_rotation));
+#ifndef EMFX_SCALE_DISABLED
+            ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(staticJointData.m_staticTransform.m_scale));
+            ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(staticJointData.m_bindTransform.m_scale));
+#endif
+            jointChunk.m_positionTrack = m_jointTracks[i].m_position;
+            jointChunk.m_rotationTrack = m_jointTracks[i].m_rotation;
+            jointChunk.m_scaleTrack = m_jointTracks[i].m_scale;
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(i).c_str());
+                MCore::LogDetailedInfo("   + Position Keys:     %zu", GetNumJointPositionKeys(i));
+                MCore::LogDetailedInfo("   + Rotation Keys:     %zu", GetNumJointRotationKeys(i));
+            }
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_positionTrack, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_rotationTrack, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_scaleTrack, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_QuantizedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+        }
+
+        // Write the morph and float channels.
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!SaveQuantizedFloat(stream, GetMorphName(i), GetMorphStaticValue(i), m_morphTracks[i], saveSettings))
+            {
+                return false;
+            }
+        }
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!SaveQuantizedFloat(stream, GetFloatName(i), GetFloatStaticValue(i), m_floatTracks[i], saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the track table, followed by the key buffers of all tracks.
+        for (const Track& track : m_tracks)
+        {
+            File_QuantizedMotionData_Track trackChunk;
+            for (size_t c = 0; c < MaxNumComponents; ++c)
+            {
+                trackChunk.m_rangeMin[c] = track.m_rangeMin[c];
+                trackChunk.m_rangeScale[c] = track.m_rangeScale[c];
+                ExporterLib::ConvertFloat(&trackChunk.m_rangeMin[c], targetEndianType);
+                ExporterLib::ConvertFloat(&trackChunk.m_rangeScale[c], targetEndianType);
+            }
+            trackChunk.m_firstKey = track.m_firstKey;
+            trackChunk.m_firstValue = track.m_firstValue;
+            trackChunk.m_numKeys = track.m_numKeys;
+            trackChunk.m_numComponents = track.m_numComponents;
+            ExporterLib::ConvertUnsignedInt(&trackChunk.m_firstKey, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&trackChunk.m_firstValue, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&trackChunk.m_numKeys, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&trackChunk.m_numComponents, targetEndianType);
+            if (stream->Write(&trackChunk, sizeof(File_QuantizedMotionData_Track)) == 0)
+            {
+                return false;
+            }
+        }
+
+        return SaveQuantizedKeys(stream, m_keyFrames, saveSettings) && SaveQuantizedKeys(stream, m_keyValues, saveSettings);
+    }
+
+    bool QuantizedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        if (readSettings.m_version != 1)
+        {
+            AZ_Error("EMotionFX", false, "Unsupported QuantizedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            return false;
+        }
+
+        // Read the info header.
+        File_QuantizedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_QuantizedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numTracks, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numKeys, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numValues, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- QuantizedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumTracks  = %d", info.m_numTracks);
+            MCore::LogDetailedInfo("  + NumKeys    = %d", info.m_numKeys);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        SetSampleRate(info.m_sampleRate);
+        m_numSamples = info.m_numSamples;
+        UpdateDuration();
+
+        // Read all joints.
+        AZStd::string name;
+        for (size_t i = 0; i < info.m_numJoints; ++i)
+        {
+            File_QuantizedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_QuantizedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_positionTrack, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_rotationTrack, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_scaleTrack, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            m_jointTracks[i].m_position = jointInfo.m_positionTrack;
+            m_jointTracks[i].m_rotation = jointInfo.m_rotationTrack;
+            m_jointTracks[i].m_scale = jointInfo.m_scaleTrack;
+
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - IsAnimated      = %s", IsJointAnimated(i) ? "Yes" : "No");
+            }
+        }
+
+        // Read the morph and float channels.
+        auto readFloat = [stream, sourceEndianType, &name](float& outStaticValue, AZ::u32& outTrack)
+        {
+            File_QuantizedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_QuantizedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&floatInfo.m_track, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            outStaticValue = floatInfo.m_staticValue;
+            outTrack = floatInfo.m_track;
+            return true;
+        };
+
+        for (size_t i = 0; i < info.m_numMorphs; ++i)
+        {
+            float staticValue;
+            if (!readFloat(staticValue, m_morphTracks[i]))
+            {
+                return false;
+            }
+            SetMorphName(i, name);
+            SetMorphStaticValue(i, staticValue);
+        }
+
+        for (size_t i = 0; i < info.m_numFloats; ++i)
+        {
+            float staticValue;
+            if (!readFloat(staticValue, m_floatTracks[i]))
+            {
+                return false;
+            }
+            SetFloatName(i, name);
+            SetFloatStaticValue(i, staticValue);
+        }
+
+        // Read the track table and the key buffers.
+        m_tracks.resize(info.m_numTracks);
+        m_sourceSamples.resize(info.m_numTracks);
+        for (Track& track : m_tracks)
+        {
+            File_QuantizedMotionData_Track trackInfo;
+            if (stream->Read(&trackInfo, sizeof(File_QuantizedMotionData_Track)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(trackInfo.m_rangeMin, sourceEndianType, MaxNumComponents);
+            MCore::Endian::ConvertFloat(trackInfo.m_rangeScale, sourceEndianType, MaxNumComponents);
+            MCore::Endian::ConvertUnsignedInt32(&trackInfo.m_firstKey, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&trackInfo.m_firstValue, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&trackInfo.m_numKeys, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&trackInfo.m_numComponents, sourceEndianType);
+
+            for (size_t c = 0; c < MaxNumComponents; ++c)
+            {
+                track.m_rangeMin[c] = trackInfo.m_rangeMin[c];
+                track.m_rangeScale[c] = trackInfo.m_rangeScale[c];
+            }
+            track.m_firstKey = trackInfo.m_firstKey;
+            track.m_firstValue = trackInfo.m_firstValue;
+            track.m_numKeys = trackInfo.m_numKeys;
+            track.m_numComponents = trackInfo.m_numComponents;
+        }
+
+        m_keyFrames.resize(info.m_numKeys);
+        m_keyValues.resize(info.m_numValues);
+        if ((!m_keyFrames.empty() && stream->Read(m_keyFrames.data(), m_keyFrames.size() * sizeof(AZ::u16)) == 0) ||
+            (!m_keyValues.empty() && stream->Read(m_keyValues.data(), m_keyValues.size() * sizeof(AZ::u16)) == 0))
+        {
+            return false;
+        }
+        MCore::Endian::ConvertUnsignedInt16(m_keyFrames.data(), sourceEndianType, static_cast<AZ::u32>(m_keyFrames.size()));
+        MCore::Endian::ConvertUnsignedInt16(m_keyValues.data(), sourceEndianType, static_cast<AZ::u32>(m_keyValues.size()));
+
+        return VerifyIntegrity();
+    }
+} // namespace EMotionFX
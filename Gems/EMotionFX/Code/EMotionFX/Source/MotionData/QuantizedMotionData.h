@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    // Motion data that stores its keyframes quantized to 16 bits per component, relative to the value range of each track.
+    // The keys of each track are curve fitted on a uniform sample grid, so only the keys needed to stay within the optimize
+    // error tolerances are stored, each as a 16 bit frame index followed by its quantized components.
+    // All tracks live in a few contiguous buffers, so sampling a pose calculates the sample frame once and then decodes the
+    // joints in a single pass over the track table, without any per key allocations or pointer chasing.
+    class EMFX_API QuantizedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(QuantizedMotionData, MotionAllocator, 0)
+        AZ_RTTI(QuantizedMotionData, "{22199B59-447B-4CD9-94AE-BDBA5EDFE199}", MotionData)
+
+        static constexpr size_t MaxNumSamples = 65536; // Frame indices are stored as 16 bit values.
+
+        QuantizedMotionData() = default;
+        ~QuantizedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+        bool VerifyIntegrity() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const SampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const SampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        size_t GetNumTracks() const;
+        size_t GetNumKeys() const;
+        size_t GetNumJointPositionKeys(size_t jointDataIndex) const;
+        size_t GetNumJointRotationKeys(size_t jointDataIndex) const;
+
+        // The number of bytes used by the tracks, keys and source samples, excluding the static data shared by all motion data types.
+        size_t CalcSampleDataSizeInBytes() const;
+
+        // Free the source samples once the data won't be optimized again. Optimizing afterwards fits the tracks from their decoded keys.
+        void ReleaseSourceSamples();
+
+        void UpdateDuration() override;
+
+    private:
+        static constexpr AZ::u32 InvalidTrack = InvalidIndex32;
+        static constexpr size_t MaxNumComponents = 4;
+
+        struct EMFX_API Track
+        {
+            float m_rangeMin[MaxNumComponents] = { 0.0f, 0.0f, 0.0f, 0.0f };    // The minimum value of each component.
+            float m_rangeScale[MaxNumComponents] = { 0.0f, 0.0f, 0.0f, 0.0f };  // The range of each component divided by the largest quantized value.
+            AZ::u32 m_firstKey = 0;        // The index of the first key in m_keyFrames.
+            AZ::u32 m_firstValue = 0;      // The index of the first quantized component in m_keyValues.
+            AZ::u32 m_numKeys = 0;
+            AZ::u32 m_numComponents = 0;
+        };
+
+        struct EMFX_API JointTracks
+        {
+            AZ::u32 m_position = InvalidTrack;
+            AZ::u32 m_rotation = InvalidTrack;
+            AZ::u32 m_scale = InvalidTrack;
+        };
+
+        // Float values of a track on every frame of the uniform sample grid, used while building the keys.
+        using TrackSamples = AZStd::vector<float>;
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        // Interpolate between the two keys surrounding the sample frame and dequantize the result.
+        static void InterpolateKeys(const Track& track, const AZ::u16* keyFrames, const AZ::u16* keyValues, float sampleFrame, float* outValues);
+        static void DecodeTrack(const Track& track, const AZ::u16* keyFrames, const AZ::u16* keyValues, size_t numSamples, TrackSamples& outSamples);
+
+        float CalcSampleFrame(float sampleTime) const;
+        void SampleTrack(AZ::u32 trackIndex, float sampleFrame, float* outValues) const;
+        AZ::Vector3 SampleVector3Track(AZ::u32 trackIndex, float sampleFrame, const AZ::Vector3& staticValue) const;
+        AZ::Quaternion SampleQuaternionTrack(AZ::u32 trackIndex, float sampleFrame, const AZ::Quaternion& staticValue) const;
+        float SampleFloatTrack(AZ::u32 trackIndex, float sampleFrame, float staticValue) const;
+        Transform SampleJointData(size_t jointDataIndex, float sampleFrame) const;
+
+        // Curve fit and quantize the samples, and append them as a new track, keeping the samples as its source samples.
+        // The error tolerance of each component is at least half a quantization step, which is the error of the quantized keys themselves.
+        // Returns InvalidTrack when all samples are within maxError of the static value, so the track isn't needed.
+        AZ::u32 AddTrack(TrackSamples samples, size_t numComponents, const float* staticValue, float maxError);
+
+        // Rebuild the track buffers so they only contain referenced tracks, in joint, morph and float order.
+        // When optimize settings are passed, the tracks are curve fitted again from their source samples using the error tolerances.
+        void RebuildTracks(const OptimizeSettings* optimizeSettings);
+
+        AZStd::vector<JointTracks> m_jointTracks;
+        AZStd::vector<AZ::u32> m_morphTracks;
+        AZStd::vector<AZ::u32> m_floatTracks;
+        AZStd::vector<Track> m_tracks;
+        AZStd::vector<AZ::u16> m_keyFrames;
+        AZStd::vector<AZ::u16> m_keyValues;
+        // The unquantized samples each track was fitted from, so optimizing again doesn't add to the error of earlier fits.
+        // Tracks that were read from a stream, or whose samples were released, have none until they're decoded for the next optimize.
+        AZStd::vector<TrackSamples> m_sourceSamples;
+        size_t m_numSamples = 0;
+    };
+} // namespace EMotionFX
@@ -471,6 +471,28 @@ namespace EMotionFX
         return m_numSamples;
     }
 
+    size_t UniformMotionData::CalcSampleDataSizeInBytes() const
+    {
+        size_t numBytes = m_jointData.size() * sizeof(JointData) + (m_morphData.size() + m_floatData.size()) * sizeof(FloatData);
+        for (const JointData& jointData : m_jointData)
+        {
+            numBytes += jointData.m_positions.size() * sizeof(AZ::Vector3);
+            numBytes += jointData.m_rotations.size() * sizeof(MCore::Compressed16BitQuaternion);
+#ifndef EMFX_SCALE_DISABLED
+            numBytes += jointData.m_scales.size() * sizeof(AZ::Vector3);
+#endif
+        }
+        for (const FloatData& morphData : m_morphData)
+        {
+            numBytes += morphData.m_values.size() * sizeof(float);
+        }
+        for (const FloatData& floatData : m_floatData)
+        {
+            numBytes += floatData.m_values.size() * sizeof(float);
+        }
+        return numBytes;
+    }
+
     float UniformMotionData::GetSampleSpacing() const
     {
         return m_sampleSpacing;
@@ -108,6 +108,9 @@ namespace EMotionFX
 
         size_t GetNumSamples() const;
         float GetSampleSpacing() const;
+
+        // The number of bytes used by the samples, excluding the static data shared by all motion data types.
+        size_t CalcSampleDataSizeInBytes() const;
         void SetSampleRate(float sampleRate) override;
         void UpdateDuration() override;
 
@@ -11,6 +11,7 @@
 #include "ActorManager.h"
 #include "ActorInstance.h"
 #include "AnimGraphInstance.h"
+#include "AnimGraphPoseSharing.h"
 #include "Attachment.h"
 #include "EMotionFXManager.h"
 #include <EMotionFX/Source/Allocators.h>
@@ -163,75 +164,133 @@ namespace EMotionFX
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
+        m_numSharedPoses.SetValue(0);
 
-        for (const ScheduleStep& currentStep : m_steps)
+        // decide which actor instances get a full update this frame, and with how much time
+        m_updateRateLod.Evaluate(actorManager, timePassedInSeconds);
+        m_numSkipped.SetValue(m_updateRateLod.GetNumSkippedActorInstances());
+
+        AnimGraphPoseSharing& poseSharing = GetActorManager().GetPoseSharing();
+
+        auto startUpdateJob = [this, fixedTimeStep](ActorInstance* actorInstance, AZ::JobCompletion& jobCompletion)
         {
-            if (currentStep.m_actorInstances.empty())
-            {
-                continue;
-            }
+            const bool updateThisFrame = actorInstance->GetUpdateRateLodState().GetUpdateThisFrame();
 
-            // process the actor instances in the current step in parallel
-            AZ::JobCompletion jobCompletion;
-            for (ActorInstance* actorInstance : currentStep.m_actorInstances)
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, actorInstance, fixedTimeStep, updateThisFrame]()
             {
-                if (actorInstance->GetIsEnabled() == false)
-                {
-                    continue;
-                }
+                AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
+
+                const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+                actorInstance->SetThreadIndex(threadIndex);
 
-                AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance, fixedTimeStep]()
+                const bool isVisible = actorInstance->GetIsVisible();
+                if (isVisible)
                 {
-                    AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
+                    m_numVisible.Increment();
+                }
 
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
+                UpdateRateLodState& lodState = actorInstance->GetUpdateRateLodState();
+                const bool interpolate = isVisible && actorInstance->GetUpdateRateLodSettings().m_interpolateSkippedFrames;
 
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
+                // skipped by the update rate LOD, only follow the entity and optionally interpolate the pose
+                if (!updateThisFrame)
+                {
+                    actorInstance->UpdateWorldTransform();
+                    if (!interpolate || !lodState.ApplyInterpolatedPose(actorInstance))
                     {
-                        m_numVisible.Increment();
+                        actorInstance->UpdateAttachments();
                     }
+                    return;
+                }
 
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
+                // the time passed since the last update, which spans multiple frames for actor instances running at a reduced update rate
+                const float timePassedInSeconds = lodState.GetUpdateTimeDelta();
 
-                        if (isVisible)
-                        {
-                            m_numSampled.Increment();
-                        }
-                    }
+                // check if we want to sample motions
+                bool sampleMotions = false;
+                actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+                if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+                {
+                    sampleMotions = true;
+                    actorInstance->SetMotionSamplingTimer(0.0f);
 
-                    // update the actor instance
-                    if (fixedTimeStep > 0.f)
+                    if (isVisible)
                     {
-                        float remaining = timePassedInSeconds;
-                        while (remaining > fixedTimeStep)
-                        {
-                            actorInstance->UpdateTransformations(fixedTimeStep, isVisible, sampleMotions);
-                            remaining -= fixedTimeStep;
-                        }
-                        actorInstance->UpdateTransformations(remaining, isVisible, sampleMotions);
+                        m_numSampled.Increment();
                     }
-                    else
+                }
+
+                // update the actor instance
+                if (fixedTimeStep > 0.f)
+                {
+                    float remaining = timePassedInSeconds;
+                    while (remaining > fixedTimeStep)
                     {
-                        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                        actorInstance->UpdateTransformations(fixedTimeStep, isVisible, sampleMotions);
+                        remaining -= fixedTimeStep;
                     }
-                }, true, jobContext);
+                    actorInstance->UpdateTransformations(remaining, isVisible, sampleMotions);
+                }
+                else
+                {
+                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                }
+
+                // the pose source is only valid for the duration of this update
+                actorInstance->SetPoseSharingSource(nullptr);
 
-                job->SetDependent(&jobCompletion);               
-                job->Start();
+                lodState.StoreUpdatedPose(actorInstance, interpolate);
+            }, true, jobContext);
 
+            job->SetDependent(&jobCompletion);
+            job->Start();
+
+            if (updateThisFrame)
+            {
                 m_numUpdated.Increment();
             }
+        };
+
+        for (const ScheduleStep& currentStep : m_steps)
+        {
+            if (currentStep.m_actorInstances.empty())
+            {
+                continue;
+            }
+
+            // group the actor instances that are in the same anim graph state, so only one of each group calculates its output pose
+            const size_t numSharedPoses = poseSharing.AssignPoseSources(currentStep.m_actorInstances);
+            m_numSharedPoses.SetValue(m_numSharedPoses.GetValue() + numSharedPoses);
+
+            // process the actor instances in the current step in parallel
+            // when poses are shared, the pose sources are processed first, and the actor instances copying their pose afterwards
+            AZ::JobCompletion jobCompletion;
+            for (ActorInstance* actorInstance : currentStep.m_actorInstances)
+            {
+                if (actorInstance->GetIsEnabled() == false || actorInstance->GetPoseSharingSource())
+                {
+                    continue;
+                }
+
+                startUpdateJob(actorInstance, jobCompletion);
+            }
 
             jobCompletion.StartAndWaitForCompletion();
+
+            if (numSharedPoses > 0)
+            {
+                AZ::JobCompletion sharedPoseJobCompletion;
+                for (ActorInstance* actorInstance : currentStep.m_actorInstances)
+                {
+                    if (actorInstance->GetPoseSharingSource())
+                    {
+                        startUpdateJob(actorInstance, sharedPoseJobCompletion);
+                    }
+                }
+
+                sharedPoseJobCompletion.StartAndWaitForCompletion();
+            }
         } // for all steps
     }
 
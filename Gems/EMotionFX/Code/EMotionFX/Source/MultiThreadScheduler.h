@@ -11,6 +11,7 @@
 // include the required headers
 #include "EMotionFXConfig.h"
 #include "ActorUpdateScheduler.h"
+#include "ActorUpdateRateLod.h"
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
 
@@ -122,8 +123,17 @@ namespace EMotionFX
         const ScheduleStep& GetScheduleStep(size_t index) const { return m_steps[index]; }
         size_t GetNumScheduleSteps() const { return m_steps.size(); }
 
+        /**
+         * Get the update rate LOD policy, which decides each frame which actor instances get updated.
+         * Use this to feed in the viewer and to set the global update budget.
+         * @result The update rate LOD policy.
+         */
+        ActorUpdateRateLod& GetUpdateRateLod() { return m_updateRateLod; }
+        const ActorUpdateRateLod& GetUpdateRateLod() const { return m_updateRateLod; }
+
     protected:
         AZStd::vector< ScheduleStep >    m_steps;         /**< An array of update steps, that together form the schedule. */
+        ActorUpdateRateLod              m_updateRateLod; /**< Decides which actor instances are updated this frame, based on their update rate LOD settings. */
         float                           m_cleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
         MCore::MutexRecursive           m_mutex;
 
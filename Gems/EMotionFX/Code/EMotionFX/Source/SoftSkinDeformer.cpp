@@ -18,6 +18,9 @@
 #include "ActorInstance.h"
 #include <EMotionFX/Source/Allocators.h>
 #include <MCore/Source/AzCoreConversions.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/SimdMath.h>
 
 
 namespace EMotionFX
@@ -36,6 +39,8 @@ namespace EMotionFX
     {
         m_nodeNumbers.clear();
         m_boneMatrices.clear();
+        m_influenceBones.clear();
+        m_influenceWeights.clear();
     }
 
 
@@ -69,6 +74,9 @@ namespace EMotionFX
         // copy the bone info (for precalc/optimization reasons)
         result->m_nodeNumbers    = m_nodeNumbers;
         result->m_boneMatrices   = m_boneMatrices;
+        result->m_influenceBones = m_influenceBones;
+        result->m_influenceWeights = m_influenceWeights;
+        result->m_numInfluenceSlots = m_numInfluenceSlots;
 
         // return the result
         return result;
@@ -103,7 +111,166 @@ namespace EMotionFX
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
         AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+        SkinVertices(positions, normals, tangents, bitangents, orgVerts, layer);
+    }
+
+
+    void SoftSkinDeformer::SkinVertices(AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
+    {
+        const uint32 numVertices = m_mesh->GetNumVertices();
+
+        // meshes with more influences per vertex than the batched kernel supports are skinned one vertex at a time
+        if (m_numInfluenceSlots == 0 || m_influenceWeights.size() != numVertices * m_numInfluenceSlots)
+        {
+            SkinVertexRange(0, numVertices, positions, normals, tangents, bitangents, orgVerts, layer);
+            return;
+        }
+
+        if (numVertices < MinVerticesPerJob * 2)
+        {
+            SkinVertexRangeBatched(0, numVertices, positions, normals, tangents, bitangents);
+            return;
+        }
+
+        // Split up large meshes into ranges and skin them simultaneously. The ranges are a multiple of the batch size,
+        // so only the last range has a partial batch.
+        static_assert(MinVerticesPerJob % BatchSize == 0, "The vertices per job have to be a multiple of the batch size.");
+        AZ::JobCompletion jobCompletion;
+        for (uint32 startVertex = 0; startVertex < numVertices; startVertex += MinVerticesPerJob)
+        {
+            const uint32 endVertex = AZStd::min(startVertex + MinVerticesPerJob, numVertices);
+
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex, positions, normals, tangents, bitangents]()
+                {
+                    SkinVertexRangeBatched(startVertex, endVertex, positions, normals, tangents, bitangents);
+                }, /*isAutoDelete=*/true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
+    void SoftSkinDeformer::SkinVertexRangeBatched(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        const size_t numSlots = m_numInfluenceSlots;
+        const AZ::Matrix3x4* boneMatrices = m_boneMatrices.data();
+
+        Vec4::FloatType blendedRows[3][BatchSize];  // [matrix row][lane]
+        Vec4::FloatType matrix[3][4];               // [matrix row][matrix column], every lane holding another vertex
+        Vec4::FloatType input[4];
+        Vec4::FloatType soa[4];
+        Vec4::FloatType output[4];
+
+        // transpose the attribute of all lanes into x, y, z and w vectors
+        auto loadSoa = [&input, &soa](const auto* data, const uint32* lanes, auto toVec4)
+        {
+            for (uint32 lane = 0; lane < BatchSize; ++lane)
+            {
+                input[lane] = toVec4(data[lanes[lane]]);
+            }
+            Vec4::Mat4x4Transpose(input, soa);
+        };
+
+        // transform the direction, or point when a translation is passed, by the blended matrices of all lanes
+        auto transform = [&matrix, &soa, &output](const Vec4::FloatType* translation)
+        {
+            for (size_t row = 0; row < 3; ++row)
+            {
+                Vec4::FloatType result = translation ? translation[row] : Vec4::ZeroFloat();
+                result = Vec4::Madd(matrix[row][0], soa[0], result);
+                result = Vec4::Madd(matrix[row][1], soa[1], result);
+                output[row] = Vec4::Madd(matrix[row][2], soa[2], result);
+            }
+            output[3] = soa[3];
+        };
+
+        auto toVec4FromVec3 = [](const AZ::Vector3& value) { return Vec4::FromVec3(value.GetSimdValue()); };
+        auto toVec4 = [](const AZ::Vector4& value) { return value.GetSimdValue(); };
+
+        for (uint32 batchStart = startVertex; batchStart < endVertex; batchStart += BatchSize)
+        {
+            // the lanes past the end of the range repeat the last vertex, and are not written back
+            const uint32 numLanes = AZStd::min(BatchSize, endVertex - batchStart);
+            uint32 lanes[BatchSize];
+            for (uint32 lane = 0; lane < BatchSize; ++lane)
+            {
+                lanes[lane] = batchStart + AZStd::min(lane, numLanes - 1);
+            }
+
+            // blend the bone matrices of each vertex into a single matrix
+            for (uint32 lane = 0; lane < BatchSize; ++lane)
+            {
+                const size_t slotOffset = lanes[lane] * numSlots;
+                const uint16* bones = &m_influenceBones[slotOffset];
+                const float* weights = &m_influenceWeights[slotOffset];
+
+                blendedRows[0][lane] = Vec4::ZeroFloat();
+                blendedRows[1][lane] = Vec4::ZeroFloat();
+                blendedRows[2][lane] = Vec4::ZeroFloat();
+                for (size_t slot = 0; slot < numSlots; ++slot)
+                {
+                    const Vec4::FloatType weight = Vec4::Splat(weights[slot]);
+                    const Vec4::FloatType* boneRows = boneMatrices[bones[slot]].GetSimdValues();
+                    blendedRows[0][lane] = Vec4::Madd(boneRows[0], weight, blendedRows[0][lane]);
+                    blendedRows[1][lane] = Vec4::Madd(boneRows[1], weight, blendedRows[1][lane]);
+                    blendedRows[2][lane] = Vec4::Madd(boneRows[2], weight, blendedRows[2][lane]);
+                }
+            }
+
+            Vec4::Mat4x4Transpose(blendedRows[0], matrix[0]);
+            Vec4::Mat4x4Transpose(blendedRows[1], matrix[1]);
+            Vec4::Mat4x4Transpose(blendedRows[2], matrix[2]);
+
+            // positions, including the translation column of the blended matrices
+            loadSoa(positions, lanes, toVec4FromVec3);
+            {
+                const Vec4::FloatType translation[3] = { matrix[0][3], matrix[1][3], matrix[2][3] };
+                transform(translation);
+            }
+            Vec4::Mat4x4Transpose(output, input);
+            for (uint32 lane = 0; lane < numLanes; ++lane)
+            {
+                positions[batchStart + lane] = AZ::Vector3(Vec4::ToVec3(input[lane]));
+            }
+
+            loadSoa(normals, lanes, toVec4FromVec3);
+            transform(nullptr);
+            Vec4::Mat4x4Transpose(output, input);
+            for (uint32 lane = 0; lane < numLanes; ++lane)
+            {
+                normals[batchStart + lane] = AZ::Vector3(Vec4::ToVec3(input[lane]));
+            }
+
+            // tangents keep their w component, which holds the handedness
+            if (tangents)
+            {
+                loadSoa(tangents, lanes, toVec4);
+                transform(nullptr);
+                Vec4::Mat4x4Transpose(output, input);
+                for (uint32 lane = 0; lane < numLanes; ++lane)
+                {
+                    tangents[batchStart + lane] = AZ::Vector4(input[lane]);
+                }
+            }
+
+            // like the per vertex path, bitangents are only skinned together with tangents
+            if (tangents && bitangents)
+            {
+                loadSoa(bitangents, lanes, toVec4FromVec3);
+                transform(nullptr);
+                Vec4::Mat4x4Transpose(output, input);
+                for (uint32 lane = 0; lane < numLanes; ++lane)
+                {
+                    bitangents[batchStart + lane] = AZ::Vector3(Vec4::ToVec3(input[lane]));
+                }
+            }
+        }
     }
 
 
@@ -211,6 +378,9 @@ namespace EMotionFX
         // clear the bone information array
         m_boneMatrices.clear();
         m_nodeNumbers.clear();
+        m_influenceBones.clear();
+        m_influenceWeights.clear();
+        m_numInfluenceSlots = 0;
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -252,5 +422,53 @@ namespace EMotionFX
                 influence->SetBoneNr(static_cast<uint16>(boneIndex));
             }
         }
+
+        InitInfluenceSlots(skinningLayer);
+    }
+
+
+    void SoftSkinDeformer::InitInfluenceSlots(SkinningInfoVertexAttributeLayer* layer)
+    {
+        m_influenceBones.clear();
+        m_influenceWeights.clear();
+        m_numInfluenceSlots = 0;
+
+        const AZ::u32* orgVerts = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        if (!orgVerts || m_boneMatrices.empty())
+        {
+            return;
+        }
+
+        // the slot count is the maximum number of influences, so the kernel doesn't have to branch per vertex
+        size_t numSlots = 0;
+        const uint32 numOrgVerts = m_mesh->GetNumOrgVertices();
+        for (uint32 i = 0; i < numOrgVerts; ++i)
+        {
+            numSlots = AZStd::max(numSlots, layer->GetNumInfluences(i));
+        }
+
+        if (numSlots == 0 || numSlots > MaxBatchedInfluences)
+        {
+            return;
+        }
+
+        // store the influences per vertex rather than per original vertex, so the kernel reads them linearly
+        // unused slots point to the first bone with a zero weight
+        const uint32 numVertices = m_mesh->GetNumVertices();
+        m_influenceBones.resize(numVertices * numSlots, 0);
+        m_influenceWeights.resize(numVertices * numSlots, 0.0f);
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            const uint32 orgVertex = orgVerts[v];
+            const size_t numInfluences = layer->GetNumInfluences(orgVertex);
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
+                m_influenceBones[v * numSlots + i] = influence->GetBoneNr();
+                m_influenceWeights[v * numSlots + i] = influence->GetWeight();
+            }
+        }
+
+        m_numInfluenceSlots = numSlots;
     }
 } // namespace EMotionFX
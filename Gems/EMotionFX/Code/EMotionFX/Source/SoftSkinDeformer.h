@@ -117,9 +117,24 @@ namespace EMotionFX
         MCORE_INLINE void ReserveLocalBones(size_t numBones)                { m_nodeNumbers.reserve(numBones); m_boneMatrices.reserve(numBones); }
 
 
+        /**
+         * Get the number of influence slots per vertex used by the batched skinning kernel.
+         * This is the maximum number of influences of any vertex in the mesh, or zero when the mesh has more influences than
+         * MaxBatchedInfluences on some vertex, in which case the vertices are skinned one at a time.
+         * @result The number of influence slots per vertex.
+         */
+        MCORE_INLINE size_t GetNumInfluenceSlots() const                    { return m_numInfluenceSlots; }
+
+        static constexpr size_t MaxBatchedInfluences = 8;       /**< The maximum number of influences per vertex supported by the batched skinning kernel. */
+        static constexpr uint32 BatchSize = 4;                  /**< The number of vertices skinned together by the batched skinning kernel. */
+        static constexpr uint32 MinVerticesPerJob = 4096;       /**< Meshes with at least twice this number of vertices get skinned by multiple jobs. */
+
     protected:
         AZStd::vector<AZ::Matrix3x4>    m_boneMatrices;
         AZStd::vector<size_t>           m_nodeNumbers;
+        AZStd::vector<uint16>           m_influenceBones;       /**< The local bone index per vertex and influence slot, stored at [vertex * m_numInfluenceSlots + slot]. */
+        AZStd::vector<float>            m_influenceWeights;     /**< The weight per vertex and influence slot, unused slots have a zero weight. */
+        size_t                          m_numInfluenceSlots = 0;
 
         /**
          * Default constructor.
@@ -143,6 +158,26 @@ namespace EMotionFX
             return foundBoneIndex != end(m_nodeNumbers) ? AZStd::distance(begin(m_nodeNumbers), foundBoneIndex) : InvalidIndex;
         }
 
+        /**
+         * Build the fixed size influence slots per vertex used by the batched skinning kernel.
+         * Must be called after the influences have been remapped to local bone indices.
+         * @param layer The skinning layer of the mesh.
+         */
+        void InitInfluenceSlots(SkinningInfoVertexAttributeLayer* layer);
+
+        /**
+         * Skin all vertices of the mesh, picking the batched kernel when the influences fit in the influence slots,
+         * and splitting large meshes over multiple jobs.
+         */
+        void SkinVertices(AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+
         void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+
+        /**
+         * Skin a range of vertices, BatchSize vertices at a time, using the influence slots.
+         * The bone matrices of each vertex are blended into a single matrix first, after which the vertex attributes of the batch
+         * are transposed so that each SIMD lane transforms another vertex.
+         */
+        void SkinVertexRangeBatched(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents);
     };
 } // namespace EMotionFX
@@ -15,6 +15,8 @@ set(FILES
     Source/ActorInstanceBus.h
     Source/ActorManager.cpp
     Source/ActorManager.h
+    Source/ActorUpdateRateLod.cpp
+    Source/ActorUpdateRateLod.h
     Source/ActorUpdateScheduler.h
     Source/Algorithms.h
     Source/Allocators.cpp
@@ -190,6 +192,8 @@ set(FILES
     Source/AnimGraphPlaySpeedModifier.cpp
     Source/AnimGraphPose.cpp
     Source/AnimGraphPose.h
+    Source/AnimGraphPoseSharing.cpp
+    Source/AnimGraphPoseSharing.h
     Source/AnimGraphPosePool.cpp
     Source/AnimGraphPosePool.h
     Source/AnimGraphRefCountedData.h
@@ -358,6 +362,8 @@ set(FILES
     Source/MotionData/MotionDataFactory.h
     Source/MotionData/NonUniformMotionData.cpp
     Source/MotionData/NonUniformMotionData.h
+    Source/MotionData/QuantizedMotionData.cpp
+    Source/MotionData/QuantizedMotionData.h
     Source/MotionData/UniformMotionData.cpp
     Source/MotionData/UniformMotionData.h
     Source/MotionEvent.cpp
@@ -141,7 +141,7 @@ namespace EMotionFX
             if (serializeContext)
             {
                 serializeContext->Class<Configuration>()
-                    ->Version(4)
+                    ->Version(5)
                     ->Field("ActorAsset", &Configuration::m_actorAsset)
                     ->Field("MaterialPerLOD", &Configuration::m_materialPerLOD)
                     ->Field("RenderSkeleton", &Configuration::m_renderSkeleton)
@@ -153,6 +153,7 @@ namespace EMotionFX
                     ->Field("LODLevel", &Configuration::m_lodLevel)
                     ->Field("BoundingBoxConfig", &Configuration::m_bboxConfig)
                     ->Field("ForceJointsUpdateOOV", &Configuration::m_forceUpdateJointsOOV)
+                    ->Field("UpdateRateLod", &Configuration::m_updateRateLod)
                 ;
             }
         }
@@ -534,6 +535,7 @@ namespace EMotionFX
                 m_actorInstance.get());
 
             m_actorInstance->SetLODLevel(m_configuration.m_lodLevel);
+            m_actorInstance->SetUpdateRateLodSettings(m_configuration.m_updateRateLod);
 
             // Setup initial transform and listen for transform changes.
             AZ::Transform transform = AZ::Transform::CreateIdentity();
@@ -93,6 +93,7 @@ namespace EMotionFX
                 // actor are disabled when the actor is out of view. 
                 bool m_forceUpdateJointsOOV = false;
                 BoundingBoxConfiguration m_bboxConfig; ///< Configuration for bounding box type and updates
+                UpdateRateLodSettings m_updateRateLod; ///< Reduces the update rate of the actor when it is far away or small on screen.
 
                 static void Reflect(AZ::ReflectContext* context);
             };
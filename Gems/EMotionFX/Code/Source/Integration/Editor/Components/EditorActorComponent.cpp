@@ -43,7 +43,7 @@ namespace EMotionFX
             if (serializeContext)
             {
                 serializeContext->Class<EditorActorComponent, AzToolsFramework::Components::EditorComponentBase>()
-                    ->Version(4)
+                    ->Version(5)
                     ->Field("ActorAsset", &EditorActorComponent::m_actorAsset)
                     ->Field("MaterialPerLOD", &EditorActorComponent::m_materialPerLOD)
                     ->Field("MaterialPerActor", &EditorActorComponent::m_materialPerActor)
@@ -56,6 +56,7 @@ namespace EMotionFX
                     ->Field("UpdateJointTransformsWhenOutOfView", &EditorActorComponent::m_forceUpdateJointsOOV)
                     ->Field("LodLevel", &EditorActorComponent::m_lodLevel)
                     ->Field("BBoxConfig", &EditorActorComponent::m_bboxConfig)
+                    ->Field("UpdateRateLod", &EditorActorComponent::m_updateRateLod)
                     ;
 
                 AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -153,6 +154,8 @@ namespace EMotionFX
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                         ->DataElement(0, &EditorActorComponent::m_forceUpdateJointsOOV,
                             "Force update joints", "Force update the joint transforms of actor, even when the character is out of the camera view.")
+                        ->DataElement(0, &EditorActorComponent::m_updateRateLod,
+                            "Update rate LOD", "Update the actor less often when it is far away or small on screen. Only applies in game mode.")
 
                         ->DataElement(0, &EditorActorComponent::m_bboxConfig,
                                       "Bounding box configuration", "")
@@ -627,6 +630,7 @@ namespace EMotionFX
             cfg.m_skinningMethod = m_skinningMethod;
             cfg.m_bboxConfig = m_bboxConfig;
             cfg.m_forceUpdateJointsOOV = m_forceUpdateJointsOOV;
+            cfg.m_updateRateLod = m_updateRateLod;
 
             gameEntity->AddComponent(aznew ActorComponent(&cfg));
         }
@@ -15,5 +15,7 @@ namespace EMotionFX::Integration
     public:
         static inline int emfx_updateEnabled = 1;
         static inline int emfx_actorRenderEnabled = 1;
+        static inline int emfx_updateRateLodEnabled = 1;
+        static inline int emfx_updateRateLodMaxUpdatesPerFrame = 0;
     };
 };
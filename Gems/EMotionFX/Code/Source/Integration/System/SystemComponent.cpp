@@ -13,11 +13,13 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Utils/Utils.h>
 
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/CharacterBus.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/AnimGraphManager.h>
 #include <EMotionFX/Source/AnimGraphObjectFactory.h>
@@ -311,6 +313,7 @@ namespace EMotionFX
 
             EMotionFX::PoseData::Reflect(context);
             EMotionFX::PoseDataRagdoll::Reflect(context);
+            EMotionFX::UpdateRateLodSettings::Reflect(context);
 
             // Motion set
             EMotionFX::MotionSet::Reflect(context);
@@ -594,6 +597,8 @@ namespace EMotionFX
             REGISTER_CVAR2("emfx_updateEnabled", &CVars::emfx_updateEnabled, 1, VF_DEV_ONLY, "Enable main EMFX update");
             REGISTER_CVAR2("emfx_actorRenderEnabled", &CVars::emfx_actorRenderEnabled, 1, VF_DEV_ONLY, "Enable ActorRenderNode rendering");
             REGISTER_CVAR2("emfx_fixedTimeStep", &emfx_fixedTimeStep, 1, VF_DEV_ONLY, "If greater than zero, use this fixed timestep when updating");
+            REGISTER_CVAR2("emfx_updateRateLodEnabled", &CVars::emfx_updateRateLodEnabled, 1, VF_NULL, "Enable the update rate LOD for actor instances that have it enabled in their settings");
+            REGISTER_CVAR2("emfx_updateRateLodMaxUpdatesPerFrame", &CVars::emfx_updateRateLodMaxUpdatesPerFrame, 0, VF_NULL, "Maximum number of update rate LOD actor instances fully updated per frame, 0 means no limit");
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -601,12 +606,42 @@ namespace EMotionFX
         {
             gEnv->pConsole->UnregisterVariable("emfx_updateEnabled");
             gEnv->pConsole->UnregisterVariable("emfx_actorRenderEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateRateLodEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateRateLodMaxUpdatesPerFrame");
 
 #if !defined(AZ_MONOLITHIC_BUILD)
             gEnv = nullptr;
 #endif
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        void SystemComponent::UpdateActorUpdateRateLod()
+        {
+            ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+            if (!scheduler || scheduler->GetType() != MultiThreadScheduler::TYPE_ID)
+            {
+                return;
+            }
+
+            ActorUpdateRateLod& updateRateLod = static_cast<MultiThreadScheduler*>(scheduler)->GetUpdateRateLod();
+            updateRateLod.SetEnabled(CVars::emfx_updateRateLodEnabled != 0);
+            updateRateLod.SetMaxUpdatesPerFrame(static_cast<size_t>(AZStd::max(CVars::emfx_updateRateLodMaxUpdatesPerFrame, 0)));
+
+            // Screen size and distance are measured relative to the active camera, without one all visible actor instances run at full rate.
+            if (Camera::ActiveCameraRequestBus::HasHandlers())
+            {
+                AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+                Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+                Camera::Configuration cameraConfiguration;
+                Camera::ActiveCameraRequestBus::BroadcastResult(cameraConfiguration, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraConfiguration);
+                updateRateLod.SetViewer(cameraTransform.GetTranslation(), cameraConfiguration.m_fovRadians);
+            }
+            else
+            {
+                updateRateLod.ClearViewer();
+            }
+        }
+
         //////////////////////////////////////////////////////////////////////////
         void SystemComponent::OnTick(float delta, AZ::ScriptTimePoint timePoint)
         {
@@ -622,6 +657,8 @@ namespace EMotionFX
 
             if (CVars::emfx_updateEnabled)
             {
+                UpdateActorUpdateRateLod();
+
                 // Main EMotionFX runtime update.
                 GetEMotionFX().Update(delta);
             }
@@ -108,6 +108,7 @@ namespace EMotionFX
 
 
             void RegisterAssetTypesAndHandlers();
+            void UpdateActorUpdateRateLod();
             void SetMediaRoot(const char* alias);
 
 #if defined (EMOTIONFXANIMATION_EDITOR)
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateRateLod.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX
+{
+    /*
+     * Updates a crowd of 1000 actor instances spread out in front of the viewer, one frame per iteration,
+     * so the reported time is the animation update cost per frame.
+     */
+    class ActorUpdateRateLodBenchmarkFixture
+        : public UnitTest::TestFixtureBenchmarkFixture<SystemComponentFixture>
+    {
+    public:
+        static constexpr size_t CrowdSize = 1000;
+        static constexpr size_t CrowdColumns = 40;
+        static constexpr float CrowdSpacing = 2.0f;
+        static constexpr float FrameTime = 1.0f / 60.0f;
+
+        void SetUpBenchmark() override
+        {
+            m_scheduler = static_cast<MultiThreadScheduler*>(GetEMotionFX().GetActorManager()->GetScheduler());
+            m_scheduler->GetUpdateRateLod().SetViewer(AZ::Vector3::CreateZero(), AZ::DegToRad(60.0f));
+
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+            m_actorInstances.reserve(CrowdSize);
+            for (size_t i = 0; i < CrowdSize; ++i)
+            {
+                ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+                const float x = (static_cast<float>(i % CrowdColumns) - static_cast<float>(CrowdColumns) * 0.5f) * CrowdSpacing;
+                const float y = static_cast<float>(i / CrowdColumns + 1) * CrowdSpacing;
+                actorInstance->SetLocalSpacePosition(AZ::Vector3(x, y, 0.0f));
+                m_actorInstances.emplace_back(actorInstance);
+            }
+        }
+
+        void TearDownBenchmark() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances = {};
+            m_actor.reset();
+        }
+
+        void RunCrowdBenchmark(const UpdateRateLodSettings& settings, size_t maxUpdatesPerFrame, ::benchmark::State& state)
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->SetUpdateRateLodSettings(settings);
+            }
+            m_scheduler->GetUpdateRateLod().SetMaxUpdatesPerFrame(maxUpdatesPerFrame);
+
+            // Let the bounds settle, so the screen sizes used by the update rate LOD are representative.
+            m_scheduler->Execute(FrameTime);
+
+            size_t numUpdated = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                m_scheduler->Execute(FrameTime);
+                numUpdated += m_scheduler->GetNumUpdatedActorInstances();
+            }
+
+            state.SetItemsProcessed(state.iterations() * CrowdSize);
+            state.counters["UpdatedPerFrame"] = ::benchmark::Counter(static_cast<double>(numUpdated), ::benchmark::Counter::kAvgIterations);
+        }
+
+        UpdateRateLodSettings CreateCrowdSettings() const
+        {
+            UpdateRateLodSettings settings;
+            settings.m_enabled = true;
+            settings.m_metric = UpdateRateLodSettings::Metric::Distance;
+            settings.m_thresholds = { 10.0f, 20.0f, 30.0f, 40.0f };
+            settings.m_maxFrameInterval = 8;
+            return settings;
+        }
+
+        MultiThreadScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<JackNoMeshesActor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    BENCHMARK_F(ActorUpdateRateLodBenchmarkFixture, Crowd_FullRate)(benchmark::State& state)
+    {
+        RunCrowdBenchmark(UpdateRateLodSettings(), 0, state);
+    }
+
+    BENCHMARK_F(ActorUpdateRateLodBenchmarkFixture, Crowd_UpdateRateLod)(benchmark::State& state)
+    {
+        RunCrowdBenchmark(CreateCrowdSettings(), 0, state);
+    }
+
+    BENCHMARK_F(ActorUpdateRateLodBenchmarkFixture, Crowd_UpdateRateLodNoInterpolation)(benchmark::State& state)
+    {
+        UpdateRateLodSettings settings = CreateCrowdSettings();
+        settings.m_interpolateSkippedFrames = false;
+        RunCrowdBenchmark(settings, 0, state);
+    }
+
+    BENCHMARK_F(ActorUpdateRateLodBenchmarkFixture, Crowd_UpdateRateLodBudget)(benchmark::State& state)
+    {
+        RunCrowdBenchmark(CreateCrowdSettings(), 100, state);
+    }
+} // namespace EMotionFX
+#endif
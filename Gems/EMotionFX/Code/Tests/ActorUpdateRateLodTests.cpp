@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateRateLod.h>
+#include <EMotionFX/Source/AttachmentNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    TEST(UpdateRateLodSettingsTests, ScreenSizeFrameInterval)
+    {
+        UpdateRateLodSettings settings;
+        settings.m_metric = UpdateRateLodSettings::Metric::ScreenSize;
+        settings.m_thresholds = { 0.5f, 0.25f, 0.1f };
+        settings.m_maxFrameInterval = 6;
+
+        EXPECT_EQ(settings.CalcFrameInterval(1.0f), 1);
+        EXPECT_EQ(settings.CalcFrameInterval(0.5f), 1);
+        EXPECT_EQ(settings.CalcFrameInterval(0.3f), 2);
+        EXPECT_EQ(settings.CalcFrameInterval(0.1f), 3);
+        EXPECT_EQ(settings.CalcFrameInterval(0.01f), 6);
+    }
+
+    TEST(UpdateRateLodSettingsTests, DistanceFrameInterval)
+    {
+        UpdateRateLodSettings settings;
+        settings.m_metric = UpdateRateLodSettings::Metric::Distance;
+        settings.m_thresholds = { 10.0f, 20.0f, 40.0f };
+        settings.m_maxFrameInterval = 2;
+
+        EXPECT_EQ(settings.CalcFrameInterval(5.0f), 1);
+        EXPECT_EQ(settings.CalcFrameInterval(15.0f), 2);
+        EXPECT_EQ(settings.CalcFrameInterval(30.0f), 2) << "Frame intervals are clamped to the max frame interval.";
+        EXPECT_EQ(settings.CalcFrameInterval(100.0f), 2);
+    }
+
+    class ActorUpdateRateLodFixture
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+            ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+            m_scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+            m_scheduler->GetUpdateRateLod() = ActorUpdateRateLod();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        ActorInstance* CreateActorInstance(const UpdateRateLodSettings& settings)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            actorInstance->SetUpdateRateLodSettings(settings);
+            m_actorInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+    protected:
+        MultiThreadScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<JackNoMeshesActor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_F(ActorUpdateRateLodFixture, DisabledUpdatesEveryFrame)
+    {
+        ActorInstance* actorInstance = CreateActorInstance(UpdateRateLodSettings());
+        actorInstance->SetIsVisible(false);
+
+        for (int frame = 0; frame < 8; ++frame)
+        {
+            m_scheduler->Execute(0.1f);
+            EXPECT_TRUE(actorInstance->GetUpdateRateLodState().GetUpdateThisFrame());
+            EXPECT_FLOAT_EQ(actorInstance->GetUpdateRateLodState().GetUpdateTimeDelta(), 0.1f);
+            EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 1);
+            EXPECT_EQ(m_scheduler->GetNumSkippedActorInstances(), 0);
+        }
+    }
+
+    TEST_F(ActorUpdateRateLodFixture, InvisibleFrameInterval)
+    {
+        UpdateRateLodSettings settings;
+        settings.m_enabled = true;
+        settings.m_invisibleFrameInterval = 4;
+        ActorInstance* actorInstance = CreateActorInstance(settings);
+        actorInstance->SetIsVisible(false);
+
+        // The first frame after enabling updates, after which the actor instance is only updated every 4th frame with the accumulated time.
+        m_scheduler->Execute(0.1f);
+        EXPECT_TRUE(actorInstance->GetUpdateRateLodState().GetUpdateThisFrame());
+
+        for (int cycle = 0; cycle < 3; ++cycle)
+        {
+            for (int skippedFrame = 0; skippedFrame < 3; ++skippedFrame)
+            {
+                m_scheduler->Execute(0.1f);
+                EXPECT_FALSE(actorInstance->GetUpdateRateLodState().GetUpdateThisFrame());
+                EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 0);
+                EXPECT_EQ(m_scheduler->GetNumSkippedActorInstances(), 1);
+            }
+
+            m_scheduler->Execute(0.1f);
+            EXPECT_TRUE(actorInstance->GetUpdateRateLodState().GetUpdateThisFrame());
+            EXPECT_NEAR(actorInstance->GetUpdateRateLodState().GetUpdateTimeDelta(), 0.4f, 0.0001f);
+            EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 1);
+        }
+    }
+
+    TEST_F(ActorUpdateRateLodFixture, DistanceFrameInterval)
+    {
+        UpdateRateLodSettings settings;
+        settings.m_enabled = true;
+        settings.m_metric = UpdateRateLodSettings::Metric::Distance;
+        settings.m_thresholds = { 10.0f };
+        settings.m_maxFrameInterval = 3;
+
+        ActorInstance* nearInstance = CreateActorInstance(settings);
+        nearInstance->SetLocalSpacePosition(AZ::Vector3(5.0f, 0.0f, 0.0f));
+        ActorInstance* farInstance = CreateActorInstance(settings);
+        farInstance->SetLocalSpacePosition(AZ::Vector3(500.0f, 0.0f, 0.0f));
+
+        m_scheduler->GetUpdateRateLod().SetViewer(AZ::Vector3::CreateZero(), AZ::DegToRad(60.0f));
+
+        size_t numNearUpdates = 0;
+        size_t numFarUpdates = 0;
+        constexpr size_t numFrames = 30;
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            m_scheduler->Execute(1.0f / 30.0f);
+            numNearUpdates += nearInstance->GetUpdateRateLodState().GetUpdateThisFrame() ? 1 : 0;
+            numFarUpdates += farInstance->GetUpdateRateLodState().GetUpdateThisFrame() ? 1 : 0;
+        }
+
+        EXPECT_EQ(numNearUpdates, numFrames);
+        EXPECT_EQ(farInstance->GetUpdateRateLodState().GetFrameInterval(), 3);
+        EXPECT_NEAR(numFarUpdates, numFrames / 3, 1);
+    }
+
+    TEST_F(ActorUpdateRateLodFixture, MaxUpdatesPerFrame)
+    {
+        UpdateRateLodSettings settings;
+        settings.m_enabled = true;
+
+        constexpr size_t numActorInstances = 10;
+        constexpr size_t maxUpdatesPerFrame = 3;
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            CreateActorInstance(settings);
+        }
+
+        // Actor instances without update rate LOD are never deferred.
+        CreateActorInstance(UpdateRateLodSettings());
+
+        m_scheduler->GetUpdateRateLod().SetMaxUpdatesPerFrame(maxUpdatesPerFrame);
+
+        AZStd::vector<size_t> numUpdates(m_actorInstances.size(), 0);
+        constexpr size_t numFrames = 20;
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            m_scheduler->Execute(0.1f);
+            EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), maxUpdatesPerFrame + 1);
+            EXPECT_EQ(m_scheduler->GetUpdateRateLod().GetNumDeferredActorInstances(), numActorInstances - maxUpdatesPerFrame);
+
+            for (size_t i = 0; i < m_actorInstances.size(); ++i)
+            {
+                numUpdates[i] += m_actorInstances[i]->GetUpdateRateLodState().GetUpdateThisFrame() ? 1 : 0;
+            }
+        }
+
+        // Deferred actor instances are prioritized the next frame, so the budget is spread evenly.
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            EXPECT_GE(numUpdates[i], numFrames * maxUpdatesPerFrame / numActorInstances - 1);
+        }
+        EXPECT_EQ(numUpdates.back(), numFrames);
+    }
+
+    TEST_F(ActorUpdateRateLodFixture, AttachmentsFollowRoot)
+    {
+        UpdateRateLodSettings settings;
+        settings.m_enabled = true;
+        settings.m_invisibleFrameInterval = 2;
+        ActorInstance* rootInstance = CreateActorInstance(settings);
+        ActorInstance* attachmentInstance = CreateActorInstance(UpdateRateLodSettings());
+        rootInstance->AddAttachment(AttachmentNode::Create(rootInstance, 0, attachmentInstance));
+        rootInstance->SetIsVisible(false);
+
+        for (int frame = 0; frame < 6; ++frame)
+        {
+            m_scheduler->Execute(0.1f);
+            EXPECT_EQ(attachmentInstance->GetUpdateRateLodState().GetUpdateThisFrame(), rootInstance->GetUpdateRateLodState().GetUpdateThisFrame());
+        }
+    }
+} // namespace EMotionFX
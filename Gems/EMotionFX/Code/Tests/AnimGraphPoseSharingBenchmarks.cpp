@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MotionSet.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/AnimGraphFactory.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/TestMotionAssets.h>
+
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX
+{
+    /*
+     * Updates a crowd of 500 actor instances that all run the same walk anim graph, one frame per iteration,
+     * so the reported time is the animation update cost per frame. The crowd is spread over a number of motion phases,
+     * where actor instances in the same phase are in the same anim graph state.
+     */
+    class AnimGraphPoseSharingBenchmarkFixture
+        : public UnitTest::TestFixtureBenchmarkFixture<SystemComponentFixture>
+    {
+    public:
+        static constexpr size_t CrowdSize = 500;
+        static constexpr float FrameTime = 1.0f / 60.0f;
+
+        void SetUpBenchmark() override
+        {
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+
+            m_motionSet = aznew MotionSet("motionSet");
+            MotionSet::MotionEntry* motionEntry = aznew MotionSet::MotionEntry();
+            motionEntry->SetMotion(TestMotionAssets::GetJackWalkForward());
+            m_motionSet->AddMotionEntry(motionEntry);
+            m_motionSet->SetMotionEntryId(motionEntry, "jack_walk_forward_aim_zup");
+
+            m_animGraph = AnimGraphFactory::Create<EmptyAnimGraph>();
+            m_motionNode = aznew AnimGraphMotionNode();
+            m_motionNode->AddMotionId("jack_walk_forward_aim_zup");
+            m_motionNode->SetLoop(true);
+            m_animGraph->GetRootStateMachine()->AddChildNode(m_motionNode);
+            m_animGraph->GetRootStateMachine()->SetEntryState(m_motionNode);
+            m_animGraph->InitAfterLoading();
+
+            m_actorInstances.reserve(CrowdSize);
+            for (size_t i = 0; i < CrowdSize; ++i)
+            {
+                ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+                m_animGraph->GetAnimGraphInstance(actorInstance, m_motionSet);
+                m_actorInstances.emplace_back(actorInstance);
+            }
+        }
+
+        void TearDownBenchmark() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->GetAnimGraphInstance()->Destroy();
+                actorInstance->Destroy();
+            }
+            m_actorInstances = {};
+            m_animGraph.reset();
+            delete m_motionSet;
+            m_motionSet = nullptr;
+            m_actor.reset();
+        }
+
+        void RunCrowdBenchmark(bool poseSharing, size_t numPhases, ::benchmark::State& state)
+        {
+            ActorManager* actorManager = GetEMotionFX().GetActorManager();
+            actorManager->UpdateActorInstances(0.0f);
+
+            const float duration = m_motionNode->GetDuration(m_actorInstances[0]->GetAnimGraphInstance());
+            for (size_t i = 0; i < CrowdSize; ++i)
+            {
+                ActorInstance* actorInstance = m_actorInstances[i];
+                actorInstance->SetPoseSharingEnabled(poseSharing);
+                const float phase = static_cast<float>(i % numPhases) / static_cast<float>(numPhases);
+                m_motionNode->SetCurrentPlayTime(actorInstance->GetAnimGraphInstance(), phase * duration);
+            }
+
+            size_t numShared = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                actorManager->UpdateActorInstances(FrameTime);
+                numShared += actorManager->GetScheduler()->GetNumSharedPoseActorInstances();
+            }
+
+            state.SetItemsProcessed(state.iterations() * CrowdSize);
+            state.counters["SharedPerFrame"] = ::benchmark::Counter(static_cast<double>(numShared), ::benchmark::Counter::kAvgIterations);
+        }
+
+        AZStd::unique_ptr<JackNoMeshesActor> m_actor;
+        AZStd::unique_ptr<EmptyAnimGraph> m_animGraph;
+        AnimGraphMotionNode* m_motionNode = nullptr;
+        MotionSet* m_motionSet = nullptr;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    BENCHMARK_F(AnimGraphPoseSharingBenchmarkFixture, Crowd_Evaluated)(benchmark::State& state)
+    {
+        RunCrowdBenchmark(/*poseSharing=*/false, 8, state);
+    }
+
+    BENCHMARK_F(AnimGraphPoseSharingBenchmarkFixture, Crowd_SharedPosesOnePhase)(benchmark::State& state)
+    {
+        RunCrowdBenchmark(/*poseSharing=*/true, 1, state);
+    }
+
+    BENCHMARK_F(AnimGraphPoseSharingBenchmarkFixture, Crowd_SharedPosesEightPhases)(benchmark::State& state)
+    {
+        RunCrowdBenchmark(/*poseSharing=*/true, 8, state);
+    }
+
+    BENCHMARK_F(AnimGraphPoseSharingBenchmarkFixture, Crowd_SharedPosesUniquePhases)(benchmark::State& state)
+    {
+        RunCrowdBenchmark(/*poseSharing=*/true, CrowdSize, state);
+    }
+} // namespace EMotionFX
+#endif
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateRateLod.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphPoseSharing.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MotionSet.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/Parameter/FloatSliderParameter.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <MCore/Source/AttributeFloat.h>
+#include <Tests/JackGraphFixture.h>
+#include <Tests/TestAssetCode/TestMotionAssets.h>
+
+namespace EMotionFX
+{
+    class AnimGraphPoseSharingFixture
+        : public JackGraphFixture
+    {
+    public:
+        static constexpr float FrameTime = 1.0f / 60.0f;
+
+        void ConstructGraph() override
+        {
+            JackGraphFixture::ConstructGraph();
+
+            MotionSet::MotionEntry* motionEntry = aznew MotionSet::MotionEntry();
+            motionEntry->SetMotion(TestMotionAssets::GetJackWalkForward());
+            m_motionSet->AddMotionEntry(motionEntry);
+            m_motionSet->SetMotionEntryId(motionEntry, "jack_walk_forward_aim_zup");
+
+            m_motionNode = aznew AnimGraphMotionNode();
+            m_motionNode->SetName("Walk");
+            m_motionNode->AddMotionId("jack_walk_forward_aim_zup");
+            m_motionNode->SetLoop(true);
+            m_animGraph->GetRootStateMachine()->AddChildNode(m_motionNode);
+            m_animGraph->GetRootStateMachine()->SetEntryState(m_motionNode);
+
+            FloatSliderParameter* parameter = aznew FloatSliderParameter();
+            parameter->SetName("Speed");
+            parameter->SetDefaultValue(1.0f);
+            m_animGraph->AddParameter(parameter);
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_crowdInstances)
+            {
+                actorInstance->GetAnimGraphInstance()->Destroy();
+                actorInstance->Destroy();
+            }
+            m_crowdInstances.clear();
+
+            GetEMotionFX().GetActorManager()->GetPoseSharing() = AnimGraphPoseSharing();
+            static_cast<MultiThreadScheduler*>(GetEMotionFX().GetActorManager()->GetScheduler())->GetUpdateRateLod() = ActorUpdateRateLod();
+            JackGraphFixture::TearDown();
+        }
+
+        ActorInstance* CreateCrowdInstance(bool poseSharing)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            m_animGraph->GetAnimGraphInstance(actorInstance, m_motionSet);
+            actorInstance->SetPoseSharingEnabled(poseSharing);
+            m_crowdInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+        void SetSpeed(ActorInstance* actorInstance, float speed)
+        {
+            static_cast<MCore::AttributeFloat*>(actorInstance->GetAnimGraphInstance()->GetParameterValue(0))->SetValue(speed);
+        }
+
+        size_t GetNumSharedPoses() const
+        {
+            return GetEMotionFX().GetActorManager()->GetScheduler()->GetNumSharedPoseActorInstances();
+        }
+
+        void ExpectSamePose(const ActorInstance* expected, const ActorInstance* actual)
+        {
+            const Pose* expectedPose = expected->GetTransformData()->GetCurrentPose();
+            const Pose* actualPose = actual->GetTransformData()->GetCurrentPose();
+            ASSERT_EQ(expectedPose->GetNumTransforms(), actualPose->GetNumTransforms());
+            for (size_t i = 0; i < expectedPose->GetNumTransforms(); ++i)
+            {
+                const Transform& expectedTransform = expectedPose->GetLocalSpaceTransform(i);
+                const Transform& actualTransform = actualPose->GetLocalSpaceTransform(i);
+                EXPECT_TRUE(actualTransform.m_position.IsClose(expectedTransform.m_position, 0.0001f)) << "Joint " << i;
+                EXPECT_TRUE(actualTransform.m_rotation.IsClose(expectedTransform.m_rotation, 0.0001f)) << "Joint " << i;
+            }
+        }
+
+    protected:
+        AnimGraphMotionNode* m_motionNode = nullptr;
+        AZStd::vector<ActorInstance*> m_crowdInstances;
+    };
+
+    TEST_F(AnimGraphPoseSharingFixture, DisabledByDefault)
+    {
+        ActorInstance* actorInstance = CreateCrowdInstance(/*poseSharing=*/false);
+        EXPECT_FALSE(m_actorInstance->GetPoseSharingEnabled());
+
+        for (int i = 0; i < 10; ++i)
+        {
+            Evaluate(FrameTime);
+            EXPECT_EQ(GetNumSharedPoses(), 0);
+            EXPECT_EQ(actorInstance->GetPoseSharingSource(), nullptr);
+        }
+    }
+
+    TEST_F(AnimGraphPoseSharingFixture, StateHash)
+    {
+        ActorInstance* instanceA = CreateCrowdInstance(/*poseSharing=*/true);
+        ActorInstance* instanceB = CreateCrowdInstance(/*poseSharing=*/true);
+        Evaluate(FrameTime);
+
+        const AnimGraphPoseSharing& poseSharing = GetEMotionFX().GetActorManager()->GetPoseSharing();
+        EXPECT_TRUE(poseSharing.GetIsEligible(instanceA));
+        EXPECT_FALSE(poseSharing.GetIsEligible(m_actorInstance)) << "Pose sharing is opt-in.";
+        EXPECT_EQ(poseSharing.CalcStateHash(instanceA), poseSharing.CalcStateHash(instanceB));
+
+        SetSpeed(instanceB, 2.0f);
+        EXPECT_NE(poseSharing.CalcStateHash(instanceA), poseSharing.CalcStateHash(instanceB));
+
+        SetSpeed(instanceB, 1.0f + poseSharing.GetValueTolerance() * 0.1f);
+        EXPECT_EQ(poseSharing.CalcStateHash(instanceA), poseSharing.CalcStateHash(instanceB)) << "Differences within the tolerance should be ignored.";
+
+        SetSpeed(instanceB, 1.0f);
+        m_motionNode->SetCurrentPlayTime(instanceB->GetAnimGraphInstance(), 0.5f);
+        EXPECT_NE(poseSharing.CalcStateHash(instanceA), poseSharing.CalcStateHash(instanceB)) << "A different motion phase should change the hash.";
+
+        instanceB->SetIsVisible(false);
+        EXPECT_FALSE(poseSharing.GetIsEligible(instanceB)) << "Invisible actor instances do not calculate their output pose.";
+    }
+
+    TEST_F(AnimGraphPoseSharingFixture, EqualState)
+    {
+        // Pose sources are only shared when the full states are equal, so a collision of the state hashes can't share a pose.
+        ActorInstance* instanceA = CreateCrowdInstance(/*poseSharing=*/true);
+        ActorInstance* instanceB = CreateCrowdInstance(/*poseSharing=*/true);
+        Evaluate(FrameTime);
+
+        const AnimGraphPoseSharing& poseSharing = GetEMotionFX().GetActorManager()->GetPoseSharing();
+        EXPECT_TRUE(poseSharing.GetHasEqualState(instanceA, instanceB));
+
+        SetSpeed(instanceB, 1.0f + poseSharing.GetValueTolerance() * 0.1f);
+        EXPECT_TRUE(poseSharing.GetHasEqualState(instanceA, instanceB)) << "Differences within the tolerance should be ignored.";
+
+        SetSpeed(instanceB, 2.0f);
+        EXPECT_FALSE(poseSharing.GetHasEqualState(instanceA, instanceB));
+
+        SetSpeed(instanceB, 1.0f);
+        m_motionNode->SetCurrentPlayTime(instanceB->GetAnimGraphInstance(), 0.5f);
+        EXPECT_FALSE(poseSharing.GetHasEqualState(instanceA, instanceB));
+    }
+
+    TEST_F(AnimGraphPoseSharingFixture, SharedPoseMatchesEvaluatedPose)
+    {
+        ActorInstance* reference = CreateCrowdInstance(/*poseSharing=*/false);
+        ActorInstance* instanceA = CreateCrowdInstance(/*poseSharing=*/true);
+        ActorInstance* instanceB = CreateCrowdInstance(/*poseSharing=*/true);
+        ActorInstance* instanceC = CreateCrowdInstance(/*poseSharing=*/true);
+        instanceB->SetLocalSpacePosition(AZ::Vector3(5.0f, 0.0f, 0.0f));
+
+        for (int i = 0; i < 30; ++i)
+        {
+            Evaluate(FrameTime);
+            EXPECT_EQ(GetNumSharedPoses(), 2);
+            ExpectSamePose(reference, instanceA);
+            ExpectSamePose(reference, instanceB);
+            ExpectSamePose(reference, instanceC);
+        }
+
+        // The pose sources are only assigned during the update.
+        EXPECT_EQ(instanceB->GetPoseSharingSource(), nullptr);
+
+        // Root motion and placement stay per actor instance.
+        EXPECT_TRUE(instanceB->GetWorldSpaceTransform().m_position.IsClose(
+            instanceA->GetWorldSpaceTransform().m_position + AZ::Vector3(5.0f, 0.0f, 0.0f), 0.0001f));
+    }
+
+    TEST_F(AnimGraphPoseSharingFixture, SharedPoseWithUpdateRateLodMatchesEvaluatedPose)
+    {
+        // All instances are far enough to update every third frame and interpolate the frames in between. The pose source
+        // interpolates its pose right after its update, the instances sharing it must interpolate the updated pose only once.
+        UpdateRateLodSettings settings;
+        settings.m_enabled = true;
+        settings.m_metric = UpdateRateLodSettings::Metric::Distance;
+        settings.m_thresholds = { 10.0f };
+        settings.m_maxFrameInterval = 3;
+        settings.m_interpolateSkippedFrames = true;
+
+        ActorInstance* reference = CreateCrowdInstance(/*poseSharing=*/false);
+        ActorInstance* instanceA = CreateCrowdInstance(/*poseSharing=*/true);
+        ActorInstance* instanceB = CreateCrowdInstance(/*poseSharing=*/true);
+        for (ActorInstance* actorInstance : { reference, instanceA, instanceB })
+        {
+            actorInstance->SetUpdateRateLodSettings(settings);
+            actorInstance->SetLocalSpacePosition(AZ::Vector3(500.0f, 0.0f, 0.0f));
+        }
+        static_cast<MultiThreadScheduler*>(GetEMotionFX().GetActorManager()->GetScheduler())->GetUpdateRateLod().SetViewer(
+            AZ::Vector3::CreateZero(), AZ::DegToRad(60.0f));
+
+        size_t numSharedUpdates = 0;
+        for (int i = 0; i < 30; ++i)
+        {
+            Evaluate(FrameTime);
+            numSharedUpdates += GetNumSharedPoses();
+            ExpectSamePose(reference, instanceA);
+            ExpectSamePose(reference, instanceB);
+        }
+
+        EXPECT_EQ(instanceA->GetUpdateRateLodState().GetFrameInterval(), 3);
+        EXPECT_GT(numSharedUpdates, 0);
+    }
+
+    TEST_F(AnimGraphPoseSharingFixture, DifferentStatesDoNotShare)
+    {
+        ActorInstance* instanceA = CreateCrowdInstance(/*poseSharing=*/true);
+        ActorInstance* instanceB = CreateCrowdInstance(/*poseSharing=*/true);
+        Evaluate(FrameTime);
+        EXPECT_EQ(GetNumSharedPoses(), 1);
+
+        SetSpeed(instanceB, 2.0f);
+        Evaluate(FrameTime);
+        EXPECT_EQ(GetNumSharedPoses(), 0);
+
+        SetSpeed(instanceB, 1.0f);
+        m_motionNode->SetCurrentPlayTime(instanceB->GetAnimGraphInstance(), 0.5f);
+        Evaluate(FrameTime);
+        EXPECT_EQ(GetNumSharedPoses(), 0);
+        EXPECT_EQ(instanceA->GetPoseSharingSource(), nullptr);
+
+        GetEMotionFX().GetActorManager()->GetPoseSharing().SetEnabled(false);
+        m_motionNode->SetCurrentPlayTime(instanceB->GetAnimGraphInstance(), m_motionNode->GetCurrentPlayTime(instanceA->GetAnimGraphInstance()));
+        Evaluate(FrameTime);
+        EXPECT_EQ(GetNumSharedPoses(), 0);
+    }
+} // namespace EMotionFX
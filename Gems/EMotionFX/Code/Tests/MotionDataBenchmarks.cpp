@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/QuantizedMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX
+{
+    /*
+     * Samples the pose of an actor instance with 100 joints from a ten second motion that animates all of them, one
+     * SamplePose per iteration, so the reported items are sampled joints. The in memory size of the sample data is
+     * reported as counters, in bytes and relative to the UniformMotionData of the same motion.
+     */
+    class MotionDataBenchmarkFixture
+        : public UnitTest::TestFixtureBenchmarkFixture<SystemComponentFixture>
+    {
+    public:
+        static constexpr size_t NumJoints = 100;
+        static constexpr size_t NumKeys = 301;
+        static constexpr float SampleRate = 30.0f;
+
+        void SetUpBenchmark() override
+        {
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(NumJoints);
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+
+            // Smooth curves with a random frequency and phase per joint, similar to captured animation.
+            AZ::SimpleLcgRandom random(1234);
+            m_sourceData = AZStd::make_unique<NonUniformMotionData>();
+            m_sourceData->Resize(NumJoints, 0, 0);
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                m_sourceData->SetJointName(i, m_actor->GetSkeleton()->GetNode(i)->GetNameString());
+                m_sourceData->AllocateJointPositionSamples(i, NumKeys);
+                m_sourceData->AllocateJointRotationSamples(i, NumKeys);
+
+                const float frequency = 0.5f + random.GetRandomFloat() * 2.0f;
+                const float phase = random.GetRandomFloat() * AZ::Constants::TwoPi;
+                const AZ::Vector3 axis = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat() + 0.1f).GetNormalized();
+                for (size_t k = 0; k < NumKeys; ++k)
+                {
+                    const float time = static_cast<float>(k) / SampleRate;
+                    const float wave = AZ::Sin(time * frequency + phase);
+                    m_sourceData->SetJointPositionSample(i, k, { time, AZ::Vector3(wave, wave * 0.5f, 0.1f * time) });
+                    m_sourceData->SetJointRotationSample(i, k, { time, AZ::Quaternion::CreateFromAxisAngle(axis, wave) });
+                }
+            }
+            m_sourceData->UpdateDuration();
+        }
+
+        void TearDownBenchmark() override
+        {
+            m_sourceData.reset();
+            m_actorInstance->Destroy();
+            m_actor.reset();
+        }
+
+        void RunSamplingBenchmark(::benchmark::State& state, MotionData& motionData)
+        {
+            motionData.InitFromNonUniformData(m_sourceData.get(), /*keepSameSampleRate=*/false, SampleRate);
+            MotionData::OptimizeSettings optimizeSettings;
+            motionData.Optimize(optimizeSettings);
+
+            Pose pose;
+            pose.LinkToActorInstance(m_actorInstance);
+            MotionData::SampleSettings sampleSettings;
+            sampleSettings.m_actorInstance = m_actorInstance;
+
+            // Link the motion to the actor before measuring, like the first update of a motion instance does.
+            motionData.SamplePose(sampleSettings, &pose);
+
+            const float duration = motionData.GetDuration();
+            const float timeStep = duration / 97.0f;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                motionData.SamplePose(sampleSettings, &pose);
+                benchmark::DoNotOptimize(pose.GetLocalSpaceTransform(NumJoints - 1));
+
+                sampleSettings.m_sampleTime += timeStep;
+                if (sampleSettings.m_sampleTime > duration)
+                {
+                    sampleSettings.m_sampleTime -= duration;
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * NumJoints);
+        }
+
+        // The sample data size of the UniformMotionData of the source motion, to compare the other types against.
+        size_t CalcUniformSampleDataSizeInBytes() const
+        {
+            UniformMotionData uniformData;
+            uniformData.InitFromNonUniformData(m_sourceData.get(), /*keepSameSampleRate=*/false, SampleRate);
+            return uniformData.CalcSampleDataSizeInBytes();
+        }
+
+        void ReportSampleDataSize(::benchmark::State& state, size_t sampleDataSizeInBytes) const
+        {
+            state.counters["SampleDataBytes"] = static_cast<double>(sampleDataSizeInBytes);
+            state.counters["SizeOfUniform"] = static_cast<double>(sampleDataSizeInBytes) / static_cast<double>(CalcUniformSampleDataSizeInBytes());
+        }
+
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        AZStd::unique_ptr<NonUniformMotionData> m_sourceData;
+    };
+
+    BENCHMARK_F(MotionDataBenchmarkFixture, UniformMotionData_SamplePose)(benchmark::State& state)
+    {
+        UniformMotionData motionData;
+        RunSamplingBenchmark(state, motionData);
+        ReportSampleDataSize(state, motionData.CalcSampleDataSizeInBytes());
+    }
+
+    BENCHMARK_F(MotionDataBenchmarkFixture, NonUniformMotionData_SamplePose)(benchmark::State& state)
+    {
+        NonUniformMotionData motionData;
+        RunSamplingBenchmark(state, motionData);
+        ReportSampleDataSize(state, motionData.CalcSampleDataSizeInBytes());
+    }
+
+    BENCHMARK_F(MotionDataBenchmarkFixture, QuantizedMotionData_SamplePose)(benchmark::State& state)
+    {
+        QuantizedMotionData motionData;
+        RunSamplingBenchmark(state, motionData);
+
+        // Like the exported data, without the source samples that are only kept for optimizing again.
+        motionData.ReleaseSourceSamples();
+        ReportSampleDataSize(state, motionData.CalcSampleDataSizeInBytes());
+    }
+} // namespace EMotionFX
+#endif
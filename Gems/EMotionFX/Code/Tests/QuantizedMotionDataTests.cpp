@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/QuantizedMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/Matchers.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    class QuantizedMotionDataFixture
+        : public SystemComponentFixture
+    {
+    public:
+        static constexpr size_t NumKeys = 61;
+        static constexpr float SampleRate = 30.0f;
+        static constexpr size_t PiecewiseSegmentLength = 10;
+        static constexpr float PiecewiseAmplitude = 10.0f;
+
+        // Joint 0 moves and rotates, joint 1 moves along a straight line and joint 2 is static.
+        // The morph ramps up linearly and the float channel is static.
+        void FillSourceMotionData(NonUniformMotionData& motionData)
+        {
+            motionData.Resize(3, 1, 1);
+            for (size_t i = 0; i < 3; ++i)
+            {
+                motionData.SetJointName(i, AZStd::string::format("Joint%zu", i));
+                motionData.SetJointStaticTransform(i, Transform::CreateIdentity());
+                motionData.SetJointBindPoseTransform(i, Transform::CreateIdentity());
+            }
+            motionData.SetMorphName(0, "Morph");
+            motionData.SetFloatName(0, "Float");
+            motionData.SetFloatStaticValue(0, 0.5f);
+
+            motionData.AllocateJointPositionSamples(0, NumKeys);
+            motionData.AllocateJointRotationSamples(0, NumKeys);
+            motionData.AllocateJointPositionSamples(1, NumKeys);
+            motionData.AllocateMorphSamples(0, NumKeys);
+            for (size_t i = 0; i < NumKeys; ++i)
+            {
+                const float time = static_cast<float>(i) / SampleRate;
+                motionData.SetJointPositionSample(0, i, { time, AZ::Vector3(AZ::Sin(time * 3.0f), AZ::Cos(time * 2.0f), time) });
+                motionData.SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateRotationZ(time * 2.0f) });
+                motionData.SetJointPositionSample(1, i, { time, AZ::Vector3(time * 4.0f, 1.0f, -time) });
+                motionData.SetMorphSample(0, i, { time, time * 0.5f });
+            }
+            motionData.UpdateDuration();
+        }
+
+        // A single joint that moves back and forth along x with a constant speed, changing direction every PiecewiseSegmentLength frames.
+        void FillPiecewiseLinearMotionData(NonUniformMotionData& motionData)
+        {
+            motionData.Resize(1, 0, 0);
+            motionData.SetJointName(0, "Joint0");
+            motionData.SetJointStaticTransform(0, Transform::CreateIdentity());
+            motionData.SetJointBindPoseTransform(0, Transform::CreateIdentity());
+
+            motionData.AllocateJointPositionSamples(0, NumKeys);
+            for (size_t i = 0; i < NumKeys; ++i)
+            {
+                const float time = static_cast<float>(i) / SampleRate;
+                const size_t segmentFrame = i % (2 * PiecewiseSegmentLength);
+                const size_t distance = (segmentFrame <= PiecewiseSegmentLength) ? segmentFrame : 2 * PiecewiseSegmentLength - segmentFrame;
+                const float x = PiecewiseAmplitude * static_cast<float>(distance) / static_cast<float>(PiecewiseSegmentLength);
+                motionData.SetJointPositionSample(0, i, { time, AZ::Vector3(x, 1.0f, 2.0f) });
+            }
+            motionData.UpdateDuration();
+        }
+
+        // The largest difference between the joint positions on the frames of the sample grid.
+        float CalcMaxPositionError(const MotionData& expected, const MotionData& actual, size_t jointIndex)
+        {
+            float maxError = 0.0f;
+            for (size_t i = 0; i < NumKeys; ++i)
+            {
+                const float time = static_cast<float>(i) / SampleRate;
+                const AZ::Vector3 difference = actual.SampleJointPosition(time, jointIndex) - expected.SampleJointPosition(time, jointIndex);
+                maxError = AZStd::max(maxError, difference.GetAbs().GetMaxElement());
+            }
+            return maxError;
+        }
+
+        void ExpectSameSamples(const MotionData& expected, const MotionData& actual, float tolerance)
+        {
+            ASSERT_FLOAT_EQ(actual.GetDuration(), expected.GetDuration());
+            const float duration = expected.GetDuration();
+            for (float time = 0.0f; time <= duration; time += 0.0123f)
+            {
+                for (size_t i = 0; i < expected.GetNumJoints(); ++i)
+                {
+                    const Transform expectedTransform = expected.SampleJointTransform(time, i);
+                    const Transform actualTransform = actual.SampleJointTransform(time, i);
+                    EXPECT_TRUE(actualTransform.m_position.IsClose(expectedTransform.m_position, tolerance)) << "Joint " << i << " at time " << time;
+                    EXPECT_TRUE(actualTransform.m_rotation.IsClose(expectedTransform.m_rotation, tolerance)) << "Joint " << i << " at time " << time;
+                }
+                EXPECT_NEAR(actual.SampleMorph(time, 0), expected.SampleMorph(time, 0), tolerance) << "Time " << time;
+                EXPECT_NEAR(actual.SampleFloat(time, 0), expected.SampleFloat(time, 0), tolerance) << "Time " << time;
+            }
+        }
+    };
+
+    TEST_F(QuantizedMotionDataFixture, InitFromNonUniformData)
+    {
+        NonUniformMotionData source;
+        FillSourceMotionData(source);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+        EXPECT_TRUE(motionData.VerifyIntegrity());
+        EXPECT_EQ(motionData.GetNumSamples(), NumKeys);
+        EXPECT_EQ(motionData.GetNumJoints(), 3);
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(1));
+        EXPECT_FALSE(motionData.IsJointRotationAnimated(1));
+        EXPECT_FALSE(motionData.IsJointAnimated(2));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_FALSE(motionData.IsFloatAnimated(0));
+
+        // The straight line motion needs only its first and last key, even at the lossless tolerance.
+        EXPECT_EQ(motionData.GetNumJointPositionKeys(1), 2);
+
+        ExpectSameSamples(source, motionData, 0.001f);
+    }
+
+    TEST_F(QuantizedMotionDataFixture, OptimizeRemovesKeys)
+    {
+        NonUniformMotionData source;
+        FillSourceMotionData(source);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+        const size_t numKeysBefore = motionData.GetNumKeys();
+
+        MotionData::OptimizeSettings optimizeSettings;
+        optimizeSettings.m_maxPosError = 0.01f;
+        optimizeSettings.m_maxRotError = 0.01f;
+        motionData.Optimize(optimizeSettings);
+        EXPECT_TRUE(motionData.VerifyIntegrity());
+        EXPECT_LT(motionData.GetNumKeys(), numKeysBefore);
+        EXPECT_LT(motionData.GetNumJointPositionKeys(0), NumKeys);
+        EXPECT_LT(motionData.GetNumJointRotationKeys(0), NumKeys);
+
+        ExpectSameSamples(source, motionData, 0.02f);
+    }
+
+    TEST_F(QuantizedMotionDataFixture, LosslessInitKeepsOnlyTheKinksWithinQuantizationError)
+    {
+        NonUniformMotionData source;
+        FillPiecewiseLinearMotionData(source);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+        EXPECT_TRUE(motionData.VerifyIntegrity());
+
+        // The first and last frame, and every change of direction.
+        EXPECT_EQ(motionData.GetNumJointPositionKeys(0), (NumKeys - 1) / PiecewiseSegmentLength + 1);
+
+        // The straight segments between the keys are reproduced within half a quantization step of the range.
+        const float halfQuantizationStep = 0.5f * PiecewiseAmplitude / 65535.0f;
+        EXPECT_LE(CalcMaxPositionError(source, motionData, 0), halfQuantizationStep * 1.01f);
+    }
+
+    TEST_F(QuantizedMotionDataFixture, OptimizeFitsFromTheSourceSamples)
+    {
+        NonUniformMotionData source;
+        FillSourceMotionData(source);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+
+        MotionData::OptimizeSettings looseSettings;
+        looseSettings.m_maxPosError = 0.05f;
+        motionData.Optimize(looseSettings);
+        const size_t numLooseKeys = motionData.GetNumJointPositionKeys(0);
+        EXPECT_LE(CalcMaxPositionError(source, motionData, 0), 0.05f * 1.01f);
+
+        // Fitting the decoded keys of the loose fit again would keep its error, fitting the source samples removes it.
+        MotionData::OptimizeSettings tightSettings;
+        tightSettings.m_maxPosError = 0.001f;
+        motionData.Optimize(tightSettings);
+        EXPECT_GT(motionData.GetNumJointPositionKeys(0), numLooseKeys);
+        const float tightError = CalcMaxPositionError(source, motionData, 0);
+        EXPECT_LE(tightError, 0.001f * 1.01f);
+
+        // Optimizing again with the same settings doesn't change the keys or add to the error.
+        const size_t numTightKeys = motionData.GetNumJointPositionKeys(0);
+        motionData.Optimize(tightSettings);
+        motionData.Optimize(tightSettings);
+        EXPECT_EQ(motionData.GetNumJointPositionKeys(0), numTightKeys);
+        EXPECT_FLOAT_EQ(CalcMaxPositionError(source, motionData, 0), tightError);
+        EXPECT_TRUE(motionData.VerifyIntegrity());
+    }
+
+    TEST_F(QuantizedMotionDataFixture, ReleaseSourceSamples)
+    {
+        NonUniformMotionData source;
+        FillSourceMotionData(source);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+        const size_t numBytesWithSourceSamples = motionData.CalcSampleDataSizeInBytes();
+
+        // The source samples of every track are counted until they're released, the keys stay as they are.
+        const size_t numKeys = motionData.GetNumKeys();
+        motionData.ReleaseSourceSamples();
+        EXPECT_LE(motionData.CalcSampleDataSizeInBytes() + NumKeys * 3 * sizeof(float), numBytesWithSourceSamples);
+        EXPECT_EQ(motionData.GetNumKeys(), numKeys);
+        ExpectSameSamples(source, motionData, 0.001f);
+
+        // Optimizing afterwards fits the decoded keys.
+        MotionData::OptimizeSettings optimizeSettings;
+        optimizeSettings.m_maxPosError = 0.01f;
+        optimizeSettings.m_maxRotError = 0.01f;
+        motionData.Optimize(optimizeSettings);
+        EXPECT_TRUE(motionData.VerifyIntegrity());
+        EXPECT_LT(motionData.GetNumKeys(), numKeys);
+        ExpectSameSamples(source, motionData, 0.02f);
+    }
+
+    TEST_F(QuantizedMotionDataFixture, OptimizeIgnoreList)
+    {
+        NonUniformMotionData source;
+        FillSourceMotionData(source);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+        const size_t numPositionKeys = motionData.GetNumJointPositionKeys(0);
+
+        MotionData::OptimizeSettings optimizeSettings;
+        optimizeSettings.m_maxPosError = 0.1f;
+        optimizeSettings.m_jointIgnoreList = { 0 };
+        motionData.Optimize(optimizeSettings);
+        EXPECT_EQ(motionData.GetNumJointPositionKeys(0), numPositionKeys);
+    }
+
+    TEST_F(QuantizedMotionDataFixture, SmallerThanUniform)
+    {
+        NonUniformMotionData source;
+        FillSourceMotionData(source);
+
+        UniformMotionData uniformData;
+        uniformData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+        QuantizedMotionData quantizedData;
+        quantizedData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+
+        const MotionData::SaveSettings saveSettings;
+        EXPECT_LT(quantizedData.CalcStreamSaveSizeInBytes(saveSettings), uniformData.CalcStreamSaveSizeInBytes(saveSettings));
+    }
+
+    TEST_F(QuantizedMotionDataFixture, SaveAndRead)
+    {
+        NonUniformMotionData source;
+        FillSourceMotionData(source);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+        MotionData::OptimizeSettings optimizeSettings;
+        motionData.Optimize(optimizeSettings);
+
+        MCore::MemoryFile file;
+        file.Open();
+        const MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        file.Seek(0);
+        QuantizedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+        EXPECT_EQ(loadedData.GetNumKeys(), motionData.GetNumKeys());
+        EXPECT_EQ(loadedData.GetNumTracks(), motionData.GetNumTracks());
+        EXPECT_STREQ(loadedData.GetJointName(1).c_str(), "Joint1");
+        EXPECT_STREQ(loadedData.GetMorphName(0).c_str(), "Morph");
+        EXPECT_FLOAT_EQ(loadedData.GetFloatStaticValue(0), 0.5f);
+
+        ExpectSameSamples(motionData, loadedData, 0.0001f);
+    }
+
+    TEST_F(QuantizedMotionDataFixture, ClearAndRemoveCompactTracks)
+    {
+        NonUniformMotionData source;
+        FillSourceMotionData(source);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, /*keepSameSampleRate=*/false, SampleRate);
+        const size_t numTracks = motionData.GetNumTracks();
+        const AZ::Vector3 expectedPosition = motionData.SampleJointPosition(0.5f, 1);
+
+        motionData.ClearJointRotationSamples(0);
+        EXPECT_FALSE(motionData.IsJointRotationAnimated(0));
+        EXPECT_EQ(motionData.GetNumTracks(), numTracks - 1);
+        EXPECT_TRUE(motionData.VerifyIntegrity());
+
+        motionData.RemoveJoint(0);
+        EXPECT_EQ(motionData.GetNumJoints(), 2);
+        EXPECT_EQ(motionData.GetNumTracks(), numTracks - 2);
+        EXPECT_TRUE(motionData.VerifyIntegrity());
+        EXPECT_THAT(motionData.SampleJointPosition(0.5f, 0), IsClose(expectedPosition));
+
+        motionData.ClearAllMorphSamples();
+        EXPECT_FALSE(motionData.IsMorphAnimated(0));
+        EXPECT_EQ(motionData.GetNumTracks(), numTracks - 3);
+        EXPECT_TRUE(motionData.VerifyIntegrity());
+    }
+} // namespace EMotionFX
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Tests/SoftSkinDeformerFixture.h>
+#include <Tests/SystemComponentFixture.h>
+
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX
+{
+    /*
+     * Skins a mesh of 50k vertices with four influences per vertex and tangents, one full mesh per iteration,
+     * so the reported items are skinned vertices.
+     */
+    class SoftSkinDeformerBenchmarkFixture
+        : public UnitTest::TestFixtureBenchmarkFixture<SystemComponentFixture>
+    {
+    public:
+        static constexpr AZ::u32 NumVertices = 50000;
+        static constexpr size_t NumBones = 64;
+        static constexpr size_t MaxInfluences = 4;
+
+        void SetUpBenchmark() override
+        {
+            m_mesh = CreateRandomSkinnedMesh(NumVertices, NumBones, MaxInfluences, true, 1234);
+            m_deformer = AZStd::make_unique<TestSoftSkinDeformer>(m_mesh);
+
+            AZ::SimpleLcgRandom random(1234);
+            m_deformer->RandomizeBoneMatrices(random);
+        }
+
+        void TearDownBenchmark() override
+        {
+            m_deformer.reset();
+            m_mesh->Destroy();
+            m_mesh = nullptr;
+        }
+
+        template<class SkinFunction>
+        void RunSkinningBenchmark(::benchmark::State& state, SkinFunction skinFunction)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                // Skinning happens in place, start from the bind pose every iteration like the deformer stack does.
+                state.PauseTiming();
+                m_mesh->ResetToOriginalData();
+                state.ResumeTiming();
+
+                skinFunction();
+                benchmark::ClobberMemory();
+            }
+
+            state.SetItemsProcessed(state.iterations() * NumVertices);
+        }
+
+        Mesh* m_mesh = nullptr;
+        AZStd::unique_ptr<TestSoftSkinDeformer> m_deformer;
+    };
+
+    BENCHMARK_F(SoftSkinDeformerBenchmarkFixture, Reference)(benchmark::State& state)
+    {
+        RunSkinningBenchmark(state, [this]() { m_deformer->SkinReference(0, NumVertices); });
+    }
+
+    BENCHMARK_F(SoftSkinDeformerBenchmarkFixture, Batched)(benchmark::State& state)
+    {
+        RunSkinningBenchmark(state, [this]() { m_deformer->SkinBatched(0, NumVertices); });
+    }
+
+    BENCHMARK_F(SoftSkinDeformerBenchmarkFixture, BatchedJobs)(benchmark::State& state)
+    {
+        RunSkinningBenchmark(state, [this]() { m_deformer->SkinAll(); });
+    }
+} // namespace EMotionFX
+#endif
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <EMotionFX/Source/VertexAttributeLayerAbstractData.h>
+
+namespace EMotionFX
+{
+    //! Exposes the skinning kernels of the soft skin deformer, so they can be run without an actor instance.
+    class TestSoftSkinDeformer
+        : public SoftSkinDeformer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestSoftSkinDeformer, AZ::SystemAllocator, 0);
+
+        explicit TestSoftSkinDeformer(Mesh* mesh)
+            : SoftSkinDeformer(mesh)
+        {
+            Reinitialize(nullptr, nullptr, 0);
+        }
+
+        ~TestSoftSkinDeformer() override = default;
+
+        void RandomizeBoneMatrices(AZ::SimpleLcgRandom& random)
+        {
+            for (AZ::Matrix3x4& boneMatrix : m_boneMatrices)
+            {
+                const AZ::Vector3 axis = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat() + 0.1f).GetNormalized();
+                const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(axis, random.GetRandomFloat() * AZ::Constants::TwoPi);
+                const AZ::Vector3 translation(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f);
+                boneMatrix = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(rotation, translation);
+            }
+        }
+
+        void SkinReference(uint32 startVertex, uint32 endVertex)
+        {
+            SkinVertexRange(startVertex, endVertex,
+                static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS)),
+                static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS)),
+                static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS)),
+                static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS)),
+                static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS)),
+                GetSkinningLayer());
+        }
+
+        //! Skin all vertices the way Update does, which splits large meshes over multiple jobs.
+        void SkinAll()
+        {
+            SkinVertices(
+                static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS)),
+                static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS)),
+                static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS)),
+                static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS)),
+                static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS)),
+                GetSkinningLayer());
+        }
+
+        void SkinBatched(uint32 startVertex, uint32 endVertex)
+        {
+            SkinVertexRangeBatched(startVertex, endVertex,
+                static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS)),
+                static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS)),
+                static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS)),
+                static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS)));
+        }
+
+    private:
+        SkinningInfoVertexAttributeLayer* GetSkinningLayer() const
+        {
+            return static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        }
+    };
+
+    /**
+     * Create a mesh without polygons that is skinned to a number of bones, with random vertex attributes and influences.
+     * Every vertex maps to its own original vertex, and gets between one and maxInfluences influences with normalized weights.
+     */
+    inline Mesh* CreateRandomSkinnedMesh(AZ::u32 numVertices, size_t numBones, size_t maxInfluences, bool withTangents, AZ::u64 seed)
+    {
+        AZ::SimpleLcgRandom random(seed);
+        Mesh* mesh = Mesh::Create(numVertices, 0, 0, numVertices, false);
+
+        SkinningInfoVertexAttributeLayer* skinningLayer = SkinningInfoVertexAttributeLayer::Create(numVertices);
+        for (AZ::u32 vertex = 0; vertex < numVertices; ++vertex)
+        {
+            const size_t numInfluences = 1 + random.GetRandom() % maxInfluences;
+            float totalWeight = 0.0f;
+            AZStd::vector<float> weights(numInfluences);
+            for (float& weight : weights)
+            {
+                weight = random.GetRandomFloat() + 0.01f;
+                totalWeight += weight;
+            }
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                skinningLayer->AddInfluence(vertex, random.GetRandom() % numBones, weights[i] / totalWeight, 0);
+            }
+        }
+        mesh->AddSharedVertexAttributeLayer(skinningLayer);
+
+        auto addLayer = [mesh, numVertices](AZ::u32 layerType, AZ::u32 attributeSize) -> void*
+        {
+            VertexAttributeLayerAbstractData* layer = VertexAttributeLayerAbstractData::Create(numVertices, layerType, attributeSize, true);
+            mesh->AddVertexAttributeLayer(layer);
+            return layer->GetOriginalData();
+        };
+
+        auto randomVector = [&random]()
+        {
+            return AZ::Vector3(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f) * 2.0f;
+        };
+
+        AZ::u32* orgVerts = static_cast<AZ::u32*>(addLayer(Mesh::ATTRIB_ORGVTXNUMBERS, sizeof(AZ::u32)));
+        AZ::Vector3* positions = static_cast<AZ::Vector3*>(addLayer(Mesh::ATTRIB_POSITIONS, sizeof(AZ::Vector3)));
+        AZ::Vector3* normals = static_cast<AZ::Vector3*>(addLayer(Mesh::ATTRIB_NORMALS, sizeof(AZ::Vector3)));
+        AZ::Vector4* tangents = withTangents ? static_cast<AZ::Vector4*>(addLayer(Mesh::ATTRIB_TANGENTS, sizeof(AZ::Vector4))) : nullptr;
+        AZ::Vector3* bitangents = withTangents ? static_cast<AZ::Vector3*>(addLayer(Mesh::ATTRIB_BITANGENTS, sizeof(AZ::Vector3))) : nullptr;
+        for (AZ::u32 vertex = 0; vertex < numVertices; ++vertex)
+        {
+            orgVerts[vertex] = vertex;
+            positions[vertex] = randomVector();
+            normals[vertex] = randomVector().GetNormalizedSafe();
+            if (withTangents)
+            {
+                tangents[vertex] = AZ::Vector4::CreateFromVector3AndFloat(randomVector().GetNormalizedSafe(), (vertex % 2) ? 1.0f : -1.0f);
+                bitangents[vertex] = randomVector().GetNormalizedSafe();
+            }
+        }
+
+        mesh->ResetToOriginalData();
+        return mesh;
+    }
+} // namespace EMotionFX
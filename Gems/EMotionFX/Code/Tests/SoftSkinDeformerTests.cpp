@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Tests/Matchers.h>
+#include <Tests/SoftSkinDeformerFixture.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    struct SoftSkinDeformerParam
+    {
+        AZ::u32 m_numVertices;
+        size_t m_maxInfluences;
+        bool m_withTangents;
+    };
+
+    class SoftSkinDeformerFixture
+        : public SystemComponentFixture
+        , public ::testing::WithParamInterface<SoftSkinDeformerParam>
+    {
+    public:
+        void TearDown() override
+        {
+            for (Mesh* mesh : m_meshes)
+            {
+                mesh->Destroy();
+            }
+            m_meshes.clear();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        Mesh* CreateMesh(const SoftSkinDeformerParam& param)
+        {
+            Mesh* mesh = CreateRandomSkinnedMesh(param.m_numVertices, s_numBones, param.m_maxInfluences, param.m_withTangents, s_seed);
+            m_meshes.emplace_back(mesh);
+            return mesh;
+        }
+
+        void ExpectEqualVertices(Mesh* expected, Mesh* actual)
+        {
+            const AZ::u32 numVertices = expected->GetNumVertices();
+            const AZ::Vector3* expectedPositions = static_cast<AZ::Vector3*>(expected->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            const AZ::Vector3* actualPositions = static_cast<AZ::Vector3*>(actual->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            const AZ::Vector3* expectedNormals = static_cast<AZ::Vector3*>(expected->FindVertexData(Mesh::ATTRIB_NORMALS));
+            const AZ::Vector3* actualNormals = static_cast<AZ::Vector3*>(actual->FindVertexData(Mesh::ATTRIB_NORMALS));
+            const AZ::Vector4* expectedTangents = static_cast<AZ::Vector4*>(expected->FindVertexData(Mesh::ATTRIB_TANGENTS));
+            const AZ::Vector4* actualTangents = static_cast<AZ::Vector4*>(actual->FindVertexData(Mesh::ATTRIB_TANGENTS));
+            const AZ::Vector3* expectedBitangents = static_cast<AZ::Vector3*>(expected->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+            const AZ::Vector3* actualBitangents = static_cast<AZ::Vector3*>(actual->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+
+            for (AZ::u32 vertex = 0; vertex < numVertices; ++vertex)
+            {
+                EXPECT_THAT(actualPositions[vertex], IsClose(expectedPositions[vertex])) << "Vertex " << vertex;
+                EXPECT_THAT(actualNormals[vertex], IsClose(expectedNormals[vertex])) << "Vertex " << vertex;
+                if (expectedTangents)
+                {
+                    EXPECT_THAT(actualTangents[vertex], IsClose(expectedTangents[vertex])) << "Vertex " << vertex;
+                    EXPECT_THAT(actualBitangents[vertex], IsClose(expectedBitangents[vertex])) << "Vertex " << vertex;
+                }
+            }
+        }
+
+    protected:
+        static constexpr size_t s_numBones = 20;
+        static constexpr AZ::u64 s_seed = 1234;
+        AZStd::vector<Mesh*> m_meshes;
+    };
+
+    TEST_P(SoftSkinDeformerFixture, BatchedMatchesReference)
+    {
+        const SoftSkinDeformerParam& param = GetParam();
+        Mesh* expectedMesh = CreateMesh(param);
+        Mesh* actualMesh = CreateMesh(param);
+
+        TestSoftSkinDeformer expectedDeformer(expectedMesh);
+        TestSoftSkinDeformer actualDeformer(actualMesh);
+        ASSERT_GT(actualDeformer.GetNumInfluenceSlots(), 0) << "Expected the batched skinning kernel to be used.";
+
+        AZ::SimpleLcgRandom expectedRandom(s_seed);
+        AZ::SimpleLcgRandom actualRandom(s_seed);
+        expectedDeformer.RandomizeBoneMatrices(expectedRandom);
+        actualDeformer.RandomizeBoneMatrices(actualRandom);
+
+        expectedDeformer.SkinReference(0, param.m_numVertices);
+        actualDeformer.SkinBatched(0, param.m_numVertices);
+        ExpectEqualVertices(expectedMesh, actualMesh);
+    }
+
+    TEST_P(SoftSkinDeformerFixture, BatchedPartialRange)
+    {
+        const SoftSkinDeformerParam& param = GetParam();
+        Mesh* expectedMesh = CreateMesh(param);
+        Mesh* actualMesh = CreateMesh(param);
+
+        TestSoftSkinDeformer expectedDeformer(expectedMesh);
+        TestSoftSkinDeformer actualDeformer(actualMesh);
+
+        AZ::SimpleLcgRandom expectedRandom(s_seed);
+        AZ::SimpleLcgRandom actualRandom(s_seed);
+        expectedDeformer.RandomizeBoneMatrices(expectedRandom);
+        actualDeformer.RandomizeBoneMatrices(actualRandom);
+
+        // A range that does not start or end on a batch boundary, the vertices outside of it must be left untouched.
+        const AZ::u32 startVertex = 1;
+        const AZ::u32 endVertex = param.m_numVertices - 2;
+        expectedDeformer.SkinReference(startVertex, endVertex);
+        actualDeformer.SkinBatched(startVertex, endVertex);
+        ExpectEqualVertices(expectedMesh, actualMesh);
+    }
+
+    TEST_P(SoftSkinDeformerFixture, SkinAllMatchesReference)
+    {
+        // Large enough to be split over multiple jobs, with a partial batch at the end.
+        SoftSkinDeformerParam param = GetParam();
+        param.m_numVertices = SoftSkinDeformer::MinVerticesPerJob * 2 + 3;
+        Mesh* expectedMesh = CreateMesh(param);
+        Mesh* actualMesh = CreateMesh(param);
+
+        TestSoftSkinDeformer expectedDeformer(expectedMesh);
+        TestSoftSkinDeformer actualDeformer(actualMesh);
+
+        AZ::SimpleLcgRandom expectedRandom(s_seed);
+        AZ::SimpleLcgRandom actualRandom(s_seed);
+        expectedDeformer.RandomizeBoneMatrices(expectedRandom);
+        actualDeformer.RandomizeBoneMatrices(actualRandom);
+
+        expectedDeformer.SkinReference(0, param.m_numVertices);
+        actualDeformer.SkinAll();
+        ExpectEqualVertices(expectedMesh, actualMesh);
+    }
+
+    INSTANTIATE_TEST_CASE_P(SoftSkinDeformer, SoftSkinDeformerFixture,
+        ::testing::ValuesIn(AZStd::vector<SoftSkinDeformerParam>{
+            { 7, 1, false },
+            { 64, 4, false },
+            { 64, 4, true },
+            { 101, 8, true },
+        }));
+
+    TEST_F(SystemComponentFixture, SoftSkinDeformer_TooManyInfluencesFallsBack)
+    {
+        Mesh* mesh = CreateRandomSkinnedMesh(64, 20, SoftSkinDeformer::MaxBatchedInfluences + 4, false, 1234);
+        {
+            TestSoftSkinDeformer deformer(mesh);
+            EXPECT_EQ(deformer.GetNumInfluenceSlots(), 0);
+        }
+        mesh->Destroy();
+    }
+} // namespace EMotionFX
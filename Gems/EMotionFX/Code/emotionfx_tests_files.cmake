@@ -12,6 +12,8 @@ set(FILES
     Tests/ActorFixture.cpp
     Tests/ActorFixture.h
     Tests/ActorInstanceCommandTests.cpp
+    Tests/ActorUpdateRateLodBenchmarks.cpp
+    Tests/ActorUpdateRateLodTests.cpp
     Tests/AdditiveMotionSamplingTests.cpp
     Tests/AnimAudioComponentTests.cpp
     Tests/AnimGraphActionTests.cpp
@@ -35,6 +37,8 @@ set(FILES
     Tests/AnimGraphNodeEventFilterTests.cpp
     Tests/AnimGraphNodeGroupTests.cpp
     Tests/AnimGraphNodeProcessingTests.cpp
+    Tests/AnimGraphPoseSharingBenchmarks.cpp
+    Tests/AnimGraphPoseSharingTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterConditionCommandTests.cpp
@@ -89,6 +93,7 @@ set(FILES
     Tests/MCoreSystemFixture.cpp
     Tests/MorphTargetRuntimeTests.cpp
     Tests/MorphSkinAttachmentTests.cpp
+    Tests/MotionDataBenchmarks.cpp
     Tests/MotionEventCommandTests.cpp
     Tests/MotionEventTrackTests.cpp
     Tests/MotionExtractionTests.cpp
@@ -98,6 +103,7 @@ set(FILES
     Tests/MultiThreadSchedulerTests.cpp
     Tests/PoseTests.cpp
     Tests/Printers.cpp
+    Tests/QuantizedMotionDataTests.cpp
     Tests/QuaternionParameterTests.cpp
     Tests/RagdollCommandTests.cpp
     Tests/RandomMotionSelectionTests.cpp
@@ -108,6 +114,9 @@ set(FILES
     Tests/SimulatedObjectSerializeTests.cpp
     Tests/SkeletalLODTests.cpp
     Tests/SkeletonNodeSearchTests.cpp
+    Tests/SoftSkinDeformerBenchmarks.cpp
+    Tests/SoftSkinDeformerFixture.h
+    Tests/SoftSkinDeformerTests.cpp
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
@@ -408,6 +408,118 @@ FN_DECIMAL FastNoise::GetNoise(FN_DECIMAL x, FN_DECIMAL y, FN_DECIMAL z) const
     }
 }
 
+template <typename SingleNoise>
+static void FillNoise(FN_DECIMAL frequency, const FN_DECIMAL* x, const FN_DECIMAL* y, const FN_DECIMAL* z, FN_DECIMAL* outNoise, size_t count, SingleNoise singleNoise)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        outNoise[i] = singleNoise(x[i] * frequency, y[i] * frequency, z[i] * frequency);
+    }
+}
+
+void FastNoise::GetNoise(const FN_DECIMAL* x, const FN_DECIMAL* y, const FN_DECIMAL* z, FN_DECIMAL* outNoise, size_t count) const
+{
+    // Same as the single position version, with the switch outside of the loop.
+    switch (m_noiseType)
+    {
+    case Value:
+        FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleValue(0, nx, ny, nz); });
+        return;
+    case ValueFractal:
+        switch (m_fractalType)
+        {
+        case FBM:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleValueFractalFBM(nx, ny, nz); });
+            return;
+        case Billow:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleValueFractalBillow(nx, ny, nz); });
+            return;
+        case RigidMulti:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleValueFractalRigidMulti(nx, ny, nz); });
+            return;
+        default:
+            break;
+        }
+        break;
+    case Perlin:
+        FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SinglePerlin(0, nx, ny, nz); });
+        return;
+    case PerlinFractal:
+        switch (m_fractalType)
+        {
+        case FBM:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SinglePerlinFractalFBM(nx, ny, nz); });
+            return;
+        case Billow:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SinglePerlinFractalBillow(nx, ny, nz); });
+            return;
+        case RigidMulti:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SinglePerlinFractalRigidMulti(nx, ny, nz); });
+            return;
+        default:
+            break;
+        }
+        break;
+    case Simplex:
+        FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleSimplex(0, nx, ny, nz); });
+        return;
+    case SimplexFractal:
+        switch (m_fractalType)
+        {
+        case FBM:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleSimplexFractalFBM(nx, ny, nz); });
+            return;
+        case Billow:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleSimplexFractalBillow(nx, ny, nz); });
+            return;
+        case RigidMulti:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleSimplexFractalRigidMulti(nx, ny, nz); });
+            return;
+        default:
+            break;
+        }
+        break;
+    case Cellular:
+        switch (m_cellularReturnType)
+        {
+        case CellValue:
+        case NoiseLookup:
+        case Distance:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleCellular(nx, ny, nz); });
+            return;
+        default:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleCellular2Edge(nx, ny, nz); });
+            return;
+        }
+    case WhiteNoise:
+        FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return GetWhiteNoise(nx, ny, nz); });
+        return;
+    case Cubic:
+        FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleCubic(0, nx, ny, nz); });
+        return;
+    case CubicFractal:
+        switch (m_fractalType)
+        {
+        case FBM:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleCubicFractalFBM(nx, ny, nz); });
+            return;
+        case Billow:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleCubicFractalBillow(nx, ny, nz); });
+            return;
+        case RigidMulti:
+            FillNoise(m_frequency, x, y, z, outNoise, count, [this](FN_DECIMAL nx, FN_DECIMAL ny, FN_DECIMAL nz) { return SingleCubicFractalRigidMulti(nx, ny, nz); });
+            return;
+        default:
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+
+    FillNoise(m_frequency, x, y, z, outNoise, count, [](FN_DECIMAL, FN_DECIMAL, FN_DECIMAL) { return FN_DECIMAL(0); });
+}
+
 FN_DECIMAL FastNoise::GetNoise(FN_DECIMAL x, FN_DECIMAL y) const
 {
     x *= m_frequency;
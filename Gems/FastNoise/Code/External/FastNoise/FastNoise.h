@@ -31,6 +31,8 @@
 #ifndef FASTNOISE_H
 #define FASTNOISE_H
 
+#include <stddef.h>
+
 // Uncomment the line below to use doubles throughout FastNoise instead of floats
 //#define FN_USE_DOUBLES
 
@@ -204,6 +206,10 @@ public:
 
 	FN_DECIMAL GetNoise(FN_DECIMAL x, FN_DECIMAL y, FN_DECIMAL z) const;
 
+	// Sets outNoise[i] to GetNoise(x[i], y[i], z[i]) for count positions. The noise and fractal type are only looked up once,
+	// so the noise function of the type can be inlined into the loop over the positions.
+	void GetNoise(const FN_DECIMAL* x, const FN_DECIMAL* y, const FN_DECIMAL* z, FN_DECIMAL* outNoise, size_t count) const;
+
 	void GradientPerturb(FN_DECIMAL& x, FN_DECIMAL& y, FN_DECIMAL& z) const;
 	void GradientPerturbFractal(FN_DECIMAL& x, FN_DECIMAL& y, FN_DECIMAL& z) const;
 
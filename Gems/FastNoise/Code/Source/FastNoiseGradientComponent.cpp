@@ -312,6 +312,37 @@ namespace FastNoiseGem
         return 0.0f;
     }
 
+    void FastNoiseGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions (%zu) and values (%zu) don't match.", positions.size(), outValues.size());
+
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = false;
+        GradientSignal::GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientSignal::GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+        // The generator samples the coordinates as separate arrays, so the noise type is only resolved once for all the points.
+        AZStd::vector<float> uvwCoordinates(positions.size() * 3);
+        float* xs = uvwCoordinates.data();
+        float* ys = xs + positions.size();
+        float* zs = ys + positions.size();
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            xs[index] = uvws[index].GetX();
+            ys[index] = uvws[index].GetY();
+            zs[index] = uvws[index].GetZ();
+        }
+
+        m_generator.GetNoise(xs, ys, zs, outValues.data(), positions.size());
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            // Generator returns a range between [-1, 1], map that to [0, 1]
+            outValues[index] = wasPointRejected[index] ? 0.0f : AZ::GetClamp((outValues[index] + 1.0f) / 2.0f, 0.0f, 1.0f);
+        }
+    }
+
     template <typename TValueType, TValueType FastNoiseGradientConfig::*TConfigMember, void (FastNoise::*TMethod)(TValueType)>
     void FastNoiseGradientComponent::SetConfigValue(TValueType value)
     {
@@ -262,6 +262,50 @@ TEST_F(FastNoiseTestApp, FastNoise_ComponentMatchesConfiguration)
     reinterpret_cast<FastNoiseGradientComponentTester*>(noiseComp)->AssertTrue(cfg);
 }
 
+TEST(FastNoiseTest, FastNoise_BulkNoiseMatchesSingleNoise)
+{
+    constexpr size_t pointCount = 64;
+    AZStd::vector<float> xs(pointCount);
+    AZStd::vector<float> ys(pointCount);
+    AZStd::vector<float> zs(pointCount);
+    for (size_t index = 0; index < pointCount; ++index)
+    {
+        xs[index] = index * 0.37f;
+        ys[index] = index * -1.13f;
+        zs[index] = 5.0f - index * 0.71f;
+    }
+
+    FastNoise generator;
+    generator.SetFrequency(0.5f);
+
+    auto expectMatchingNoise = [&]()
+    {
+        AZStd::vector<float> noise(pointCount);
+        generator.GetNoise(xs.data(), ys.data(), zs.data(), noise.data(), pointCount);
+        for (size_t index = 0; index < pointCount; ++index)
+        {
+            EXPECT_FLOAT_EQ(noise[index], generator.GetNoise(xs[index], ys[index], zs[index]));
+        }
+    };
+
+    for (int noiseType = FastNoise::Value; noiseType <= FastNoise::CubicFractal; ++noiseType)
+    {
+        generator.SetNoiseType(static_cast<FastNoise::NoiseType>(noiseType));
+        for (int fractalType = FastNoise::FBM; fractalType <= FastNoise::RigidMulti; ++fractalType)
+        {
+            generator.SetFractalType(static_cast<FastNoise::FractalType>(fractalType));
+            expectMatchingNoise();
+        }
+    }
+
+    generator.SetNoiseType(FastNoise::Cellular);
+    for (int returnType = FastNoise::CellValue; returnType <= FastNoise::Distance2Div; ++returnType)
+    {
+        generator.SetCellularReturnType(static_cast<FastNoise::CellularReturnType>(returnType));
+        expectMatchingNoise();
+    }
+}
+
 #if FASTNOISE_EDITOR
 #include <EditorFastNoiseGradientComponent.h>
 
@@ -34,6 +34,9 @@ namespace GradientSignal
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
 
+        //! Samples the gradient at every position with a single bus call. outValues must have the same size as positions.
+        inline void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         AZ::EntityId m_gradientId;
@@ -147,4 +150,71 @@ namespace GradientSignal
 
         return output * m_opacity;
     }
+
+    inline void GradientSampler::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions (%zu) and values (%zu) don't match.", positions.size(), outValues.size());
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        //apply transform if set
+        AZStd::vector<AZ::Vector3> transformedPositions;
+        const bool useTransform = m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this);
+        if (useTransform)
+        {
+            AZ::Matrix3x4 matrix3x4;
+            matrix3x4.SetFromEulerDegrees(m_rotate);
+            matrix3x4.MultiplyByScale(m_scale);
+            matrix3x4.SetTranslation(m_translate);
+
+            transformedPositions.resize_no_construct(positions.size());
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                transformedPositions[index] = matrix3x4 * positions[index];
+            }
+        }
+
+        {
+            // See GetValue for why the surface data mutex is locked before checking for cyclic dependencies.
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+            if (m_isRequestInProgress)
+            {
+                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+                AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+                return;
+            }
+
+            m_isRequestInProgress = true;
+
+            // Values of positions that no gradient handles stay at 0, like in GetValue.
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues, useTransform ? transformedPositions : positions, outValues);
+
+            m_isRequestInProgress = false;
+        }
+
+        const bool useLevels = m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this);
+        for (float& output : outValues)
+        {
+            if (m_invertInput)
+            {
+                output = 1.0f - output;
+            }
+
+            //apply levels if set
+            if (useLevels)
+            {
+                output = GetLevels(output, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+            }
+
+            output *= m_opacity;
+        }
+    }
 }
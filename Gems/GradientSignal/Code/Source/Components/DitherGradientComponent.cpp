@@ -260,6 +260,49 @@ namespace GradientSignal
         return value > d ? 1.0f : 0.0f;
     }
 
+    void DitherGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        float pointsPerUnit = m_configuration.m_pointsPerUnit;
+        if (m_configuration.m_useSystemPointsPerUnit)
+        {
+            SectorDataRequestBus::Broadcast(&SectorDataRequestBus::Events::GetPointsPerMeter, pointsPerUnit);
+        }
+        pointsPerUnit = AZ::GetMax(pointsPerUnit, 0.0001f);
+
+        // Sample the input gradient at the floored positions of all the points at once.
+        AZStd::vector<AZ::Vector3> flooredPositions;
+        flooredPositions.resize_no_construct(positions.size());
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const AZ::Vector3 scaledCoordinate = positions[index] * pointsPerUnit;
+            flooredPositions[index] = AZ::Vector3(
+                std::floor(scaledCoordinate.GetX()) / pointsPerUnit,
+                std::floor(scaledCoordinate.GetY()) / pointsPerUnit,
+                std::floor(scaledCoordinate.GetZ()) / pointsPerUnit);
+        }
+        m_configuration.m_gradientSampler.GetValues(flooredPositions, outValues);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const AZ::Vector3 patternPosition = positions[index] * pointsPerUnit + m_configuration.m_patternOffset;
+            float d = 0.0f;
+            switch (m_configuration.m_patternType)
+            {
+            default:
+            case DitherGradientConfig::BayerPatternType::PATTERN_SIZE_4x4:
+                d = GetDitherValue4x4(patternPosition);
+                break;
+            case DitherGradientConfig::BayerPatternType::PATTERN_SIZE_8x8:
+                d = GetDitherValue8x8(patternPosition);
+                break;
+            }
+
+            outValues[index] = outValues[index] > d ? 1.0f : 0.0f;
+        }
+    }
+
     bool DitherGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -277,6 +277,68 @@ namespace GradientSignal
         }
     }
 
+    void GradientSurfaceDataComponent::ModifySurfacePointBuffer(SurfaceData::SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (!m_configuration.m_modifierTags.empty())
+        {
+            // Grab a copy of the optional constraining shape bounds, like ModifySurfacePoints.
+            bool validShapeBounds = false;
+            AZ::Aabb shapeConstraintBounds;
+            if (m_validShapeBounds)
+            {
+                AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+                shapeConstraintBounds = m_cachedShapeConstraintBounds;
+                validShapeBounds = m_cachedShapeConstraintBounds.IsValid();
+            }
+
+            // Gather the points that are within our allowed shape bounds, so that the gradient is sampled for all of them in one call.
+            const AZ::EntityId entityId = GetEntityId();
+            AZStd::vector<size_t> modifiedPointIndices;
+            AZStd::vector<AZ::Vector3> positions;
+            modifiedPointIndices.reserve(pointIndices.size());
+            positions.reserve(pointIndices.size());
+            for (size_t pointIndex : pointIndices)
+            {
+                if (surfacePoints.GetEntityId(pointIndex) != entityId)
+                {
+                    const AZ::Vector3& position = surfacePoints.GetPosition(pointIndex);
+                    bool inBounds = true;
+                    if (validShapeBounds)
+                    {
+                        inBounds = false;
+                        if (shapeConstraintBounds.Contains(position))
+                        {
+                            LmbrCentral::ShapeComponentRequestsBus::EventResult(inBounds, m_configuration.m_shapeConstraintEntityId,
+                                                                                &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, position);
+                        }
+                    }
+
+                    if (inBounds)
+                    {
+                        modifiedPointIndices.push_back(pointIndex);
+                        positions.push_back(position);
+                    }
+                }
+            }
+
+            AZStd::vector<float> values(positions.size());
+            m_gradientSampler.GetValues(positions, values);
+
+            // If a value meets the gradient thresholds, add it to the surface tags of its point.
+            for (size_t index = 0; index < values.size(); ++index)
+            {
+                const float value = values[index];
+                if (value >= m_configuration.m_thresholdMin &&
+                    value <= m_configuration.m_thresholdMax)
+                {
+                    surfacePoints.AddMaxValueForTags(modifiedPointIndices[index], m_configuration.m_modifierTags, value);
+                }
+            }
+        }
+    }
+
     void GradientSurfaceDataComponent::OnCompositionChanged()
     {
         AZ_PROFILE_FUNCTION(Entity);
@@ -76,6 +76,7 @@ namespace GradientSignal
         ////////////////////////////////////////////////////////////////////////
         // SurfaceData::SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointBuffer(SurfaceData::SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // LmbrCentral::DependencyNotificationBus
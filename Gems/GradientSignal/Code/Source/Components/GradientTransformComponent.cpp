@@ -327,7 +327,26 @@ namespace GradientSignal
         AZ_PROFILE_FUNCTION(Entity);
 
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+        TransformPositionToUVWInternal(inPosition, outUVW, shouldNormalizeOutput, wasPointRejected);
+    }
+
+    void GradientTransformComponent::TransformPositionsToUVW(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outUVWs, const bool shouldNormalizeOutput, AZStd::vector<bool>& wasPointRejected) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(inPositions.size() == outUVWs.size() && inPositions.size() == wasPointRejected.size(), "The sizes of the position lists don't match.");
+
+        // Only lock once for the whole list, the cached shape data can't change while it's transformed.
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+        for (size_t index = 0; index < inPositions.size(); ++index)
+        {
+            bool wasRejected = false;
+            TransformPositionToUVWInternal(inPositions[index], outUVWs[index], shouldNormalizeOutput, wasRejected);
+            wasPointRejected[index] = wasRejected;
+        }
+    }
 
+    void GradientTransformComponent::TransformPositionToUVWInternal(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const
+    {
         //transforming coordinate into "local" relative space of shape bounds
         outUVW = m_shapeTransformInverse * inPosition;
 
@@ -374,6 +374,84 @@ namespace GradientSignal
         return AZ::GetClamp(result, 0.0f, 1.0f);
     }
 
+    void MixedGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions (%zu) and values (%zu) don't match.", positions.size(), outValues.size());
+
+        //accumulate the mixed/combined result of all layers and operations in the output values, one layer at a time
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        AZStd::vector<float> layerValues(positions.size());
+
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
+            if (!layer.m_enabled || layer.m_gradientSampler.m_opacity == 0.0f)
+            {
+                continue;
+            }
+
+            // this includes leveling and opacity result, we need unpremultiplied opacity to combine properly
+            layer.m_gradientSampler.GetValues(positions, layerValues);
+
+            // The operation is selected once per layer so the loop over the points has no branches.
+            const float opacity = layer.m_gradientSampler.m_opacity;
+            const auto blendLayer = [&outValues, &layerValues, opacity](auto operation)
+            {
+                for (size_t index = 0; index < outValues.size(); ++index)
+                {
+                    const float result = outValues[index];
+                    // unpremultiplied alpha (we clamp the end result)
+                    const float operationResult = operation(result, layerValues[index] / opacity);
+                    // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
+                    outValues[index] = (result * (1.0f - opacity)) + (operationResult * opacity);
+                }
+            };
+
+            switch (layer.m_operation)
+            {
+            default:
+            case MixedGradientLayer::MixingOperation::Initialize:
+                //reset the result of the mixed/combined layers to the current value
+                AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+                blendLayer([](float, float current) { return current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Multiply:
+                blendLayer([](float result, float current) { return result * current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Add:
+                blendLayer([](float result, float current) { return result + current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Subtract:
+                blendLayer([](float result, float current) { return result - current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Min:
+                blendLayer([](float result, float current) { return AZStd::min(current, result); });
+                break;
+            case MixedGradientLayer::MixingOperation::Max:
+                blendLayer([](float result, float current) { return AZStd::max(current, result); });
+                break;
+            case MixedGradientLayer::MixingOperation::Average:
+                blendLayer([](float result, float current) { return (result + current) / 2.0f; });
+                break;
+            case MixedGradientLayer::MixingOperation::Normal:
+                blendLayer([](float, float current) { return current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Overlay:
+                blendLayer([](float result, float current)
+                    {
+                        return (result >= 0.5f) ? (1.0f - (2.0f * (1.0f - result) * (1.0f - current))) : (2.0f * result * current);
+                    });
+                break;
+            }
+        }
+
+        for (float& output : outValues)
+        {
+            output = AZ::GetClamp(output, 0.0f, 1.0f);
+        }
+    }
+
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         for (const auto& layer : m_configuration.m_layers)
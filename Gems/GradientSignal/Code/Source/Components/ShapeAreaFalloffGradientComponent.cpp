@@ -162,6 +162,29 @@ namespace GradientSignal
         float distance = 0.0f;
         LmbrCentral::ShapeComponentRequestsBus::EventResult(distance, m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceFromPoint, sampleParams.m_position);
 
+        return GetFalloffValue(distance);
+    }
+
+    void ShapeAreaFalloffGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions (%zu) and values (%zu) don't match.", positions.size(), outValues.size());
+
+        // Points are at 0 distance when there's no shape, like in GetValue.
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        // Query the distances of all the points with a single bulk shape query and store them in the output values.
+        LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId,
+            &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceFromPointList, positions, outValues);
+
+        for (float& output : outValues)
+        {
+            output = GetFalloffValue(output);
+        }
+    }
+
+    float ShapeAreaFalloffGradientComponent::GetFalloffValue(float distance) const
+    {
         // In the special case of 0 falloff, make sure that all points inside the shape (0 distance) return 
         // 1.0, and all points outside the shape return 0.
         if (m_configuration.m_falloffWidth == 0.0f)
@@ -69,6 +69,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -83,6 +84,9 @@ namespace GradientSignal
         void SetFalloffType(FalloffType type) override;
 
     private:
+        //! Converts the distance of a point from the shape to the falloff value.
+        float GetFalloffValue(float distance) const;
+
         ShapeAreaFalloffGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
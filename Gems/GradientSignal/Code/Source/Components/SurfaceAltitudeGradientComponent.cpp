@@ -217,6 +217,32 @@ namespace GradientSignal
         return GetRatio(m_configuration.m_altitudeMin, m_configuration.m_altitudeMax, position.GetZ());
     }
 
+    void SurfaceAltitudeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions (%zu) and values (%zu) don't match.", positions.size(), outValues.size());
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        // Query the surface points of all the positions with a single bus call, reusing one point list.
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            [this, &positions, &outValues](SurfaceData::SurfaceDataSystemRequestBus::Events* surfaceDataSystem)
+            {
+                SurfaceData::SurfacePointList points;
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    points.clear();
+                    surfaceDataSystem->GetSurfacePoints(positions[index], m_configuration.m_surfaceTagsToSample, points);
+                    if (!points.empty())
+                    {
+                        const AZ::Vector3& position = points.front().m_position;
+                        outValues[index] = GetRatio(m_configuration.m_altitudeMin, m_configuration.m_altitudeMax, position.GetZ());
+                    }
+                }
+            });
+    }
+
     void SurfaceAltitudeGradientComponent::OnCompositionChanged()
     {
         m_dirty = true;
@@ -214,10 +214,38 @@ namespace GradientSignal
             return 0.0f;
         }
 
+        return GetSlopeValue(points.front().m_normal);
+    }
+
+    void SurfaceSlopeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions (%zu) and values (%zu) don't match.", positions.size(), outValues.size());
+
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        // Query the surface points of all the positions with a single bus call, reusing one point list.
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            [this, &positions, &outValues](SurfaceData::SurfaceDataSystemRequestBus::Events* surfaceDataSystem)
+            {
+                SurfaceData::SurfacePointList points;
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    points.clear();
+                    surfaceDataSystem->GetSurfacePoints(positions[index], m_configuration.m_surfaceTagsToSample, points);
+                    if (!points.empty())
+                    {
+                        outValues[index] = GetSlopeValue(points.front().m_normal);
+                    }
+                }
+            });
+    }
+
+    float SurfaceSlopeGradientComponent::GetSlopeValue(const AZ::Vector3& normal) const
+    {
         // Assuming our surface normal vector is actually normalized, we can get the slope
         // by just grabbing the Z value.  It's the same thing as normal.Dot(AZ::Vector3::CreateAxisZ()).
-        AZ_Assert(points.front().m_normal.GetNormalized().IsClose(points.front().m_normal), "Surface normals are expected to be normalized");
-        const float slope = points.front().m_normal.GetZ();
+        AZ_Assert(normal.GetNormalized().IsClose(normal), "Surface normals are expected to be normalized");
+        const float slope = normal.GetZ();
         // Convert slope back to an angle so that we can lerp in "angular space", not "slope value space".
         // (We want our 0-1 range to be linear across the range of angles)
         const float slopeAngle = acosf(slope);
@@ -91,6 +91,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -121,6 +122,9 @@ namespace GradientSignal
         void SetFallOffMidpoint(float midpoint) override;
 
     private:
+        //! Converts the normal of a surface point to the gradient value of its slope.
+        float GetSlopeValue(const AZ::Vector3& normal) const;
+
         SurfaceSlopeGradientConfig m_configuration;
     };
 }
@@ -9,6 +9,8 @@
 
 #include <GradientSignal/PerlinImprovedNoise.h>
 
+#include <AzCore/Math/SimdMath.h>
+
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
 
@@ -60,6 +62,100 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // SIMD versions of the functions above, which evaluate four positions at a time.
+        // They are written to produce the same values as the scalar versions.
+        using Vec4 = AZ::Simd::Vec4;
+
+        AZ_FORCE_INLINE Vec4::FloatType Gradient(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            // Branchless form of the switch above: u is x for hashes below 8 and y otherwise, v is y for hashes below 4,
+            // x for 12 and 14 and z otherwise, and the two lowest bits of the hash negate u and v.
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType hLessThan8 = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(8)));
+            const Vec4::FloatType hLessThan4 = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(4)));
+            const Vec4::FloatType hIs12Or14 = Vec4::CastToFloat(Vec4::CmpEq(Vec4::Or(h, Vec4::Splat(2)), Vec4::Splat(14)));
+
+            const Vec4::FloatType u = Vec4::Select(x, y, hLessThan8);
+            const Vec4::FloatType v = Vec4::Select(y, Vec4::Select(x, z, hIs12Or14), hLessThan4);
+
+            const Vec4::Int32Type signBit = Vec4::Splat(static_cast<int32_t>(0x80000000));
+            const Vec4::Int32Type one = Vec4::Splat(1);
+            const Vec4::Int32Type two = Vec4::Splat(2);
+            const Vec4::FloatType uSign = Vec4::CastToFloat(Vec4::And(Vec4::CmpEq(Vec4::And(h, one), one), signBit));
+            const Vec4::FloatType vSign = Vec4::CastToFloat(Vec4::And(Vec4::CmpEq(Vec4::And(h, two), two), signBit));
+
+            return Vec4::Add(Vec4::Xor(u, uSign), Vec4::Xor(v, vSign));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType t3 = Vec4::Mul(Vec4::Mul(t, t), t);
+            const Vec4::FloatType t6Minus15 = Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f));
+            return Vec4::Mul(t3, Vec4::Add(Vec4::Mul(t, t6Minus15), Vec4::Splat(10.0f)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
+
+        Vec4::FloatType GenerateNoise(const AZStd::array<int, 512>& p, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::FloatType floorX = Vec4::Floor(x);
+            const Vec4::FloatType floorY = Vec4::Floor(y);
+            const Vec4::FloatType floorZ = Vec4::Floor(z);
+            const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+            const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+            const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+
+            const Vec4::Int32Type mask = Vec4::Splat(255);
+            alignas(16) int32_t xi0[4];
+            alignas(16) int32_t yi0[4];
+            alignas(16) int32_t zi0[4];
+            Vec4::StoreAligned(xi0, Vec4::And(Vec4::ConvertToInt(floorX), mask));
+            Vec4::StoreAligned(yi0, Vec4::And(Vec4::ConvertToInt(floorY), mask));
+            Vec4::StoreAligned(zi0, Vec4::And(Vec4::ConvertToInt(floorZ), mask));
+
+            // There is no gather instruction on every platform, so the hashes of the unit cube corners are looked up
+            // in the permutation table one lane at a time.
+            alignas(16) int32_t hashes[8][4];
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const int a = p[xi0[lane]] + yi0[lane];
+                const int b = p[xi0[lane] + 1] + yi0[lane];
+                const int aa = p[a] + zi0[lane];
+                const int ab = p[a + 1] + zi0[lane];
+                const int ba = p[b] + zi0[lane];
+                const int bb = p[b + 1] + zi0[lane];
+                hashes[0][lane] = p[aa];     // aaa
+                hashes[1][lane] = p[ab];     // aba
+                hashes[2][lane] = p[aa + 1]; // aab
+                hashes[3][lane] = p[ab + 1]; // abb
+                hashes[4][lane] = p[ba];     // baa
+                hashes[5][lane] = p[bb];     // bba
+                hashes[6][lane] = p[ba + 1]; // bab
+                hashes[7][lane] = p[bb + 1]; // bbb
+            }
+
+            const Vec4::FloatType u = Fade(xf);
+            const Vec4::FloatType v = Fade(yf);
+            const Vec4::FloatType w = Fade(zf);
+
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+            const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+            const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+            Vec4::FloatType x1 = Lerp(Gradient(Vec4::LoadAligned(hashes[0]), xf, yf, zf), Gradient(Vec4::LoadAligned(hashes[4]), xf1, yf, zf), u);
+            Vec4::FloatType x2 = Lerp(Gradient(Vec4::LoadAligned(hashes[1]), xf, yf1, zf), Gradient(Vec4::LoadAligned(hashes[5]), xf1, yf1, zf), u);
+            const Vec4::FloatType y1 = Lerp(x1, x2, v);
+            x1 = Lerp(Gradient(Vec4::LoadAligned(hashes[2]), xf, yf, zf1), Gradient(Vec4::LoadAligned(hashes[6]), xf1, yf, zf1), u);
+            x2 = Lerp(Gradient(Vec4::LoadAligned(hashes[3]), xf, yf1, zf1), Gradient(Vec4::LoadAligned(hashes[7]), xf1, yf1, zf1), u);
+            const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+            return Vec4::Mul(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(0.5f));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -87,6 +183,65 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues,
+        int octaves, float persistence, float initialFrequency) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions (%zu) and values (%zu) don't match.", positions.size(), outValues.size());
+
+        float maxValue = 0.0f;
+        float amplitude = 1.0f;
+        for (int i = 0; i < octaves; ++i)
+        {
+            maxValue += amplitude;
+            amplitude *= persistence;
+        }
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+        const Vec4::FloatType maxValues = Vec4::Splat(maxValue);
+
+        for (size_t index = 0; index < positions.size(); index += 4)
+        {
+            // The last batch repeats its last position in the unused lanes.
+            const size_t count = AZStd::min<size_t>(positions.size() - index, 4);
+            const AZ::Vector3& p0 = positions[index];
+            const AZ::Vector3& p1 = positions[index + AZStd::min<size_t>(1, count - 1)];
+            const AZ::Vector3& p2 = positions[index + AZStd::min<size_t>(2, count - 1)];
+            const AZ::Vector3& p3 = positions[index + AZStd::min<size_t>(3, count - 1)];
+            const Vec4::FloatType x = Vec4::LoadImmediate(p0.GetX(), p1.GetX(), p2.GetX(), p3.GetX());
+            const Vec4::FloatType y = Vec4::LoadImmediate(p0.GetY(), p1.GetY(), p2.GetY(), p3.GetY());
+            const Vec4::FloatType z = Vec4::LoadImmediate(p0.GetZ(), p1.GetZ(), p2.GetZ(), p3.GetZ());
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequencies = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = PerlinImprovedNoiseDetails::GenerateNoise(
+                    m_permutationTable, Vec4::Mul(x, frequencies), Vec4::Mul(y, frequencies), Vec4::Mul(z, frequencies));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            const Vec4::FloatType values = Vec4::Div(total, maxValues);
+            if (count == 4)
+            {
+                Vec4::StoreUnaligned(&outValues[index], values);
+            }
+            else
+            {
+                alignas(16) float lastValues[4];
+                Vec4::StoreAligned(lastValues, values);
+                AZStd::copy(lastValues, lastValues + count, outValues.begin() + index);
+            }
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include "Tests/GradientSignalTestMocks.h"
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <GradientSignal/PerlinImprovedNoise.h>
+
+#include <Source/Components/GradientTransformComponent.h>
+#include <Source/Components/LevelsGradientComponent.h>
+#include <Source/Components/MixedGradientComponent.h>
+#include <Source/Components/PerlinGradientComponent.h>
+#include <Source/Components/ShapeAreaFalloffGradientComponent.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    /*
+     * Samples a 256x256 grid of points from a typical vegetation gradient graph: a Mixed gradient that multiplies a
+     * Levels gradient of Perlin noise by a ShapeAreaFalloff gradient. The per point benchmark calls GetValue for every
+     * point, like the gradient consumers did before GetValues, and the bulk benchmark evaluates the whole grid with one
+     * GetValues call. The reported items are points.
+     */
+    class GradientGetValuesBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr int GridSize = 256;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+
+        void internalSetUp()
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 128 * 1024 * 1024;
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            AZ::Entity* systemEntity = m_app->Create(appDesc);
+            m_app->AddEntity(systemEntity);
+
+            const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(static_cast<float>(GridSize)));
+
+            // The Perlin noise and the shape that bounds the gradient graph.
+            AZ::Entity* noiseEntity = CreateEntity();
+            GradientSignal::PerlinGradientConfig perlinConfig;
+            perlinConfig.m_octave = 4;
+            CreateComponent<GradientSignal::PerlinGradientComponent>(noiseEntity, perlinConfig);
+            CreateComponent<GradientSignal::GradientTransformComponent>(noiseEntity, GradientSignal::GradientTransformConfig());
+            CreateComponent<MockShapeComponent>(noiseEntity);
+            m_shapeHandler = AZStd::make_unique<MockShapeComponentHandler>(noiseEntity->GetId());
+            m_shapeHandler->m_GetLocalBounds = bounds;
+            m_shapeHandler->m_GetEncompassingAabb = bounds;
+            ActivateEntity(noiseEntity);
+
+            AZ::Entity* levelsEntity = CreateEntity();
+            GradientSignal::LevelsGradientConfig levelsConfig;
+            levelsConfig.m_gradientSampler.m_gradientId = noiseEntity->GetId();
+            levelsConfig.m_inputMin = 0.2f;
+            levelsConfig.m_inputMax = 0.8f;
+            CreateComponent<GradientSignal::LevelsGradientComponent>(levelsEntity, levelsConfig);
+            ActivateEntity(levelsEntity);
+
+            AZ::Entity* falloffEntity = CreateEntity();
+            GradientSignal::ShapeAreaFalloffGradientConfig falloffConfig;
+            falloffConfig.m_shapeEntityId = noiseEntity->GetId();
+            falloffConfig.m_falloffWidth = 16.0f;
+            CreateComponent<GradientSignal::ShapeAreaFalloffGradientComponent>(falloffEntity, falloffConfig);
+            ActivateEntity(falloffEntity);
+
+            AZ::Entity* mixedEntity = CreateEntity();
+            GradientSignal::MixedGradientConfig mixedConfig;
+            GradientSignal::MixedGradientLayer layer;
+            layer.m_operation = GradientSignal::MixedGradientLayer::MixingOperation::Initialize;
+            layer.m_gradientSampler.m_gradientId = levelsEntity->GetId();
+            mixedConfig.m_layers.push_back(layer);
+            layer.m_operation = GradientSignal::MixedGradientLayer::MixingOperation::Multiply;
+            layer.m_gradientSampler.m_gradientId = falloffEntity->GetId();
+            mixedConfig.m_layers.push_back(layer);
+            CreateComponent<GradientSignal::MixedGradientComponent>(mixedEntity, mixedConfig);
+            ActivateEntity(mixedEntity);
+
+            m_sampler.m_gradientId = mixedEntity->GetId();
+
+            // Sample outside of the shape as well, so the falloff isn't constant.
+            m_positions.reserve(GridSize * GridSize);
+            for (int y = 0; y < GridSize; ++y)
+            {
+                for (int x = 0; x < GridSize; ++x)
+                {
+                    m_positions.emplace_back(static_cast<float>(x) * 1.25f - 32.0f, static_cast<float>(y) * 1.25f - 32.0f, 0.0f);
+                }
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_positions = {};
+            m_sampler.m_gradientId = AZ::EntityId();
+            m_entities.clear();
+            m_shapeHandler.reset();
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        AZ::Entity* CreateEntity()
+        {
+            return m_entities.emplace_back(AZStd::make_unique<AZ::Entity>()).get();
+        }
+
+        void ActivateEntity(AZ::Entity* entity)
+        {
+            entity->Init();
+            entity->Activate();
+        }
+
+        template <typename Component, typename Configuration>
+        void CreateComponent(AZ::Entity* entity, const Configuration& config)
+        {
+            m_app->RegisterComponentDescriptor(Component::CreateDescriptor());
+            entity->CreateComponent<Component>(config);
+        }
+
+        template <typename Component>
+        void CreateComponent(AZ::Entity* entity)
+        {
+            m_app->RegisterComponentDescriptor(Component::CreateDescriptor());
+            entity->CreateComponent<Component>();
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        AZStd::unique_ptr<MockShapeComponentHandler> m_shapeHandler;
+        GradientSignal::GradientSampler m_sampler;
+        AZStd::vector<AZ::Vector3> m_positions;
+    };
+
+    BENCHMARK_DEFINE_F(GradientGetValuesBenchmarkFixture, GetValuePerPoint)(benchmark::State& state)
+    {
+        AZStd::vector<float> values(m_positions.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GradientSignal::GradientSampleParams sampleParams;
+            for (size_t index = 0; index < m_positions.size(); ++index)
+            {
+                sampleParams.m_position = m_positions[index];
+                values[index] = m_sampler.GetValue(sampleParams);
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(GradientGetValuesBenchmarkFixture, GetValuesBulk)(benchmark::State& state)
+    {
+        AZStd::vector<float> values(m_positions.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sampler.GetValues(m_positions, values);
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_REGISTER_F(GradientGetValuesBenchmarkFixture, GetValuePerPoint)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(GradientGetValuesBenchmarkFixture, GetValuesBulk)->Unit(benchmark::kMillisecond);
+
+    /*
+     * Generates 4 octaves of Perlin noise for a 256x256 grid of points, one point at a time with the scalar version of
+     * GenerateOctaveNoise and four points at a time with the SIMD bulk version. The reported items are points.
+     */
+    class PerlinNoiseBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int GridSize = 256;
+        static constexpr int Octaves = 4;
+        static constexpr float Persistence = 0.5f;
+        static constexpr float Frequency = 0.05f;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void internalSetUp()
+        {
+            m_perlinNoise = AZStd::make_unique<GradientSignal::PerlinImprovedNoise>(1);
+            m_positions.reserve(GridSize * GridSize);
+            for (int y = 0; y < GridSize; ++y)
+            {
+                for (int x = 0; x < GridSize; ++x)
+                {
+                    m_positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+                }
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_positions = {};
+            m_perlinNoise.reset();
+        }
+
+        AZStd::unique_ptr<GradientSignal::PerlinImprovedNoise> m_perlinNoise;
+        AZStd::vector<AZ::Vector3> m_positions;
+    };
+
+    BENCHMARK_DEFINE_F(PerlinNoiseBenchmarkFixture, OctaveNoisePerPoint)(benchmark::State& state)
+    {
+        AZStd::vector<float> values(m_positions.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_positions.size(); ++index)
+            {
+                const AZ::Vector3& position = m_positions[index];
+                values[index] = m_perlinNoise->GenerateOctaveNoise(position.GetX(), position.GetY(), position.GetZ(), Octaves, Persistence, Frequency);
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(PerlinNoiseBenchmarkFixture, OctaveNoiseBulk)(benchmark::State& state)
+    {
+        AZStd::vector<float> values(m_positions.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_perlinNoise->GenerateOctaveNoise(m_positions, values, Octaves, Persistence, Frequency);
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_REGISTER_F(PerlinNoiseBenchmarkFixture, OctaveNoisePerPoint)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(PerlinNoiseBenchmarkFixture, OctaveNoiseBulk)->Unit(benchmark::kMillisecond);
+} // namespace UnitTest
+
+#endif
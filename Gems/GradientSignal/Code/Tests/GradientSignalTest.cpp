@@ -184,6 +184,31 @@ namespace UnitTest
         TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, PerlinImprovedNoise_BulkMatchesSinglePosition)
+    {
+        // Make sure the SIMD bulk version of GenerateOctaveNoise returns the same values as the single position
+        // version, including positions with negative coordinates and a point count that isn't a multiple of four.
+
+        GradientSignal::PerlinImprovedNoise perlinNoise(7878);
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (int index = 0; index < 103; ++index)
+        {
+            const float offset = static_cast<float>(index) * 0.37f;
+            positions.emplace_back(offset - 17.0f, 5.5f - offset * 1.3f, offset * 0.25f);
+        }
+
+        AZStd::vector<float> values(positions.size());
+        perlinNoise.GenerateOctaveNoise(positions, values, 4, 3.0f, 1.13f);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const AZ::Vector3& position = positions[index];
+            const float expectedValue = perlinNoise.GenerateOctaveNoise(position.GetX(), position.GetY(), position.GetZ(), 4, 3.0f, 1.13f);
+            EXPECT_NEAR(expectedValue, values[index], 1.0e-6f);
+        }
+    }
+
     TEST_F(GradientSignalTestGeneratorFixture, RandomGradientComponent_GoldenTest)
     {
         // Make sure RandomGradientComponent returns back a "golden" set
@@ -20,6 +20,7 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <Shape/ShapeBulkQueryUtil.h>
 #include <Shape/ShapeDisplay.h>
 #include <random>
 
@@ -147,6 +148,70 @@ namespace LmbrCentral
         return m_intersectionDataCache.m_obb.GetDistanceSq(point);
     }
 
+    void BoxShape::IsPointInsideList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outInside)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+        outInside.resize(points.size());
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Vector3 boxMin = m_intersectionDataCache.m_aabb.GetMin();
+            const AZ::Vector3 boxMax = m_intersectionDataCache.m_aabb.GetMax();
+            ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+            {
+                StoreMask(ContainsAabb(batch, boxMin, boxMax), count, outInside.data() + index);
+            });
+            return;
+        }
+
+        // Rotate the points into the space of the obb, where it's an aabb centered on the origin.
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        const AZ::Vector3 axisX = obb.GetAxisX();
+        const AZ::Vector3 axisY = obb.GetAxisY();
+        const AZ::Vector3 axisZ = obb.GetAxisZ();
+        const AZ::Vector3 halfLengths = obb.GetHalfLengths();
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            const Points4 offsets = Sub(batch, obb.GetPosition());
+            const Points4 localPoints{ Dot(offsets, axisX), Dot(offsets, axisY), Dot(offsets, axisZ) };
+            StoreMask(ContainsAabb(localPoints, -halfLengths, halfLengths), count, outInside.data() + index);
+        });
+    }
+
+    void BoxShape::DistanceSquaredFromPointList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+        outDistancesSquared.resize(points.size());
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Vector3 boxMin = m_intersectionDataCache.m_aabb.GetMin();
+            const AZ::Vector3 boxMax = m_intersectionDataCache.m_aabb.GetMax();
+            ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+            {
+                StoreValues(DistanceSqAabb(batch, boxMin, boxMax), count, outDistancesSquared.data() + index);
+            });
+            return;
+        }
+
+        // Rotate the points into the space of the obb, where it's an aabb centered on the origin.
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        const AZ::Vector3 axisX = obb.GetAxisX();
+        const AZ::Vector3 axisY = obb.GetAxisY();
+        const AZ::Vector3 axisZ = obb.GetAxisZ();
+        const AZ::Vector3 halfLengths = obb.GetHalfLengths();
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            const Points4 offsets = Sub(batch, obb.GetPosition());
+            const Points4 localPoints{ Dot(offsets, axisX), Dot(offsets, axisY), Dot(offsets, axisZ) };
+            StoreValues(DistanceSqAabb(localPoints, -halfLengths, halfLengths), count, outDistancesSquared.data() + index);
+        });
+    }
+
     bool BoxShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
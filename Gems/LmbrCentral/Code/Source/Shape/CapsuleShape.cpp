@@ -15,6 +15,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <CryCommon/Cry_GeoDistance.h>
 #include <MathConversion.h>
+#include <Shape/ShapeBulkQueryUtil.h>
 
 namespace LmbrCentral
 {
@@ -175,6 +176,81 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void CapsuleShape::IsPointInsideList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outInside)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+        outInside.resize(points.size());
+
+        // Same tests as IsPointInside: the bottom sphere, the top sphere, and the cylinder between them, which is
+        // skipped if the capsule is just a sphere or if the cylinder has no volume.
+        const AZ::Vector3 basePlaneCenterPoint = m_intersectionDataCache.m_basePlaneCenterPoint;
+        const AZ::Vector3 topPlaneCenterPoint = m_intersectionDataCache.m_topPlaneCenterPoint;
+        const AZ::Vector3 axisVector = m_intersectionDataCache.m_axisVector;
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        const float axisLengthSquared = powf(m_intersectionDataCache.m_internalHeight, 2.0f);
+        const bool testSphereOnly = m_intersectionDataCache.m_isSphere;
+        const bool testCylinder = !testSphereOnly && axisLengthSquared > 0.0f && radiusSquared > 0.0f;
+
+        const Vec4::FloatType radiiSquared = Vec4::Splat(radiusSquared);
+        const Vec4::FloatType axisLengthsSquared = Vec4::Splat(axisLengthSquared);
+        const Vec4::FloatType inverseAxisLengthsSquared = Vec4::Splat(testCylinder ? 1.0f / axisLengthSquared : 0.0f);
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            const Points4 basePlaneCenterPointToPoints = Sub(batch, basePlaneCenterPoint);
+            Vec4::FloatType inside = Vec4::CmpLt(LengthSq(basePlaneCenterPointToPoints), radiiSquared);
+
+            if (!testSphereOnly)
+            {
+                inside = Vec4::Or(inside, Vec4::CmpLt(LengthSq(Sub(batch, topPlaneCenterPoint)), radiiSquared));
+            }
+
+            if (testCylinder)
+            {
+                const Vec4::FloatType dotProduct = Dot(basePlaneCenterPointToPoints, axisVector);
+                const Vec4::FloatType distanceSquared = Vec4::Sub(
+                    LengthSq(basePlaneCenterPointToPoints), Vec4::Mul(Vec4::Mul(dotProduct, dotProduct), inverseAxisLengthsSquared));
+                const Vec4::FloatType insideCylinder = Vec4::And(
+                    Vec4::And(Vec4::CmpGtEq(dotProduct, Vec4::ZeroFloat()), Vec4::CmpLtEq(dotProduct, axisLengthsSquared)),
+                    Vec4::CmpLtEq(distanceSquared, radiiSquared));
+                inside = Vec4::Or(inside, insideCylinder);
+            }
+
+            StoreMask(inside, count, outInside.data() + index);
+        });
+    }
+
+    void CapsuleShape::DistanceSquaredFromPointList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+        outDistancesSquared.resize(points.size());
+
+        // Distance from the line segment between the end caps, minus the radius, like Distance::Point_Lineseg.
+        const AZ::Vector3 segmentStart = m_intersectionDataCache.m_basePlaneCenterPoint;
+        const AZ::Vector3 segmentDirection = m_intersectionDataCache.m_topPlaneCenterPoint - segmentStart;
+        const float segmentLengthSquared = segmentDirection.GetLengthSq();
+        const Vec4::FloatType inverseSegmentLengthsSquared =
+            Vec4::Splat(segmentLengthSquared > 0.0f ? 1.0f / segmentLengthSquared : 0.0f);
+        const Vec4::FloatType radius = Vec4::Splat(m_intersectionDataCache.m_radius);
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            const Points4 segmentStartToPoints = Sub(batch, segmentStart);
+            const Vec4::FloatType proportion = Vec4::Clamp(
+                Vec4::Mul(Dot(segmentStartToPoints, segmentDirection), inverseSegmentLengthsSquared), Vec4::ZeroFloat(), Vec4::Splat(1.0f));
+            const Points4 closestPointsToPoints{
+                Vec4::Sub(segmentStartToPoints.m_x, Vec4::Mul(proportion, Vec4::Splat(segmentDirection.GetX()))),
+                Vec4::Sub(segmentStartToPoints.m_y, Vec4::Mul(proportion, Vec4::Splat(segmentDirection.GetY()))),
+                Vec4::Sub(segmentStartToPoints.m_z, Vec4::Mul(proportion, Vec4::Splat(segmentDirection.GetZ()))) };
+
+            const Vec4::FloatType distance =
+                Vec4::Max(Vec4::Sub(Vec4::Sqrt(LengthSq(closestPointsToPoints)), radius), Vec4::ZeroFloat());
+            StoreValues(Vec4::Mul(distance, distance), count, outDistancesSquared.data() + index);
+        });
+    }
+
     bool CapsuleShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
@@ -127,6 +127,52 @@ namespace LmbrCentral
         return smallestDistanceSquared;
     }
 
+    void CompoundShapeComponent::IsPointInsideList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outInside)
+    {
+        outInside.assign(points.size(), false);
+
+        AZStd::vector<bool> childInside;
+        for (AZ::EntityId childEntity : m_configuration.GetChildEntities())
+        {
+            // A child without a shape leaves the list empty, and doesn't contain any of the points.
+            childInside.clear();
+            ShapeComponentRequestsBus::Event(childEntity, &ShapeComponentRequests::IsPointInsideList, points, childInside);
+            if (childInside.size() != points.size())
+            {
+                continue;
+            }
+
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outInside[index] = outInside[index] || childInside[index];
+            }
+        }
+    }
+
+    void CompoundShapeComponent::DistanceSquaredFromPointList(
+        const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        outDistancesSquared.assign(points.size(), FLT_MAX);
+
+        AZStd::vector<float> childDistancesSquared;
+        for (AZ::EntityId childEntity : m_configuration.GetChildEntities())
+        {
+            // A child without a shape leaves the list empty, and is infinitely far away from all the points.
+            childDistancesSquared.clear();
+            ShapeComponentRequestsBus::Event(
+                childEntity, &ShapeComponentRequests::DistanceSquaredFromPointList, points, childDistancesSquared);
+            if (childDistancesSquared.size() != points.size())
+            {
+                continue;
+            }
+
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = AZStd::min(outDistancesSquared[index], childDistancesSquared[index]);
+            }
+        }
+    }
+
     bool CompoundShapeComponent::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         bool intersection = false;
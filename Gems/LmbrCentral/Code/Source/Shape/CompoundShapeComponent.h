@@ -32,6 +32,11 @@ namespace LmbrCentral
             m_currentlyActiveChildren(0)
         {}
 
+        explicit CompoundShapeComponent(const CompoundShapeConfiguration& configuration)
+            : m_configuration(configuration)
+            , m_currentlyActiveChildren(0)
+        {}
+
         // AZ::Component interface implementation
         void Activate() override;
         void Deactivate() override;
@@ -46,6 +51,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         bool IsPointInside(const AZ::Vector3& point) override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void IsPointInsideList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outInside) override;
+        void DistanceSquaredFromPointList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared) override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
         
         // CompoundShapeComponentRequestsBus::Handler implementation
@@ -17,6 +17,7 @@
 #include <AzCore/Math/Random.h>
 #include <AzCore/Math/Sfmt.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <Shape/ShapeBulkQueryUtil.h>
 #include <Shape/ShapeDisplay.h>
 
 #include "Cry_GeoDistance.h"
@@ -249,6 +250,84 @@ namespace LmbrCentral
             m_intersectionDataCache.m_radius);
     }
 
+    void CylinderShape::IsPointInsideList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outInside)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        // Same test as AZ::Intersect::PointCylinder, the point cannot be inside if the cylinder has no volume.
+        const float axisLengthSquared = powf(m_intersectionDataCache.m_height, 2.0f);
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        if (axisLengthSquared <= 0.0f || radiusSquared <= 0.0f)
+        {
+            outInside.assign(points.size(), false);
+            return;
+        }
+
+        outInside.resize(points.size());
+
+        const AZ::Vector3 baseCenterPoint = m_intersectionDataCache.m_baseCenterPoint;
+        const AZ::Vector3 axisVector = m_intersectionDataCache.m_axisVector;
+        const Vec4::FloatType axisLengthsSquared = Vec4::Splat(axisLengthSquared);
+        const Vec4::FloatType inverseAxisLengthsSquared = Vec4::Splat(1.0f / axisLengthSquared);
+        const Vec4::FloatType radiiSquared = Vec4::Splat(radiusSquared);
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            const Points4 baseCenterPointToPoints = Sub(batch, baseCenterPoint);
+            const Vec4::FloatType dotProduct = Dot(baseCenterPointToPoints, axisVector);
+            const Vec4::FloatType distanceSquared = Vec4::Sub(
+                LengthSq(baseCenterPointToPoints), Vec4::Mul(Vec4::Mul(dotProduct, dotProduct), inverseAxisLengthsSquared));
+
+            const Vec4::FloatType inside = Vec4::And(
+                Vec4::And(Vec4::CmpGtEq(dotProduct, Vec4::ZeroFloat()), Vec4::CmpLtEq(dotProduct, axisLengthsSquared)),
+                Vec4::CmpLtEq(distanceSquared, radiiSquared));
+            StoreMask(inside, count, outInside.data() + index);
+        });
+    }
+
+    void CylinderShape::DistanceSquaredFromPointList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+        outDistancesSquared.resize(points.size());
+
+        if (m_cylinderShapeConfig.m_height <= 0.0f || m_cylinderShapeConfig.m_radius <= 0.0f)
+        {
+            const AZ::Vector3 baseCenterPoint = m_intersectionDataCache.m_baseCenterPoint;
+            ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+            {
+                StoreValues(LengthSq(Sub(batch, baseCenterPoint)), count, outDistancesSquared.data() + index);
+            });
+            return;
+        }
+
+        // Same Voronoi regions as Distance::Point_CylinderSq, relative to the center of the cylinder axis. The distance
+        // beyond the radius and the distance beyond the end caps are each 0 in the regions where they don't apply.
+        const AZ::Vector3 axisVector = m_intersectionDataCache.m_axisVector;
+        const AZ::Vector3 axisUnit = axisVector.GetNormalized();
+        const AZ::Vector3 centerPoint = m_intersectionDataCache.m_baseCenterPoint + axisVector * 0.5f;
+        const Vec4::FloatType halfLength = Vec4::Splat(axisVector.GetLength() * 0.5f);
+        const Vec4::FloatType radius = Vec4::Splat(m_intersectionDataCache.m_radius);
+        const Vec4::FloatType radiusSquared = Vec4::Mul(radius, radius);
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            const Points4 pointsToCenter = Sub(batch, centerPoint);
+            const Vec4::FloatType axialDistance = Vec4::Abs(Dot(pointsToCenter, axisUnit));
+            const Vec4::FloatType radialDistanceSquared =
+                Vec4::Sub(LengthSq(pointsToCenter), Vec4::Mul(axialDistance, axialDistance));
+
+            const Vec4::FloatType beyondRadius = Vec4::Sub(Vec4::Sqrt(Vec4::Max(radialDistanceSquared, Vec4::ZeroFloat())), radius);
+            const Vec4::FloatType beyondEnds = Vec4::Sub(axialDistance, halfLength);
+            const Vec4::FloatType radialTerm = Vec4::Select(
+                Vec4::Mul(beyondRadius, beyondRadius), Vec4::ZeroFloat(), Vec4::CmpGt(radialDistanceSquared, radiusSquared));
+            const Vec4::FloatType axialTerm = Vec4::Select(
+                Vec4::Mul(beyondEnds, beyondEnds), Vec4::ZeroFloat(), Vec4::CmpGtEq(axialDistance, halfLength));
+            StoreValues(Vec4::Add(radialTerm, axialTerm), count, outDistancesSquared.data() + index);
+        });
+    }
+
     bool CylinderShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
@@ -17,6 +17,7 @@
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <MathConversion.h>
+#include <Shape/ShapeBulkQueryUtil.h>
 #include <Shape/ShapeGeometryUtil.h>
 #include <Shape/ShapeDisplay.h>
 #include <ISystem.h>
@@ -398,6 +399,45 @@ namespace LmbrCentral
         return PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, point, m_currentTransform);;
     }
 
+    void PolygonPrismShape::IsPointInsideList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outInside)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+        outInside.resize(points.size());
+
+        // Reject the points outside of the aabb four at a time, and only run the crossings test on the remaining ones.
+        const AZ::Vector3 aabbMin = m_intersectionDataCache.m_aabb.GetMin();
+        const AZ::Vector3 aabbMax = m_intersectionDataCache.m_aabb.GetMax();
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            const Vec4::FloatType insideAabb = ContainsAabb(batch, aabbMin, aabbMax);
+            StoreMask(insideAabb, count, outInside.data() + index);
+            if (AnyLane(insideAabb, count))
+            {
+                for (size_t lane = 0; lane < count; ++lane)
+                {
+                    if (outInside[index + lane])
+                    {
+                        outInside[index + lane] = PolygonPrismUtil::IsPointInside(*m_polygonPrism, points[index + lane], m_currentTransform);
+                    }
+                }
+            }
+        });
+    }
+
+    void PolygonPrismShape::DistanceSquaredFromPointList(
+        const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+
+        outDistancesSquared.resize(points.size());
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outDistancesSquared[index] = PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, points[index], m_currentTransform);
+        }
+    }
+
     bool PolygonPrismShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace LmbrCentral
+{
+    /// Helpers for the shape IsPointInsideList and DistanceSquaredFromPointList implementations,
+    /// which evaluate four points at a time with AZ::Simd::Vec4.
+    namespace ShapeBulkQueryUtil
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        /// Four points, with the x, y and z components of each point in one lane.
+        struct Points4
+        {
+            Vec4::FloatType m_x;
+            Vec4::FloatType m_y;
+            Vec4::FloatType m_z;
+        };
+
+        /// Calls batchFunc(size_t index, size_t count, const Points4& points) for each batch of four points of the list.
+        /// The last batch repeats its last point in the unused lanes, count is the number of lanes that hold points of the list.
+        template <typename BatchFunc>
+        void ForEachBatch(const AZStd::vector<AZ::Vector3>& points, BatchFunc&& batchFunc)
+        {
+            for (size_t index = 0; index < points.size(); index += 4)
+            {
+                const size_t count = AZStd::min<size_t>(points.size() - index, 4);
+                const AZ::Vector3& p0 = points[index];
+                const AZ::Vector3& p1 = points[index + AZStd::min<size_t>(1, count - 1)];
+                const AZ::Vector3& p2 = points[index + AZStd::min<size_t>(2, count - 1)];
+                const AZ::Vector3& p3 = points[index + AZStd::min<size_t>(3, count - 1)];
+
+                const Points4 batch{ Vec4::LoadImmediate(p0.GetX(), p1.GetX(), p2.GetX(), p3.GetX()),
+                                     Vec4::LoadImmediate(p0.GetY(), p1.GetY(), p2.GetY(), p3.GetY()),
+                                     Vec4::LoadImmediate(p0.GetZ(), p1.GetZ(), p2.GetZ(), p3.GetZ()) };
+                batchFunc(index, count, batch);
+            }
+        }
+
+        /// Writes the first count lanes of a comparison mask as bools.
+        AZ_FORCE_INLINE void StoreMask(Vec4::FloatArgType mask, size_t count, bool* out)
+        {
+            alignas(16) int32_t lanes[4];
+            Vec4::StoreAligned(lanes, Vec4::CastToInt(mask));
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                out[lane] = (lanes[lane] != 0);
+            }
+        }
+
+        /// Writes the first count lanes of the values.
+        AZ_FORCE_INLINE void StoreValues(Vec4::FloatArgType values, size_t count, float* out)
+        {
+            if (count == 4)
+            {
+                Vec4::StoreUnaligned(out, values);
+            }
+            else
+            {
+                alignas(16) float lanes[4];
+                Vec4::StoreAligned(lanes, values);
+                AZStd::copy(lanes, lanes + count, out);
+            }
+        }
+
+        /// Returns true if any of the first count lanes of a comparison mask is set.
+        AZ_FORCE_INLINE bool AnyLane(Vec4::FloatArgType mask, size_t count)
+        {
+            alignas(16) int32_t lanes[4];
+            Vec4::StoreAligned(lanes, Vec4::CastToInt(mask));
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                if (lanes[lane] != 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        AZ_FORCE_INLINE Points4 Sub(const Points4& points, const AZ::Vector3& offset)
+        {
+            return Points4{ Vec4::Sub(points.m_x, Vec4::Splat(offset.GetX())),
+                            Vec4::Sub(points.m_y, Vec4::Splat(offset.GetY())),
+                            Vec4::Sub(points.m_z, Vec4::Splat(offset.GetZ())) };
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Dot(const Points4& points, const AZ::Vector3& direction)
+        {
+            return Vec4::Madd(points.m_z, Vec4::Splat(direction.GetZ()),
+                Vec4::Madd(points.m_y, Vec4::Splat(direction.GetY()), Vec4::Mul(points.m_x, Vec4::Splat(direction.GetX()))));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType LengthSq(const Points4& points)
+        {
+            return Vec4::Madd(points.m_z, points.m_z, Vec4::Madd(points.m_y, points.m_y, Vec4::Mul(points.m_x, points.m_x)));
+        }
+
+        /// Mask of the points that are inside of the box, including its boundary.
+        AZ_FORCE_INLINE Vec4::FloatType ContainsAabb(const Points4& points, const AZ::Vector3& boxMin, const AZ::Vector3& boxMax)
+        {
+            const Vec4::FloatType insideX = Vec4::And(
+                Vec4::CmpGtEq(points.m_x, Vec4::Splat(boxMin.GetX())), Vec4::CmpLtEq(points.m_x, Vec4::Splat(boxMax.GetX())));
+            const Vec4::FloatType insideY = Vec4::And(
+                Vec4::CmpGtEq(points.m_y, Vec4::Splat(boxMin.GetY())), Vec4::CmpLtEq(points.m_y, Vec4::Splat(boxMax.GetY())));
+            const Vec4::FloatType insideZ = Vec4::And(
+                Vec4::CmpGtEq(points.m_z, Vec4::Splat(boxMin.GetZ())), Vec4::CmpLtEq(points.m_z, Vec4::Splat(boxMax.GetZ())));
+            return Vec4::And(insideX, Vec4::And(insideY, insideZ));
+        }
+
+        /// Square distances of the points from the box, 0 for points inside of it.
+        AZ_FORCE_INLINE Vec4::FloatType DistanceSqAabb(const Points4& points, const AZ::Vector3& boxMin, const AZ::Vector3& boxMax)
+        {
+            const Vec4::FloatType deltaX = Vec4::Sub(
+                points.m_x, Vec4::Clamp(points.m_x, Vec4::Splat(boxMin.GetX()), Vec4::Splat(boxMax.GetX())));
+            const Vec4::FloatType deltaY = Vec4::Sub(
+                points.m_y, Vec4::Clamp(points.m_y, Vec4::Splat(boxMin.GetY()), Vec4::Splat(boxMax.GetY())));
+            const Vec4::FloatType deltaZ = Vec4::Sub(
+                points.m_z, Vec4::Clamp(points.m_z, Vec4::Splat(boxMin.GetZ()), Vec4::Splat(boxMax.GetZ())));
+            return LengthSq(Points4{ deltaX, deltaY, deltaZ });
+        }
+    } // namespace ShapeBulkQueryUtil
+} // namespace LmbrCentral
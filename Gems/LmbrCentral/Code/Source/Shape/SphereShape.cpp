@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Math/IntersectSegment.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <Shape/ShapeBulkQueryUtil.h>
 #include <Shape/ShapeDisplay.h>
 
 namespace LmbrCentral
@@ -118,6 +119,38 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void SphereShape::IsPointInsideList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outInside)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+        outInside.resize(points.size());
+
+        const AZ::Vector3 center = m_intersectionDataCache.m_position;
+        const Vec4::FloatType radiusSquared = Vec4::Splat(powf(m_intersectionDataCache.m_radius, 2.0f));
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            StoreMask(Vec4::CmpLt(LengthSq(Sub(batch, center)), radiusSquared), count, outInside.data() + index);
+        });
+    }
+
+    void SphereShape::DistanceSquaredFromPointList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+        outDistancesSquared.resize(points.size());
+
+        const AZ::Vector3 center = m_intersectionDataCache.m_position;
+        const Vec4::FloatType radius = Vec4::Splat(m_intersectionDataCache.m_radius);
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            const Vec4::FloatType distance =
+                Vec4::Max(Vec4::Sub(Vec4::Sqrt(LengthSq(Sub(batch, center))), radius), Vec4::ZeroFloat());
+            StoreValues(Vec4::Mul(distance, distance), count, outDistancesSquared.data() + index);
+        });
+    }
+
     bool SphereShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
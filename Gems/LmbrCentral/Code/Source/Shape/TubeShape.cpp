@@ -9,6 +9,7 @@
 #include "TubeShape.h"
 
 #include <AzCore/Math/Transform.h>
+#include <Shape/ShapeBulkQueryUtil.h>
 #include <Shape/ShapeGeometryUtil.h>
 
 #if LMBR_CENTRAL_EDITOR
@@ -22,6 +23,42 @@ namespace LmbrCentral
         return AZ::Lerp(from, to, fraction);
     }
 
+    /// Transforms points from world space to the unscaled local space of the tube, four points at a time.
+    /// Returns the uniform scale of the transform.
+    static float TransformPointsToLocal(
+        const AZ::Transform& worldFromLocal, const AZStd::vector<AZ::Vector3>& points, AZStd::vector<AZ::Vector3>& outLocalPoints)
+    {
+        using namespace ShapeBulkQueryUtil;
+
+        AZ::Transform worldFromLocalNormalized = worldFromLocal;
+        const float scale = worldFromLocalNormalized.ExtractUniformScale();
+
+        // The rotation is orthonormal, so the local coordinates are the projections onto the world space basis vectors.
+        const AZ::Vector3 translation = worldFromLocalNormalized.GetTranslation();
+        const AZ::Vector3 basisX = worldFromLocalNormalized.GetBasisX();
+        const AZ::Vector3 basisY = worldFromLocalNormalized.GetBasisY();
+        const AZ::Vector3 basisZ = worldFromLocalNormalized.GetBasisZ();
+        const Vec4::FloatType inverseScale = Vec4::Splat(1.0f / scale);
+
+        outLocalPoints.resize(points.size());
+        ForEachBatch(points, [&](size_t index, size_t count, const Points4& batch)
+        {
+            const Points4 offsets = Sub(batch, translation);
+            alignas(16) float localX[4];
+            alignas(16) float localY[4];
+            alignas(16) float localZ[4];
+            Vec4::StoreAligned(localX, Vec4::Mul(Dot(offsets, basisX), inverseScale));
+            Vec4::StoreAligned(localY, Vec4::Mul(Dot(offsets, basisY), inverseScale));
+            Vec4::StoreAligned(localZ, Vec4::Mul(Dot(offsets, basisZ), inverseScale));
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                outLocalPoints[index + lane].Set(localX[lane], localY[lane], localZ[lane]);
+            }
+        });
+
+        return scale;
+    }
+
     AZ::Vector3 CalculateNormal(
         const AZ::Vector3& previousNormal, const AZ::Vector3& previousTangent, const AZ::Vector3& currentTangent)
     {
@@ -257,6 +294,48 @@ namespace LmbrCentral
         return powf((sqrtf(splineQueryResult.m_distanceSq) - (m_radius + variableRadius)) * uniformScale, 2.0f);
     }
 
+    void TubeShape::IsPointInsideList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outInside)
+    {
+        if (m_spline == nullptr)
+        {
+            outInside.assign(points.size(), false);
+            return;
+        }
+
+        // The nearest spline position search doesn't vectorize, so only the transforms into local space are batched.
+        AZStd::vector<AZ::Vector3> localPoints;
+        const float scale = TransformPointsToLocal(m_currentTransform, points, localPoints);
+        const float radiusSq = powf(m_radius, 2.0f);
+
+        outInside.resize(points.size());
+        for (size_t index = 0; index < localPoints.size(); ++index)
+        {
+            const auto address = m_spline->GetNearestAddressPosition(localPoints[index]).m_splineAddress;
+            const float variableRadiusSq =
+                powf(m_variableRadius.GetElementInterpolated(address, Lerpf), 2.0f);
+
+            outInside[index] = (m_spline->GetPosition(address) - localPoints[index]).GetLengthSq() < (radiusSq + variableRadiusSq) * scale;
+        }
+    }
+
+    void TubeShape::DistanceSquaredFromPointList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        // The nearest spline position search doesn't vectorize, so only the transforms into local space are batched.
+        AZStd::vector<AZ::Vector3> localPoints;
+        const float uniformScale = TransformPointsToLocal(m_currentTransform, points, localPoints);
+
+        outDistancesSquared.resize(points.size());
+        for (size_t index = 0; index < localPoints.size(); ++index)
+        {
+            const auto splineQueryResult = m_spline->GetNearestAddressPosition(localPoints[index]);
+            const float variableRadius =
+                m_variableRadius.GetElementInterpolated(splineQueryResult.m_splineAddress, Lerpf);
+
+            outDistancesSquared[index] =
+                powf((sqrtf(splineQueryResult.m_distanceSq) - (m_radius + variableRadius)) * uniformScale, 2.0f);
+        }
+    }
+
     bool TubeShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         AZ::Transform transformUniformScale = m_currentTransform;
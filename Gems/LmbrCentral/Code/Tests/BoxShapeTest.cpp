@@ -15,6 +15,7 @@
 #include <AzFramework/Components/NonUniformScaleComponent.h>
 #include <Shape/BoxShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <ShapeBulkQueryTestHelpers.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include <AzFramework/UnitTest/TestDebugDisplayRequests.h>
 
@@ -652,4 +653,18 @@ namespace UnitTest
         EXPECT_THAT(debugDrawAabb.GetMin(), IsClose(shapeAabb.GetMin()));
         EXPECT_THAT(debugDrawAabb.GetMax(), IsClose(shapeAabb.GetMax()));
     }
+
+    TEST_F(BoxShapeTest, BulkQueriesMatchPerPointQueries)
+    {
+        AZ::Entity axisAlignedEntity;
+        CreateBox(AZ::Transform::CreateTranslation(AZ::Vector3(2.0f, -3.0f, 1.0f)), AZ::Vector3(4.0f, 2.0f, 3.0f), axisAlignedEntity);
+        ExpectBulkQueriesMatchPerPointQueries(axisAlignedEntity.GetId());
+
+        AZ::Entity orientedEntity;
+        AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion(0.70f, 0.10f, 0.34f, 0.62f), AZ::Vector3(3.0f, -1.0f, 2.0f));
+        transform.MultiplyByUniformScale(2.0f);
+        CreateBoxWithNonUniformScale(transform, AZ::Vector3(2.4f, 1.3f, 1.8f), AZ::Vector3(1.2f, 0.8f, 1.7f), orientedEntity);
+        ExpectBulkQueriesMatchPerPointQueries(orientedEntity.GetId());
+    }
 }
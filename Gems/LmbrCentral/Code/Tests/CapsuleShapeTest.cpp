@@ -13,6 +13,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <Shape/CapsuleShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <ShapeBulkQueryTestHelpers.h>
 
 namespace UnitTest
 {
@@ -349,4 +350,26 @@ namespace UnitTest
 
         EXPECT_NEAR(distance, 2.0f, 1e-2f);
     }
+
+    TEST_F(CapsuleShapeTest, BulkQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        CreateCapsule(
+            AZ::Transform::CreateTranslation(AZ::Vector3(27.0f, 28.0f, 38.0f)) *
+            AZ::Transform::CreateRotationX(AZ::Constants::HalfPi) *
+            AZ::Transform::CreateRotationY(AZ::Constants::QuarterPi) *
+            AZ::Transform::CreateUniformScale(2.0f),
+            0.5f, 4.0f, entity);
+
+        ExpectBulkQueriesMatchPerPointQueries(entity.GetId());
+    }
+
+    // the height is less than twice the radius, so the capsule is a sphere
+    TEST_F(CapsuleShapeTest, BulkQueriesMatchPerPointQueriesForSphericalCapsule)
+    {
+        AZ::Entity entity;
+        CreateCapsule(AZ::Transform::CreateTranslation(AZ::Vector3(-4.0f, 2.0f, 1.0f)), 1.5f, 2.0f, entity);
+
+        ExpectBulkQueriesMatchPerPointQueries(entity.GetId());
+    }
 }
@@ -14,6 +14,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <Shape/CylinderShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <ShapeBulkQueryTestHelpers.h>
 
 namespace UnitTest
 {
@@ -544,4 +545,17 @@ namespace UnitTest
         CylinderShapeDistanceFromPointTest,
         ::testing::ValuesIn(CylinderShapeDistanceFromPointTest::ShouldPass)
     );
+
+    TEST_F(CylinderShapeTest, BulkQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        CreateCylinder(
+            AZ::Transform::CreateTranslation(AZ::Vector3(27.0f, 28.0f, 38.0f)) *
+            AZ::Transform::CreateRotationX(AZ::Constants::HalfPi) *
+            AZ::Transform::CreateRotationY(AZ::Constants::QuarterPi) *
+            AZ::Transform::CreateUniformScale(1.5f),
+            2.0f, 5.0f, entity);
+
+        ExpectBulkQueriesMatchPerPointQueries(entity.GetId());
+    }
 }
@@ -15,6 +15,7 @@
 #include <AzFramework/Components/NonUniformScaleComponent.h>
 #include <Shape/PolygonPrismShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <ShapeBulkQueryTestHelpers.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 
 namespace UnitTest
@@ -847,4 +848,24 @@ namespace UnitTest
         // then
         EXPECT_TRUE(polygonPrismMesh.m_triangles.empty());
     }
+
+    TEST_F(PolygonPrismShapeTest, BulkQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        CreatePolygonPrismWithNonUniformScale(
+            AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion(0.46f, 0.26f, 0.58f, 0.62f), AZ::Vector3(2.0f, -1.0f, 4.0f)),
+            3.0f,
+            AZStd::vector<AZ::Vector2>(
+            {
+                AZ::Vector2(0.0f, 0.0f),
+                AZ::Vector2(2.0f, 5.0f),
+                AZ::Vector2(4.0f, 1.0f),
+                AZ::Vector2(6.0f, 4.0f),
+                AZ::Vector2(7.0f, -2.0f)
+            }),
+            AZ::Vector3(1.5f, 0.8f, 1.2f), entity);
+
+        ExpectBulkQueriesMatchPerPointQueries(entity.GetId());
+    }
 }
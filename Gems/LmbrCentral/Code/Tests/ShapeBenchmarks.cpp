@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Transform.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzTest/AzTest.h>
+
+#include <LmbrCentral/Shape/BoxShapeComponentBus.h>
+#include <LmbrCentral/Shape/CapsuleShapeComponentBus.h>
+#include <LmbrCentral/Shape/CompoundShapeComponentBus.h>
+#include <LmbrCentral/Shape/CylinderShapeComponentBus.h>
+#include <LmbrCentral/Shape/PolygonPrismShapeComponentBus.h>
+#include <LmbrCentral/Shape/SphereShapeComponentBus.h>
+#include <LmbrCentral/Shape/SplineComponentBus.h>
+#include <LmbrCentral/Shape/TubeShapeComponentBus.h>
+#include <Shape/AxisAlignedBoxShapeComponent.h>
+#include <Shape/BoxShapeComponent.h>
+#include <Shape/CapsuleShapeComponent.h>
+#include <Shape/CompoundShapeComponent.h>
+#include <Shape/CylinderShapeComponent.h>
+#include <Shape/PolygonPrismShapeComponent.h>
+#include <Shape/SphereShapeComponent.h>
+#include <Shape/SplineComponent.h>
+#include <Shape/TubeShapeComponent.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    /*
+     * Queries a grid of points around a shape, either with one ShapeComponentRequests call per point or with one call to the
+     * bulk query for the whole grid. The argument selects the shape type, the reported items are points.
+     */
+    class ShapeQueryBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        enum ShapeType
+        {
+            Box,
+            AxisAlignedBox,
+            Sphere,
+            Capsule,
+            Cylinder,
+            PolygonPrism,
+            Tube,
+            Compound
+        };
+
+        static constexpr int GridSize = 64;
+        static constexpr int GridLayers = 16;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(static_cast<ShapeType>(state.range(0)));
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(static_cast<ShapeType>(state.range(0)));
+            state.SetLabel(GetShapeName(static_cast<ShapeType>(state.range(0))));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+
+        void internalSetUp(ShapeType shapeType)
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 128 * 1024 * 1024;
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            m_app->Create(appDesc);
+
+            m_app->RegisterComponentDescriptor(AzFramework::TransformComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(LmbrCentral::AxisAlignedBoxShapeComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(LmbrCentral::BoxShapeComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(LmbrCentral::CapsuleShapeComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(LmbrCentral::CompoundShapeComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(LmbrCentral::CylinderShapeComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(LmbrCentral::PolygonPrismShapeComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(LmbrCentral::SphereShapeComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(LmbrCentral::SplineComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(LmbrCentral::TubeShapeComponent::CreateDescriptor());
+
+            // All the shapes are rotated, so that the oriented shapes can't take any axis aligned shortcuts.
+            const AZ::Transform transform = AZ::Transform::CreateTranslation(AZ::Vector3(2.0f, -1.0f, 3.0f)) *
+                AZ::Transform::CreateRotationZ(AZ::Constants::QuarterPi) * AZ::Transform::CreateRotationX(0.3f);
+
+            switch (shapeType)
+            {
+            case Box:
+                m_shapeEntityId = CreateBox(transform, AZ::Vector3(12.0f, 8.0f, 6.0f));
+                break;
+            case AxisAlignedBox:
+                m_shapeEntityId = CreateAxisAlignedBox(AZ::Transform::CreateTranslation(transform.GetTranslation()), AZ::Vector3(12.0f, 8.0f, 6.0f));
+                break;
+            case Sphere:
+                m_shapeEntityId = CreateSphere(transform, 6.0f);
+                break;
+            case Capsule:
+                m_shapeEntityId = CreateCapsule(transform, 3.0f, 14.0f);
+                break;
+            case Cylinder:
+                m_shapeEntityId = CreateCylinder(transform, 4.0f, 10.0f);
+                break;
+            case PolygonPrism:
+                m_shapeEntityId = CreatePolygonPrism(transform);
+                break;
+            case Tube:
+                m_shapeEntityId = CreateTube(transform);
+                break;
+            case Compound:
+                {
+                    LmbrCentral::CompoundShapeConfiguration config;
+                    config.AddChildEntity(CreateBox(transform, AZ::Vector3(12.0f, 8.0f, 6.0f)));
+                    config.AddChildEntity(CreateSphere(AZ::Transform::CreateTranslation(AZ::Vector3(8.0f, 4.0f, 3.0f)), 4.0f));
+                    config.AddChildEntity(CreateCylinder(AZ::Transform::CreateTranslation(AZ::Vector3(-6.0f, -5.0f, 0.0f)), 3.0f, 8.0f));
+                    m_shapeEntityId = CreateEntity<LmbrCentral::CompoundShapeComponent>(config);
+                }
+                break;
+            }
+
+            // Sample a volume that's larger than the shape, so that some of the points are inside and some are outside.
+            m_points.reserve(GridSize * GridSize * GridLayers);
+            for (int z = 0; z < GridLayers; ++z)
+            {
+                for (int y = 0; y < GridSize; ++y)
+                {
+                    for (int x = 0; x < GridSize; ++x)
+                    {
+                        m_points.emplace_back(
+                            static_cast<float>(x) * 0.5f - 14.0f, static_cast<float>(y) * 0.5f - 16.0f, static_cast<float>(z) - 5.0f);
+                    }
+                }
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_points = {};
+            m_shapeEntityId = AZ::EntityId();
+
+            // Destroy the compound shape before its children.
+            while (!m_entities.empty())
+            {
+                m_entities.pop_back();
+            }
+
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        static const char* GetShapeName(ShapeType shapeType)
+        {
+            switch (shapeType)
+            {
+            case Box:
+                return "Box";
+            case AxisAlignedBox:
+                return "AxisAlignedBox";
+            case Sphere:
+                return "Sphere";
+            case Capsule:
+                return "Capsule";
+            case Cylinder:
+                return "Cylinder";
+            case PolygonPrism:
+                return "PolygonPrism";
+            case Tube:
+                return "Tube";
+            case Compound:
+                return "Compound";
+            }
+            return "";
+        }
+
+        template <typename ShapeComponent, typename... Args>
+        AZ::EntityId CreateEntity(Args&&... args)
+        {
+            auto entity = AZStd::make_unique<AZ::Entity>();
+            entity->CreateComponent<AzFramework::TransformComponent>();
+            entity->CreateComponent<ShapeComponent>(AZStd::forward<Args>(args)...);
+            entity->Init();
+            entity->Activate();
+
+            const AZ::EntityId entityId = entity->GetId();
+            m_entities.push_back(AZStd::move(entity));
+            return entityId;
+        }
+
+        AZ::EntityId CreateBox(const AZ::Transform& transform, const AZ::Vector3& dimensions)
+        {
+            const AZ::EntityId entityId = CreateEntity<LmbrCentral::BoxShapeComponent>();
+            AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetWorldTM, transform);
+            LmbrCentral::BoxShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::BoxShapeComponentRequestsBus::Events::SetBoxDimensions, dimensions);
+            return entityId;
+        }
+
+        AZ::EntityId CreateAxisAlignedBox(const AZ::Transform& transform, const AZ::Vector3& dimensions)
+        {
+            const AZ::EntityId entityId = CreateEntity<LmbrCentral::AxisAlignedBoxShapeComponent>();
+            AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetWorldTM, transform);
+            LmbrCentral::BoxShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::BoxShapeComponentRequestsBus::Events::SetBoxDimensions, dimensions);
+            return entityId;
+        }
+
+        AZ::EntityId CreateSphere(const AZ::Transform& transform, float radius)
+        {
+            const AZ::EntityId entityId = CreateEntity<LmbrCentral::SphereShapeComponent>();
+            AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetWorldTM, transform);
+            LmbrCentral::SphereShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::SphereShapeComponentRequestsBus::Events::SetRadius, radius);
+            return entityId;
+        }
+
+        AZ::EntityId CreateCapsule(const AZ::Transform& transform, float radius, float height)
+        {
+            const AZ::EntityId entityId = CreateEntity<LmbrCentral::CapsuleShapeComponent>();
+            AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetWorldTM, transform);
+            LmbrCentral::CapsuleShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::CapsuleShapeComponentRequestsBus::Events::SetHeight, height);
+            LmbrCentral::CapsuleShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::CapsuleShapeComponentRequestsBus::Events::SetRadius, radius);
+            return entityId;
+        }
+
+        AZ::EntityId CreateCylinder(const AZ::Transform& transform, float radius, float height)
+        {
+            const AZ::EntityId entityId = CreateEntity<LmbrCentral::CylinderShapeComponent>();
+            AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetWorldTM, transform);
+            LmbrCentral::CylinderShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::CylinderShapeComponentRequestsBus::Events::SetHeight, height);
+            LmbrCentral::CylinderShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::CylinderShapeComponentRequestsBus::Events::SetRadius, radius);
+            return entityId;
+        }
+
+        AZ::EntityId CreatePolygonPrism(const AZ::Transform& transform)
+        {
+            const AZ::EntityId entityId = CreateEntity<LmbrCentral::PolygonPrismShapeComponent>();
+            AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetWorldTM, transform);
+            LmbrCentral::PolygonPrismShapeComponentRequestBus::Event(
+                entityId, &LmbrCentral::PolygonPrismShapeComponentRequests::SetHeight, 6.0f);
+            LmbrCentral::PolygonPrismShapeComponentRequestBus::Event(
+                entityId, &LmbrCentral::PolygonPrismShapeComponentRequests::SetVertices,
+                AZStd::vector<AZ::Vector2>{ AZ::Vector2(-8.0f, -6.0f), AZ::Vector2(-2.0f, 7.0f), AZ::Vector2(1.0f, 0.0f),
+                                            AZ::Vector2(6.0f, 8.0f), AZ::Vector2(9.0f, -5.0f), AZ::Vector2(2.0f, -8.0f) });
+            return entityId;
+        }
+
+        AZ::EntityId CreateTube(const AZ::Transform& transform)
+        {
+            auto entity = AZStd::make_unique<AZ::Entity>();
+            entity->CreateComponent<AzFramework::TransformComponent>();
+            entity->CreateComponent<LmbrCentral::SplineComponent>();
+            entity->CreateComponent<LmbrCentral::TubeShapeComponent>();
+            entity->Init();
+            entity->Activate();
+
+            const AZ::EntityId entityId = entity->GetId();
+            m_entities.push_back(AZStd::move(entity));
+
+            AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetWorldTM, transform);
+            LmbrCentral::SplineComponentRequestBus::Event(
+                entityId, &LmbrCentral::SplineComponentRequests::SetVertices,
+                AZStd::vector<AZ::Vector3>{ AZ::Vector3(-10.0f, -4.0f, 0.0f), AZ::Vector3(-4.0f, 3.0f, 1.0f),
+                                            AZ::Vector3(3.0f, -2.0f, -1.0f), AZ::Vector3(10.0f, 4.0f, 0.0f) });
+            LmbrCentral::TubeShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::TubeShapeComponentRequestsBus::Events::SetRadius, 2.0f);
+            return entityId;
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        AZ::EntityId m_shapeEntityId;
+        AZStd::vector<AZ::Vector3> m_points;
+    };
+
+    BENCHMARK_DEFINE_F(ShapeQueryBenchmarkFixture, IsPointInsidePerPoint)(benchmark::State& state)
+    {
+        AZStd::vector<bool> inside(m_points.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_points.size(); ++index)
+            {
+                bool pointInside = false;
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                    pointInside, m_shapeEntityId, &LmbrCentral::ShapeComponentRequests::IsPointInside, m_points[index]);
+                inside[index] = pointInside;
+            }
+            benchmark::DoNotOptimize(inside.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_points.size());
+    }
+
+    BENCHMARK_DEFINE_F(ShapeQueryBenchmarkFixture, IsPointInsideList)(benchmark::State& state)
+    {
+        AZStd::vector<bool> inside;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                m_shapeEntityId, &LmbrCentral::ShapeComponentRequests::IsPointInsideList, m_points, inside);
+            benchmark::DoNotOptimize(inside.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_points.size());
+    }
+
+    BENCHMARK_DEFINE_F(ShapeQueryBenchmarkFixture, DistanceSquaredFromPointPerPoint)(benchmark::State& state)
+    {
+        AZStd::vector<float> distancesSquared(m_points.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_points.size(); ++index)
+            {
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                    distancesSquared[index], m_shapeEntityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint,
+                    m_points[index]);
+            }
+            benchmark::DoNotOptimize(distancesSquared.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_points.size());
+    }
+
+    BENCHMARK_DEFINE_F(ShapeQueryBenchmarkFixture, DistanceSquaredFromPointList)(benchmark::State& state)
+    {
+        AZStd::vector<float> distancesSquared;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                m_shapeEntityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPointList, m_points, distancesSquared);
+            benchmark::DoNotOptimize(distancesSquared.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_points.size());
+    }
+
+    static void ShapeTypeArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int shapeType = ShapeQueryBenchmarkFixture::Box; shapeType <= ShapeQueryBenchmarkFixture::Compound; ++shapeType)
+        {
+            benchmark->Arg(shapeType);
+        }
+        benchmark->Unit(benchmark::kMillisecond);
+    }
+
+    BENCHMARK_REGISTER_F(ShapeQueryBenchmarkFixture, IsPointInsidePerPoint)->Apply(ShapeTypeArguments);
+    BENCHMARK_REGISTER_F(ShapeQueryBenchmarkFixture, IsPointInsideList)->Apply(ShapeTypeArguments);
+    BENCHMARK_REGISTER_F(ShapeQueryBenchmarkFixture, DistanceSquaredFromPointPerPoint)->Apply(ShapeTypeArguments);
+    BENCHMARK_REGISTER_F(ShapeQueryBenchmarkFixture, DistanceSquaredFromPointList)->Apply(ShapeTypeArguments);
+} // namespace UnitTest
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
+#include <LmbrCentral/Shape/ShapeComponentBus.h>
+
+namespace UnitTest
+{
+    // Checks that the bulk shape queries return the same results as the per point queries, for a grid of points that covers
+    // the bounds of the shape and the space around them. The grid is offset by a small amount so that the points don't land
+    // exactly on the boundaries of the shape, where rounding differences could decide between inside and outside.
+    inline void ExpectBulkQueriesMatchPerPointQueries(AZ::EntityId entityId)
+    {
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(bounds, entityId, &LmbrCentral::ShapeComponentRequests::GetEncompassingAabb);
+        ASSERT_TRUE(bounds.IsValid());
+        bounds.Expand(AZ::Vector3(2.0f));
+
+        // 11 x 11 x 11 points isn't a multiple of four, so the last batch of the bulk queries is partially filled.
+        constexpr int pointsPerAxis = 11;
+        const AZ::Vector3 step = bounds.GetExtents() / static_cast<float>(pointsPerAxis - 1);
+        const AZ::Vector3 offset(0.013f, 0.027f, 0.041f);
+        AZStd::vector<AZ::Vector3> points;
+        for (int z = 0; z < pointsPerAxis; ++z)
+        {
+            for (int y = 0; y < pointsPerAxis; ++y)
+            {
+                for (int x = 0; x < pointsPerAxis; ++x)
+                {
+                    points.push_back(
+                        bounds.GetMin() + offset + step * AZ::Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)));
+                }
+            }
+        }
+
+        AZStd::vector<bool> inside;
+        AZStd::vector<float> distances;
+        AZStd::vector<float> distancesSquared;
+        LmbrCentral::ShapeComponentRequestsBus::Event(entityId, &LmbrCentral::ShapeComponentRequests::IsPointInsideList, points, inside);
+        LmbrCentral::ShapeComponentRequestsBus::Event(entityId, &LmbrCentral::ShapeComponentRequests::DistanceFromPointList, points, distances);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPointList, points, distancesSquared);
+        ASSERT_EQ(inside.size(), points.size());
+        ASSERT_EQ(distances.size(), points.size());
+        ASSERT_EQ(distancesSquared.size(), points.size());
+
+        size_t insideCount = 0;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            bool pointInside = false;
+            float pointDistance = 0.0f;
+            float pointDistanceSquared = 0.0f;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                pointInside, entityId, &LmbrCentral::ShapeComponentRequests::IsPointInside, points[index]);
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                pointDistance, entityId, &LmbrCentral::ShapeComponentRequests::DistanceFromPoint, points[index]);
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                pointDistanceSquared, entityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, points[index]);
+
+            EXPECT_EQ(inside[index], pointInside) << "at point " << index;
+            EXPECT_NEAR(distances[index], pointDistance, 1e-3f * AZ::GetMax(1.0f, pointDistance)) << "at point " << index;
+            EXPECT_NEAR(distancesSquared[index], pointDistanceSquared, 1e-3f * AZ::GetMax(1.0f, pointDistanceSquared))
+                << "at point " << index;
+
+            insideCount += pointInside ? 1 : 0;
+        }
+
+        // The grid should test both sides of the shape boundary.
+        EXPECT_GT(insideCount, 0u);
+        EXPECT_LT(insideCount, points.size());
+    }
+} // namespace UnitTest
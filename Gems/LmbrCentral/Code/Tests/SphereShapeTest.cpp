@@ -13,6 +13,7 @@
 #include <LmbrCentral/Shape/SphereShapeComponentBus.h>
 #include <Shape/SphereShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <ShapeBulkQueryTestHelpers.h>
 
 namespace Constants = AZ::Constants;
 
@@ -339,4 +340,15 @@ namespace UnitTest
 
         EXPECT_NEAR(distance, 2.5f, 1e-2f);
     }
+
+    TEST_F(SphereShapeTest, BulkQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        CreateSphere(
+            AZ::Transform::CreateTranslation(AZ::Vector3(19.0f, 34.0f, 37.0f)) *
+            AZ::Transform::CreateUniformScale(2.0f),
+            1.5f, entity);
+
+        ExpectBulkQueriesMatchPerPointQueries(entity.GetId());
+    }
 }
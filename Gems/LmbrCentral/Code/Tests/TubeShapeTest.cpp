@@ -14,6 +14,7 @@
 #include <Shape/SplineComponent.h>
 #include <Shape/TubeShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <ShapeBulkQueryTestHelpers.h>
 
 namespace UnitTest
 {
@@ -412,4 +413,21 @@ namespace UnitTest
             EXPECT_THAT(variableRadius, FloatEq(radiis.second));
         }
     }
+
+    TEST_F(TubeShapeTest, BulkQueriesMatchPerPointQueries)
+    {
+        AZ::Entity entity;
+        CreateTube(
+            AZ::Transform::CreateTranslation(AZ::Vector3(5.0f, -2.0f, 3.0f)) *
+            AZ::Transform::CreateRotationZ(AZ::Constants::QuarterPi) *
+            AZ::Transform::CreateUniformScale(1.5f),
+            1.0f, entity);
+
+        LmbrCentral::TubeShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::TubeShapeComponentRequestsBus::Events::SetVariableRadius, 0, 1.0f);
+        LmbrCentral::TubeShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::TubeShapeComponentRequestsBus::Events::SetVariableRadius, 3, 2.0f);
+
+        ExpectBulkQueriesMatchPerPointQueries(entity.GetId());
+    }
 }
@@ -52,6 +52,11 @@ namespace LmbrCentral
             return m_childEntities;
         }
 
+        void AddChildEntity(const AZ::EntityId& entityId)
+        {
+            m_childEntities.push_back(entityId);
+        }
+
     private:
         AZStd::list<AZ::EntityId> m_childEntities;
     };
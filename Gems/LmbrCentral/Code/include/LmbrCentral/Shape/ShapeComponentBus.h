@@ -12,6 +12,7 @@
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <AzFramework/Viewport/ViewportColors.h>
 
@@ -185,6 +186,42 @@ namespace LmbrCentral
         /// @return float indicating square distance point is from shape
         virtual float DistanceSquaredFromPoint(const AZ::Vector3& point) = 0;
 
+        /// @brief Checks if each point of a list is inside a shape or outside it
+        /// @param points Vector3 list of the points to be tested
+        /// @param outInside Resized to the number of points, set to whether each point is inside or out
+        virtual void IsPointInsideList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outInside)
+        {
+            outInside.resize(points.size());
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outInside[index] = IsPointInside(points[index]);
+            }
+        }
+
+        /// @brief Returns the min distance each point of a list is from the shape
+        /// @param points Vector3 list of the points to calculate distances from
+        /// @param outDistances Resized to the number of points, set to the distance of each point from the shape
+        virtual void DistanceFromPointList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistances)
+        {
+            DistanceSquaredFromPointList(points, outDistances);
+            for (float& distance : outDistances)
+            {
+                distance = sqrtf(distance);
+            }
+        }
+
+        /// @brief Returns the min squared distance each point of a list is from the shape
+        /// @param points Vector3 list of the points to calculate square distances from
+        /// @param outDistancesSquared Resized to the number of points, set to the square distance of each point from the shape
+        virtual void DistanceSquaredFromPointList(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+        {
+            outDistancesSquared.resize(points.size());
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = DistanceSquaredFromPoint(points[index]);
+            }
+        }
+
         /// @brief Returns a random position inside the volume.
         /// @param randomDistribution An enum representing the different random distributions to use.
         virtual AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType /*randomDistribution*/)
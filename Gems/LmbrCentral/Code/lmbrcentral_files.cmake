@@ -145,6 +145,7 @@ set(FILES
     Source/Shape/ShapeComponentConverters.inl
     Source/Shape/ShapeGeometryUtil.h
     Source/Shape/ShapeGeometryUtil.cpp
+    Source/Shape/ShapeBulkQueryUtil.h
     Source/Unhandled/Material/MaterialAssetTypeInfo.cpp
     Source/Unhandled/Material/MaterialAssetTypeInfo.h
     Source/Unhandled/Other/AudioAssetTypeInfo.cpp
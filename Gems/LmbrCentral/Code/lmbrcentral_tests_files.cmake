@@ -20,6 +20,8 @@ set(FILES
     Tests/LmbrCentralReflectionTest.h
     Tests/LmbrCentralReflectionTest.cpp
     Tests/LmbrCentralTest.cpp
+    Tests/ShapeBenchmarks.cpp
+    Tests/ShapeBulkQueryTestHelpers.h
     Tests/ShapeGeometryUtilTest.cpp
     Tests/SpawnerComponentTest.cpp
     Tests/SplineComponentTests.cpp
@@ -8,18 +8,87 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "PacketSampleCapture.h"
+#include "ZstdCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    // WARN: similar to net_UdpCompressor these are read when a network interface creates its compressor
+    AZ_CVAR(bool, net_CompressionCaptureSamples, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Record uncompressed packet payloads for zstd dictionary training");
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path to a trained zstd dictionary, an empty path compresses without a dictionary");
+    AZ_CVAR(int32_t, net_ZstdCompressionLevel, ZstdDefaultCompressionLevel, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Compression level used by the zstd compressor");
+
+    static AZStd::unique_ptr<AzNetworking::ICompressor> WrapForSampleCapture(AZStd::unique_ptr<AzNetworking::ICompressor> compressor)
+    {
+        if (net_CompressionCaptureSamples)
+        {
+            if (PacketSampleCapture* capture = AZ::Interface<PacketSampleCapture>::Get())
+            {
+                return AZStd::make_unique<SampleCapturingCompressor>(AZStd::move(compressor), *capture);
+            }
+        }
+        return compressor;
+    }
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
-        return AZStd::make_unique<LZ4Compressor>();
+        return WrapForSampleCapture(AZStd::make_unique<LZ4Compressor>());
     }
 
     AZ::Name MultiplayerCompressionFactory::GetFactoryName() const
     {
         return m_name;
     }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> ZstdCompressionFactory::Create()
+    {
+        const AZStd::string dictionaryPath = static_cast<AZ::CVarFixedString>(net_ZstdDictionaryPath).c_str();
+        const int compressionLevel = net_ZstdCompressionLevel;
+        return WrapForSampleCapture(AZStd::make_unique<ZstdCompressor>(compressionLevel, AcquireDictionary(dictionaryPath, compressionLevel)));
+    }
+
+    AZ::Name ZstdCompressionFactory::GetFactoryName() const
+    {
+        return m_name;
+    }
+
+    AZStd::shared_ptr<ZstdDictionary> ZstdCompressionFactory::AcquireDictionary(const AZStd::string& dictionaryPath, int compressionLevel)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_dictionaryMutex);
+        if (dictionaryPath == m_dictionaryPath && compressionLevel == m_dictionaryCompressionLevel)
+        {
+            return m_dictionary;
+        }
+
+        m_dictionary.reset();
+        m_dictionaryPath = dictionaryPath;
+        m_dictionaryCompressionLevel = compressionLevel;
+
+        if (dictionaryPath.empty())
+        {
+            return m_dictionary;
+        }
+
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(dictionaryPath);
+        if (!readResult.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to load zstd dictionary, compressing without one: %s", readResult.GetError().c_str());
+            return m_dictionary;
+        }
+
+        const AZStd::vector<AZ::u8>& dictionaryData = readResult.GetValue();
+        AZStd::shared_ptr<ZstdDictionary> dictionary = AZStd::make_shared<ZstdDictionary>(dictionaryData.data(), dictionaryData.size(), compressionLevel);
+        if (dictionary->IsValid())
+        {
+            m_dictionary = AZStd::move(dictionary);
+        }
+        return m_dictionary;
+    }
 }
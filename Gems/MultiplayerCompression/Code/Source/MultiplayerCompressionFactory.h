@@ -9,11 +9,16 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
 namespace MultiplayerCompression
 {
+    class ZstdDictionary;
+
     class MultiplayerCompressionFactory
         : public AzNetworking::ICompressorFactory
     {
@@ -29,4 +34,30 @@ namespace MultiplayerCompression
     private:
         const AZ::Name m_name = AZ::Name("MultiplayerCompressor");
     };
+
+    //! Factory for the zstd compressor, selected by setting net_UdpCompressor to MultiplayerZstdCompressor.
+    //! The dictionary named by net_ZstdDictionaryPath is loaded on first use and shared by all created compressors.
+    class ZstdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the AZ Name of this compressor factory
+        //! @return the AZ Name of this compressor factory
+        AZ::Name GetFactoryName() const override;
+
+    private:
+        //! Returns the dictionary for the current cvar settings, reloading it if the path or level changed.
+        AZStd::shared_ptr<ZstdDictionary> AcquireDictionary(const AZStd::string& dictionaryPath, int compressionLevel);
+
+        const AZ::Name m_name = AZ::Name("MultiplayerZstdCompressor");
+
+        AZStd::mutex m_dictionaryMutex;
+        AZStd::shared_ptr<ZstdDictionary> m_dictionary;
+        AZStd::string m_dictionaryPath;
+        int m_dictionaryCompressionLevel = 0;
+    };
 }
@@ -51,10 +51,20 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+
+        m_zstdCompressionFactory = new ZstdCompressionFactory();
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_zstdCompressionFactory);
+
+        AZ::Interface<PacketSampleCapture>::Register(&m_packetSampleCapture);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
+        AZ::Interface<PacketSampleCapture>::Unregister(&m_packetSampleCapture);
+
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdCompressionFactory->GetFactoryName());
+        delete m_zstdCompressionFactory;
+
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
     }
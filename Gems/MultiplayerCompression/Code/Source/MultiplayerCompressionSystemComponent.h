@@ -12,12 +12,14 @@
 #include <AzCore/std/containers/unordered_set.h>
 
 #include <MultiplayerCompressionFactory.h>
+#include <PacketSampleCapture.h>
 
 namespace MultiplayerCompression
 {
     /**
-    * System component whose sole purpose is to own a compression factory and expose it via EBUS
-    * so GridMate/Multiplayer Gem can easily ingest the compressor.
+    * System component whose sole purpose is to own the compression factories and expose them via EBUS
+    * so GridMate/Multiplayer Gem can easily ingest the compressors.
+    * Also owns the packet sample capture used to train zstd dictionaries.
     */
     class MultiplayerCompressionSystemComponent
         : public AZ::Component
@@ -41,5 +43,7 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        ZstdCompressionFactory* m_zstdCompressionFactory;
+        PacketSampleCapture m_packetSampleCapture;
     };
 }
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "PacketSampleCapture.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(uint32_t, net_CompressionMaxCapturedSamples, 100000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet payloads recorded while net_CompressionCaptureSamples is enabled");
+
+    void PacketSampleCapture::AddSample(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_sampleSizes.size() >= net_CompressionMaxCapturedSamples)
+        {
+            return;
+        }
+
+        const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(data);
+        m_sampleData.insert(m_sampleData.end(), bytes, bytes + size);
+        m_sampleSizes.push_back(size);
+    }
+
+    void PacketSampleCapture::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_sampleData.clear();
+        m_sampleSizes.clear();
+    }
+
+    size_t PacketSampleCapture::GetSampleCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_sampleSizes.size();
+    }
+
+    size_t PacketSampleCapture::GetSampleBytes() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_sampleData.size();
+    }
+
+    AZ::Outcome<void, AZStd::string> PacketSampleCapture::SaveSamples(AZStd::string_view filePath) const
+    {
+        AZStd::string fileContent;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            fileContent.reserve(m_sampleData.size() + m_sampleSizes.size() * sizeof(AZ::u32));
+
+            size_t sampleOffset = 0;
+            for (const size_t sampleSize : m_sampleSizes)
+            {
+                const AZ::u32 recordSize = aznumeric_cast<AZ::u32>(sampleSize);
+                fileContent.append(reinterpret_cast<const char*>(&recordSize), sizeof(recordSize));
+                fileContent.append(reinterpret_cast<const char*>(m_sampleData.data() + sampleOffset), sampleSize);
+                sampleOffset += sampleSize;
+            }
+        }
+
+        return AZ::Utils::WriteFile(fileContent, filePath);
+    }
+
+    AZ::Outcome<void, AZStd::string> PacketSampleCapture::LoadSamples(AZStd::string_view filePath)
+    {
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(filePath);
+        if (!readResult.IsSuccess())
+        {
+            return AZ::Failure(readResult.TakeError());
+        }
+
+        const AZStd::vector<AZ::u8>& fileContent = readResult.GetValue();
+        size_t readOffset = 0;
+        while (readOffset + sizeof(AZ::u32) <= fileContent.size())
+        {
+            AZ::u32 recordSize = 0;
+            memcpy(&recordSize, fileContent.data() + readOffset, sizeof(recordSize));
+            readOffset += sizeof(recordSize);
+
+            if (readOffset + recordSize > fileContent.size())
+            {
+                return AZ::Failure(AZStd::string::format("Truncated sample record at offset %zu in '%.*s'",
+                    readOffset, aznumeric_cast<int>(filePath.size()), filePath.data()));
+            }
+
+            AddSample(fileContent.data() + readOffset, recordSize);
+            readOffset += recordSize;
+        }
+
+        return AZ::Success();
+    }
+
+    AZ::Outcome<AZStd::vector<AZ::u8>, AZStd::string> PacketSampleCapture::TrainDictionary(size_t dictionaryCapacity) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_sampleSizes.empty())
+        {
+            return AZ::Failure(AZStd::string("No packet samples have been captured"));
+        }
+
+        AZStd::vector<AZ::u8> dictionary;
+        dictionary.resize_no_construct(dictionaryCapacity);
+
+        const size_t dictionarySize = ZDICT_trainFromBuffer(
+            dictionary.data(), dictionary.size(),
+            m_sampleData.data(), m_sampleSizes.data(), aznumeric_cast<unsigned>(m_sampleSizes.size()));
+
+        if (ZDICT_isError(dictionarySize))
+        {
+            return AZ::Failure(AZStd::string::format("Dictionary training failed on %zu samples: %s",
+                m_sampleSizes.size(), ZDICT_getErrorName(dictionarySize)));
+        }
+
+        dictionary.resize(dictionarySize);
+        return AZ::Success(AZStd::move(dictionary));
+    }
+
+    SampleCapturingCompressor::SampleCapturingCompressor(AZStd::unique_ptr<AzNetworking::ICompressor> compressor, PacketSampleCapture& capture)
+        : m_compressor(AZStd::move(compressor))
+        , m_capture(capture)
+    {
+        ;
+    }
+
+    AzNetworking::CompressorType SampleCapturingCompressor::GetType() const
+    {
+        return m_compressor->GetType();
+    }
+
+    bool SampleCapturingCompressor::Init()
+    {
+        return m_compressor->Init();
+    }
+
+    size_t SampleCapturingCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return m_compressor->GetMaxChunkSize(maxCompSize);
+    }
+
+    size_t SampleCapturingCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return m_compressor->GetMaxCompressedBufferSize(uncompSize);
+    }
+
+    AzNetworking::CompressorError SampleCapturingCompressor::Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize)
+    {
+        m_capture.AddSample(uncompData, uncompSize);
+        return m_compressor->Compress(uncompData, uncompSize, compData, compDataSize, compSize);
+    }
+
+    AzNetworking::CompressorError SampleCapturingCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize)
+    {
+        const AzNetworking::CompressorError result = m_compressor->Decompress(compData, compDataSize, uncompData, uncompDataSize, consumedSize, uncompSize);
+        if (result == AzNetworking::CompressorError::Ok)
+        {
+            // Received traffic is as representative as sent traffic, so capture both directions
+            m_capture.AddSample(uncompData, uncompSize);
+        }
+        return result;
+    }
+
+    void net_CompressionSaveSamples(const AZ::ConsoleCommandContainer& arguments)
+    {
+        PacketSampleCapture* capture = AZ::Interface<PacketSampleCapture>::Get();
+        if (capture == nullptr || arguments.size() < 1)
+        {
+            AZLOG_ERROR("Usage: net_CompressionSaveSamples <capture file path>");
+            return;
+        }
+
+        const AZStd::string filePath(arguments.front());
+        auto result = capture->SaveSamples(filePath);
+        if (!result.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to save packet samples: %s", result.GetError().c_str());
+            return;
+        }
+        AZLOG_INFO("Saved %zu packet samples to %s", capture->GetSampleCount(), filePath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(net_CompressionSaveSamples, AZ::ConsoleFunctorFlags::DontReplicate, "Writes captured packet payloads to a sample file for offline dictionary training");
+
+    void net_CompressionLoadSamples(const AZ::ConsoleCommandContainer& arguments)
+    {
+        PacketSampleCapture* capture = AZ::Interface<PacketSampleCapture>::Get();
+        if (capture == nullptr || arguments.size() < 1)
+        {
+            AZLOG_ERROR("Usage: net_CompressionLoadSamples <capture file path>");
+            return;
+        }
+
+        const AZStd::string filePath(arguments.front());
+        auto result = capture->LoadSamples(filePath);
+        if (!result.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to load packet samples: %s", result.GetError().c_str());
+            return;
+        }
+        AZLOG_INFO("Loaded packet samples from %s, %zu samples captured", filePath.c_str(), capture->GetSampleCount());
+    }
+    AZ_CONSOLEFREEFUNC(net_CompressionLoadSamples, AZ::ConsoleFunctorFlags::DontReplicate, "Appends packet payloads from a sample file to the current capture");
+
+    void net_CompressionClearSamples([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (PacketSampleCapture* capture = AZ::Interface<PacketSampleCapture>::Get())
+        {
+            capture->Clear();
+        }
+    }
+    AZ_CONSOLEFREEFUNC(net_CompressionClearSamples, AZ::ConsoleFunctorFlags::DontReplicate, "Discards all captured packet payloads");
+
+    void net_CompressionTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        PacketSampleCapture* capture = AZ::Interface<PacketSampleCapture>::Get();
+        if (capture == nullptr || arguments.size() < 1)
+        {
+            AZLOG_ERROR("Usage: net_CompressionTrainDictionary <dictionary file path> [dictionary size in bytes]");
+            return;
+        }
+
+        size_t dictionarySize = PacketSampleCapture::DefaultDictionarySize;
+        if (arguments.size() > 1 && !AZ::ConsoleTypeHelpers::StringToValue(dictionarySize, arguments[1]))
+        {
+            AZLOG_ERROR("Invalid dictionary size %.*s", aznumeric_cast<int>(arguments[1].size()), arguments[1].data());
+            return;
+        }
+
+        auto trainResult = capture->TrainDictionary(dictionarySize);
+        if (!trainResult.IsSuccess())
+        {
+            AZLOG_ERROR("%s", trainResult.GetError().c_str());
+            return;
+        }
+
+        const AZStd::vector<AZ::u8>& dictionary = trainResult.GetValue();
+        const AZStd::string filePath(arguments.front());
+        auto writeResult = AZ::Utils::WriteFile(AZStd::string_view(reinterpret_cast<const char*>(dictionary.data()), dictionary.size()), filePath);
+        if (!writeResult.IsSuccess())
+        {
+            AZLOG_ERROR("Failed to write dictionary: %s", writeResult.GetError().c_str());
+            return;
+        }
+        AZLOG_INFO("Trained %zu B dictionary from %zu packet samples, written to %s", dictionary.size(), capture->GetSampleCount(), filePath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(net_CompressionTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate, "Trains a zstd dictionary from captured packet payloads for use with net_ZstdDictionaryPath");
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+namespace MultiplayerCompression
+{
+    /**
+    * Records uncompressed packet payloads so a zstd dictionary can be trained from real traffic.
+    * Samples are stored back to back in a single buffer, which is the layout ZDICT_trainFromBuffer expects.
+    * Captures are saved as a sequence of [u32 size][payload] records.
+    */
+    class PacketSampleCapture
+    {
+    public:
+        AZ_RTTI(PacketSampleCapture, "{5E0A2B67-8C5D-4B0E-A5B1-0B6F2F8C3D41}");
+        AZ_CLASS_ALLOCATOR(PacketSampleCapture, AZ::SystemAllocator, 0);
+
+        //! Default dictionary capacity, zstd recommends roughly 100x smaller than the total sample size.
+        static constexpr size_t DefaultDictionarySize = 16 * 1024;
+
+        virtual ~PacketSampleCapture() = default;
+
+        //! Appends a single uncompressed payload, dropped once the configured sample limit is reached.
+        //! @param data pointer to the uncompressed payload
+        //! @param size size of the payload in bytes
+        void AddSample(const void* data, size_t size);
+
+        //! Discards all captured samples.
+        void Clear();
+
+        //! Returns the number of captured samples.
+        size_t GetSampleCount() const;
+
+        //! Returns the total number of captured payload bytes.
+        size_t GetSampleBytes() const;
+
+        //! Writes all captured samples to disk.
+        //! @param filePath path of the capture file to write
+        AZ::Outcome<void, AZStd::string> SaveSamples(AZStd::string_view filePath) const;
+
+        //! Appends the samples stored in a capture file previously written by SaveSamples.
+        //! @param filePath path of the capture file to read
+        AZ::Outcome<void, AZStd::string> LoadSamples(AZStd::string_view filePath);
+
+        //! Trains a zstd dictionary from the captured samples.
+        //! @param dictionaryCapacity maximum size of the dictionary in bytes
+        //! @return the trained dictionary, or an error string if training failed
+        AZ::Outcome<AZStd::vector<AZ::u8>, AZStd::string> TrainDictionary(size_t dictionaryCapacity = DefaultDictionarySize) const;
+
+    private:
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<AZ::u8> m_sampleData;
+        AZStd::vector<size_t> m_sampleSizes;
+    };
+
+    /**
+    * Compressor decorator that records each uncompressed payload into the PacketSampleCapture before forwarding it.
+    * Created by the compression factories in place of the wrapped compressor while net_CompressionCaptureSamples is set,
+    * so samples are taken from exactly the payloads UdpConnection hands to the compressor.
+    */
+    class SampleCapturingCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SampleCapturingCompressor, AZ::SystemAllocator, 0);
+
+        SampleCapturingCompressor(AZStd::unique_ptr<AzNetworking::ICompressor> compressor, PacketSampleCapture& capture);
+
+        AzNetworking::CompressorType GetType() const override;
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        AZStd::unique_ptr<AzNetworking::ICompressor> m_compressor;
+        PacketSampleCapture& m_capture;
+    };
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+
+#include <zstd.h>
+
+namespace MultiplayerCompression
+{
+    ZstdDictionary::ZstdDictionary(const void* dictData, size_t dictSize, int compressionLevel)
+    {
+        if (dictData == nullptr || dictSize == 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Zstd dictionary buffer is empty");
+            return;
+        }
+
+        // Both calls copy the dictionary content, so the caller is free to release dictData afterwards
+        m_cdict = ZSTD_createCDict(dictData, dictSize, compressionLevel);
+        m_ddict = ZSTD_createDDict(dictData, dictSize);
+        m_dictionaryId = ZSTD_getDictID_fromDict(dictData, dictSize);
+
+        AZ_Warning("Multiplayer Compressor", IsValid(), "Failed to create zstd dictionary from %zu bytes", dictSize);
+    }
+
+    ZstdDictionary::~ZstdDictionary()
+    {
+        ZSTD_freeCDict(m_cdict);
+        ZSTD_freeDDict(m_ddict);
+    }
+
+    bool ZstdDictionary::IsValid() const
+    {
+        return (m_cdict != nullptr) && (m_ddict != nullptr);
+    }
+
+    AZ::u32 ZstdDictionary::GetDictionaryId() const
+    {
+        return m_dictionaryId;
+    }
+
+    ZstdCompressor::ZstdCompressor(int compressionLevel, AZStd::shared_ptr<ZstdDictionary> dictionary)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_compressionLevel(compressionLevel)
+    {
+        if (m_dictionary && !m_dictionary->IsValid())
+        {
+            m_dictionary.reset();
+        }
+
+        // Contexts are retained for the lifetime of the compressor to avoid re-allocating zstd state per packet
+        m_cctx = ZSTD_createCCtx();
+        m_dctx = ZSTD_createDCtx();
+    }
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        ZSTD_freeCCtx(m_cctx);
+        ZSTD_freeDCtx(m_dctx);
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        return (m_cctx != nullptr) && (m_dctx != nullptr);
+    }
+
+    bool ZstdCompressor::HasDictionary() const
+    {
+        return m_dictionary != nullptr;
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_cctx == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Zstd compression context is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t compWorstCaseSize = ZSTD_compressBound(uncompSize);
+        AZ_Warning("Multiplayer Compressor", compDataSize >= compWorstCaseSize, "Outbuffer size (%zu B) passed to Compress() is less than estimated worst case (%zu B)", compDataSize, compWorstCaseSize);
+
+        const size_t result = HasDictionary()
+            ? ZSTD_compress_usingCDict(m_cctx, compData, compDataSize, uncompData, uncompSize, m_dictionary->GetCompressionDictionary())
+            : ZSTD_compressCCtx(m_cctx, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+
+        if (ZSTD_isError(result))
+        {
+            compSize = 0;
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B) error:(%s)", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return (compDataSize < compWorstCaseSize)
+                ? AzNetworking::CompressorError::InsufficientBuffer
+                : AzNetworking::CompressorError::CorruptData;
+        }
+
+        compSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_dctx == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Zstd decompression context is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t result = HasDictionary()
+            ? ZSTD_decompress_usingDDict(m_dctx, uncompData, uncompDataSize, compData, compDataSize, m_dictionary->GetDecompressionDictionary())
+            : ZSTD_decompressDCtx(m_dctx, uncompData, uncompDataSize, compData, compDataSize);
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            // Corrupt frames, dictionary mismatches and undersized output buffers are all treated as corrupt data
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B) error:(%s)", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        uncompSizeOut = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    static const char* ZstdCompressorName = "Zstd";
+    static const AzNetworking::CompressorType ZstdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZstdCompressorName)));
+
+    //! Default compression level used when no level is supplied, small packets favour speed over ratio.
+    static constexpr int ZstdDefaultCompressionLevel = 3;
+
+    /**
+    * Digested zstd dictionary, shared between all compressors created by the same factory.
+    * Digesting a dictionary is expensive compared to compressing a packet, so this is done once up front.
+    * Both peers of a connection must use the same dictionary, frames carry the dictionary id and will fail to
+    * decompress against a different one.
+    */
+    class ZstdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionary, AZ::SystemAllocator, 0);
+
+        ZstdDictionary(const void* dictData, size_t dictSize, int compressionLevel);
+        ~ZstdDictionary();
+
+        //! Returns true if both the compression and decompression dictionaries were created successfully.
+        bool IsValid() const;
+
+        //! Returns the id embedded in the dictionary, or 0 for raw content dictionaries.
+        AZ::u32 GetDictionaryId() const;
+
+        ZSTD_CDict_s* GetCompressionDictionary() const { return m_cdict; }
+        ZSTD_DDict_s* GetDecompressionDictionary() const { return m_ddict; }
+
+    private:
+        ZSTD_CDict_s* m_cdict = nullptr;
+        ZSTD_DDict_s* m_ddict = nullptr;
+        AZ::u32 m_dictionaryId = 0;
+    };
+
+    /**
+    * Implements a zstd Compressor against AzNetworking's Compressor interface for use with the Multiplayer Gem.
+    * Entity update packets are small and highly repetitive, a dictionary trained from captured packet samples
+    * lets zstd reference common byte sequences without them appearing earlier in the same packet.
+    * When no dictionary is provided the compressor falls back to plain zstd frames.
+    */
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator, 0);
+
+        ZstdCompressor(int compressionLevel = ZstdDefaultCompressionLevel, AZStd::shared_ptr<ZstdDictionary> dictionary = nullptr);
+        ~ZstdCompressor() override;
+
+        const char* GetName() const { return ZstdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZstdCompressorType; };
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+        //! Returns true if this compressor is compressing against a trained dictionary.
+        bool HasDictionary() const;
+
+    private:
+        AZStd::shared_ptr<ZstdDictionary> m_dictionary;
+        ZSTD_CCtx_s* m_cctx = nullptr;
+        ZSTD_DCtx_s* m_dctx = nullptr;
+        int m_compressionLevel = ZstdDefaultCompressionLevel;
+    };
+}
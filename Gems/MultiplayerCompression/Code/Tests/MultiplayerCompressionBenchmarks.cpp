@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+
+#include <LZ4Compressor.h>
+#include <PacketSampleCapture.h>
+#include <ZstdCompressor.h>
+
+#include <SyntheticPacketGenerator.h>
+
+#include <benchmark/benchmark.h>
+
+namespace MultiplayerCompressionTests
+{
+    /*
+     * Compresses a corpus of synthetic entity update packets, one packet per iteration, so the reported time is ns/packet.
+     * The dictionary is trained on a separate corpus than the one being compressed to avoid overstating the ratio.
+     */
+    class CompressionBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t TrainingPacketCount = 8192;
+        static constexpr size_t BenchmarkPacketCount = 1024;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void internalSetUp()
+        {
+            m_capture = AZStd::make_unique<MultiplayerCompression::PacketSampleCapture>();
+            SyntheticPacketGenerator trainingGenerator(1);
+            for (size_t i = 0; i < TrainingPacketCount; ++i)
+            {
+                const AZStd::vector<AZ::u8> packet = trainingGenerator.Generate();
+                m_capture->AddSample(packet.data(), packet.size());
+            }
+
+            auto trainResult = m_capture->TrainDictionary();
+            if (trainResult.IsSuccess())
+            {
+                const AZStd::vector<AZ::u8>& dictionary = trainResult.GetValue();
+                m_dictionary = AZStd::make_shared<MultiplayerCompression::ZstdDictionary>(
+                    dictionary.data(), dictionary.size(), MultiplayerCompression::ZstdDefaultCompressionLevel);
+            }
+
+            SyntheticPacketGenerator packetGenerator(2);
+            m_packets.resize(BenchmarkPacketCount);
+            for (AZStd::vector<AZ::u8>& packet : m_packets)
+            {
+                packet = packetGenerator.Generate();
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_packets = {};
+            m_dictionary.reset();
+            m_capture.reset();
+        }
+
+        void RunCompressBenchmark(AzNetworking::ICompressor& compressor, ::benchmark::State& state)
+        {
+            AzNetworking::UdpPacketEncodingBuffer compressedBuffer;
+            size_t uncompressedBytes = 0;
+            size_t compressedBytes = 0;
+            size_t packetIndex = 0;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                const AZStd::vector<AZ::u8>& packet = m_packets[packetIndex];
+                packetIndex = (packetIndex + 1) % m_packets.size();
+
+                size_t compressedSize = 0;
+                compressor.Compress(packet.data(), packet.size(), compressedBuffer.GetBuffer(), compressedBuffer.GetCapacity(), compressedSize);
+                benchmark::DoNotOptimize(compressedSize);
+
+                uncompressedBytes += packet.size();
+                compressedBytes += compressedSize;
+            }
+
+            state.SetItemsProcessed(state.iterations());
+            state.SetBytesProcessed(uncompressedBytes);
+            state.counters["Ratio"] = (compressedBytes > 0) ? static_cast<double>(uncompressedBytes) / static_cast<double>(compressedBytes) : 0.0;
+        }
+
+        void RunDecompressBenchmark(AzNetworking::ICompressor& compressor, ::benchmark::State& state)
+        {
+            AZStd::vector<AZStd::vector<AZ::u8>> compressedPackets;
+            compressedPackets.reserve(m_packets.size());
+            for (const AZStd::vector<AZ::u8>& packet : m_packets)
+            {
+                AZStd::vector<AZ::u8> compressed(compressor.GetMaxCompressedBufferSize(packet.size()));
+                size_t compressedSize = 0;
+                compressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize);
+                compressed.resize(compressedSize);
+                compressedPackets.emplace_back(AZStd::move(compressed));
+            }
+
+            AzNetworking::UdpPacketEncodingBuffer uncompressedBuffer;
+            size_t uncompressedBytes = 0;
+            size_t packetIndex = 0;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                const AZStd::vector<AZ::u8>& packet = compressedPackets[packetIndex];
+                packetIndex = (packetIndex + 1) % compressedPackets.size();
+
+                size_t consumedSize = 0;
+                size_t uncompressedSize = 0;
+                compressor.Decompress(packet.data(), packet.size(), uncompressedBuffer.GetBuffer(), uncompressedBuffer.GetCapacity(), consumedSize, uncompressedSize);
+                benchmark::DoNotOptimize(uncompressedSize);
+
+                uncompressedBytes += uncompressedSize;
+            }
+
+            state.SetItemsProcessed(state.iterations());
+            state.SetBytesProcessed(uncompressedBytes);
+        }
+
+        AZStd::unique_ptr<MultiplayerCompression::PacketSampleCapture> m_capture;
+        AZStd::shared_ptr<MultiplayerCompression::ZstdDictionary> m_dictionary;
+        AZStd::vector<AZStd::vector<AZ::u8>> m_packets;
+    };
+
+    BENCHMARK_F(CompressionBenchmarkFixture, LZ4_Compress)(benchmark::State& state)
+    {
+        MultiplayerCompression::LZ4Compressor compressor;
+        RunCompressBenchmark(compressor, state);
+    }
+
+    BENCHMARK_F(CompressionBenchmarkFixture, Zstd_Compress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor;
+        RunCompressBenchmark(compressor, state);
+    }
+
+    BENCHMARK_F(CompressionBenchmarkFixture, ZstdDictionary_Compress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor(MultiplayerCompression::ZstdDefaultCompressionLevel, m_dictionary);
+        RunCompressBenchmark(compressor, state);
+    }
+
+    BENCHMARK_F(CompressionBenchmarkFixture, LZ4_Decompress)(benchmark::State& state)
+    {
+        MultiplayerCompression::LZ4Compressor compressor;
+        RunDecompressBenchmark(compressor, state);
+    }
+
+    BENCHMARK_F(CompressionBenchmarkFixture, Zstd_Decompress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor;
+        RunDecompressBenchmark(compressor, state);
+    }
+
+    BENCHMARK_F(CompressionBenchmarkFixture, ZstdDictionary_Decompress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor(MultiplayerCompression::ZstdDefaultCompressionLevel, m_dictionary);
+        RunDecompressBenchmark(compressor, state);
+    }
+}
+#endif
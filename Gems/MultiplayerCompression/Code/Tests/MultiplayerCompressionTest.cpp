@@ -10,9 +10,13 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <PacketSampleCapture.h>
+#include <ZstdCompressor.h>
+#include <SyntheticPacketGenerator.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
@@ -126,4 +130,133 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZstdRoundTripTest)
+{
+    MultiplayerCompressionTests::SyntheticPacketGenerator generator;
+    const AZStd::vector<AZ::u8> packet = generator.Generate();
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor;
+    ASSERT_TRUE(zstdCompressor.Init());
+    EXPECT_FALSE(zstdCompressor.HasDictionary());
+
+    AZStd::vector<AZ::u8> compressed(zstdCompressor.GetMaxCompressedBufferSize(packet.size()));
+    size_t compressedSize = 0;
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize);
+    ASSERT_EQ(compressStatus, AzNetworking::CompressorError::Ok);
+    EXPECT_GT(compressedSize, 0);
+
+    AZStd::vector<AZ::u8> decompressed(packet.size());
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize);
+    ASSERT_EQ(decompressStatus, AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(consumedSize, compressedSize);
+    EXPECT_EQ(uncompressedSize, packet.size());
+    EXPECT_EQ(memcmp(decompressed.data(), packet.data(), packet.size()), 0);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZstdDictionaryTest)
+{
+    MultiplayerCompression::PacketSampleCapture capture;
+    MultiplayerCompressionTests::SyntheticPacketGenerator trainingGenerator(1);
+    for (int i = 0; i < 4096; ++i)
+    {
+        const AZStd::vector<AZ::u8> sample = trainingGenerator.Generate();
+        capture.AddSample(sample.data(), sample.size());
+    }
+    EXPECT_EQ(capture.GetSampleCount(), 4096);
+
+    auto trainResult = capture.TrainDictionary(4 * 1024);
+    ASSERT_TRUE(trainResult.IsSuccess());
+    const AZStd::vector<AZ::u8>& dictionaryData = trainResult.GetValue();
+    auto dictionary = AZStd::make_shared<MultiplayerCompression::ZstdDictionary>(dictionaryData.data(), dictionaryData.size(), MultiplayerCompression::ZstdDefaultCompressionLevel);
+    ASSERT_TRUE(dictionary->IsValid());
+
+    MultiplayerCompression::ZstdCompressor plainCompressor;
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor(MultiplayerCompression::ZstdDefaultCompressionLevel, dictionary);
+    EXPECT_TRUE(dictionaryCompressor.HasDictionary());
+
+    MultiplayerCompressionTests::SyntheticPacketGenerator packetGenerator(2);
+    size_t plainBytes = 0;
+    size_t dictionaryBytes = 0;
+    for (int i = 0; i < 64; ++i)
+    {
+        const AZStd::vector<AZ::u8> packet = packetGenerator.Generate();
+        AZStd::vector<AZ::u8> compressed(dictionaryCompressor.GetMaxCompressedBufferSize(packet.size()));
+
+        size_t compressedSize = 0;
+        ASSERT_EQ(plainCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+        plainBytes += compressedSize;
+
+        ASSERT_EQ(dictionaryCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+        dictionaryBytes += compressedSize;
+
+        AZStd::vector<AZ::u8> decompressed(packet.size());
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 0;
+        ASSERT_EQ(dictionaryCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+        ASSERT_EQ(uncompressedSize, packet.size());
+        EXPECT_EQ(memcmp(decompressed.data(), packet.data(), packet.size()), 0);
+    }
+
+    // Small repetitive packets are exactly where a trained dictionary should beat plain frames
+    EXPECT_LT(dictionaryBytes, plainBytes);
+    AZ_TracePrintf("Multiplayer Compression Test", "Zstd Compressed Size:(%zu B) Zstd Dictionary Compressed Size:(%zu B) \n", plainBytes, dictionaryBytes);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZstdNullTest)
+{
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor;
+
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(nullptr, 4, nullptr, 4, compressedSize);
+    EXPECT_TRUE(compressStatus == AzNetworking::CompressorError::Uninitialized);
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(nullptr, 4, nullptr, 4, consumedSize, uncompressedSize);
+    EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZstdCorruptDataTest)
+{
+    char garbage[64];
+    memset(garbage, 0xAB, sizeof(garbage));
+    char pBuffer[256];
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor;
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(garbage, sizeof(garbage), pBuffer, sizeof(pBuffer), consumedSize, uncompressedSize);
+    EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_SampleCaptureTest)
+{
+    MultiplayerCompression::PacketSampleCapture capture;
+    MultiplayerCompression::SampleCapturingCompressor capturingCompressor(AZStd::make_unique<MultiplayerCompression::ZstdCompressor>(), capture);
+    EXPECT_EQ(capturingCompressor.GetType(), MultiplayerCompression::ZstdCompressorType);
+
+    MultiplayerCompressionTests::SyntheticPacketGenerator generator;
+    const AZStd::vector<AZ::u8> packet = generator.Generate();
+
+    AZStd::vector<AZ::u8> compressed(capturingCompressor.GetMaxCompressedBufferSize(packet.size()));
+    size_t compressedSize = 0;
+    ASSERT_EQ(capturingCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(capture.GetSampleCount(), 1);
+    EXPECT_EQ(capture.GetSampleBytes(), packet.size());
+
+    AZStd::vector<AZ::u8> decompressed(packet.size());
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    ASSERT_EQ(capturingCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(capture.GetSampleCount(), 2);
+
+    capture.Clear();
+    EXPECT_EQ(capture.GetSampleCount(), 0);
+    EXPECT_FALSE(capture.TrainDictionary().IsSuccess());
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace MultiplayerCompressionTests
+{
+    //! Generates payloads shaped like entity update packets: a small header followed by a run of
+    //! per-entity records holding a net entity id, a dirty bit mask and quantized transform deltas.
+    //! Consecutive packets share most of their structure, which is what a trained dictionary exploits.
+    class SyntheticPacketGenerator
+    {
+    public:
+        explicit SyntheticPacketGenerator(AZ::u64 seed = 1234)
+            : m_random(seed)
+        {
+        }
+
+        AZStd::vector<AZ::u8> Generate()
+        {
+            AZStd::vector<AZ::u8> packet;
+            const AZ::u32 entityCount = 4 + m_random.GetRandom() % 12;
+
+            // Packet header: type, sequence and entity record count
+            Write<AZ::u8>(packet, 0x0B);
+            Write<AZ::u16>(packet, static_cast<AZ::u16>(m_sequence++));
+            Write<AZ::u8>(packet, static_cast<AZ::u8>(entityCount));
+
+            for (AZ::u32 i = 0; i < entityCount; ++i)
+            {
+                const AZ::u32 netEntityId = 1000 + m_random.GetRandom() % 64;
+                Write<AZ::u32>(packet, netEntityId);
+
+                // Most updates only touch the transform component
+                const AZ::u8 dirtyMask = (m_random.GetRandom() % 8 == 0) ? 0x0F : 0x03;
+                Write<AZ::u8>(packet, dirtyMask);
+                Write<AZ::u16>(packet, 0x7F00); // Transform component index
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    // Quantized positions drift slowly, upper bytes rarely change
+                    Write<AZ::u16>(packet, static_cast<AZ::u16>(0x4000 + (netEntityId << 4) + m_random.GetRandom() % 16));
+                }
+                if (dirtyMask & 0x0C)
+                {
+                    Write<AZ::u16>(packet, 0x3C00); // Health component index
+                    Write<AZ::u32>(packet, 100 - m_random.GetRandom() % 4);
+                }
+            }
+            return packet;
+        }
+
+    private:
+        template <typename TYPE>
+        static void Write(AZStd::vector<AZ::u8>& packet, TYPE value)
+        {
+            const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(&value);
+            packet.insert(packet.end(), bytes, bytes + sizeof(TYPE));
+        }
+
+        AZ::SimpleLcgRandom m_random;
+        AZ::u32 m_sequence = 0;
+    };
+}
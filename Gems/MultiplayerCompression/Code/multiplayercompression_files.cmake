@@ -13,4 +13,8 @@ set(FILES
     Source/MultiplayerCompressionFactory.h
     Source/MultiplayerCompressionSystemComponent.cpp
     Source/MultiplayerCompressionSystemComponent.h
+    Source/PacketSampleCapture.cpp
+    Source/PacketSampleCapture.h
+    Source/ZstdCompressor.cpp
+    Source/ZstdCompressor.h
 )
@@ -49,7 +49,15 @@ namespace PhysX
 
         static PhysXSystemConfiguration CreateDefault();
 
+        //! The scheduler the tasks of the PhysX simulation run on.
+        enum class CpuDispatcherType : AZ::u8
+        {
+            JobManager, //!< Run PhysX tasks as jobs on the AZ::JobManager (default).
+            TaskGraph //!< Run PhysX tasks on the AZ::TaskExecutor workers, shared with the rest of the engine.
+        };
+
         WindConfiguration m_windConfiguration; //!< Wind configuration for PhysX.
+        CpuDispatcherType m_cpuDispatcherType = CpuDispatcherType::JobManager; //!< Scheduler for the PhysX simulation tasks, applied when no scene exists.
 
         bool operator==(const PhysXSystemConfiguration& other) const;
         bool operator!=(const PhysXSystemConfiguration& other) const;
@@ -90,8 +90,9 @@ namespace PhysX
         if (auto* serializeContext = azdynamic_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<PhysX::PhysXSystemConfiguration, AzPhysics::SystemConfiguration>()
-                ->Version(2, &PhysXInternal::PhysXSystemConfigurationConverter)
+                ->Version(3, &PhysXInternal::PhysXSystemConfigurationConverter)
                 ->Field("WindConfiguration", &PhysXSystemConfiguration::m_windConfiguration)
+                ->Field("CpuDispatcherType", &PhysXSystemConfiguration::m_cpuDispatcherType)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -100,6 +101,11 @@ namespace PhysX
                 editContext->Class<PhysX::PhysXSystemConfiguration>("System Configuration", "PhysX system configuration")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::ComboBox, &PhysXSystemConfiguration::m_cpuDispatcherType,
+                        "CPU dispatcher", "Scheduler the PhysX simulation tasks run on. Task Graph shares the worker threads with "
+                        "the rest of the engine. Changes take effect when no physics scene exists.")
+                        ->EnumAttribute(PhysXSystemConfiguration::CpuDispatcherType::JobManager, "Job Manager")
+                        ->EnumAttribute(PhysXSystemConfiguration::CpuDispatcherType::TaskGraph, "Task Graph")
                     ;
             }
         }
@@ -115,7 +121,8 @@ namespace PhysX
     bool PhysXSystemConfiguration::operator==(const PhysXSystemConfiguration& other) const
     {
         return AzPhysics::SystemConfiguration::operator==(other) &&
-            m_windConfiguration == other.m_windConfiguration
+            m_windConfiguration == other.m_windConfiguration &&
+            m_cpuDispatcherType == other.m_cpuDispatcherType
             ;
     }
 
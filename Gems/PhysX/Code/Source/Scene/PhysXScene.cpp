@@ -8,6 +8,10 @@
 #include <Scene/PhysXScene.h>
 
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -492,6 +496,9 @@ namespace PhysX
 
     PhysXScene::~PhysXScene()
     {
+        // async scene queries access the PxScene from worker threads, they need to finish first
+        WaitForAsyncSceneQueries();
+
         m_physicsSystemConfigChanged.Disconnect();
 
         s_overlapBuffer.swap({});
@@ -950,27 +957,116 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        const size_t numRequests = requests.size();
+        AzPhysics::SceneQueryHitsList results(numRequests);
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t numWorkers = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+        const size_t numJobs = AZStd::min(numWorkers, numRequests / MinSceneQueryBatchSizePerJob);
+        if (numJobs <= 1)
         {
-            results.emplace_back(QueryScene(request.get()));
+            QuerySceneBatchRange(requests, results, 0, numRequests);
+            return results;
         }
+
+        // Split the requests in contiguous ranges, one per job. Each query uses its own filter callback and
+        // the hit buffers are thread local, so the only state shared between the jobs is the scene read lock.
+        const size_t requestsPerJob = (numRequests + numJobs - 1) / numJobs;
+        AZ::JobCompletion jobCompletion;
+        for (size_t begin = requestsPerJob; begin < numRequests; begin += requestsPerJob)
+        {
+            const size_t end = AZStd::min(begin + requestsPerJob, numRequests);
+            AZ::Job* job = AZ::CreateJobFunction([this, &requests, &results, begin, end]()
+                {
+                    QuerySceneBatchRange(requests, results, begin, end);
+                }, true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        // the calling thread processes the first range itself, rather than idling until the jobs are done
+        QuerySceneBatchRange(requests, results, 0, requestsPerJob);
+        jobCompletion.StartAndWaitForCompletion();
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    void PhysXScene::QuerySceneBatchRange(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results,
+        size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            results[i] = QueryScene(requests[i].get());
+        }
+    }
+
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
+    {
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        // the request is owned by the caller and has to stay valid until the callback is called
+        return StartAsyncSceneQueryJob([this, requestId, request, callback = AZStd::move(callback)]()
+            {
+                callback(requestId, QueryScene(request));
+            });
+    }
+
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (!callback)
+        {
+            return false;
+        }
+
+        // copying the request list shares ownership of the requests with the job
+        return StartAsyncSceneQueryJob([this, requestId, requests, callback = AZStd::move(callback)]()
+            {
+                callback(requestId, QuerySceneBatch(requests));
+            });
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    bool PhysXScene::StartAsyncSceneQueryJob(AZStd::function<void()>&& query)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext == nullptr)
+        {
+            AZ_Warning("PhysXScene", false, "Async scene queries require the job manager.");
+            return false;
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+            ++m_numPendingAsyncSceneQueries;
+        }
+
+        AZ::Job* job = AZ::CreateJobFunction([this, query = AZStd::move(query)]()
+            {
+                AZ_PROFILE_SCOPE(Physics, "PhysXScene::AsyncSceneQuery");
+                query();
+
+                AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+                if (--m_numPendingAsyncSceneQueries == 0)
+                {
+                    m_asyncSceneQueryCondition.notify_all();
+                }
+            }, true, jobContext);
+        job->Start();
+        return true;
+    }
+
+    void PhysXScene::WaitForAsyncSceneQueries()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+        m_asyncSceneQueryCondition.wait(lock, [this]()
+            {
+                return m_numPendingAsyncSceneQueries == 0;
+            });
     }
 
     void PhysXScene::SuppressCollisionEvents(
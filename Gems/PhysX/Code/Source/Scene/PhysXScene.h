@@ -12,6 +12,8 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
@@ -79,6 +81,10 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! The minimum number of requests each job processes when a scene query batch is split over the job system.
+        //! Smaller batches are processed on the calling thread, as the job overhead would outweigh the gain.
+        static constexpr size_t MinSceneQueryBatchSizePerJob = 32;
+
     private:
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
@@ -90,6 +96,14 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        //! Run a range of requests from a scene query batch, writing the hits to the matching entries of the results.
+        void QuerySceneBatchRange(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results,
+            size_t begin, size_t end);
+
+        //! Start a job that runs an async scene query, which keeps the scene alive until the job has finished.
+        bool StartAsyncSceneQueryJob(AZStd::function<void()>&& query);
+        void WaitForAsyncSceneQueries();
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
@@ -112,6 +126,10 @@ namespace PhysX
         AZ::u64 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u64 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
 
+        AZStd::mutex m_asyncSceneQueryMutex;
+        AZStd::condition_variable m_asyncSceneQueryCondition; //!< Signaled when the last pending async scene query has finished.
+        AZ::u32 m_numPendingAsyncSceneQueries = 0; //!< The number of async scene query jobs that have been started but not finished.
+
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
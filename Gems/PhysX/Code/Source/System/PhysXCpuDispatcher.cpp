@@ -6,16 +6,42 @@
  *
  */
 
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/parallel/thread.h>
 #include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
 
 namespace PhysX
 {
+    namespace
+    {
+        const AZ::TaskDescriptor PhysXTaskDescriptor{ "PhysX Task", "Physics" };
+
+        void RunPhysXTask(physx::PxBaseTask& pxTask)
+        {
+            AZ_PROFILE_SCOPE(Physics, pxTask.getName());
+            pxTask.run();
+            pxTask.release();
+        }
+    } // namespace
+
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
     {
         return aznew PhysXCpuDispatcher();
     }
 
+    PhysXTaskGraphCpuDispatcher* PhysXTaskGraphCpuDispatcherCreate()
+    {
+        auto* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (!taskGraphActiveInterface)
+        {
+            return nullptr;
+        }
+        return aznew PhysXTaskGraphCpuDispatcher(AZ::TaskExecutor::Instance());
+    }
+
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
         auto azJob = aznew PhysXJob(task);
@@ -26,5 +52,78 @@ namespace PhysX
     {
         return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
     }
-} // namespace PhysX
 
+    PhysXTaskGraphCpuDispatcher::PhysXTaskGraphCpuDispatcher(AZ::TaskExecutor& executor)
+        : m_executor(executor)
+    {
+        for (PooledTask& pooledTask : m_taskPool)
+        {
+            pooledTask.m_taskGraph.AddTask(PhysXTaskDescriptor, [&pooledTask]()
+                {
+                    RunPhysXTask(*pooledTask.m_pxTask);
+                    pooledTask.m_pxTask = nullptr;
+                    pooledTask.m_claimed = false;
+                });
+        }
+    }
+
+    PhysXTaskGraphCpuDispatcher::~PhysXTaskGraphCpuDispatcher()
+    {
+        // the scenes are released before the dispatcher, so this only waits for the tails of the last tasks
+        for (PooledTask& pooledTask : m_taskPool)
+        {
+            while (pooledTask.m_taskGraph.IsSubmitted())
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+    }
+
+    PhysXTaskGraphCpuDispatcher::PooledTask* PhysXTaskGraphCpuDispatcher::ClaimPooledTask()
+    {
+        const AZ::u32 start = m_nextPooledTask++;
+        for (AZ::u32 i = 0; i < TaskPoolSize; ++i)
+        {
+            PooledTask& pooledTask = m_taskPool[(start + i) % TaskPoolSize];
+            bool expected = false;
+            if (!pooledTask.m_claimed.compare_exchange_strong(expected, true))
+            {
+                continue;
+            }
+
+            // The claim is released at the end of the task, while the executor still accesses the task graph
+            // until it has finished. The graph can only be resubmitted once it is no longer in flight.
+            if (pooledTask.m_taskGraph.IsSubmitted())
+            {
+                pooledTask.m_claimed = false;
+                continue;
+            }
+
+            return &pooledTask;
+        }
+        return nullptr;
+    }
+
+    void PhysXTaskGraphCpuDispatcher::submitTask(physx::PxBaseTask& task)
+    {
+        if (PooledTask* pooledTask = ClaimPooledTask())
+        {
+            pooledTask->m_pxTask = &task;
+            pooledTask->m_taskGraph.SubmitOnExecutor(m_executor);
+            return;
+        }
+
+        AZ::TaskGraph taskGraph;
+        taskGraph.AddTask(PhysXTaskDescriptor, [pxTask = &task]()
+            {
+                RunPhysXTask(*pxTask);
+            });
+        taskGraph.Detach();
+        taskGraph.SubmitOnExecutor(m_executor);
+    }
+
+    physx::PxU32 PhysXTaskGraphCpuDispatcher::getWorkerCount() const
+    {
+        return m_executor.GetThreadCount();
+    }
+} // namespace PhysX
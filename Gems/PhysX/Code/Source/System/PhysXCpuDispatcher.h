@@ -7,9 +7,17 @@
  */
 
 #pragma once
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <PxPhysicsAPI.h>
 #include <System/PhysXAllocator.h>
 
+namespace AZ
+{
+    class TaskExecutor;
+}
+
 namespace PhysX
 {
     //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
@@ -28,6 +36,46 @@ namespace PhysX
         physx::PxU32 getWorkerCount() const override;
     };
 
+    //! CPU dispatcher which runs tasks submitted by PhysX on the AZ::TaskExecutor workers.
+    //! Every PhysX task is wrapped in a retained single task graph from a fixed pool, which is resubmitted
+    //! instead of allocating a task graph per PhysX task. Only when all pooled graphs are in flight, a
+    //! detached task graph is allocated for the task.
+    class PhysXTaskGraphCpuDispatcher
+        : public physx::PxCpuDispatcher
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PhysXTaskGraphCpuDispatcher, PhysXAllocator, 0);
+
+        //! The number of pooled task graphs, which bounds the PhysX tasks in flight without allocations.
+        static constexpr size_t TaskPoolSize = 256;
+
+        explicit PhysXTaskGraphCpuDispatcher(AZ::TaskExecutor& executor);
+        ~PhysXTaskGraphCpuDispatcher();
+
+    private:
+        // PxCpuDispatcher implementation
+        void submitTask(physx::PxBaseTask& task) override;
+        physx::PxU32 getWorkerCount() const override;
+
+        struct PooledTask
+        {
+            AZ::TaskGraph m_taskGraph;
+            physx::PxBaseTask* m_pxTask = nullptr;
+            AZStd::atomic_bool m_claimed{ false }; //!< Set while a PhysX task is assigned, cleared once the task has run.
+        };
+
+        //! Claims a pooled task whose task graph is not in flight, or returns nullptr when all of them are busy.
+        PooledTask* ClaimPooledTask();
+
+        AZ::TaskExecutor& m_executor;
+        AZStd::array<PooledTask, TaskPoolSize> m_taskPool;
+        AZStd::atomic<AZ::u32> m_nextPooledTask{ 0 };
+    };
+
     //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate();
+
+    //! Creates a CPU dispatcher which runs tasks submitted by PhysX on the global AZ::TaskExecutor.
+    //! Returns nullptr when the task graph system is not active.
+    PhysXTaskGraphCpuDispatcher* PhysXTaskGraphCpuDispatcherCreate();
 } // namespace PhysX
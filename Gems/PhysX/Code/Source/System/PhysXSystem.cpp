@@ -7,6 +7,7 @@
  */
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
 
 #include <Scene/PhysXScene.h>
 #include <System/PhysXSystem.h>
@@ -204,6 +205,8 @@ namespace PhysX
             return AzPhysics::InvalidSceneHandle;
         }
 
+        UpdateCpuDispatcher();
+
         if (!m_freeSceneSlots.empty()) //fill any free slots first before increasing the size of the scene list vector.
         {
             AzPhysics::SceneIndex freeIndex = m_freeSceneSlots.front();
@@ -417,15 +420,53 @@ namespace PhysX
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
 
         // Set up CPU dispatcher
+        m_cpuDispatcherType = m_systemConfig.m_cpuDispatcherType;
+        m_cpuDispatcher = CreateCpuDispatcher(m_cpuDispatcherType);
+
+        PxSetProfilerCallback(&m_pxAzProfilerCallback);
+    }
+
+    physx::PxCpuDispatcher* PhysXSystem::CreateCpuDispatcher(PhysXSystemConfiguration::CpuDispatcherType type)
+    {
+        if (type == PhysXSystemConfiguration::CpuDispatcherType::TaskGraph)
+        {
+            if (physx::PxCpuDispatcher* taskGraphDispatcher = PhysXTaskGraphCpuDispatcherCreate())
+            {
+                return taskGraphDispatcher;
+            }
+            AZ_Warning("PhysXSystem", false, "The task graph system is not active, PhysX tasks will run on the job manager instead.");
+        }
+
 #if defined(AZ_PLATFORM_LINUX)
         // Temporary workaround for linux. At the moment using AzPhysXCpuDispatcher results in an assert at
         // PhysX mutex indicating it must be unlocked only by the thread that has already acquired lock.
-        m_cpuDispatcher = physx::PxDefaultCpuDispatcherCreate(0);
+        return physx::PxDefaultCpuDispatcherCreate(0);
 #else
-        m_cpuDispatcher = PhysXCpuDispatcherCreate();
+        return PhysXCpuDispatcherCreate();
 #endif
+    }
 
-        PxSetProfilerCallback(&m_pxAzProfilerCallback);
+    void PhysXSystem::UpdateCpuDispatcher()
+    {
+        if (m_cpuDispatcherType == m_systemConfig.m_cpuDispatcherType)
+        {
+            return;
+        }
+
+        // the scenes keep using the dispatcher they were created with, so it can only be replaced when there are none
+        const bool hasScenes = AZStd::any_of(m_sceneList.begin(), m_sceneList.end(),
+            [](const AZStd::unique_ptr<AzPhysics::Scene>& scene)
+            {
+                return scene != nullptr;
+            });
+        if (hasScenes)
+        {
+            return;
+        }
+
+        delete m_cpuDispatcher;
+        m_cpuDispatcherType = m_systemConfig.m_cpuDispatcherType;
+        m_cpuDispatcher = CreateCpuDispatcher(m_cpuDispatcherType);
     }
 
     void PhysXSystem::ShutdownPhysXSdk()
@@ -89,6 +89,14 @@ namespace PhysX
         //! @param cookingParams The cooking params to use when setting up PhysX cooking interface. 
         void InitializePhysXSdk(const physx::PxCookingParams& cookingParams);
         void ShutdownPhysXSdk();
+
+        //! Creates the CPU dispatcher that runs the PhysX simulation tasks.
+        //! Falls back to the job manager when the task graph is requested but not active.
+        physx::PxCpuDispatcher* CreateCpuDispatcher(PhysXSystemConfiguration::CpuDispatcherType type);
+
+        //! Replaces the CPU dispatcher when the configured type changed and no scene exists.
+        //! Called before adding a scene, so a configuration change applies to the next scenes once all current ones are removed.
+        void UpdateCpuDispatcher();
         bool LoadMaterialLibrary();
 
         // AzFramework::AssetCatalogEventBus::Handler ...
@@ -113,6 +121,7 @@ namespace PhysX
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        PhysXSystemConfiguration::CpuDispatcherType m_cpuDispatcherType = PhysXSystemConfiguration::CpuDispatcherType::JobManager; //!< The configured type of m_cpuDispatcher.
 
         enum class State : AZ::u8
         {
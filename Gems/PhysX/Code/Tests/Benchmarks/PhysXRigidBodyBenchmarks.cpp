@@ -19,6 +19,7 @@
 
 #include <PhysXTestCommon.h>
 #include <PhysXTestUtil.h>
+#include <PhysX/Configuration/PhysXConfiguration.h>
 
 namespace PhysX::Benchmarks
 {
@@ -180,6 +181,79 @@ namespace PhysX::Benchmarks
         }
         // PhysXBaseBenchmarkFixture Interface ---------
 
+        //! Creates the physics washing machine, a cylinder with a spinning blade, spawns the requested number of rigid bodies
+        //! above the machine and lets them fall into the spinning blade, timing each simulation tick.
+        void RunMovingAndColliding(benchmark::State& state)
+        {
+            //setup some pieces for the test
+            AZ::SimpleLcgRandom rand;
+            rand.SetSeed(RigidBodyConstants::RandGenSeed);
+
+            //Create a washing machine of physx objects. This is a cylinder with a spinning blade that rigid bodies are placed inside
+            const AZ::Vector3 washingMachineCentre(500.0f, 500.0f, 1.0f);
+            WashingMachine washingMachine;
+            washingMachine.SetupWashingMachine(
+                m_testSceneHandle, RigidBodyConstants::TestRadius, RigidBodyConstants::WashingMachine::CylinderHeight,
+                washingMachineCentre, RigidBodyConstants::WashingMachine::BladeRPM);
+
+            //get the request number of rigid bodies and prepare to spawn them
+            const int numRigidBodies = static_cast<int>(state.range(0));
+
+            //add the rigid bodies
+            //function to generate the rigid bodies position / orientation / mass
+            Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
+                const float spawnArea = (RigidBodyConstants::TestRadius * 1.5f);
+                const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+                const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+                const float z = washingMachineCentre.GetZ() + RigidBodyConstants::WashingMachine::CylinderHeight + ((RigidBodyConstants::RigidBodys::BoxSize / 2.0f) * idx);
+                return AZ::Vector3(x, y, z);
+            };
+            Utils::GenerateSpawnOrientationFuncPtr oriGenerator = [&rand]([[maybe_unused]] int idx) -> AZ::Quaternion {
+                return AZ::CreateRandomQuaternion(rand);
+            };
+            Utils::GenerateMassFuncPtr massGenerator = [&rand]([[maybe_unused]] int idx) -> float {
+                return rand.GetRandomFloat() * 25.0f + 5.0f;
+            };
+            auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
+            Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+            {
+                return boxShapeConfiguration;
+            };
+            //spawn the rigid bodies
+            AzPhysics::SimulatedBodyHandleList rigidBodies = Utils::CreateRigidBodies(numRigidBodies, m_defaultScene,
+                RigidBodyConstants::CCDEnabled, &colliderGenerator, &posGenerator, &oriGenerator, &massGenerator);
+
+            //setup the sub tick tracker
+            Utils::PrePostSimulationEventHandler subTickTracker;
+            subTickTracker.Start(m_defaultScene);
+
+            //setup the frame timer tracker
+            AZStd::vector<double> tickTimes;
+            tickTimes.reserve(RigidBodyConstants::GameFramesToSimulate);
+            for (auto _ : state)
+            {
+                for (AZ::u32 i = 0; i < RigidBodyConstants::GameFramesToSimulate; i++)
+                {
+                    auto start = AZStd::chrono::system_clock::now();
+                    StepScene1Tick(DefaultTimeStep);
+
+                    //time each physics tick and store it to analyze
+                    auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                    tickTimes.emplace_back(tickElapsedMilliseconds.count());
+                }
+            }
+            subTickTracker.Stop();
+
+            //object clean up
+            washingMachine.TearDownWashingMachine();
+            m_defaultScene->RemoveSimulatedBodies(rigidBodies);
+            rigidBodies.clear();
+
+            //sort the frame times and get the P50, P90, P99 percentiles
+            Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+            Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        }
+
         Physics::System *m_system;
         EntityPtr m_terrainEntity;
     };
@@ -257,73 +331,7 @@ namespace PhysX::Benchmarks
     //! The test will run the simulation for ~1800 game frames at 60fps.
     BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_MovingAndColliding)(benchmark::State &state)
     {
-        //setup some pieces for the test
-        AZ::SimpleLcgRandom rand;
-        rand.SetSeed(RigidBodyConstants::RandGenSeed);
-
-        //Create a washing machine of physx objects. This is a cylinder with a spinning blade that rigid bodies are placed inside
-        const AZ::Vector3 washingMachineCentre(500.0f, 500.0f, 1.0f);
-        WashingMachine washingMachine;
-        washingMachine.SetupWashingMachine(
-            m_testSceneHandle, RigidBodyConstants::TestRadius, RigidBodyConstants::WashingMachine::CylinderHeight,
-            washingMachineCentre, RigidBodyConstants::WashingMachine::BladeRPM);
-
-        //get the request number of rigid bodies and prepare to spawn them
-        const int numRigidBodies = static_cast<int>(state.range(0));
-
-        //add the rigid bodies
-        //function to generate the rigid bodies position / orientation / mass
-        Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
-            const float spawnArea = (RigidBodyConstants::TestRadius * 1.5f);
-            const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
-            const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
-            const float z = washingMachineCentre.GetZ() + RigidBodyConstants::WashingMachine::CylinderHeight + ((RigidBodyConstants::RigidBodys::BoxSize / 2.0f) * idx);
-            return AZ::Vector3(x, y, z);
-        };
-        Utils::GenerateSpawnOrientationFuncPtr oriGenerator = [&rand]([[maybe_unused]] int idx) -> AZ::Quaternion {
-            return AZ::CreateRandomQuaternion(rand);
-        };
-        Utils::GenerateMassFuncPtr massGenerator = [&rand]([[maybe_unused]] int idx) -> float {
-            return rand.GetRandomFloat() * 25.0f + 5.0f;
-        };
-        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
-        Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
-        {
-            return boxShapeConfiguration;
-        };
-        //spawn the rigid bodies
-        AzPhysics::SimulatedBodyHandleList rigidBodies = Utils::CreateRigidBodies(numRigidBodies, m_defaultScene,
-            RigidBodyConstants::CCDEnabled, &colliderGenerator, &posGenerator, &oriGenerator, &massGenerator);
-
-        //setup the sub tick tracker
-        Utils::PrePostSimulationEventHandler subTickTracker;
-        subTickTracker.Start(m_defaultScene);
-
-        //setup the frame timer tracker
-        AZStd::vector<double> tickTimes;
-        tickTimes.reserve(RigidBodyConstants::GameFramesToSimulate);
-        for (auto _ : state)
-        {
-            for (AZ::u32 i = 0; i < RigidBodyConstants::GameFramesToSimulate; i++)
-            {
-                auto start = AZStd::chrono::system_clock::now();
-                StepScene1Tick(DefaultTimeStep);
-
-                //time each physics tick and store it to analyze
-                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
-                tickTimes.emplace_back(tickElapsedMilliseconds.count());
-            }
-        }
-        subTickTracker.Stop();
-
-        //object clean up
-        washingMachine.TearDownWashingMachine();
-        m_defaultScene->RemoveSimulatedBodies(rigidBodies);
-        rigidBodies.clear();
-
-        //sort the frame times and get the P50, P90, P99 percentiles
-        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
-        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        RunMovingAndColliding(state);
     }
 
     //! Same as the PhysXRigidbodyBenchmarkFixture, adds a world event handler to receive collision events
@@ -501,6 +509,72 @@ namespace PhysX::Benchmarks
         state.counters["Collisions-End"] = static_cast<double>(m_collisionEndCount);
     }
 
+    //! Same as the PhysXRigidbodyBenchmarkFixture, with the PhysX tasks running on the task graph instead of the job manager
+    class PhysXRigidbodyTaskGraphBenchmarkFixture
+        : public PhysXRigidbodyBenchmarkFixture
+    {
+        void internalSetUp() override
+        {
+            //the CPU dispatcher is replaced when the test scene is created
+            m_previousCpuDispatcherType = SetCpuDispatcherType(PhysXSystemConfiguration::CpuDispatcherType::TaskGraph);
+            PhysXRigidbodyBenchmarkFixture::internalSetUp();
+        }
+
+        void internalTearDown() override
+        {
+            PhysXRigidbodyBenchmarkFixture::internalTearDown();
+            SetCpuDispatcherType(m_previousCpuDispatcherType);
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        //! Updates the CPU dispatcher type in the PhysX system configuration, returning the previous type.
+        static PhysXSystemConfiguration::CpuDispatcherType SetCpuDispatcherType(PhysXSystemConfiguration::CpuDispatcherType type)
+        {
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            const auto* config = azdynamic_cast<const PhysXSystemConfiguration*>(physicsSystem->GetConfiguration());
+            if (!config)
+            {
+                return type;
+            }
+
+            //config points at the live configuration, which holds the new type after the update
+            const PhysXSystemConfiguration::CpuDispatcherType previousType = config->m_cpuDispatcherType;
+            PhysXSystemConfiguration newConfig = *config;
+            newConfig.m_cpuDispatcherType = type;
+            physicsSystem->UpdateConfiguration(&newConfig);
+            return previousType;
+        }
+
+        PhysXSystemConfiguration::CpuDispatcherType m_previousCpuDispatcherType = PhysXSystemConfiguration::CpuDispatcherType::JobManager;
+    };
+
+    //! BM_RigidBody_MovingAndColliding_TaskGraph - Runs the same benchmark as BM_RigidBody_MovingAndColliding, with the PhysX tasks
+    //! running on the task graph, to compare the simulation tick times between the CPU dispatchers.
+    //! The test will run the simulation for ~1800 game frames at 60fps.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyTaskGraphBenchmarkFixture, BM_RigidBody_MovingAndColliding_TaskGraph)(benchmark::State& state)
+    {
+        RunMovingAndColliding(state);
+    }
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_AtRest)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Range(RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange)
@@ -515,6 +589,13 @@ namespace PhysX::Benchmarks
         ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
         ;
 
+    BENCHMARK_REGISTER_F(PhysXRigidbodyTaskGraphBenchmarkFixture, BM_RigidBody_MovingAndColliding_TaskGraph)
+        ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
+        ->Range(RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
+        ;
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyCollisionsBenchmarkFixture, BM_RigidBody_MovingAndColliding_CollisionHandlers)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Ranges({ {RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange}, {RigidBodyConstants::BenchmarkSettings::AllCollisionHanders, RigidBodyConstants::BenchmarkSettings::AllCollisionHanders} })
@@ -28,6 +28,7 @@ namespace PhysX::Benchmarks
         static const float SphereShapeRadius = 2.0f;
         static const AZ::u32 MinRadius = 2u;
         static const int Seed = 100;
+        static const size_t RaycastBatchSize = 4096;
 
         static const std::vector<std::vector<std::pair<int64_t, int64_t>>> BenchmarkConfigs =
         {
@@ -226,6 +227,53 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Builds a batch of raycasts from the origin towards the boxes, cycling through the boxes when the batch is larger.
+    static AzPhysics::SceneQueryRequests CreateRaycastBatch(const std::vector<AZ::Vector3>& boxes, size_t batchSize)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(batchSize);
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = boxes[i % boxes.size()].GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+        return requests;
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchSerial)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(m_boxes, SceneQueryConstants::RaycastBatchSize);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            for (const auto& request : requests)
+            {
+                AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(m_testSceneHandle, request.get());
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * SceneQueryConstants::RaycastBatchSize);
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatch)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(m_boxes, SceneQueryConstants::RaycastBatchSize);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.SetItemsProcessed(state.iterations() * SceneQueryConstants::RaycastBatchSize);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -250,5 +298,15 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchSerial)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[2])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatch)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[2])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
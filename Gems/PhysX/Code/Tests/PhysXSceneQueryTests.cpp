@@ -7,6 +7,7 @@
  */
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1009,4 +1010,121 @@ namespace PhysX
             }
         }
     }
+
+    // Enough requests for the batch to be split over multiple jobs.
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_MatchesSingleQueries)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const size_t numSpheres = 16;
+        const size_t numRequests = 1024;
+        for (size_t i = 0; i < numSpheres; ++i)
+        {
+            const float angle = AZ::Constants::TwoPi * static_cast<float>(i) / static_cast<float>(numSpheres);
+            TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(AZ::Cos(angle), AZ::Sin(angle), 0.0f) * 10.0f, 1.0f);
+        }
+
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(numRequests);
+        for (size_t i = 0; i < numRequests; ++i)
+        {
+            const float angle = AZ::Constants::TwoPi * static_cast<float>(i) / static_cast<float>(numRequests);
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = AZ::Vector3(AZ::Cos(angle), AZ::Sin(angle), 0.0f);
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+        ASSERT_EQ(results.size(), requests.size());
+
+        size_t numHits = 0;
+        for (size_t i = 0; i < numRequests; ++i)
+        {
+            const AzPhysics::SceneQueryHits expected = sceneInterface->QueryScene(m_testSceneHandle, requests[i].get());
+            ASSERT_EQ(results[i].m_hits.size(), expected.m_hits.size()) << "Request " << i;
+            for (size_t j = 0; j < expected.m_hits.size(); ++j)
+            {
+                EXPECT_EQ(results[i].m_hits[j].m_bodyHandle, expected.m_hits[j].m_bodyHandle) << "Request " << i;
+            }
+            numHits += results[i].m_hits.size();
+        }
+        EXPECT_GT(numHits, 0);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallsCallbackWithHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX();
+        request.m_distance = 200.0f;
+
+        const AzPhysics::SceneQuery::AsyncRequestId requestId = 42;
+        AzPhysics::SceneQuery::AsyncRequestId receivedId = 0;
+        AzPhysics::SceneQueryHits receivedHits;
+        AZStd::binary_semaphore done;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, requestId, &request,
+            [&receivedId, &receivedHits, &done](AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHits hits)
+            {
+                receivedId = id;
+                receivedHits = AZStd::move(hits);
+                done.release();
+            });
+        ASSERT_TRUE(queued);
+        done.acquire();
+
+        EXPECT_EQ(receivedId, requestId);
+        ASSERT_EQ(receivedHits.m_hits.size(), 1);
+        EXPECT_EQ(receivedHits.m_hits[0].m_bodyHandle, sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallsCallbackWithAllHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = pos.GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQueryHitsList results;
+        AZStd::binary_semaphore done;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 7, requests,
+            [&results, &done]([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHitsList hits)
+            {
+                results = AZStd::move(hits);
+                done.release();
+            });
+
+        // The requests are shared with the query, so the caller does not need to keep them alive.
+        requests.clear();
+
+        ASSERT_TRUE(queued);
+        done.acquire();
+
+        ASSERT_EQ(results.size(), positions.size());
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_EQ(results[i].m_hits[0].m_bodyHandle, simBodies[i]);
+        }
+    }
 }
@@ -317,4 +317,37 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    TEST_F(PhysXSystemFixture, TaskGraphCpuDispatcher_SimulatesScene)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        const auto* currentConfig = azdynamic_cast<const PhysXSystemConfiguration*>(physicsSystem->GetConfiguration());
+        ASSERT_NE(currentConfig, nullptr);
+        const PhysXSystemConfiguration preTestConfig = *currentConfig;
+
+        //the dispatcher is replaced when the next scene is added
+        PhysXSystemConfiguration taskGraphConfig = preTestConfig;
+        taskGraphConfig.m_cpuDispatcherType = PhysXSystemConfiguration::CpuDispatcherType::TaskGraph;
+        physicsSystem->UpdateConfiguration(&taskGraphConfig);
+
+        AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        AzPhysics::Scene* scene = physicsSystem->GetScene(sceneHandle);
+        ASSERT_NE(scene, nullptr);
+
+        const AZ::Vector3 startPosition(0.0f, 0.0f, 10.0f);
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(sceneHandle, startPosition);
+        for (int i = 0; i < 30; i++)
+        {
+            scene->StartSimulation(preTestConfig.m_fixedTimestep);
+            scene->FinishSimulation();
+        }
+
+        //the sphere should have fallen under gravity
+        AzPhysics::SimulatedBody* sphere = scene->GetSimulatedBodyFromHandle(sphereHandle);
+        ASSERT_NE(sphere, nullptr);
+        EXPECT_LT(sphere->GetPosition().GetZ(), startPosition.GetZ());
+
+        physicsSystem->RemoveScene(sceneHandle);
+        physicsSystem->UpdateConfiguration(&preTestConfig);
+    }
 }
@@ -32,6 +32,21 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        //! Modifies or annotates the points of a surface point buffer in one call. pointIndices are the points whose input
+        //! position is within the bounds the modifier registered with, the same points that ModifySurfacePoints gets.
+        //! The default implementation calls ModifySurfacePoints for every one of them.
+        virtual void ModifySurfacePointBuffer(SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const
+        {
+            SurfacePointList surfacePointList(1);
+            SurfacePoint& point = surfacePointList.front();
+            for (size_t pointIndex : pointIndices)
+            {
+                surfacePoints.GetSurfacePoint(pointIndex, point);
+                ModifySurfacePoints(surfacePointList);
+                surfacePoints.AddMaxValueForMasks(pointIndex, point.m_masks);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
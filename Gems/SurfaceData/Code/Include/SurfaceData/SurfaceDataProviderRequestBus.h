@@ -31,6 +31,23 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Adds the surface points of a list of positions to a surface point buffer in one call. The points are added with
+        //! the index of their position in inPositions. The default implementation calls GetSurfacePoints for every position.
+        virtual void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+        {
+            SurfacePointList surfacePointList;
+            for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+            {
+                surfacePointList.clear();
+                GetSurfacePoints(inPositions[inputIndex], surfacePointList);
+                for (const SurfacePoint& point : surfacePointList)
+                {
+                    const size_t pointIndex = surfacePoints.AddSurfacePoint(inputIndex, point.m_entityId, point.m_position, point.m_normal);
+                    surfacePoints.AddMaxValueForMasks(pointIndex, point.m_masks);
+                }
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
@@ -41,6 +41,12 @@ namespace SurfaceData
         virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
                                                 SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
 
+        // Get all surface points for every input position within an AABB region, like GetSurfacePointsFromRegion, in a flat surface point buffer.
+        // The input positions of the buffer are the queried positions, and the points of each one are sorted in decreasing Z order.
+        // Providers and modifiers process the whole region in one call, and no memory is allocated per point when the buffer is reused.
+        virtual void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
+                                                     SurfacePointBuffer& surfacePoints) const = 0;
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
@@ -13,6 +13,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <SurfaceData/SurfaceTag.h>
 
 namespace SurfaceData
@@ -36,6 +37,100 @@ namespace SurfaceData
     using SurfacePointList = AZStd::vector<SurfacePoint>;
     using SurfacePointListPerPosition = AZStd::vector<AZStd::pair<AZ::Vector3, SurfacePointList>>;
 
+    //! The surface points of a list of input positions, stored as flat structure-of-arrays.
+    //! Every surface point is a row of the same arrays. The surface tags of a point are a bitset over the tags of the
+    //! buffer, which grows by another 64 bits per point whenever the buffer runs out of tag bits, and the tag weights are
+    //! stored in one array per tag, so adding points and tags doesn't allocate anything per point. Clear() keeps the memory,
+    //! so a buffer that is reused across queries stops allocating once it has grown to its working size.
+    class SurfacePointBuffer final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SurfacePointBuffer, AZ::SystemAllocator, 0);
+
+        //! Removes the input positions, surface points and tags, and keeps the memory for reuse.
+        void Clear();
+
+        void AddInputPosition(const AZ::Vector3& position);
+        const AZStd::vector<AZ::Vector3>& GetInputPositions() const;
+        size_t GetInputPositionCount() const;
+
+        //! Adds a surface point without any tags for the input position with the given index, and returns the index of the new point.
+        size_t AddSurfacePoint(size_t inputIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal);
+
+        //! Sets the weight of the tags of a point to the max of the given value and their current weight, like AddMaxValueForMasks.
+        void AddMaxValueForTag(size_t pointIndex, AZ::Crc32 tag, float value);
+        void AddMaxValueForTags(size_t pointIndex, const SurfaceTagVector& tags, float value);
+        void AddMaxValueForMasks(size_t pointIndex, const SurfaceTagWeightMap& masks);
+
+        size_t GetPointCount() const;
+        size_t GetInputIndex(size_t pointIndex) const;
+        const AZ::EntityId& GetEntityId(size_t pointIndex) const;
+        const AZ::Vector3& GetPosition(size_t pointIndex) const;
+        const AZ::Vector3& GetNormal(size_t pointIndex) const;
+
+        //! Returns true if a point has the tag GetTag(tagIndex).
+        bool HasTag(size_t pointIndex, size_t tagIndex) const;
+
+        //! Returns the weight of a tag of a point, or 0 if the point doesn't have the tag.
+        float GetTagWeight(size_t pointIndex, size_t tagIndex) const;
+
+        size_t GetTagCount() const;
+        AZ::Crc32 GetTag(size_t tagIndex) const;
+
+        //! Copies a surface point and its tag weights into a SurfacePoint.
+        void GetSurfacePoint(size_t pointIndex, SurfacePoint& point) const;
+
+        //! Replaces the input index of the points from firstPointIndex on with inputIndices[inputIndex]. This maps the points that
+        //! a provider added for a subset of the input positions back to the input positions of the buffer.
+        void RemapInputIndices(size_t firstPointIndex, const AZStd::vector<size_t>& inputIndices);
+
+        //! Groups the points by input position and sorts the points of every input position in decreasing Z order. Points with
+        //! effectively the same position and normal are combined, and points that have none of the desired tags are removed.
+        //! Afterwards, GetPointRange returns the points of every input position.
+        void CombineSortAndFilterNeighboringPoints(const SurfaceTagVector& desiredTags);
+
+        //! Returns the [begin, end) range of the points of an input position. Only valid after CombineSortAndFilterNeighboringPoints.
+        AZStd::pair<size_t, size_t> GetPointRange(size_t inputIndex) const;
+
+    private:
+        //! One word of the bitset of the buffer tags that a surface point has, where bit i of word w is the tag GetTag(w * 64 + i).
+        using TagMask = AZ::u64;
+        static constexpr size_t TagMaskBits = 64;
+
+        size_t FindOrAddTag(AZ::Crc32 tag);
+
+        //! Adds another word to the tag bitset of every point.
+        void GrowTagMasks();
+
+        AZStd::vector<AZ::Vector3> m_inputPositions;
+        AZStd::vector<size_t> m_inputPointStart;
+
+        // One entry per surface point.
+        AZStd::vector<AZ::u32> m_inputIndices;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+
+        // The tag bitsets of the points, m_tagMaskWordCount words per point. The word count is kept for reuse by Clear().
+        AZStd::vector<TagMask> m_tagMasks;
+        size_t m_tagMaskWordCount = 1;
+
+        // The tags of the buffer, and one weight per surface point for each of them. Only the weights of the points that have
+        // the tag are meaningful. There can be more weight arrays than tags, they are kept for reuse.
+        AZStd::vector<AZ::Crc32> m_tags;
+        AZStd::vector<AZStd::vector<float>> m_tagWeights;
+
+        // Scratch arrays of CombineSortAndFilterNeighboringPoints, kept for reuse.
+        AZStd::vector<AZ::u32> m_sortedPointIndices;
+        AZStd::vector<AZ::u32> m_combinedInputIndices;
+        AZStd::vector<AZ::EntityId> m_combinedEntityIds;
+        AZStd::vector<AZ::Vector3> m_combinedPositions;
+        AZStd::vector<AZ::Vector3> m_combinedNormals;
+        AZStd::vector<TagMask> m_combinedTagMasks;
+        AZStd::vector<TagMask> m_desiredTagMask;
+        AZStd::vector<AZStd::vector<float>> m_combinedTagWeights;
+    };
+
     struct SurfaceDataRegistryEntry
     {
         AZ::EntityId m_entityId;
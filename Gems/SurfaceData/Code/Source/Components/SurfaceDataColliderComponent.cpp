@@ -245,6 +245,26 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // We want a full raycast, so don't just query the start point.
+        constexpr bool queryPointOnly = false;
+
+        const AZ::EntityId entityId = GetEntityId();
+        for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+        {
+            AZ::Vector3 hitPosition;
+            AZ::Vector3 hitNormal;
+            if (DoRayTrace(inPositions[inputIndex], queryPointOnly, hitPosition, hitNormal))
+            {
+                const size_t pointIndex = surfacePoints.AddSurfacePoint(inputIndex, entityId, hitPosition, hitNormal);
+                surfacePoints.AddMaxValueForTags(pointIndex, m_configuration.m_providerTags, 1.0f);
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(Entity);
@@ -270,6 +290,32 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::ModifySurfacePointBuffer(SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_colliderBounds.IsValid() && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            for (size_t pointIndex : pointIndices)
+            {
+                const AZ::Vector3& position = surfacePoints.GetPosition(pointIndex);
+                if (surfacePoints.GetEntityId(pointIndex) != entityId && m_colliderBounds.Contains(position))
+                {
+                    AZ::Vector3 hitPosition;
+                    AZ::Vector3 hitNormal;
+                    constexpr bool queryPointOnly = true;
+                    if (DoRayTrace(position, queryPointOnly, hitPosition, hitNormal))
+                    {
+                        surfacePoints.AddMaxValueForTags(pointIndex, m_configuration.m_modifierTags, 1.0f);
+                    }
+                }
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::OnCompositionChanged()
     {
         if (!m_refresh)
@@ -147,6 +147,38 @@ namespace SurfaceData
 
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
 
+        AZ::Vector3 position;
+        if (GetShapeSurfacePosition(inPosition, position))
+        {
+            SurfacePoint point;
+            point.m_entityId = GetEntityId();
+            point.m_position = position;
+            point.m_normal = AZ::Vector3::CreateAxisZ();
+            AddMaxValueForMasks(point.m_masks, m_configuration.m_providerTags, 1.0f);
+            surfacePointList.push_back(point);
+        }
+    }
+
+    void SurfaceDataShapeComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        const AZ::EntityId entityId = GetEntityId();
+        for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+        {
+            AZ::Vector3 position;
+            if (GetShapeSurfacePosition(inPositions[inputIndex], position))
+            {
+                const size_t pointIndex = surfacePoints.AddSurfacePoint(inputIndex, entityId, position, AZ::Vector3::CreateAxisZ());
+                surfacePoints.AddMaxValueForTags(pointIndex, m_configuration.m_providerTags, 1.0f);
+            }
+        }
+    }
+
+    bool SurfaceDataShapeComponent::GetShapeSurfacePosition(const AZ::Vector3& inPosition, AZ::Vector3& outPosition) const
+    {
         if (m_shapeBoundsIsValid)
         {
             const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_shapeBounds.GetMax().GetZ());
@@ -156,14 +188,11 @@ namespace SurfaceData
             LmbrCentral::ShapeComponentRequestsBus::EventResult(hitShape, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IntersectRay, rayOrigin, rayDirection, intersectionDistance);
             if (hitShape)
             {
-                SurfacePoint point;
-                point.m_entityId = GetEntityId();
-                point.m_position = rayOrigin + intersectionDistance * rayDirection;
-                point.m_normal = AZ::Vector3::CreateAxisZ();
-                AddMaxValueForMasks(point.m_masks, m_configuration.m_providerTags, 1.0f);
-                surfacePointList.push_back(point);
+                outPosition = rayOrigin + intersectionDistance * rayDirection;
+                return true;
             }
         }
+        return false;
     }
 
     void SurfaceDataShapeComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
@@ -174,22 +203,65 @@ namespace SurfaceData
 
         if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
         {
-            const AZ::EntityId entityId = GetEntityId();
             for (auto& point : surfacePointList)
             {
-                if (point.m_entityId != entityId && m_shapeBounds.Contains(point.m_position))
+                if (IsModifiedPoint(point.m_entityId, point.m_position))
                 {
-                    bool inside = false;
-                    LmbrCentral::ShapeComponentRequestsBus::EventResult(inside, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
-                    if (inside)
-                    {
-                        AddMaxValueForMasks(point.m_masks, m_configuration.m_modifierTags, 1.0f);
-                    }
+                    AddMaxValueForMasks(point.m_masks, m_configuration.m_modifierTags, 1.0f);
                 }
             }
         }
     }
 
+    void SurfaceDataShapeComponent::ModifySurfacePointBuffer(SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
+        {
+            // Gather the points of other entities inside the shape bounds, and test them against the shape with one bulk query.
+            AZStd::vector<size_t> candidateIndices;
+            AZStd::vector<AZ::Vector3> candidatePositions;
+            for (size_t pointIndex : pointIndices)
+            {
+                if (surfacePoints.GetEntityId(pointIndex) != GetEntityId() && m_shapeBounds.Contains(surfacePoints.GetPosition(pointIndex)))
+                {
+                    candidateIndices.push_back(pointIndex);
+                    candidatePositions.push_back(surfacePoints.GetPosition(pointIndex));
+                }
+            }
+
+            if (candidatePositions.empty())
+            {
+                return;
+            }
+
+            AZStd::vector<bool> inside(candidatePositions.size(), false);
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInsideList, candidatePositions, inside);
+
+            for (size_t candidateIndex = 0; candidateIndex < candidateIndices.size(); ++candidateIndex)
+            {
+                if (inside[candidateIndex])
+                {
+                    surfacePoints.AddMaxValueForTags(candidateIndices[candidateIndex], m_configuration.m_modifierTags, 1.0f);
+                }
+            }
+        }
+    }
+
+    bool SurfaceDataShapeComponent::IsModifiedPoint(const AZ::EntityId& pointEntityId, const AZ::Vector3& pointPosition) const
+    {
+        bool inside = false;
+        if (pointEntityId != GetEntityId() && m_shapeBounds.Contains(pointPosition))
+        {
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(inside, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, pointPosition);
+        }
+        return inside;
+    }
+
     void SurfaceDataShapeComponent::OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& /*world*/)
     {
         OnCompositionChanged();
@@ -65,10 +65,12 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const override;
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointBuffer(SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // AZ::TransformNotificationBus
@@ -85,6 +87,11 @@ namespace SurfaceData
         void OnCompositionChanged();
         void UpdateShapeData();
 
+        //! Returns true and the top surface position of the shape if a vertical ray through inPosition hits the shape.
+        bool GetShapeSurfacePosition(const AZ::Vector3& inPosition, AZ::Vector3& outPosition) const;
+        //! Returns true if a surface point of another entity is inside the shape, and should get the modifier tags.
+        bool IsModifiedPoint(const AZ::EntityId& pointEntityId, const AZ::Vector3& pointPosition) const;
+
         SurfaceDataShapeConfig m_configuration;
 
         SurfaceDataRegistryHandle m_providerHandle = InvalidSurfaceDataRegistryHandle;
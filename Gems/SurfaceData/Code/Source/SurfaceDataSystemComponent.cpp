@@ -229,27 +229,54 @@ namespace SurfaceData
 
     void SurfaceDataSystemComponent::GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const
     {
+        AZ_PROFILE_FUNCTION(Entity);
+
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
 
+        GetSurfacePointBufferFromRegion(inRegion, stepSize, desiredTags, m_regionPointBuffer);
+
+        // Copy the points of every input position out of the flat buffer into a list per position.
+        const size_t inputPositionCount = m_regionPointBuffer.GetInputPositionCount();
         surfacePointListPerPosition.clear();
-        surfacePointListPerPosition.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
+        surfacePointListPerPosition.reserve(inputPositionCount);
+        for (size_t inputIndex = 0; inputIndex < inputPositionCount; ++inputIndex)
+        {
+            surfacePointListPerPosition.emplace_back(m_regionPointBuffer.GetInputPositions()[inputIndex], SurfaceData::SurfacePointList{});
+            SurfacePointList& surfacePointList = surfacePointListPerPosition.back().second;
+
+            const auto pointRange = m_regionPointBuffer.GetPointRange(inputIndex);
+            surfacePointList.resize(pointRange.second - pointRange.first);
+            for (size_t pointIndex = pointRange.first; pointIndex < pointRange.second; ++pointIndex)
+            {
+                m_regionPointBuffer.GetSurfacePoint(pointIndex, surfacePointList[pointIndex - pointRange.first]);
+            }
+        }
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
-        // Initialize our list-per-position list with every input position to query from the region.
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+        surfacePoints.Clear();
+
+        // Initialize the input positions of the buffer with every position to query from the region.
         // This is inclusive on the min sides of inRegion, and exclusive on the max sides.
         for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
         {
             for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
             {
-                surfacePointListPerPosition.emplace_back(AZ::Vector3(x, y, AZ::Constants::FloatMax), SurfaceData::SurfacePointList{});
+                surfacePoints.AddInputPosition(AZ::Vector3(x, y, AZ::Constants::FloatMax));
             }
         }
+        const AZStd::vector<AZ::Vector3>& inPositions = surfacePoints.GetInputPositions();
 
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
+        // Loop through each data provider, and send it all the input positions within its bounds in one call.  This allows us to check
+        // the tags and the overall AABB bounds just once per provider, instead of once per point.
         for (const auto& entryPair : m_registeredSurfaceDataProviders)
         {
             const SurfaceDataRegistryEntry& entry = entryPair.second;
@@ -259,16 +286,26 @@ namespace SurfaceData
                 ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
                 )
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                m_providerInputPositions.clear();
+                m_providerInputIndices.clear();
+                for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
+                    const AZ::Vector3& point2d = inPositions[inputIndex];
                     AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
                     if (alwaysApplies || entry.m_bounds.Contains(point3d))
                     {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
+                        m_providerInputPositions.push_back(point3d);
+                        m_providerInputIndices.push_back(inputIndex);
                     }
                 }
+
+                if (!m_providerInputPositions.empty())
+                {
+                    // The provider adds its points with indices into its own list of positions, so map them back to the region positions.
+                    const size_t firstPointIndex = surfacePoints.GetPointCount();
+                    SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, m_providerInputPositions, surfacePoints);
+                    surfacePoints.RemapInputIndices(firstPointIndex, m_providerInputIndices);
+                }
             }
         }
 
@@ -276,26 +313,31 @@ namespace SurfaceData
         // surface tags / values onto each point.  The difference between this and the above loop is that surface data *providers*
         // create new surface points, but surface data *modifiers* simply annotate points that have already been created.  The modifiers
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
-        // within a water volume.
-        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        // within a water volume.  Each modifier gets all the points of the input positions within its bounds in one call.
+        if (surfacePoints.GetPointCount() > 0)
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
-
-            if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
+            for (const auto& entryPair : m_registeredSurfaceDataModifiers)
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                bool alwaysApplies = !entry.m_bounds.IsValid();
+
+                if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
+                    m_modifierPointIndices.clear();
+                    for (size_t pointIndex = 0; pointIndex < surfacePoints.GetPointCount(); ++pointIndex)
                     {
+                        const AZ::Vector3& point2d = inPositions[surfacePoints.GetInputIndex(pointIndex)];
                         AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
                         if (alwaysApplies || entry.m_bounds.Contains(point3d))
                         {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+                            m_modifierPointIndices.push_back(pointIndex);
                         }
                     }
+
+                    if (!m_modifierPointIndices.empty())
+                    {
+                        SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointBuffer, surfacePoints, m_modifierPointIndices);
+                    }
                 }
             }
         }
@@ -304,14 +346,7 @@ namespace SurfaceData
         // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
         // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
         // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-        for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
-        {
-            auto& surfacePointList = surfacePointListAndPoint.second;
-            if (!surfacePointList.empty())
-            {
-                CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags);
-            }
-        }
+        surfacePoints.CombineSortAndFilterNeighboringPoints(desiredTags);
     }
 
     void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
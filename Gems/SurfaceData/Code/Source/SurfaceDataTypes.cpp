@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/Utility/SurfaceDataUtility.h>
+
+#include <AzCore/std/sort.h>
+
+namespace SurfaceData
+{
+    void SurfacePointBuffer::Clear()
+    {
+        m_inputPositions.clear();
+        m_inputPointStart.clear();
+        m_inputIndices.clear();
+        m_entityIds.clear();
+        m_positions.clear();
+        m_normals.clear();
+        m_tagMasks.clear();
+        m_tags.clear();
+    }
+
+    void SurfacePointBuffer::AddInputPosition(const AZ::Vector3& position)
+    {
+        m_inputPositions.push_back(position);
+    }
+
+    const AZStd::vector<AZ::Vector3>& SurfacePointBuffer::GetInputPositions() const
+    {
+        return m_inputPositions;
+    }
+
+    size_t SurfacePointBuffer::GetInputPositionCount() const
+    {
+        return m_inputPositions.size();
+    }
+
+    size_t SurfacePointBuffer::AddSurfacePoint(size_t inputIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal)
+    {
+        m_inputIndices.push_back(aznumeric_cast<AZ::u32>(inputIndex));
+        m_entityIds.push_back(entityId);
+        m_positions.push_back(position);
+        m_normals.push_back(normal);
+        m_tagMasks.resize(m_tagMasks.size() + m_tagMaskWordCount, 0);
+        return m_positions.size() - 1;
+    }
+
+    void SurfacePointBuffer::AddMaxValueForTag(size_t pointIndex, AZ::Crc32 tag, float value)
+    {
+        const size_t tagIndex = FindOrAddTag(tag);
+
+        // The weight arrays grow with the capacity of the point arrays, so they are only resized when the point arrays are.
+        AZStd::vector<float>& weights = m_tagWeights[tagIndex];
+        if (weights.size() < m_positions.size())
+        {
+            weights.resize(m_positions.capacity());
+        }
+
+        const TagMask tagBit = TagMask(1) << (tagIndex % TagMaskBits);
+        TagMask& tagMask = m_tagMasks[pointIndex * m_tagMaskWordCount + tagIndex / TagMaskBits];
+        const float valueOld = (tagMask & tagBit) ? weights[pointIndex] : 0.0f;
+        weights[pointIndex] = AZ::GetMax(value, valueOld);
+        tagMask |= tagBit;
+    }
+
+    void SurfacePointBuffer::AddMaxValueForTags(size_t pointIndex, const SurfaceTagVector& tags, float value)
+    {
+        for (const auto& tag : tags)
+        {
+            AddMaxValueForTag(pointIndex, tag, value);
+        }
+    }
+
+    void SurfacePointBuffer::AddMaxValueForMasks(size_t pointIndex, const SurfaceTagWeightMap& masks)
+    {
+        for (const auto& mask : masks)
+        {
+            AddMaxValueForTag(pointIndex, mask.first, mask.second);
+        }
+    }
+
+    size_t SurfacePointBuffer::GetPointCount() const
+    {
+        return m_positions.size();
+    }
+
+    size_t SurfacePointBuffer::GetInputIndex(size_t pointIndex) const
+    {
+        return m_inputIndices[pointIndex];
+    }
+
+    const AZ::EntityId& SurfacePointBuffer::GetEntityId(size_t pointIndex) const
+    {
+        return m_entityIds[pointIndex];
+    }
+
+    const AZ::Vector3& SurfacePointBuffer::GetPosition(size_t pointIndex) const
+    {
+        return m_positions[pointIndex];
+    }
+
+    const AZ::Vector3& SurfacePointBuffer::GetNormal(size_t pointIndex) const
+    {
+        return m_normals[pointIndex];
+    }
+
+    bool SurfacePointBuffer::HasTag(size_t pointIndex, size_t tagIndex) const
+    {
+        return (m_tagMasks[pointIndex * m_tagMaskWordCount + tagIndex / TagMaskBits] & (TagMask(1) << (tagIndex % TagMaskBits))) != 0;
+    }
+
+    float SurfacePointBuffer::GetTagWeight(size_t pointIndex, size_t tagIndex) const
+    {
+        return HasTag(pointIndex, tagIndex) ? m_tagWeights[tagIndex][pointIndex] : 0.0f;
+    }
+
+    size_t SurfacePointBuffer::GetTagCount() const
+    {
+        return m_tags.size();
+    }
+
+    AZ::Crc32 SurfacePointBuffer::GetTag(size_t tagIndex) const
+    {
+        return m_tags[tagIndex];
+    }
+
+    void SurfacePointBuffer::GetSurfacePoint(size_t pointIndex, SurfacePoint& point) const
+    {
+        point.m_entityId = m_entityIds[pointIndex];
+        point.m_position = m_positions[pointIndex];
+        point.m_normal = m_normals[pointIndex];
+        point.m_masks.clear();
+
+        for (size_t wordIndex = 0; wordIndex < m_tagMaskWordCount; ++wordIndex)
+        {
+            TagMask tagMask = m_tagMasks[pointIndex * m_tagMaskWordCount + wordIndex];
+            for (size_t tagIndex = wordIndex * TagMaskBits; tagMask != 0; ++tagIndex, tagMask >>= 1)
+            {
+                if (tagMask & 1)
+                {
+                    point.m_masks[m_tags[tagIndex]] = m_tagWeights[tagIndex][pointIndex];
+                }
+            }
+        }
+    }
+
+    void SurfacePointBuffer::RemapInputIndices(size_t firstPointIndex, const AZStd::vector<size_t>& inputIndices)
+    {
+        for (size_t pointIndex = firstPointIndex; pointIndex < m_inputIndices.size(); ++pointIndex)
+        {
+            m_inputIndices[pointIndex] = aznumeric_cast<AZ::u32>(inputIndices[m_inputIndices[pointIndex]]);
+        }
+    }
+
+    void SurfacePointBuffer::CombineSortAndFilterNeighboringPoints(const SurfaceTagVector& desiredTags)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const bool hasDesiredTags = HasValidTags(desiredTags);
+        const size_t pointCount = m_positions.size();
+        const size_t tagCount = m_tags.size();
+        const size_t wordCount = m_tagMaskWordCount;
+
+        // The bitset of the desired tags. Tags that no point of the buffer has are ignored.
+        m_desiredTagMask.assign(wordCount, 0);
+        for (const auto& tag : desiredTags)
+        {
+            const auto tagItr = AZStd::find(m_tags.begin(), m_tags.end(), static_cast<AZ::Crc32>(tag));
+            if (tagItr != m_tags.end())
+            {
+                const size_t tagIndex = tagItr - m_tags.begin();
+                m_desiredTagMask[tagIndex / TagMaskBits] |= TagMask(1) << (tagIndex % TagMaskBits);
+            }
+        }
+
+        // Group the points by input position, and sort the points of each input position by depth/distance before combining points.
+        m_sortedPointIndices.resize(pointCount);
+        for (size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+        {
+            m_sortedPointIndices[pointIndex] = aznumeric_cast<AZ::u32>(pointIndex);
+        }
+        AZStd::sort(m_sortedPointIndices.begin(), m_sortedPointIndices.end(), [this](AZ::u32 a, AZ::u32 b)
+        {
+            if (m_inputIndices[a] != m_inputIndices[b])
+            {
+                return m_inputIndices[a] < m_inputIndices[b];
+            }
+            return m_positions[a].GetZ() > m_positions[b].GetZ();
+        });
+
+        m_combinedInputIndices.clear();
+        m_combinedEntityIds.clear();
+        m_combinedPositions.clear();
+        m_combinedNormals.clear();
+        m_combinedTagMasks.clear();
+        if (m_combinedTagWeights.size() < tagCount)
+        {
+            m_combinedTagWeights.resize(tagCount);
+        }
+        for (size_t tagIndex = 0; tagIndex < tagCount; ++tagIndex)
+        {
+            if (m_combinedTagWeights[tagIndex].size() < pointCount)
+            {
+                m_combinedTagWeights[tagIndex].resize(pointCount);
+            }
+        }
+
+        // Efficient point consolidation requires the points to be pre-sorted so we are only comparing/combining neighbors.
+        for (const AZ::u32 sourceIndex : m_sortedPointIndices)
+        {
+            const TagMask* sourceTagMasks = &m_tagMasks[sourceIndex * wordCount];
+            if (hasDesiredTags)
+            {
+                bool hasDesiredTag = false;
+                for (size_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+                {
+                    hasDesiredTag = hasDesiredTag || (sourceTagMasks[wordIndex] & m_desiredTagMask[wordIndex]) != 0;
+                }
+                if (!hasDesiredTag)
+                {
+                    continue;
+                }
+            }
+
+            const size_t combinedCount = m_combinedPositions.size();
+            const bool combine = combinedCount > 0 &&
+                m_combinedInputIndices.back() == m_inputIndices[sourceIndex] &&
+                m_combinedPositions.back().IsClose(m_positions[sourceIndex]) &&
+                m_combinedNormals.back().IsClose(m_normals[sourceIndex]);
+
+            if (!combine)
+            {
+                m_combinedInputIndices.push_back(m_inputIndices[sourceIndex]);
+                m_combinedEntityIds.push_back(m_entityIds[sourceIndex]);
+                m_combinedPositions.push_back(m_positions[sourceIndex]);
+                m_combinedNormals.push_back(m_normals[sourceIndex]);
+                m_combinedTagMasks.resize(m_combinedTagMasks.size() + wordCount, 0);
+            }
+
+            // Consolidate points with similar attributes by adding the source tags to the target point with their max weight.
+            const size_t targetIndex = m_combinedPositions.size() - 1;
+            for (size_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+            {
+                TagMask& targetTagMask = m_combinedTagMasks[targetIndex * wordCount + wordIndex];
+                TagMask tagMask = sourceTagMasks[wordIndex];
+                for (size_t bitIndex = 0; tagMask != 0; ++bitIndex, tagMask >>= 1)
+                {
+                    if (tagMask & 1)
+                    {
+                        const size_t tagIndex = wordIndex * TagMaskBits + bitIndex;
+                        const TagMask tagBit = TagMask(1) << bitIndex;
+                        const float sourceWeight = m_tagWeights[tagIndex][sourceIndex];
+                        float& targetWeight = m_combinedTagWeights[tagIndex][targetIndex];
+                        targetWeight = (targetTagMask & tagBit) ? AZ::GetMax(sourceWeight, targetWeight) : sourceWeight;
+                        targetTagMask |= tagBit;
+                    }
+                }
+            }
+        }
+
+        AZStd::swap(m_inputIndices, m_combinedInputIndices);
+        AZStd::swap(m_entityIds, m_combinedEntityIds);
+        AZStd::swap(m_positions, m_combinedPositions);
+        AZStd::swap(m_normals, m_combinedNormals);
+        AZStd::swap(m_tagMasks, m_combinedTagMasks);
+        AZStd::swap(m_tagWeights, m_combinedTagWeights);
+
+        // The points of every input position are contiguous now, so their ranges are the running sum of the point counts.
+        m_inputPointStart.clear();
+        m_inputPointStart.resize(m_inputPositions.size() + 1, 0);
+        for (const AZ::u32 inputIndex : m_inputIndices)
+        {
+            ++m_inputPointStart[inputIndex + 1];
+        }
+        for (size_t inputIndex = 0; inputIndex < m_inputPositions.size(); ++inputIndex)
+        {
+            m_inputPointStart[inputIndex + 1] += m_inputPointStart[inputIndex];
+        }
+    }
+
+    AZStd::pair<size_t, size_t> SurfacePointBuffer::GetPointRange(size_t inputIndex) const
+    {
+        AZ_Assert(m_inputPointStart.size() == m_inputPositions.size() + 1, "CombineSortAndFilterNeighboringPoints needs to be called before GetPointRange.");
+        return AZStd::make_pair(m_inputPointStart[inputIndex], m_inputPointStart[inputIndex + 1]);
+    }
+
+    size_t SurfacePointBuffer::FindOrAddTag(AZ::Crc32 tag)
+    {
+        const auto tagItr = AZStd::find(m_tags.begin(), m_tags.end(), tag);
+        if (tagItr != m_tags.end())
+        {
+            return tagItr - m_tags.begin();
+        }
+
+        if (m_tags.size() == m_tagMaskWordCount * TagMaskBits)
+        {
+            GrowTagMasks();
+        }
+
+        m_tags.push_back(tag);
+        if (m_tagWeights.size() < m_tags.size())
+        {
+            m_tagWeights.emplace_back();
+        }
+        return m_tags.size() - 1;
+    }
+
+    void SurfacePointBuffer::GrowTagMasks()
+    {
+        // Rare, so the masks are copied to the new layout through the scratch array of CombineSortAndFilterNeighboringPoints.
+        const size_t wordCount = m_tagMaskWordCount + 1;
+        m_combinedTagMasks.assign(m_positions.size() * wordCount, 0);
+        for (size_t pointIndex = 0; pointIndex < m_positions.size(); ++pointIndex)
+        {
+            AZStd::copy(
+                m_tagMasks.begin() + pointIndex * m_tagMaskWordCount,
+                m_tagMasks.begin() + (pointIndex + 1) * m_tagMaskWordCount,
+                m_combinedTagMasks.begin() + pointIndex * wordCount);
+        }
+        AZStd::swap(m_tagMasks, m_combinedTagMasks);
+        m_tagMaskWordCount = wordCount;
+    }
+}
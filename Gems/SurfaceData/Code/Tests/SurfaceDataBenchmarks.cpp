@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <SurfaceDataModule.h>
+#include <SurfaceData/SurfaceDataModifierRequestBus.h>
+#include <SurfaceData/SurfaceDataProviderRequestBus.h>
+#include <SurfaceData/SurfaceDataSystemRequestBus.h>
+#include <SurfaceData/Utility/SurfaceDataUtility.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    // Surface provider with two flat surfaces at heights 0 and 4 that cover everything, and surface modifier that tags the
+    // points in its bounds. Both implement the per position and the bulk requests.
+    class BenchmarkSurfaceProvider
+        : private SurfaceData::SurfaceDataProviderRequestBus::Handler
+        , private SurfaceData::SurfaceDataModifierRequestBus::Handler
+    {
+    public:
+        BenchmarkSurfaceProvider(const AZ::Aabb& modifierBounds)
+            : m_modifierBounds(modifierBounds)
+        {
+            SurfaceData::SurfaceDataRegistryEntry registryEntry;
+            registryEntry.m_entityId = m_providerId;
+            registryEntry.m_tags = m_providerTags;
+            SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(m_providerHandle,
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataProvider, registryEntry);
+            SurfaceData::SurfaceDataProviderRequestBus::Handler::BusConnect(m_providerHandle);
+
+            registryEntry.m_entityId = m_modifierId;
+            registryEntry.m_bounds = m_modifierBounds;
+            registryEntry.m_tags = m_modifierTags;
+            SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(m_modifierHandle,
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataModifier, registryEntry);
+            SurfaceData::SurfaceDataModifierRequestBus::Handler::BusConnect(m_modifierHandle);
+        }
+
+        ~BenchmarkSurfaceProvider()
+        {
+            SurfaceData::SurfaceDataModifierRequestBus::Handler::BusDisconnect();
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataModifier, m_modifierHandle);
+            SurfaceData::SurfaceDataProviderRequestBus::Handler::BusDisconnect();
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataProvider, m_providerHandle);
+        }
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        // SurfaceDataProviderRequestBus
+        void GetSurfacePoints(const AZ::Vector3& inPosition, SurfaceData::SurfacePointList& surfacePointList) const override
+        {
+            for (const float height : Heights)
+            {
+                SurfaceData::SurfacePoint point;
+                point.m_entityId = m_providerId;
+                point.m_position = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), height);
+                point.m_normal = AZ::Vector3::CreateAxisZ();
+                SurfaceData::AddMaxValueForMasks(point.m_masks, m_providerTags, 1.0f);
+                surfacePointList.push_back(point);
+            }
+        }
+
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfaceData::SurfacePointBuffer& surfacePoints) const override
+        {
+            for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+            {
+                for (const float height : Heights)
+                {
+                    const AZ::Vector3 position(inPositions[inputIndex].GetX(), inPositions[inputIndex].GetY(), height);
+                    const size_t pointIndex = surfacePoints.AddSurfacePoint(inputIndex, m_providerId, position, AZ::Vector3::CreateAxisZ());
+                    surfacePoints.AddMaxValueForTags(pointIndex, m_providerTags, 1.0f);
+                }
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // SurfaceDataModifierRequestBus
+        void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override
+        {
+            for (auto& point : surfacePointList)
+            {
+                if (m_modifierBounds.Contains(point.m_position))
+                {
+                    SurfaceData::AddMaxValueForMasks(point.m_masks, m_modifierTags, 0.5f);
+                }
+            }
+        }
+
+        void ModifySurfacePointBuffer(SurfaceData::SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const override
+        {
+            for (size_t pointIndex : pointIndices)
+            {
+                if (m_modifierBounds.Contains(surfacePoints.GetPosition(pointIndex)))
+                {
+                    surfacePoints.AddMaxValueForTags(pointIndex, m_modifierTags, 0.5f);
+                }
+            }
+        }
+
+        static constexpr float Heights[] = { 0.0f, 4.0f };
+
+        const AZ::EntityId m_providerId = AZ::EntityId(0x11111111);
+        const AZ::EntityId m_modifierId = AZ::EntityId(0x22222222);
+        const SurfaceData::SurfaceTagVector m_providerTags = { SurfaceData::SurfaceTag(AZ::Crc32("benchmark_surface")) };
+        const SurfaceData::SurfaceTagVector m_modifierTags = { SurfaceData::SurfaceTag(AZ::Crc32("benchmark_modifier")) };
+        AZ::Aabb m_modifierBounds;
+        SurfaceData::SurfaceDataRegistryHandle m_providerHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+        SurfaceData::SurfaceDataRegistryHandle m_modifierHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+    };
+
+    /*
+     * Fills a 256x256 region of surface points from one provider with two surfaces and one modifier that covers half of the
+     * region. The list benchmark returns a list of surface points per position, and the buffer benchmark fills a reused
+     * surface point buffer. The reported items are input positions.
+     */
+    class SurfaceDataRegionBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr float RegionSize = 256.0f;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+
+        void internalSetUp()
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 128 * 1024 * 1024;
+
+            AZ::ComponentApplication::StartupParameters appStartup;
+            appStartup.m_createStaticModulesCallback =
+                [](AZStd::vector<AZ::Module*>& modules)
+            {
+                modules.emplace_back(new SurfaceData::SurfaceDataModule);
+            };
+
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            AZ::Entity* systemEntity = m_app->Create(appDesc, appStartup);
+            systemEntity->Init();
+            systemEntity->Activate();
+
+            m_region = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(RegionSize, RegionSize, 16.0f));
+            m_provider = AZStd::make_unique<BenchmarkSurfaceProvider>(
+                AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(RegionSize / 2.0f, RegionSize, 16.0f)));
+        }
+
+        void internalTearDown()
+        {
+            m_provider.reset();
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZStd::unique_ptr<BenchmarkSurfaceProvider> m_provider;
+        AZ::Aabb m_region;
+        const AZ::Vector2 m_stepSize = AZ::Vector2(1.0f);
+    };
+
+    BENCHMARK_DEFINE_F(SurfaceDataRegionBenchmarkFixture, RegionToPointLists)(benchmark::State& state)
+    {
+        SurfaceData::SurfacePointListPerPosition surfacePointListPerPosition;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+                m_region, m_stepSize, SurfaceData::SurfaceTagVector(), surfacePointListPerPosition);
+            benchmark::DoNotOptimize(surfacePointListPerPosition.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * surfacePointListPerPosition.size());
+    }
+
+    BENCHMARK_DEFINE_F(SurfaceDataRegionBenchmarkFixture, RegionToPointBuffer)(benchmark::State& state)
+    {
+        SurfaceData::SurfacePointBuffer surfacePoints;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+                m_region, m_stepSize, SurfaceData::SurfaceTagVector(), surfacePoints);
+            benchmark::DoNotOptimize(surfacePoints.GetPointCount());
+        }
+
+        state.SetItemsProcessed(state.iterations() * surfacePoints.GetInputPositionCount());
+    }
+
+    BENCHMARK_REGISTER_F(SurfaceDataRegionBenchmarkFixture, RegionToPointLists)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(SurfaceDataRegionBenchmarkFixture, RegionToPointBuffer)->Unit(benchmark::kMillisecond);
+} // namespace UnitTest
+
+#endif
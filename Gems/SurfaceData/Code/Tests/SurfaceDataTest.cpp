@@ -203,6 +203,42 @@ class MockSurfaceProvider
 
 };
 
+// A surface modifier that tags every point it gets, and only implements ModifySurfacePoints, so the points it tags are the
+// ones the surface data system passes to it.
+class MockTagAllModifier
+    : public SurfaceData::SurfaceDataModifierRequestBus::Handler
+{
+public:
+    MockTagAllModifier(const SurfaceData::SurfaceTagVector& surfaceTags, const AZ::Aabb& bounds)
+        : m_tags(surfaceTags)
+    {
+        SurfaceData::SurfaceDataRegistryEntry registryEntry;
+        registryEntry.m_entityId = AZ::EntityId(0x87654321);
+        registryEntry.m_bounds = bounds;
+        registryEntry.m_tags = m_tags;
+        SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(m_modifierHandle, &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataModifier, registryEntry);
+        SurfaceData::SurfaceDataModifierRequestBus::Handler::BusConnect(m_modifierHandle);
+    }
+
+    ~MockTagAllModifier()
+    {
+        SurfaceData::SurfaceDataModifierRequestBus::Handler::BusDisconnect();
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataModifier, m_modifierHandle);
+    }
+
+    void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override
+    {
+        for (auto& point : surfacePointList)
+        {
+            AddMaxValueForMasks(point.m_masks, m_tags, 1.0f);
+        }
+    }
+
+private:
+    SurfaceData::SurfaceTagVector m_tags;
+    SurfaceData::SurfaceDataRegistryHandle m_modifierHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+};
+
 
 
 
@@ -743,4 +779,188 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBuffer_CombineSortAndFilter)
+{
+    // This test verifies that a surface point buffer groups its points by input position in decreasing Z order,
+    // combines similar points with the max weight of each tag, and removes the points without a desired tag.
+
+    SurfaceData::SurfacePointBuffer surfacePoints;
+    surfacePoints.AddInputPosition(AZ::Vector3(0.0f));
+    surfacePoints.AddInputPosition(AZ::Vector3(1.0f));
+
+    const AZ::Vector3 normal = AZ::Vector3::CreateAxisZ();
+    const AZ::EntityId entityId(0x12345678);
+
+    // Points of the second input position, added before the points of the first one.
+    size_t pointIndex = surfacePoints.AddSurfacePoint(1, entityId, AZ::Vector3(1.0f, 1.0f, 2.0f), normal);
+    surfacePoints.AddMaxValueForTag(pointIndex, m_testSurface1Crc, 0.25f);
+    pointIndex = surfacePoints.AddSurfacePoint(1, entityId, AZ::Vector3(1.0f, 1.0f, 8.0f), normal);
+    surfacePoints.AddMaxValueForTag(pointIndex, m_testSurfaceNoMatchCrc, 1.0f);
+
+    // Points of the first input position, two of which are close enough to be combined.
+    pointIndex = surfacePoints.AddSurfacePoint(0, entityId, AZ::Vector3(0.0f, 0.0f, 1.0f), normal);
+    surfacePoints.AddMaxValueForTag(pointIndex, m_testSurface1Crc, 0.5f);
+    pointIndex = surfacePoints.AddSurfacePoint(0, entityId, AZ::Vector3(0.0f, 0.0f, 4.0f), normal);
+    surfacePoints.AddMaxValueForTag(pointIndex, m_testSurface1Crc, 0.75f);
+    pointIndex = surfacePoints.AddSurfacePoint(0, entityId, AZ::Vector3(0.0f, 0.0f, 4.0f + (AZ::Constants::Tolerance / 2.0f)), normal);
+    surfacePoints.AddMaxValueForTag(pointIndex, m_testSurface1Crc, 0.5f);
+    surfacePoints.AddMaxValueForTag(pointIndex, m_testSurface2Crc, 0.5f);
+
+    surfacePoints.CombineSortAndFilterNeighboringPoints({ SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) });
+
+    ASSERT_EQ(surfacePoints.GetPointCount(), 3u);
+
+    // The first input position has the combined point at height 4 followed by the point at height 1.
+    auto pointRange = surfacePoints.GetPointRange(0);
+    ASSERT_EQ(pointRange.second - pointRange.first, 2u);
+    SurfaceData::SurfacePoint point;
+    surfacePoints.GetSurfacePoint(pointRange.first, point);
+    EXPECT_NEAR(point.m_position.GetZ(), 4.0f, AZ::Constants::Tolerance);
+    EXPECT_EQ(point.m_masks.size(), 2u);
+    EXPECT_FLOAT_EQ(point.m_masks[m_testSurface1Crc], 0.75f);
+    EXPECT_FLOAT_EQ(point.m_masks[m_testSurface2Crc], 0.5f);
+    surfacePoints.GetSurfacePoint(pointRange.first + 1, point);
+    EXPECT_FLOAT_EQ(point.m_position.GetZ(), 1.0f);
+    EXPECT_EQ(point.m_masks.size(), 1u);
+
+    // The second input position only keeps the point with a desired tag.
+    pointRange = surfacePoints.GetPointRange(1);
+    ASSERT_EQ(pointRange.second - pointRange.first, 1u);
+    EXPECT_EQ(surfacePoints.GetInputIndex(pointRange.first), 1u);
+    EXPECT_FLOAT_EQ(surfacePoints.GetPosition(pointRange.first).GetZ(), 2.0f);
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBufferFromRegion_MatchesSurfacePointsFromRegion)
+{
+    // This test verifies that the surface point buffer of a region has the same points as the lists per position,
+    // for providers and modifiers that only cover part of the region.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(6.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(2.0f, 2.0f, 0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(8.0f));
+
+    SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, SurfaceData::SurfaceTagVector(), availablePointsPerPosition);
+
+    SurfaceData::SurfacePointBuffer surfacePoints;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+        regionBounds, stepSize, SurfaceData::SurfaceTagVector(), surfacePoints);
+
+    ASSERT_EQ(surfacePoints.GetInputPositionCount(), availablePointsPerPosition.size());
+    size_t modifiedPointCount = 0;
+    for (size_t inputIndex = 0; inputIndex < availablePointsPerPosition.size(); ++inputIndex)
+    {
+        const SurfaceData::SurfacePointList& pointList = availablePointsPerPosition[inputIndex].second;
+        EXPECT_TRUE(availablePointsPerPosition[inputIndex].first.IsClose(surfacePoints.GetInputPositions()[inputIndex]));
+
+        const auto pointRange = surfacePoints.GetPointRange(inputIndex);
+        ASSERT_EQ(pointRange.second - pointRange.first, pointList.size());
+        for (size_t index = 0; index < pointList.size(); ++index)
+        {
+            SurfaceData::SurfacePoint point;
+            surfacePoints.GetSurfacePoint(pointRange.first + index, point);
+            EXPECT_TRUE(point.m_position.IsClose(pointList[index].m_position));
+            EXPECT_TRUE(point.m_normal.IsClose(pointList[index].m_normal));
+            EXPECT_EQ(point.m_masks, pointList[index].m_masks);
+            modifiedPointCount += point.m_masks.size() > 1 ? 1 : 0;
+        }
+    }
+
+    // The provider covers 6x6 positions with two points each, and the modifier tags the 4x4 positions that overlap it.
+    EXPECT_EQ(surfacePoints.GetPointCount(), 6u * 6u * 2u);
+    EXPECT_EQ(modifiedPointCount, 4u * 4u * 2u);
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBufferFromRegion_ModifierOnlyGetsPointsWithinItsBounds)
+{
+    // This test verifies that a modifier without its own bulk implementation only modifies the points of the input
+    // positions within its registered bounds, like it does for the lists per position.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockTagAllModifier mockModifier(modifierTags, AZ::Aabb::CreateFromMinMax(AZ::Vector3(2.0f, 2.0f, 0.0f), AZ::Vector3(5.0f, 5.0f, 8.0f)));
+
+    SurfaceData::SurfacePointBuffer surfacePoints;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+        AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(8.0f)), AZ::Vector2(1.0f, 1.0f), SurfaceData::SurfaceTagVector(), surfacePoints);
+
+    size_t modifiedPointCount = 0;
+    for (size_t pointIndex = 0; pointIndex < surfacePoints.GetPointCount(); ++pointIndex)
+    {
+        SurfaceData::SurfacePoint point;
+        surfacePoints.GetSurfacePoint(pointIndex, point);
+        if (point.m_masks.find(m_testSurface2Crc) != point.m_masks.end())
+        {
+            ++modifiedPointCount;
+            EXPECT_GE(point.m_position.GetX(), 2.0f);
+            EXPECT_LE(point.m_position.GetX(), 5.0f);
+            EXPECT_GE(point.m_position.GetY(), 2.0f);
+            EXPECT_LE(point.m_position.GetY(), 5.0f);
+        }
+    }
+
+    // The bounds include their max sides, so the modifier tags 4x4 positions with two points each.
+    EXPECT_EQ(surfacePoints.GetPointCount(), 8u * 8u * 2u);
+    EXPECT_EQ(modifiedPointCount, 4u * 4u * 2u);
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBuffer_MoreTagsThanOneMaskWord)
+{
+    // This test verifies that a surface point buffer keeps the tags of its points when it has more tags than fit in 64 bits,
+    // including tags added after the points.
+
+    constexpr size_t TagCount = 150;
+    auto makeTag = [](size_t tagIndex)
+    {
+        return AZ::Crc32(AZStd::string::format("test_tag_%zu", tagIndex).c_str());
+    };
+
+    SurfaceData::SurfacePointBuffer surfacePoints;
+    surfacePoints.AddInputPosition(AZ::Vector3(0.0f));
+    const AZ::EntityId entityId(0x12345678);
+    const size_t firstPoint = surfacePoints.AddSurfacePoint(0, entityId, AZ::Vector3(0.0f, 0.0f, 1.0f), AZ::Vector3::CreateAxisZ());
+    const size_t secondPoint = surfacePoints.AddSurfacePoint(0, entityId, AZ::Vector3(0.0f, 0.0f, 2.0f), AZ::Vector3::CreateAxisZ());
+
+    // The first point gets every tag, the second one only the last tag.
+    for (size_t tagIndex = 0; tagIndex < TagCount; ++tagIndex)
+    {
+        surfacePoints.AddMaxValueForTag(firstPoint, makeTag(tagIndex), static_cast<float>(tagIndex) / TagCount);
+    }
+    surfacePoints.AddMaxValueForTag(secondPoint, makeTag(TagCount - 1), 1.0f);
+    ASSERT_EQ(surfacePoints.GetTagCount(), TagCount);
+
+    // Only the points with the last tag are kept, which are both points.
+    surfacePoints.CombineSortAndFilterNeighboringPoints({ SurfaceData::SurfaceTag(makeTag(TagCount - 1)) });
+    ASSERT_EQ(surfacePoints.GetPointCount(), 2u);
+
+    SurfaceData::SurfacePoint point;
+    surfacePoints.GetSurfacePoint(0, point);
+    EXPECT_FLOAT_EQ(point.m_position.GetZ(), 2.0f);
+    EXPECT_EQ(point.m_masks.size(), 1u);
+    EXPECT_TRUE(surfacePoints.HasTag(0, TagCount - 1));
+    EXPECT_FALSE(surfacePoints.HasTag(0, 0));
+
+    surfacePoints.GetSurfacePoint(1, point);
+    ASSERT_EQ(point.m_masks.size(), TagCount);
+    for (size_t tagIndex = 0; tagIndex < TagCount; ++tagIndex)
+    {
+        EXPECT_TRUE(surfacePoints.HasTag(1, tagIndex));
+        EXPECT_FLOAT_EQ(point.m_masks[makeTag(tagIndex)], static_cast<float>(tagIndex) / TagCount);
+    }
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -34,6 +34,8 @@ namespace UnitTest
         MOCK_METHOD1(RegisterArea, void(AZ::EntityId areaId));
         MOCK_METHOD1(UnregisterArea, void(AZ::EntityId areaId));
         MOCK_METHOD1(RefreshArea, void(AZ::EntityId areaId));
+        MOCK_METHOD1(SetHeightCacheMemoryBudget, void(size_t memoryBudgetBytes));
+        MOCK_CONST_METHOD0(GetHeightCacheStatistics, Terrain::TerrainHeightCacheStatistics());
     };
 
     class MockTerrainDataNotificationListener : public AzFramework::Terrain::TerrainDataNotificationBus::Handler
@@ -173,6 +173,40 @@ namespace Terrain
         outPosition.SetZ(AZ::GetClamp(height, m_cachedMinWorldHeight, m_cachedMaxWorldHeight));
     }
 
+    void TerrainHeightGradientListComponent::GetHeights(
+        const AZStd::vector<AZ::Vector3>& inPositions,
+        AZStd::vector<float>& outHeights,
+        AZStd::vector<bool>& terrainExists)
+    {
+        // Same as GetHeight, but every gradient gets sampled for all the positions at once, so it can use its bulk GetValues path.
+        AZStd::vector<AZ::Vector3> samplePositions(inPositions.size());
+        for (size_t index = 0; index < inPositions.size(); ++index)
+        {
+            samplePositions[index] = AZ::Vector3(inPositions[index].GetX(), inPositions[index].GetY(), 0.0f);
+        }
+
+        AZStd::vector<float> maxSamples(inPositions.size(), 0.0f);
+        AZStd::vector<float> samples(inPositions.size());
+        for (auto& gradientId : m_configuration.m_gradientEntities)
+        {
+            AZStd::fill(samples.begin(), samples.end(), 0.0f);
+            GradientSignal::GradientRequestBus::Event(
+                gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, samplePositions, samples);
+            for (size_t index = 0; index < samples.size(); ++index)
+            {
+                maxSamples[index] = AZ::GetMax(maxSamples[index], samples[index]);
+            }
+        }
+
+        const bool exists = !m_configuration.m_gradientEntities.empty();
+        for (size_t index = 0; index < inPositions.size(); ++index)
+        {
+            const float height = AZ::Lerp(m_cachedShapeBounds.GetMin().GetZ(), m_cachedShapeBounds.GetMax().GetZ(), maxSamples[index]);
+            outHeights[index] = AZ::GetClamp(height, m_cachedMinWorldHeight, m_cachedMaxWorldHeight);
+            terrainExists[index] = exists;
+        }
+    }
+
     void TerrainHeightGradientListComponent::OnCompositionChanged()
     {
         RefreshMinMaxHeights();
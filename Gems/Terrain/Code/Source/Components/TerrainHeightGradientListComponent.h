@@ -65,6 +65,7 @@ namespace Terrain
         ~TerrainHeightGradientListComponent() = default;
 
         void GetHeight(const AZ::Vector3& inPosition, AZ::Vector3& outPosition, bool& terrainExists) override;
+        void GetHeights(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights, AZStd::vector<bool>& terrainExists) override;
 
         //////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
@@ -178,6 +178,71 @@ namespace Terrain
         }
     }
 
+    void TerrainSurfaceDataSystemComponent::GetSurfacePointsFromList(
+        const AZStd::vector<AZ::Vector3>& inPositions, SurfaceData::SurfacePointBuffer& surfacePoints) const
+    {
+        if (m_terrainBoundsIsValid)
+        {
+            auto enumerationCallback = [&](AzFramework::Terrain::TerrainDataRequests* terrain) -> bool
+            {
+                const AZ::Aabb terrainAabb = terrain->GetTerrainAabb();
+                const AZ::EntityId entityId = GetEntityId();
+
+                // Query the heights, normals and surface weights of all the positions inside the terrain with the bulk queries.
+                AZStd::vector<size_t> inputIndices;
+                AZStd::vector<AZ::Vector3> terrainPositions;
+                inputIndices.reserve(inPositions.size());
+                terrainPositions.reserve(inPositions.size());
+                for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+                {
+                    if (terrainAabb.Contains(inPositions[inputIndex]))
+                    {
+                        inputIndices.push_back(inputIndex);
+                        terrainPositions.push_back(inPositions[inputIndex]);
+                    }
+                }
+
+                if (terrainPositions.empty())
+                {
+                    return false;
+                }
+
+                AZStd::vector<float> terrainHeights;
+                AZStd::vector<bool> isTerrainValidAtPoints;
+                AZStd::vector<AZ::Vector3> terrainNormals;
+                AZStd::vector<AzFramework::SurfaceData::OrderedSurfaceTagWeightSet> surfaceWeights;
+                terrain->GetHeightsFromList(
+                    terrainPositions, terrainHeights, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, &isTerrainValidAtPoints);
+                terrain->GetNormalsFromList(terrainPositions, terrainNormals, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+                terrain->GetSurfaceWeightsFromList(terrainPositions, surfaceWeights);
+
+                for (size_t terrainIndex = 0; terrainIndex < terrainPositions.size(); ++terrainIndex)
+                {
+                    const bool isHole = !isTerrainValidAtPoints[terrainIndex];
+
+                    const AZ::Vector3& inPosition = terrainPositions[terrainIndex];
+                    const AZ::Vector3 position(inPosition.GetX(), inPosition.GetY(), terrainHeights[terrainIndex]);
+                    const size_t pointIndex =
+                        surfacePoints.AddSurfacePoint(inputIndices[terrainIndex], entityId, position, terrainNormals[terrainIndex]);
+
+                    // Always add a "terrain" or "terrainHole" tag.
+                    const AZ::Crc32 terrainTag =
+                        isHole ? SurfaceData::Constants::s_terrainHoleTagCrc : SurfaceData::Constants::s_terrainTagCrc;
+                    surfacePoints.AddMaxValueForTag(pointIndex, terrainTag, 1.0f);
+
+                    // Add all of the surface tags that the terrain has at this point.
+                    for (auto& tag : surfaceWeights[terrainIndex])
+                    {
+                        surfacePoints.AddMaxValueForTag(pointIndex, tag.m_surfaceType, tag.m_weight);
+                    }
+                }
+                // Only one handler should exist.
+                return false;
+            };
+            AzFramework::Terrain::TerrainDataRequestBus::EnumerateHandlers(enumerationCallback);
+        }
+    }
+
     AZ::Aabb TerrainSurfaceDataSystemComponent::GetSurfaceAabb() const
     {
         auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
@@ -23,10 +23,11 @@ namespace Terrain
         if (serialize)
         {
             serialize->Class<TerrainWorldConfig, AZ::ComponentConfig>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("WorldMin", &TerrainWorldConfig::m_worldMin)
                 ->Field("WorldMax", &TerrainWorldConfig::m_worldMax)
                 ->Field("HeightQueryResolution", &TerrainWorldConfig::m_heightQueryResolution)
+                ->Field("HeightCacheMemoryBudgetMb", &TerrainWorldConfig::m_heightCacheMemoryBudgetMb)
             ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -42,6 +43,8 @@ namespace Terrain
                     ->DataElement(AZ::Edit::UIHandlers::Default, &TerrainWorldConfig::m_worldMin, "World Bounds (Min)", "")
                     ->DataElement(AZ::Edit::UIHandlers::Default, &TerrainWorldConfig::m_worldMax, "World Bounds (Max)", "")
                     ->DataElement(AZ::Edit::UIHandlers::Default, &TerrainWorldConfig::m_heightQueryResolution, "Height Query Resolution (m)", "")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &TerrainWorldConfig::m_heightCacheMemoryBudgetMb, "Height Cache Budget (MB)",
+                        "Memory budget for caching evaluated terrain heights at the height query resolution, 0 disables the cache.")
                 ;
             }
         }
@@ -96,6 +99,9 @@ namespace Terrain
             AZ::Aabb::CreateFromMinMax(m_configuration.m_worldMin, m_configuration.m_worldMax));
         AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
             &AzFramework::Terrain::TerrainDataRequestBus::Events::SetTerrainHeightQueryResolution, m_configuration.m_heightQueryResolution);
+        TerrainSystemServiceRequestBus::Broadcast(
+            &TerrainSystemServiceRequestBus::Events::SetHeightCacheMemoryBudget,
+            static_cast<size_t>(m_configuration.m_heightCacheMemoryBudgetMb) * 1024 * 1024);
     }
 
     void TerrainWorldComponent::Deactivate()
@@ -32,6 +32,7 @@ namespace Terrain
         AZ::Vector3 m_worldMin{ 0.0f, 0.0f, 0.0f };
         AZ::Vector3 m_worldMax{ 1024.0f, 1024.0f, 1024.0f };
         AZ::Vector2 m_heightQueryResolution{ 1.0f, 1.0f };
+        AZ::u32 m_heightCacheMemoryBudgetMb{ 0 };
     };
 
 
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainHeightCache.h>
+
+namespace Terrain
+{
+    TerrainHeightCache::TerrainHeightCache(FillFunction fillFunction)
+        : m_fillFunction(AZStd::move(fillFunction))
+    {
+    }
+
+    size_t TerrainHeightCache::GetTileMemorySize()
+    {
+        return sizeof(Tile);
+    }
+
+    void TerrainHeightCache::SetMemoryBudget(size_t memoryBudgetBytes)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        m_memoryBudget = memoryBudgetBytes;
+        m_maxTileCount = memoryBudgetBytes / GetTileMemorySize();
+        EvictTiles(nullptr);
+    }
+
+    bool TerrainHeightCache::IsEnabled() const
+    {
+        return m_maxTileCount > 0;
+    }
+
+    void TerrainHeightCache::Clear(const AZ::Vector2& queryResolution)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        m_tiles.clear();
+        m_queryResolution = queryResolution;
+        ++m_generation;
+    }
+
+    void TerrainHeightCache::Invalidate(const AZ::Aabb& region)
+    {
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        ++m_generation;
+
+        // Round the region outwards to grid points, and drop every tile that overlaps it.
+        const AZ::s32 minTileX = GetTileCoordinate(GetGridCoordinate(region.GetMin().GetX(), m_queryResolution.GetX()) - 1);
+        const AZ::s32 minTileY = GetTileCoordinate(GetGridCoordinate(region.GetMin().GetY(), m_queryResolution.GetY()) - 1);
+        const AZ::s32 maxTileX = GetTileCoordinate(GetGridCoordinate(region.GetMax().GetX(), m_queryResolution.GetX()) + 1);
+        const AZ::s32 maxTileY = GetTileCoordinate(GetGridCoordinate(region.GetMax().GetY(), m_queryResolution.GetY()) + 1);
+
+        for (auto tileItr = m_tiles.begin(); tileItr != m_tiles.end();)
+        {
+            const AZ::s32 tileX = static_cast<AZ::s32>(static_cast<AZ::u32>(tileItr->first >> 32));
+            const AZ::s32 tileY = static_cast<AZ::s32>(static_cast<AZ::u32>(tileItr->first));
+            if (tileX >= minTileX && tileX <= maxTileX && tileY >= minTileY && tileY <= maxTileY)
+            {
+                tileItr = m_tiles.erase(tileItr);
+                ++m_tilesInvalidated;
+            }
+            else
+            {
+                ++tileItr;
+            }
+        }
+    }
+
+    void TerrainHeightCache::GetHeight(const AZ::Vector3& inPosition, float& outHeight, bool& outTerrainExists, bool& outAreaFound)
+    {
+        AZ::Vector2 queryResolution;
+        AZ::u64 generation;
+        AZ::s32 gridX;
+        AZ::s32 gridY;
+
+        auto readTile = [&gridX, &gridY, &outHeight, &outTerrainExists, &outAreaFound](const Tile& tile)
+        {
+            const size_t index = GetTileIndex(gridX, gridY);
+            outHeight = tile.m_heights[index];
+            outTerrainExists = (tile.m_flags[index] & TerrainExistsFlag) != 0;
+            outAreaFound = (tile.m_flags[index] & AreaFoundFlag) != 0;
+        };
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+            queryResolution = m_queryResolution;
+            generation = m_generation;
+            gridX = GetGridCoordinate(inPosition.GetX(), queryResolution.GetX());
+            gridY = GetGridCoordinate(inPosition.GetY(), queryResolution.GetY());
+
+            if (const Tile* tile = FindTile(MakeTileKey(GetTileCoordinate(gridX), GetTileCoordinate(gridY))))
+            {
+                tile->m_lastUsed = ++m_useCounter;
+                readTile(*tile);
+                ++m_hits;
+                return;
+            }
+        }
+
+        ++m_misses;
+        FillTile(GetTileCoordinate(gridX), GetTileCoordinate(gridY), queryResolution, generation, readTile);
+    }
+
+    void TerrainHeightCache::GetHeights(
+        const AZStd::vector<AZ::Vector3>& inPositions,
+        AZStd::vector<float>& outHeights,
+        AZStd::vector<bool>& outTerrainExists,
+        AZStd::vector<bool>& outAreaFound)
+    {
+        outHeights.resize(inPositions.size());
+        outTerrainExists.resize(inPositions.size());
+        outAreaFound.resize(inPositions.size());
+
+        AZ::Vector2 queryResolution;
+        AZ::u64 generation;
+        AZStd::vector<size_t> missingIndices;
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+            queryResolution = m_queryResolution;
+            generation = m_generation;
+            const AZ::u64 useCount = ++m_useCounter;
+
+            // Neighboring positions are usually in the same tile, so only look up the tile when it changes.
+            TileKey currentKey = 0;
+            const Tile* currentTile = nullptr;
+            bool hasCurrentKey = false;
+
+            for (size_t index = 0; index < inPositions.size(); ++index)
+            {
+                const AZ::s32 gridX = GetGridCoordinate(inPositions[index].GetX(), queryResolution.GetX());
+                const AZ::s32 gridY = GetGridCoordinate(inPositions[index].GetY(), queryResolution.GetY());
+                const TileKey key = MakeTileKey(GetTileCoordinate(gridX), GetTileCoordinate(gridY));
+                if (!hasCurrentKey || key != currentKey)
+                {
+                    currentKey = key;
+                    hasCurrentKey = true;
+                    currentTile = FindTile(key);
+                    if (currentTile)
+                    {
+                        currentTile->m_lastUsed = useCount;
+                    }
+                }
+
+                if (currentTile)
+                {
+                    const size_t tileIndex = GetTileIndex(gridX, gridY);
+                    outHeights[index] = currentTile->m_heights[tileIndex];
+                    outTerrainExists[index] = (currentTile->m_flags[tileIndex] & TerrainExistsFlag) != 0;
+                    outAreaFound[index] = (currentTile->m_flags[tileIndex] & AreaFoundFlag) != 0;
+                }
+                else
+                {
+                    missingIndices.push_back(index);
+                }
+            }
+        }
+
+        m_hits += inPositions.size() - missingIndices.size();
+        m_misses += missingIndices.size();
+
+        // Fill the missing tiles one at a time, and read all the missing positions inside of each tile once it's filled.
+        while (!missingIndices.empty())
+        {
+            const AZ::Vector3& firstPosition = inPositions[missingIndices.front()];
+            const AZ::s32 tileX = GetTileCoordinate(GetGridCoordinate(firstPosition.GetX(), queryResolution.GetX()));
+            const AZ::s32 tileY = GetTileCoordinate(GetGridCoordinate(firstPosition.GetY(), queryResolution.GetY()));
+
+            FillTile(tileX, tileY, queryResolution, generation,
+                [&](const Tile& tile)
+                {
+                    size_t remainingCount = 0;
+                    for (const size_t index : missingIndices)
+                    {
+                        const AZ::s32 gridX = GetGridCoordinate(inPositions[index].GetX(), queryResolution.GetX());
+                        const AZ::s32 gridY = GetGridCoordinate(inPositions[index].GetY(), queryResolution.GetY());
+                        if (GetTileCoordinate(gridX) == tileX && GetTileCoordinate(gridY) == tileY)
+                        {
+                            const size_t tileIndex = GetTileIndex(gridX, gridY);
+                            outHeights[index] = tile.m_heights[tileIndex];
+                            outTerrainExists[index] = (tile.m_flags[tileIndex] & TerrainExistsFlag) != 0;
+                            outAreaFound[index] = (tile.m_flags[tileIndex] & AreaFoundFlag) != 0;
+                        }
+                        else
+                        {
+                            missingIndices[remainingCount++] = index;
+                        }
+                    }
+                    missingIndices.resize(remainingCount);
+                });
+        }
+    }
+
+    TerrainHeightCacheStatistics TerrainHeightCache::GetStatistics() const
+    {
+        TerrainHeightCacheStatistics statistics;
+        statistics.m_hits = m_hits;
+        statistics.m_misses = m_misses;
+        statistics.m_tilesFilled = m_tilesFilled;
+        statistics.m_tilesEvicted = m_tilesEvicted;
+        statistics.m_tilesInvalidated = m_tilesInvalidated;
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        statistics.m_tileCount = m_tiles.size();
+        statistics.m_memoryUsage = m_tiles.size() * GetTileMemorySize();
+        statistics.m_memoryBudget = m_memoryBudget;
+        return statistics;
+    }
+
+    TerrainHeightCache::TileKey TerrainHeightCache::MakeTileKey(AZ::s32 tileX, AZ::s32 tileY)
+    {
+        return (static_cast<TileKey>(static_cast<AZ::u32>(tileX)) << 32) | static_cast<TileKey>(static_cast<AZ::u32>(tileY));
+    }
+
+    AZ::s32 TerrainHeightCache::GetGridCoordinate(float position, float queryResolution)
+    {
+        // The positions are expected to be on grid points already, so round to the nearest one. Far away positions are clamped
+        // to a range where the tile coordinates can't overflow.
+        constexpr float MaxGridCoordinate = static_cast<float>(1 << 30);
+        return static_cast<AZ::s32>(AZ::GetClamp(floorf((position / queryResolution) + 0.5f), -MaxGridCoordinate, MaxGridCoordinate));
+    }
+
+    AZ::s32 TerrainHeightCache::GetTileCoordinate(AZ::s32 gridCoordinate)
+    {
+        // Round towards negative infinity, so that the tiles on both sides of 0 have the same size.
+        return (gridCoordinate >= 0) ? (gridCoordinate / TileSize) : ((gridCoordinate - TileSize + 1) / TileSize);
+    }
+
+    size_t TerrainHeightCache::GetTileIndex(AZ::s32 gridX, AZ::s32 gridY)
+    {
+        const AZ::s32 localX = gridX - (GetTileCoordinate(gridX) * TileSize);
+        const AZ::s32 localY = gridY - (GetTileCoordinate(gridY) * TileSize);
+        return static_cast<size_t>(localY * TileSize + localX);
+    }
+
+    const TerrainHeightCache::Tile* TerrainHeightCache::FindTile(TileKey key) const
+    {
+        const auto tileItr = m_tiles.find(key);
+        return (tileItr != m_tiles.end()) ? tileItr->second.get() : nullptr;
+    }
+
+    template <typename ReadFunc>
+    void TerrainHeightCache::FillTile(AZ::s32 tileX, AZ::s32 tileY, const AZ::Vector2& queryResolution, AZ::u64 generation, ReadFunc&& readFunc)
+    {
+        // Evaluate the whole tile with one bulk query, without holding the tile mutex.
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(TileSize * TileSize);
+        for (AZ::s32 y = 0; y < TileSize; ++y)
+        {
+            for (AZ::s32 x = 0; x < TileSize; ++x)
+            {
+                positions.emplace_back(
+                    static_cast<float>(tileX * TileSize + x) * queryResolution.GetX(),
+                    static_cast<float>(tileY * TileSize + y) * queryResolution.GetY(),
+                    0.0f);
+            }
+        }
+
+        AZStd::vector<float> heights;
+        AZStd::vector<bool> terrainExists;
+        AZStd::vector<bool> areaFound;
+        m_fillFunction(positions, heights, terrainExists, areaFound);
+
+        auto tile = AZStd::make_unique<Tile>();
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            tile->m_heights[index] = heights[index];
+            tile->m_flags[index] = (terrainExists[index] ? TerrainExistsFlag : 0) | (areaFound[index] ? AreaFoundFlag : 0);
+        }
+        ++m_tilesFilled;
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        if (generation != m_generation || m_maxTileCount == 0)
+        {
+            readFunc(*tile);
+            return;
+        }
+
+        // Another thread might have filled the same tile in the meantime, in which case that one is kept.
+        const TileKey key = MakeTileKey(tileX, tileY);
+        auto tileItr = m_tiles.find(key);
+        if (tileItr == m_tiles.end())
+        {
+            tileItr = m_tiles.emplace(key, AZStd::move(tile)).first;
+        }
+        tileItr->second->m_lastUsed = ++m_useCounter;
+        readFunc(*tileItr->second);
+
+        EvictTiles(tileItr->second.get());
+    }
+
+    void TerrainHeightCache::EvictTiles(const Tile* keepTile)
+    {
+        // Evictions only happen after a tile was filled, which is far more expensive than a scan over the tiles.
+        while (m_tiles.size() > m_maxTileCount)
+        {
+            auto oldestItr = m_tiles.end();
+            for (auto tileItr = m_tiles.begin(); tileItr != m_tiles.end(); ++tileItr)
+            {
+                if (tileItr->second.get() != keepTile &&
+                    (oldestItr == m_tiles.end() || tileItr->second->m_lastUsed < oldestItr->second->m_lastUsed))
+                {
+                    oldestItr = tileItr;
+                }
+            }
+
+            if (oldestItr == m_tiles.end())
+            {
+                break;
+            }
+            m_tiles.erase(oldestItr);
+            ++m_tilesEvicted;
+        }
+    }
+} // namespace Terrain
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <TerrainSystem/TerrainSystemBus.h>
+
+namespace Terrain
+{
+    /**
+    * A tiled cache of terrain heights at the points of the height query grid.
+    * Tiles of TileSize x TileSize grid points are filled on first use with one bulk query, and are dropped when the terrain data
+    * in their bounds changes, or when they're the least recently used tile and the cache is over its memory budget.
+    * Lookups from multiple threads are safe, they only take a shared lock unless a tile needs to be filled.
+    */
+    class TerrainHeightCache
+    {
+    public:
+        static constexpr AZ::s32 TileSize = 64;
+
+        //! Evaluates the heights at a list of grid positions, with the same outputs as TerrainSystem::GetTerrainAreaHeights.
+        using FillFunction = AZStd::function<void(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            AZStd::vector<float>& outHeights,
+            AZStd::vector<bool>& outTerrainExists,
+            AZStd::vector<bool>& outAreaFound)>;
+
+        explicit TerrainHeightCache(FillFunction fillFunction);
+        TerrainHeightCache(const TerrainHeightCache&) = delete;
+        TerrainHeightCache& operator=(const TerrainHeightCache&) = delete;
+
+        //! The memory used by one cached tile.
+        static size_t GetTileMemorySize();
+
+        //! Sets the memory budget in bytes and evicts tiles until the cache fits. A budget smaller than one tile disables the cache.
+        void SetMemoryBudget(size_t memoryBudgetBytes);
+        bool IsEnabled() const;
+
+        //! Drops all the tiles, and sets the spacing of the grid points.
+        void Clear(const AZ::Vector2& queryResolution);
+
+        //! Drops the tiles that contain grid points inside of the region.
+        void Invalidate(const AZ::Aabb& region);
+
+        //! Looks up the heights at grid positions, filling any missing tiles first. The outputs are resized to match the positions.
+        void GetHeight(const AZ::Vector3& inPosition, float& outHeight, bool& outTerrainExists, bool& outAreaFound);
+        void GetHeights(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            AZStd::vector<float>& outHeights,
+            AZStd::vector<bool>& outTerrainExists,
+            AZStd::vector<bool>& outAreaFound);
+
+        TerrainHeightCacheStatistics GetStatistics() const;
+
+    private:
+        static constexpr AZ::u8 TerrainExistsFlag = 0x01;
+        static constexpr AZ::u8 AreaFoundFlag = 0x02;
+
+        struct Tile
+        {
+            AZ_CLASS_ALLOCATOR(Tile, AZ::SystemAllocator, 0);
+
+            float m_heights[TileSize * TileSize];
+            AZ::u8 m_flags[TileSize * TileSize];
+            mutable AZStd::atomic<AZ::u64> m_lastUsed{ 0 };
+        };
+
+        using TileKey = AZ::u64;
+        using TileMap = AZStd::unordered_map<TileKey, AZStd::unique_ptr<Tile>>;
+
+        static TileKey MakeTileKey(AZ::s32 tileX, AZ::s32 tileY);
+        static AZ::s32 GetGridCoordinate(float position, float queryResolution);
+        static AZ::s32 GetTileCoordinate(AZ::s32 gridCoordinate);
+        static size_t GetTileIndex(AZ::s32 gridX, AZ::s32 gridY);
+
+        const Tile* FindTile(TileKey key) const;
+        //! Fills the tile and adds it to the cache, then calls readFunc(const Tile&) while the tile is guaranteed to be alive.
+        //! The tile isn't added if the cache was cleared or invalidated since the lookup that found it missing.
+        template <typename ReadFunc>
+        void FillTile(AZ::s32 tileX, AZ::s32 tileY, const AZ::Vector2& queryResolution, AZ::u64 generation, ReadFunc&& readFunc);
+        //! Drops least recently used tiles other than keepTile until the cache is within its budget, the tile mutex needs to be locked.
+        void EvictTiles(const Tile* keepTile);
+
+        FillFunction m_fillFunction;
+
+        mutable AZStd::shared_mutex m_tileMutex;
+        TileMap m_tiles;
+        AZ::Vector2 m_queryResolution{ 1.0f };
+        AZ::u64 m_generation = 0;
+        size_t m_memoryBudget = 0;
+        AZStd::atomic<size_t> m_maxTileCount{ 0 };
+
+        AZStd::atomic<AZ::u64> m_useCounter{ 0 };
+        AZStd::atomic<AZ::u64> m_hits{ 0 };
+        AZStd::atomic<AZ::u64> m_misses{ 0 };
+        AZStd::atomic<AZ::u64> m_tilesFilled{ 0 };
+        AZStd::atomic<AZ::u64> m_tilesEvicted{ 0 };
+        AZStd::atomic<AZ::u64> m_tilesInvalidated{ 0 };
+    };
+} // namespace Terrain
@@ -49,6 +49,12 @@ bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, co
 }
 
 TerrainSystem::TerrainSystem()
+    : m_heightCache(
+          [this](const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights, AZStd::vector<bool>& outTerrainExists,
+              AZStd::vector<bool>& outAreaFound)
+          {
+              GetTerrainAreaHeights(inPositions, outHeights, outTerrainExists, outAreaFound);
+          })
 {
     Terrain::TerrainSystemServiceRequestBus::Handler::BusConnect();
     AZ::TickBus::Handler::BusConnect();
@@ -81,6 +87,7 @@ void TerrainSystem::Activate()
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
         m_registeredAreas.clear();
+        m_heightCache.Clear(m_currentSettings.m_heightQueryResolution);
     }
 
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusConnect();
@@ -110,6 +117,7 @@ void TerrainSystem::Deactivate()
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
         m_registeredAreas.clear();
+        m_heightCache.Clear(m_currentSettings.m_heightQueryResolution);
     }
 
     m_dirtyRegion = AZ::Aabb::CreateNull();
@@ -179,10 +187,10 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             ClampPosition(x, y, pos0, normalizedDelta);
             const AZ::Vector2 pos1 = pos0 + m_currentSettings.m_heightQueryResolution;
 
-            const float heightX0Y0 = GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), terrainExists);
-            const float heightX1Y0 = GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), terrainExists);
-            const float heightX0Y1 = GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), terrainExists);
-            const float heightX1Y1 = GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), terrainExists);
+            const float heightX0Y0 = GetTerrainGridHeight(pos0.GetX(), pos0.GetY(), terrainExists);
+            const float heightX1Y0 = GetTerrainGridHeight(pos1.GetX(), pos0.GetY(), terrainExists);
+            const float heightX0Y1 = GetTerrainGridHeight(pos0.GetX(), pos1.GetY(), terrainExists);
+            const float heightX1Y1 = GetTerrainGridHeight(pos1.GetX(), pos1.GetY(), terrainExists);
             const float heightXY0 = AZ::Lerp(heightX0Y0, heightX1Y0, normalizedDelta.GetX());
             const float heightXY1 = AZ::Lerp(heightX0Y1, heightX1Y1, normalizedDelta.GetX());
             height = AZ::Lerp(heightXY0, heightXY1, normalizedDelta.GetY());
@@ -196,7 +204,7 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             AZ::Vector2 clampedPosition;
             ClampPosition(x, y, clampedPosition, normalizedDelta);
 
-            height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
+            height = GetTerrainGridHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
         }
         break;
 
@@ -241,6 +249,42 @@ float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists)
     return height;
 }
 
+float TerrainSystem::GetTerrainGridHeight(float x, float y, bool& terrainExists) const
+{
+    if (!m_heightCache.IsEnabled())
+    {
+        return GetTerrainAreaHeight(x, y, terrainExists);
+    }
+
+    float height = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    bool cachedTerrainExists = false;
+    bool areaFound = false;
+    m_heightCache.GetHeight(AZ::Vector3(x, y, 0.0f), height, cachedTerrainExists, areaFound);
+
+    // Like GetTerrainAreaHeight, terrainExists is only changed when the position is inside of a terrain area.
+    if (areaFound)
+    {
+        terrainExists = cachedTerrainExists;
+    }
+    return height;
+}
+
+void TerrainSystem::GetTerrainGridHeights(
+    const AZStd::vector<AZ::Vector3>& inPositions,
+    AZStd::vector<float>& outHeights,
+    AZStd::vector<bool>& outTerrainExists,
+    AZStd::vector<bool>& outAreaFound) const
+{
+    if (m_heightCache.IsEnabled())
+    {
+        m_heightCache.GetHeights(inPositions, outHeights, outTerrainExists, outAreaFound);
+    }
+    else
+    {
+        GetTerrainAreaHeights(inPositions, outHeights, outTerrainExists, outAreaFound);
+    }
+}
+
 float TerrainSystem::GetHeight(AZ::Vector3 position, Sampler sampler, bool* terrainExistsPtr) const
 {
     return GetHeightSynchronous(position.GetX(), position.GetY(), sampler, terrainExistsPtr);
@@ -297,6 +341,257 @@ AZ::Vector3 TerrainSystem::GetNormalFromFloats(float x, float y, Sampler sampler
     return GetNormalSynchronous(x, y, sampler, terrainExistsPtr);
 }
 
+void TerrainSystem::GetHeightsSynchronous(
+    const AZ::Vector3* inPositions, size_t count, Sampler sampler, float* outHeights, bool* outTerrainExists) const
+{
+    // Gather the positions that GetHeightSynchronous would sample for each input position, in the same order.
+    const bool bilinear = (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+    const size_t samplesPerPosition = bilinear ? 4 : 1;
+
+    AZStd::vector<AZ::Vector3> samplePositions;
+    AZStd::vector<AZ::Vector2> normalizedDeltas;
+    samplePositions.reserve(count * samplesPerPosition);
+    normalizedDeltas.reserve(bilinear ? count : 0);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const float x = inPositions[index].GetX();
+        const float y = inPositions[index].GetY();
+
+        switch (sampler)
+        {
+        case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
+            {
+                AZ::Vector2 normalizedDelta;
+                AZ::Vector2 pos0;
+                ClampPosition(x, y, pos0, normalizedDelta);
+                const AZ::Vector2 pos1 = pos0 + m_currentSettings.m_heightQueryResolution;
+
+                samplePositions.emplace_back(pos0.GetX(), pos0.GetY(), 0.0f);
+                samplePositions.emplace_back(pos1.GetX(), pos0.GetY(), 0.0f);
+                samplePositions.emplace_back(pos0.GetX(), pos1.GetY(), 0.0f);
+                samplePositions.emplace_back(pos1.GetX(), pos1.GetY(), 0.0f);
+                normalizedDeltas.push_back(normalizedDelta);
+            }
+            break;
+
+        case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
+            {
+                AZ::Vector2 normalizedDelta;
+                AZ::Vector2 clampedPosition;
+                ClampPosition(x, y, clampedPosition, normalizedDelta);
+                samplePositions.emplace_back(clampedPosition.GetX(), clampedPosition.GetY(), 0.0f);
+            }
+            break;
+
+        case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
+            [[fallthrough]];
+        default:
+            samplePositions.emplace_back(x, y, 0.0f);
+            break;
+        }
+    }
+
+    AZStd::vector<float> sampleHeights;
+    AZStd::vector<bool> sampleTerrainExists;
+    AZStd::vector<bool> sampleAreaFound;
+    if (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT)
+    {
+        GetTerrainAreaHeights(samplePositions, sampleHeights, sampleTerrainExists, sampleAreaFound);
+    }
+    else
+    {
+        // The bilinear and clamp samplers only sample points of the height query grid, which can come from the height cache.
+        GetTerrainGridHeights(samplePositions, sampleHeights, sampleTerrainExists, sampleAreaFound);
+    }
+
+    const float minHeight = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    const float maxHeight = m_currentSettings.m_worldBounds.GetMax().GetZ();
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const size_t firstSample = index * samplesPerPosition;
+
+        // Like the per position query, terrainExists comes from the last sample that was inside of a terrain area.
+        bool terrainExists = false;
+        for (size_t sample = firstSample; sample < firstSample + samplesPerPosition; ++sample)
+        {
+            if (sampleAreaFound[sample])
+            {
+                terrainExists = sampleTerrainExists[sample];
+            }
+        }
+
+        float height = sampleHeights[firstSample];
+        if (bilinear)
+        {
+            const AZ::Vector2& normalizedDelta = normalizedDeltas[index];
+            const float heightXY0 = AZ::Lerp(sampleHeights[firstSample], sampleHeights[firstSample + 1], normalizedDelta.GetX());
+            const float heightXY1 = AZ::Lerp(sampleHeights[firstSample + 2], sampleHeights[firstSample + 3], normalizedDelta.GetX());
+            height = AZ::Lerp(heightXY0, heightXY1, normalizedDelta.GetY());
+        }
+
+        outHeights[index] = AZ::GetClamp(height, minHeight, maxHeight);
+        if (outTerrainExists)
+        {
+            outTerrainExists[index] = terrainExists;
+        }
+    }
+}
+
+void TerrainSystem::GetTerrainAreaHeights(
+    const AZStd::vector<AZ::Vector3>& inPositions,
+    AZStd::vector<float>& outHeights,
+    AZStd::vector<bool>& outTerrainExists,
+    AZStd::vector<bool>& outAreaFound) const
+{
+    const float defaultHeight = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    outHeights.assign(inPositions.size(), defaultHeight);
+    outTerrainExists.assign(inPositions.size(), false);
+    outAreaFound.assign(inPositions.size(), false);
+
+    AZStd::vector<size_t> remainingIndices(inPositions.size());
+    for (size_t index = 0; index < remainingIndices.size(); ++index)
+    {
+        remainingIndices[index] = index;
+    }
+
+    AZStd::vector<size_t> areaIndices;
+    AZStd::vector<AZ::Vector3> areaPositions;
+    AZStd::vector<float> areaHeights;
+    AZStd::vector<bool> areaTerrainExists;
+
+    // The areas are sorted into priority order, so every position gets its height from the first area that contains it.
+    // Each area is queried once for all of its positions.
+    for (const auto& [areaId, areaBounds] : m_registeredAreas)
+    {
+        if (remainingIndices.empty())
+        {
+            break;
+        }
+
+        areaIndices.clear();
+        areaPositions.clear();
+        size_t remainingCount = 0;
+        for (size_t remaining = 0; remaining < remainingIndices.size(); ++remaining)
+        {
+            const size_t index = remainingIndices[remaining];
+            const AZ::Vector3 inPosition(inPositions[index].GetX(), inPositions[index].GetY(), areaBounds.GetMin().GetZ());
+            if (areaBounds.Contains(inPosition))
+            {
+                areaIndices.push_back(index);
+                areaPositions.push_back(inPosition);
+            }
+            else
+            {
+                remainingIndices[remainingCount++] = index;
+            }
+        }
+        remainingIndices.resize(remainingCount);
+
+        if (areaIndices.empty())
+        {
+            continue;
+        }
+
+        areaHeights.assign(areaIndices.size(), defaultHeight);
+        areaTerrainExists.assign(areaIndices.size(), false);
+        Terrain::TerrainAreaHeightRequestBus::Event(
+            areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights, areaPositions, areaHeights, areaTerrainExists);
+
+        for (size_t areaIndex = 0; areaIndex < areaIndices.size(); ++areaIndex)
+        {
+            const size_t index = areaIndices[areaIndex];
+            outHeights[index] = areaHeights[areaIndex];
+            outTerrainExists[index] = areaTerrainExists[areaIndex];
+            outAreaFound[index] = true;
+        }
+    }
+}
+
+void TerrainSystem::GetNormalsSynchronous(
+    const AZ::Vector3* inPositions, size_t count, Sampler sampler, AZ::Vector3* outNormals, bool* outTerrainExists) const
+{
+    // Query the heights around every position in one bulk query, in the same order as GetNormalSynchronous.
+    const AZ::Vector2 range = (m_currentSettings.m_heightQueryResolution / 2.0f);
+    AZStd::vector<AZ::Vector3> samplePositions;
+    samplePositions.reserve(count * 4);
+    for (size_t index = 0; index < count; ++index)
+    {
+        const float x = inPositions[index].GetX();
+        const float y = inPositions[index].GetY();
+        samplePositions.emplace_back(x, y - range.GetY(), 0.0f);
+        samplePositions.emplace_back(x - range.GetX(), y, 0.0f);
+        samplePositions.emplace_back(x + range.GetX(), y, 0.0f);
+        samplePositions.emplace_back(x, y + range.GetY(), 0.0f);
+    }
+
+    AZStd::vector<float> sampleHeights(samplePositions.size());
+    AZStd::vector<bool> sampleTerrainExists(samplePositions.size());
+    GetHeightsSynchronous(samplePositions.data(), samplePositions.size(), sampler, sampleHeights.data(), sampleTerrainExists.data());
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const size_t firstSample = index * 4;
+        const AZ::Vector3 v1(samplePositions[firstSample].GetX(), samplePositions[firstSample].GetY(), sampleHeights[firstSample]);
+        const AZ::Vector3 v2(samplePositions[firstSample + 1].GetX(), samplePositions[firstSample + 1].GetY(), sampleHeights[firstSample + 1]);
+        const AZ::Vector3 v3(samplePositions[firstSample + 2].GetX(), samplePositions[firstSample + 2].GetY(), sampleHeights[firstSample + 2]);
+        const AZ::Vector3 v4(samplePositions[firstSample + 3].GetX(), samplePositions[firstSample + 3].GetY(), sampleHeights[firstSample + 3]);
+
+        outNormals[index] = (v3 - v2).Cross(v4 - v1).GetNormalized();
+        if (outTerrainExists)
+        {
+            outTerrainExists[index] = sampleTerrainExists[firstSample + 3];
+        }
+    }
+}
+
+void TerrainSystem::GetHeightsFromList(
+    const AZStd::vector<AZ::Vector3>& inPositions,
+    AZStd::vector<float>& outHeights,
+    Sampler sampler,
+    AZStd::vector<bool>* terrainExists) const
+{
+    outHeights.resize(inPositions.size());
+    if (terrainExists)
+    {
+        terrainExists->resize(inPositions.size());
+    }
+
+    if (inPositions.empty())
+    {
+        return;
+    }
+
+    // The query runs on the calling thread. Callers come in through TerrainDataRequestBus, which stays locked while they wait,
+    // and the terrain areas and their gradients can query the terrain system again, so handing the positions to other
+    // threads could deadlock on the bus.
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+    GetHeightsSynchronous(inPositions.data(), inPositions.size(), sampler, outHeights.data(), terrainExists ? terrainExists->data() : nullptr);
+}
+
+void TerrainSystem::GetNormalsFromList(
+    const AZStd::vector<AZ::Vector3>& inPositions,
+    AZStd::vector<AZ::Vector3>& outNormals,
+    Sampler sampler,
+    AZStd::vector<bool>* terrainExists) const
+{
+    outNormals.resize(inPositions.size());
+    if (terrainExists)
+    {
+        terrainExists->resize(inPositions.size());
+    }
+
+    if (inPositions.empty())
+    {
+        return;
+    }
+
+    // Runs on the calling thread for the same reason as GetHeightsFromList.
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+    GetNormalsSynchronous(inPositions.data(), inPositions.size(), sampler, outNormals.data(), terrainExists ? terrainExists->data() : nullptr);
+}
+
 
 AzFramework::SurfaceData::SurfaceTagWeight TerrainSystem::GetMaxSurfaceWeight(
     const AZ::Vector3 position, Sampler sampleFilter, bool* terrainExistsPtr) const
@@ -424,6 +719,38 @@ void TerrainSystem::GetSurfaceWeightsFromFloats(
     GetOrderedSurfaceWeights(x, y, sampleFilter, outSurfaceWeights, terrainExistsPtr);
 }
 
+void TerrainSystem::GetSurfaceWeightsFromList(
+    const AZStd::vector<AZ::Vector3>& inPositions,
+    AZStd::vector<AzFramework::SurfaceData::OrderedSurfaceTagWeightSet>& outSurfaceWeights,
+    [[maybe_unused]] Sampler sampleFilter,
+    AZStd::vector<bool>* terrainExists) const
+{
+    outSurfaceWeights.resize(inPositions.size());
+
+    // Like GetOrderedSurfaceWeights, terrainExists comes from an exact height query, which is done in bulk.
+    if (terrainExists)
+    {
+        AZStd::vector<float> heights;
+        GetHeightsFromList(inPositions, heights, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, terrainExists);
+    }
+
+    // The terrain areas only provide surface weights one position at a time, so these are queried per position.
+    for (size_t index = 0; index < inPositions.size(); ++index)
+    {
+        AzFramework::SurfaceData::OrderedSurfaceTagWeightSet& surfaceWeights = outSurfaceWeights[index];
+        surfaceWeights.clear();
+
+        AZ::Aabb bounds;
+        const AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(inPositions[index].GetX(), inPositions[index].GetY(), bounds);
+        if (bestAreaId.IsValid())
+        {
+            const AZ::Vector3 inPosition(inPositions[index].GetX(), inPositions[index].GetY(), 0.0f);
+            Terrain::TerrainAreaSurfaceRequestBus::Event(
+                bestAreaId, &Terrain::TerrainAreaSurfaceRequestBus::Events::GetSurfaceWeights, inPosition, surfaceWeights);
+        }
+    }
+}
+
 const char* TerrainSystem::GetMaxSurfaceName([[maybe_unused]] AZ::Vector3 position, [[maybe_unused]] Sampler sampleFilter, [[maybe_unused]] bool* terrainExistsPtr) const
 {
     // For now, always set terrainExists to true, as we don't have a way to author data for terrain holes yet.
@@ -522,6 +849,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
     m_registeredAreas[areaId] = aabb;
     m_dirtyRegion.AddAabb(aabb);
     m_terrainHeightDirty = true;
+    m_heightCache.Invalidate(aabb);
 }
 
 void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
@@ -540,6 +868,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             {
                 m_dirtyRegion.AddAabb(aabb);
                 m_terrainHeightDirty = true;
+                m_heightCache.Invalidate(aabb);
                 return true;
             }
             return false;
@@ -562,6 +891,17 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId)
 
     m_dirtyRegion.AddAabb(expandedAabb);
     m_terrainHeightDirty = true;
+    m_heightCache.Invalidate(expandedAabb);
+}
+
+void TerrainSystem::SetHeightCacheMemoryBudget(size_t memoryBudgetBytes)
+{
+    m_heightCache.SetMemoryBudget(memoryBudgetBytes);
+}
+
+TerrainHeightCacheStatistics TerrainSystem::GetHeightCacheStatistics() const
+{
+    return m_heightCache.GetStatistics();
 }
 
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
@@ -590,6 +930,12 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // The cached heights depend on the query grid and the world height range, so they're all dropped when the settings change.
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
+            m_heightCache.Clear(m_currentSettings.m_heightQueryResolution);
+        }
     }
 
     if (terrainSettingsChanged || m_terrainHeightDirty)
@@ -14,6 +14,7 @@
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Aabb.h>
 
@@ -22,6 +23,7 @@
 #include <AzCore/Jobs/JobFunction.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <TerrainSystem/TerrainHeightCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 namespace Terrain
@@ -49,6 +51,9 @@ namespace Terrain
         void UnregisterArea(AZ::EntityId areaId) override;
         void RefreshArea(AZ::EntityId areaId) override;
 
+        void SetHeightCacheMemoryBudget(size_t memoryBudgetBytes) override;
+        TerrainHeightCacheStatistics GetHeightCacheStatistics() const override;
+
         ///////////////////////////////////////////
         // TerrainDataRequestBus::Handler Impl
         AZ::Vector2 GetTerrainHeightQueryResolution() const override;
@@ -112,6 +117,24 @@ namespace Terrain
         AZ::Vector3 GetNormalFromFloats(
             float x, float y, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const override;
 
+        //! Bulk queries for a list of positions. Heights and normals sample each terrain area once for all the positions it contains.
+        //! They run on the calling thread, since the terrain areas can query the terrain system again.
+        void GetHeightsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            AZStd::vector<float>& outHeights,
+            Sampler sampler = Sampler::DEFAULT,
+            AZStd::vector<bool>* terrainExists = nullptr) const override;
+        void GetNormalsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            AZStd::vector<AZ::Vector3>& outNormals,
+            Sampler sampler = Sampler::DEFAULT,
+            AZStd::vector<bool>* terrainExists = nullptr) const override;
+        void GetSurfaceWeightsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            AZStd::vector<AzFramework::SurfaceData::OrderedSurfaceTagWeightSet>& outSurfaceWeights,
+            Sampler sampleFilter = Sampler::DEFAULT,
+            AZStd::vector<bool>* terrainExists = nullptr) const override;
+
     private:
         void ClampPosition(float x, float y, AZ::Vector2& outPosition, AZ::Vector2& normalizedDelta) const;
 
@@ -124,8 +147,26 @@ namespace Terrain
             bool* terrainExistsPtr) const;
         float GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
         float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
+        // Same as GetTerrainAreaHeight(s) for positions on the height query grid, but reads the heights from the cache when it's enabled.
+        float GetTerrainGridHeight(float x, float y, bool& terrainExists) const;
+        void GetTerrainGridHeights(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            AZStd::vector<float>& outHeights,
+            AZStd::vector<bool>& outTerrainExists,
+            AZStd::vector<bool>& outAreaFound) const;
         AZ::Vector3  GetNormalSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
 
+        // Bulk versions of the synchronous queries for a range of positions, m_areaMutex needs to be locked by the caller.
+        void GetHeightsSynchronous(
+            const AZ::Vector3* inPositions, size_t count, Sampler sampler, float* outHeights, bool* outTerrainExists) const;
+        void GetTerrainAreaHeights(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            AZStd::vector<float>& outHeights,
+            AZStd::vector<bool>& outTerrainExists,
+            AZStd::vector<bool>& outAreaFound) const;
+        void GetNormalsSynchronous(
+            const AZ::Vector3* inPositions, size_t count, Sampler sampler, AZ::Vector3* outNormals, bool* outTerrainExists) const;
+
         // AZ::TickBus::Handler overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
@@ -145,5 +186,7 @@ namespace Terrain
 
         mutable AZStd::shared_mutex m_areaMutex;
         AZStd::map<AZ::EntityId, AZ::Aabb, TerrainLayerPriorityComparator> m_registeredAreas;
+
+        mutable TerrainHeightCache m_heightCache;
     };
 } // namespace Terrain
@@ -10,6 +10,7 @@
 
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -20,6 +21,25 @@
 
 namespace Terrain
 {
+    //! Statistics of the terrain system's tiled height cache.
+    struct TerrainHeightCacheStatistics
+    {
+        AZ::u64 m_hits = 0;             //!< Grid point heights that were read from a cached tile.
+        AZ::u64 m_misses = 0;           //!< Grid point heights that needed their tile to be filled first.
+        AZ::u64 m_tilesFilled = 0;
+        AZ::u64 m_tilesEvicted = 0;     //!< Least recently used tiles that were dropped to stay within the memory budget.
+        AZ::u64 m_tilesInvalidated = 0; //!< Tiles that were dropped because the terrain data in their bounds changed.
+        size_t m_tileCount = 0;
+        size_t m_memoryUsage = 0;
+        size_t m_memoryBudget = 0;
+
+        float GetHitRate() const
+        {
+            const AZ::u64 lookups = m_hits + m_misses;
+            return (lookups > 0) ? static_cast<float>(m_hits) / static_cast<float>(lookups) : 0.0f;
+        }
+    };
+
     /**
     * A bus to signal the life times of terrain areas
     * Note: all the API are meant to be queued events
@@ -45,6 +65,10 @@ namespace Terrain
         virtual void RegisterArea(AZ::EntityId areaId) = 0;
         virtual void UnregisterArea(AZ::EntityId areaId) = 0;
         virtual void RefreshArea(AZ::EntityId areaId) = 0;
+
+        // Sets the memory budget of the tiled cache of terrain heights, a budget of 0 disables the cache.
+        virtual void SetHeightCacheMemoryBudget(size_t memoryBudgetBytes) = 0;
+        virtual TerrainHeightCacheStatistics GetHeightCacheStatistics() const = 0;
     };
 
     using TerrainSystemServiceRequestBus = AZ::EBus<TerrainSystemServiceRequests>;
@@ -67,6 +91,23 @@ namespace Terrain
 
         // Synchronous single input location.  The Vector3 input position versions are defined to ignore the input Z value.
         virtual void GetHeight(const AZ::Vector3& inPosition, AZ::Vector3& outPosition, bool& terrainExists) = 0;
+
+        // Synchronous bulk query, outHeights and terrainExists need to be the same size as inPositions.  The input Z values are ignored.
+        virtual void GetHeights(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights, AZStd::vector<bool>& terrainExists)
+        {
+            AZ_Assert(inPositions.size() == outHeights.size() && inPositions.size() == terrainExists.size(),
+                "The number of positions (%zu), heights (%zu) and terrainExists values (%zu) don't match.",
+                inPositions.size(), outHeights.size(), terrainExists.size());
+
+            for (size_t index = 0; index < inPositions.size(); ++index)
+            {
+                AZ::Vector3 outPosition;
+                bool exists = false;
+                GetHeight(inPositions[index], outPosition, exists);
+                outHeights[index] = outPosition.GetZ();
+                terrainExists[index] = exists;
+            }
+        }
     };
 
     using TerrainAreaHeightRequestBus = AZ::EBus<TerrainAreaHeightRequests>;
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzTest/AzTest.h>
+
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+#include <TerrainSystem/TerrainSystem.h>
+#include <Components/TerrainLayerSpawnerComponent.h>
+#include <Components/TerrainHeightGradientListComponent.h>
+
+#include <MockAxisAlignedBoxShapeComponent.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    // A gradient that generates smooth rolling hills everywhere.
+    class BenchmarkHeightGradient
+        : private GradientSignal::GradientRequestBus::Handler
+    {
+    public:
+        BenchmarkHeightGradient()
+        {
+            GradientSignal::GradientRequestBus::Handler::BusConnect(m_gradientId);
+        }
+
+        ~BenchmarkHeightGradient()
+        {
+            GradientSignal::GradientRequestBus::Handler::BusDisconnect();
+        }
+
+        float GetValue(const GradientSignal::GradientSampleParams& sampleParams) const override
+        {
+            const AZ::Vector3& position = sampleParams.m_position;
+            return 0.5f + (0.25f * sinf(position.GetX() * 0.1f)) + (0.25f * cosf(position.GetY() * 0.1f));
+        }
+
+        const AZ::EntityId m_gradientId = AZ::EntityId(0x55555555);
+    };
+
+    /*
+     * Queries the heights and normals of a 256x256 grid of points from a terrain system with one terrain layer spawner that
+     * gets its heights from a gradient. The per position benchmarks call GetHeight or GetNormal for every point, and the bulk
+     * benchmarks query the whole grid with one GetHeightsFromList or GetNormalsFromList call. The reported items are points.
+     */
+    class TerrainSystemQueryBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr int GridSize = 256;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+
+        void internalSetUp()
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 128 * 1024 * 1024;
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            m_app->Create(appDesc);
+
+            const float gridSize = static_cast<float>(GridSize);
+            const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, gridSize, gridSize, 64.0f);
+
+            // The terrain system needs to exist before the terrain layer spawner, so that the spawner can register with it.
+            m_terrainSystem = AZStd::make_unique<Terrain::TerrainSystem>();
+            m_terrainSystem->SetTerrainAabb(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-512.0f), AZ::Vector3(512.0f)));
+            m_terrainSystem->SetTerrainHeightQueryResolution(AZ::Vector2(1.0f));
+            m_terrainSystem->Activate();
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+
+            m_gradient = AZStd::make_unique<BenchmarkHeightGradient>();
+
+            m_entity = AZStd::make_unique<AZ::Entity>();
+            m_shapeRequests = AZStd::make_unique<::testing::NiceMock<MockShapeComponentRequests>>(m_entity->GetId());
+            ON_CALL(*m_shapeRequests, GetEncompassingAabb).WillByDefault(::testing::Return(spawnerBox));
+
+            Terrain::TerrainHeightGradientListConfig heightConfig;
+            heightConfig.m_gradientEntities.push_back(m_gradient->m_gradientId);
+            CreateComponent<MockAxisAlignedBoxShapeComponent>(m_entity.get());
+            CreateComponent<Terrain::TerrainLayerSpawnerComponent>(m_entity.get());
+            CreateComponent<Terrain::TerrainHeightGradientListComponent>(m_entity.get(), heightConfig);
+            m_entity->Init();
+            m_entity->Activate();
+
+            // Sample outside of the spawner box as well, so that some points don't have any terrain.
+            m_positions.reserve(GridSize * GridSize);
+            for (int y = 0; y < GridSize; ++y)
+            {
+                for (int x = 0; x < GridSize; ++x)
+                {
+                    m_positions.emplace_back(static_cast<float>(x) * 1.25f - 32.0f, static_cast<float>(y) * 1.25f - 32.0f, 0.0f);
+                }
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_positions = {};
+            m_entity.reset();
+            m_shapeRequests.reset();
+            m_gradient.reset();
+            m_terrainSystem.reset();
+
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        template <typename Component, typename Configuration>
+        void CreateComponent(AZ::Entity* entity, const Configuration& config)
+        {
+            m_app->RegisterComponentDescriptor(Component::CreateDescriptor());
+            entity->CreateComponent<Component>(config);
+        }
+
+        template <typename Component>
+        void CreateComponent(AZ::Entity* entity)
+        {
+            m_app->RegisterComponentDescriptor(Component::CreateDescriptor());
+            entity->CreateComponent<Component>();
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZStd::unique_ptr<Terrain::TerrainSystem> m_terrainSystem;
+        AZStd::unique_ptr<BenchmarkHeightGradient> m_gradient;
+        AZStd::unique_ptr<::testing::NiceMock<MockShapeComponentRequests>> m_shapeRequests;
+        AZStd::unique_ptr<AZ::Entity> m_entity;
+        AZStd::vector<AZ::Vector3> m_positions;
+    };
+
+    BENCHMARK_DEFINE_F(TerrainSystemQueryBenchmarkFixture, HeightPerPosition)(benchmark::State& state)
+    {
+        AZStd::vector<float> heights(m_positions.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_positions.size(); ++index)
+            {
+                heights[index] = m_terrainSystem->GetHeight(m_positions[index]);
+            }
+            benchmark::DoNotOptimize(heights.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(TerrainSystemQueryBenchmarkFixture, HeightsFromList)(benchmark::State& state)
+    {
+        AZStd::vector<float> heights;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_terrainSystem->GetHeightsFromList(m_positions, heights);
+            benchmark::DoNotOptimize(heights.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(TerrainSystemQueryBenchmarkFixture, NormalPerPosition)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Vector3> normals(m_positions.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_positions.size(); ++index)
+            {
+                normals[index] = m_terrainSystem->GetNormal(m_positions[index]);
+            }
+            benchmark::DoNotOptimize(normals.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(TerrainSystemQueryBenchmarkFixture, NormalsFromList)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Vector3> normals;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_terrainSystem->GetNormalsFromList(m_positions, normals);
+            benchmark::DoNotOptimize(normals.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemQueryBenchmarkFixture, HeightPerPosition)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TerrainSystemQueryBenchmarkFixture, HeightsFromList)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TerrainSystemQueryBenchmarkFixture, NormalPerPosition)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TerrainSystemQueryBenchmarkFixture, NormalsFromList)
+        ->Unit(benchmark::kMillisecond);
+} // namespace UnitTest
+
+#endif
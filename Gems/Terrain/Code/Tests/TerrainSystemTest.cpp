@@ -473,3 +473,195 @@ TEST_F(TerrainSystemTest, TerrainHeightQueriesWithBilinearSamplersUseQueryGridTo
         EXPECT_NEAR(height, expectedHeight, epsilon);
     }
 }
+
+TEST_F(TerrainSystemTest, TerrainBulkQueriesMatchPerPositionQueries)
+{
+    // Verify that the bulk height and normal queries return the same values as the per position queries for every sampler,
+    // for positions both inside and outside of the terrain layer spawner bounds.
+
+    // Create a mock terrain layer spawner that uses a box of (0,0,5) - (10,10,15) and generates heights that vary in X and Y,
+    // so that both the bilinear filtering and the normals depend on the sampled positions.
+    const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 5.0f, 10.0f, 10.0f, 15.0f);
+    auto entity = CreateAndActivateMockTerrainLayerSpawner(
+        spawnerBox,
+        [](AZ::Vector3& position, bool& terrainExists)
+        {
+            position.SetZ(10.0f + (2.0f * sin(position.GetX())) + cos(position.GetY() * 0.5f));
+            terrainExists = true;
+        });
+
+    CreateAndActivateTerrainSystem(AZ::Vector2(0.5f));
+
+    // Use a region that's twice as big as the layer spawner box, with a step size that doesn't line up with the query grid.
+    const AZ::Aabb encompassingBox =
+        AZ::Aabb::CreateFromMinMax(spawnerBox.GetMin() - (spawnerBox.GetExtents() / 2.0f),
+            spawnerBox.GetMax() + (spawnerBox.GetExtents() / 2.0f));
+    const AZ::Vector2 stepSize(0.3f);
+
+    AZStd::vector<AZ::Vector3> positions;
+    AzFramework::Terrain::TerrainDataRequests::GetRegionPositions(encompassingBox, stepSize, positions);
+    ASSERT_FALSE(positions.empty());
+
+    for (auto sampler : { AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR,
+                          AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP,
+                          AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT })
+    {
+        AZStd::vector<float> heights;
+        AZStd::vector<bool> heightsTerrainExist;
+        m_terrainSystem->GetHeightsFromList(positions, heights, sampler, &heightsTerrainExist);
+
+        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<bool> normalsTerrainExist;
+        m_terrainSystem->GetNormalsFromList(positions, normals, sampler, &normalsTerrainExist);
+
+        AZStd::vector<float> regionHeights;
+        m_terrainSystem->GetHeightsFromRegion(encompassingBox, stepSize, regionHeights, sampler);
+
+        ASSERT_EQ(heights.size(), positions.size());
+        ASSERT_EQ(heightsTerrainExist.size(), positions.size());
+        ASSERT_EQ(normals.size(), positions.size());
+        ASSERT_EQ(normalsTerrainExist.size(), positions.size());
+        ASSERT_EQ(regionHeights.size(), positions.size());
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            bool terrainExists = false;
+            const float height = m_terrainSystem->GetHeight(positions[index], sampler, &terrainExists);
+            EXPECT_FLOAT_EQ(heights[index], height);
+            EXPECT_FLOAT_EQ(regionHeights[index], height);
+            EXPECT_EQ(heightsTerrainExist[index], terrainExists);
+
+            terrainExists = false;
+            const AZ::Vector3 normal = m_terrainSystem->GetNormal(positions[index], sampler, &terrainExists);
+            EXPECT_TRUE(normals[index].IsClose(normal));
+            EXPECT_EQ(normalsTerrainExist[index], terrainExists);
+        }
+    }
+}
+
+TEST_F(TerrainSystemTest, TerrainHeightCacheReturnsSameHeightsAsUncachedQueries)
+{
+    // Verify that enabling the height cache doesn't change the results of the grid based samplers, and that repeated queries
+    // are answered from the cache.
+
+    const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+    auto entity = CreateAndActivateMockTerrainLayerSpawner(
+        spawnerBox,
+        [](AZ::Vector3& position, bool& terrainExists)
+        {
+            position.SetZ(position.GetX() + position.GetY());
+            terrainExists = true;
+        });
+
+    CreateAndActivateTerrainSystem();
+
+    AZStd::vector<AZ::Vector3> positions;
+    AzFramework::Terrain::TerrainDataRequests::GetRegionPositions(
+        AZ::Aabb::CreateFromMinMaxValues(-15.0f, -15.0f, 0.0f, 15.0f, 15.0f, 0.0f), AZ::Vector2(0.75f), positions);
+
+    for (auto sampler : { AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR,
+                          AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP })
+    {
+        m_terrainSystem->SetHeightCacheMemoryBudget(0);
+        AZStd::vector<float> uncachedHeights;
+        AZStd::vector<bool> uncachedTerrainExists;
+        m_terrainSystem->GetHeightsFromList(positions, uncachedHeights, sampler, &uncachedTerrainExists);
+
+        m_terrainSystem->SetHeightCacheMemoryBudget(16 * Terrain::TerrainHeightCache::GetTileMemorySize());
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            AZStd::vector<float> cachedHeights;
+            AZStd::vector<bool> cachedTerrainExists;
+            m_terrainSystem->GetHeightsFromList(positions, cachedHeights, sampler, &cachedTerrainExists);
+
+            ASSERT_EQ(cachedHeights.size(), positions.size());
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                EXPECT_NEAR(cachedHeights[index], uncachedHeights[index], 0.0001f);
+                EXPECT_EQ(cachedTerrainExists[index], uncachedTerrainExists[index]);
+
+                bool terrainExists = false;
+                const float height = m_terrainSystem->GetHeight(positions[index], sampler, &terrainExists);
+                EXPECT_NEAR(height, uncachedHeights[index], 0.0001f);
+                EXPECT_EQ(terrainExists, uncachedTerrainExists[index]);
+            }
+        }
+    }
+
+    const Terrain::TerrainHeightCacheStatistics statistics = m_terrainSystem->GetHeightCacheStatistics();
+    EXPECT_GT(statistics.m_hits, 0u);
+    EXPECT_GT(statistics.m_tileCount, 0u);
+    EXPECT_GT(statistics.GetHitRate(), 0.5f);
+}
+
+TEST_F(TerrainSystemTest, TerrainHeightCacheIsInvalidatedWhenAreasChange)
+{
+    // Verify that cached heights are kept until the terrain area that provides them gets refreshed.
+
+    float spawnerHeight = 5.0f;
+    const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 10.0f, 10.0f, 20.0f);
+    auto entity = CreateAndActivateMockTerrainLayerSpawner(
+        spawnerBox,
+        [&spawnerHeight](AZ::Vector3& position, bool& terrainExists)
+        {
+            position.SetZ(spawnerHeight);
+            terrainExists = true;
+        });
+
+    CreateAndActivateTerrainSystem();
+    m_terrainSystem->SetHeightCacheMemoryBudget(Terrain::TerrainHeightCache::GetTileMemorySize());
+
+    const AZ::Vector3 position(1.0f, 1.0f, 0.0f);
+    EXPECT_FLOAT_EQ(m_terrainSystem->GetHeight(position, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 5.0f);
+
+    // Changing the height data without notifying the terrain system returns the cached height.
+    spawnerHeight = 8.0f;
+    EXPECT_FLOAT_EQ(m_terrainSystem->GetHeight(position, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 5.0f);
+
+    // Refreshing the area drops the cached tiles in its bounds.
+    m_terrainSystem->RefreshArea(entity->GetId());
+    EXPECT_FLOAT_EQ(m_terrainSystem->GetHeight(position, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 8.0f);
+
+    const Terrain::TerrainHeightCacheStatistics statistics = m_terrainSystem->GetHeightCacheStatistics();
+    EXPECT_EQ(statistics.m_hits, 1u);
+    EXPECT_EQ(statistics.m_misses, 2u);
+    EXPECT_EQ(statistics.m_tilesInvalidated, 1u);
+}
+
+TEST_F(TerrainSystemTest, TerrainHeightCacheEvictsLeastRecentlyUsedTiles)
+{
+    // Verify that the height cache stays within its memory budget by evicting the least recently used tiles.
+
+    const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-128.0f, -128.0f, 0.0f, 128.0f, 128.0f, 20.0f);
+    auto entity = CreateAndActivateMockTerrainLayerSpawner(
+        spawnerBox,
+        [](AZ::Vector3& position, bool& terrainExists)
+        {
+            position.SetZ(5.0f);
+            terrainExists = true;
+        });
+
+    CreateAndActivateTerrainSystem();
+    m_terrainSystem->SetHeightCacheMemoryBudget(2 * Terrain::TerrainHeightCache::GetTileMemorySize());
+
+    // With a query resolution of 1 meter, each of these positions is in a different tile.
+    const float tileSize = static_cast<float>(Terrain::TerrainHeightCache::TileSize);
+    const AZ::Vector3 positionA(1.0f, 1.0f, 0.0f);
+    const AZ::Vector3 positionB(tileSize + 1.0f, 1.0f, 0.0f);
+    const AZ::Vector3 positionC(1.0f, tileSize + 1.0f, 0.0f);
+
+    constexpr auto sampler = AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP;
+    m_terrainSystem->GetHeight(positionA, sampler); // miss
+    m_terrainSystem->GetHeight(positionB, sampler); // miss
+    m_terrainSystem->GetHeight(positionA, sampler); // hit
+    m_terrainSystem->GetHeight(positionC, sampler); // miss, evicts B
+    m_terrainSystem->GetHeight(positionA, sampler); // hit
+    m_terrainSystem->GetHeight(positionB, sampler); // miss, evicts C
+
+    const Terrain::TerrainHeightCacheStatistics statistics = m_terrainSystem->GetHeightCacheStatistics();
+    EXPECT_EQ(statistics.m_hits, 2u);
+    EXPECT_EQ(statistics.m_misses, 4u);
+    EXPECT_EQ(statistics.m_tilesEvicted, 2u);
+    EXPECT_EQ(statistics.m_tileCount, 2u);
+    EXPECT_LE(statistics.m_memoryUsage, statistics.m_memoryBudget);
+}
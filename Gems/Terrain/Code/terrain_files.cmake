@@ -29,6 +29,8 @@ set(FILES
     Source/TerrainRenderer/TerrainFeatureProcessor.cpp
     Source/TerrainRenderer/TerrainFeatureProcessor.h
     Source/TerrainRenderer/TerrainMacroMaterialBus.h
+    Source/TerrainSystem/TerrainHeightCache.cpp
+    Source/TerrainSystem/TerrainHeightCache.h
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
@@ -9,6 +9,7 @@
 set(FILES
     Tests/TerrainTest.cpp
     Tests/TerrainSystemTest.cpp
+    Tests/TerrainSystemBenchmarks.cpp
     Tests/LayerSpawnerTests.cpp
     Tests/MockAxisAlignedBoxShapeComponent.h
 )
@@ -16,6 +16,7 @@
 #include <Vegetation/Ebuses/AreaInfoBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 namespace Vegetation
 {
@@ -84,6 +85,11 @@ namespace Vegetation
         void OnAreaDisconnect() override;
         void OnAreaRefreshed() override;
 
+        //////////////////////////////////////////////////////////////////////////
+        // AreaRequestBus
+        bool PinForClaims() override;
+        void UnpinForClaims() override;
+
         //////////////////////////////////////////////////////////////////////////
         // TransformNotificationBus
         void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
@@ -102,6 +108,9 @@ namespace Vegetation
 
         AreaConfig m_configuration;
         bool m_areaRegistered { false };
+        int m_areaConnectionCount = 0;
+        //! Held shared while the area is pinned for claims, and exclusive while the area disconnects from the AreaRequestBus.
+        AZStd::shared_mutex m_claimPinMutex;
         AZStd::atomic_int m_changeIndex{ 0 };
     };
 }
@@ -90,6 +90,24 @@ namespace Vegetation
                 m_instanceSpawner->DestroyInstance(id, instance);
             }
         }
+        AZ_INLINE void CreateInstances(const AZStd::vector<const InstanceData*>& instanceDatas, AZStd::vector<InstancePtr>& outInstances)
+        {
+            if (m_instanceSpawner)
+            {
+                m_instanceSpawner->CreateInstances(instanceDatas, outInstances);
+            }
+            else
+            {
+                outInstances.assign(instanceDatas.size(), nullptr);
+            }
+        }
+        AZ_INLINE void DestroyInstances(const AZStd::vector<AZStd::pair<InstanceId, InstancePtr>>& instances)
+        {
+            if (m_instanceSpawner)
+            {
+                m_instanceSpawner->DestroyInstances(instances);
+            }
+        }
 
         // We use the InstanceSpawner pointer as the notification bus ID since the InstanceSpawner is
         // the one that will actually broadcast out the notifications.  Multiple Descriptors can point to
@@ -91,6 +91,17 @@ namespace Vegetation
         */
         virtual void UnclaimPosition(const ClaimHandle handle) = 0;
 
+        /**
+        * Keeps the handler alive and connected so the vegetation system can call ClaimPositions on it directly, without the bus
+        * lock, from the threads that fill sectors in parallel.  Returns false if the handler doesn't support this or is
+        * deactivating, in which case the claims go through the bus.
+        */
+        virtual bool PinForClaims() { return false; }
+
+        /**
+        * Releases a successful PinForClaims()
+        */
+        virtual void UnpinForClaims() {}
     };
 
     typedef AZ::EBus<AreaRequests> AreaRequestBus;
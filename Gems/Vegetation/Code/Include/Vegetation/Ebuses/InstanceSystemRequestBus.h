@@ -27,6 +27,9 @@ namespace Vegetation
         static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
         static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
         using MutexType = AZStd::recursive_mutex;
+        // The instance system is connected for as long as it's active, and its requests are thread safe, so instances can be
+        // created and destroyed from several threads at once without serializing on the bus.
+        static const bool LocklessDispatch = true;
         ////////////////////////////////////////////////////////////////////////
 
         virtual ~InstanceSystemRequests()  = default;
@@ -66,6 +69,12 @@ namespace Vegetation
         virtual AZ::u32 GetTotalTaskCount() const = 0;
         virtual AZ::u32 GetCreateTaskCount() const = 0;
         virtual AZ::u32 GetDestroyTaskCount() const = 0;
+
+        // the highest number of queued tasks
+        virtual AZ::u32 GetPeakTotalTaskCount() const = 0;
+
+        // the number of tasks executed during the last tick
+        virtual AZ::u32 GetProcessedTaskCountLastTick() const = 0;
     };
 
     using InstanceSystemStatsRequestBus = AZ::EBus<InstanceSystemStatsRequests>;
@@ -9,7 +9,9 @@
 
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/utils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Component/EntityId.h>
@@ -84,6 +86,26 @@ namespace Vegetation
         //! Destroy a single instance.
         virtual void DestroyInstance(InstanceId id, InstancePtr instance) = 0;
 
+        //! Create a batch of instances, outInstances is resized to the number of instances and receives the instance created for
+        //! each InstanceData, or nullptr if it couldn't be created. The default implementation creates them one at a time.
+        virtual void CreateInstances(const AZStd::vector<const InstanceData*>& instanceDatas, AZStd::vector<InstancePtr>& outInstances)
+        {
+            outInstances.resize(instanceDatas.size());
+            for (size_t index = 0; index < instanceDatas.size(); ++index)
+            {
+                outInstances[index] = CreateInstance(*instanceDatas[index]);
+            }
+        }
+
+        //! Destroy a batch of instances. The default implementation destroys them one at a time.
+        virtual void DestroyInstances(const AZStd::vector<AZStd::pair<InstanceId, InstancePtr>>& instances)
+        {
+            for (const auto& [id, instance] : instances)
+            {
+                DestroyInstance(id, instance);
+            }
+        }
+
         //! Check for data equivalency.  Subclasses are expected to implement this.
         bool operator==(const InstanceSpawner& rhs) const { return DataIsEquivalent(rhs); };
 
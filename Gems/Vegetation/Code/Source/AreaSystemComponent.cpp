@@ -19,10 +19,14 @@
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
@@ -36,6 +40,7 @@
 
 #include <ISystem.h>
 #include <cinttypes>
+#include <cstdlib>
 
 namespace Vegetation
 {
@@ -127,6 +132,7 @@ namespace Vegetation
     const int AreaSystemConfig::s_maxViewRectangleSize = 128;
     const int AreaSystemConfig::s_maxSectorDensity = 64;
     const int AreaSystemConfig::s_maxSectorSizeInMeters = 1024;
+    const int AreaSystemConfig::s_maxSectorWorkerCount = 16;
     const int64_t AreaSystemConfig::s_maxVegetationInstances = 2 * 1024 * 1024;
     const int AreaSystemConfig::s_maxInstancesPerMeter = 16;
 
@@ -136,13 +142,14 @@ namespace Vegetation
         if (serialize)
         {
             serialize->Class<AreaSystemConfig, AZ::ComponentConfig>()
-                ->Version(4, &AreaSystemUtil::UpdateVersion)
+                ->Version(5, &AreaSystemUtil::UpdateVersion)
                 ->Field("ViewRectangleSize", &AreaSystemConfig::m_viewRectangleSize)
                 ->Field("SectorDensity", &AreaSystemConfig::m_sectorDensity)
                 ->Field("SectorSizeInMeters", &AreaSystemConfig::m_sectorSizeInMeters)
                 ->Field("ThreadProcessingIntervalMs", &AreaSystemConfig::m_threadProcessingIntervalMs)
                 ->Field("SectorSearchPadding", &AreaSystemConfig::m_sectorSearchPadding)
                 ->Field("SectorPointSnapMode", &AreaSystemConfig::m_sectorPointSnapMode)
+                ->Field("SectorWorkerCount", &AreaSystemConfig::m_sectorWorkerCount)
             ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -173,6 +180,9 @@ namespace Vegetation
                     ->DataElement(AZ::Edit::UIHandlers::ComboBox, &AreaSystemConfig::m_sectorPointSnapMode, "Sector Point Snap Mode", "Controls whether vegetation placement points are located at the corner or the center of the cell.")
                     ->EnumAttribute(SnapMode::Corner, "Corner")
                     ->EnumAttribute(SnapMode::Center, "Center")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_sectorWorkerCount, "Sector Worker Count", "The number of jobs that fill sectors in parallel when the task graph isn't active. With 1, all sectors are filled on the vegetation thread.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Max, s_maxSectorWorkerCount)
                 ;
             }
         }
@@ -186,6 +196,7 @@ namespace Vegetation
                 ->Property("sectorDensity", BehaviorValueProperty(&AreaSystemConfig::m_sectorDensity))
                 ->Property("sectorSizeInMeters", BehaviorValueProperty(&AreaSystemConfig::m_sectorSizeInMeters))
                 ->Property("threadProcessingIntervalMs", BehaviorValueProperty(&AreaSystemConfig::m_threadProcessingIntervalMs))
+                ->Property("sectorWorkerCount", BehaviorValueProperty(&AreaSystemConfig::m_sectorWorkerCount))
                 ->Property("sectorPointSnapMode",
                 [](AreaSystemConfig* config) { return static_cast<AZ::u8>(config->m_sectorPointSnapMode); },
                 [](AreaSystemConfig* config, const AZ::u8& i) { config->m_sectorPointSnapMode = static_cast<SnapMode>(i); })
@@ -778,6 +789,8 @@ namespace Vegetation
                     m_cachedMainThreadData.m_sectorSizeInMeters = m_configuration.m_sectorSizeInMeters;
                     m_cachedMainThreadData.m_sectorDensity = m_configuration.m_sectorDensity;
                     m_cachedMainThreadData.m_sectorPointSnapMode = m_configuration.m_sectorPointSnapMode;
+                    m_cachedMainThreadData.m_sectorSearchPadding = m_configuration.m_sectorSearchPadding;
+                    m_cachedMainThreadData.m_sectorWorkerCount = m_configuration.m_sectorWorkerCount;
                 }
 
                 // Set the state to Dirty to signal the thread that it will need to pull a new copy of the main thread state data
@@ -796,10 +809,6 @@ namespace Vegetation
 
                         UpdateContext context;
                         context.Run(&m_threadData, &m_vegTasks, &m_cachedMainThreadData);
-
-                        // After we're done processing as much as we can, clear our thread states and exit.
-                        m_threadData.m_vegetationThreadState = PersistentThreadData::VegetationThreadState::Stopped;
-                        m_threadData.m_vegetationDataSyncState = PersistentThreadData::VegetationDataSyncState::Synchronized;
                     }, true);
                     job->Start();
                 }
@@ -1072,14 +1081,13 @@ namespace Vegetation
         return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
     }
 
-    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorSizeInMeters)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
         SectorInfo sectorInfo;
         sectorInfo.m_id = sectorId;
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
-        UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
@@ -1101,7 +1109,7 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+        SurfaceData::SurfacePointBuffer availablePoints;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1116,29 +1124,34 @@ namespace Vegetation
             vegStep * (sectorDensity - 0.5f), 0.0f));
 
         SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
-            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
             regionBounds,
             stepSize,
             SurfaceData::SurfaceTagVector(),
-            availablePointsPerPosition);
+            availablePoints);
 
-        AZ_Assert(availablePointsPerPosition.size() == (sectorDensity * sectorDensity),
-            "Veg sector ended up with unexpected density (%d points created, %d expected)", availablePointsPerPosition.size(),
+        AZ_Assert(availablePoints.GetInputPositionCount() == (sectorDensity * sectorDensity),
+            "Veg sector ended up with unexpected density (%d points created, %d expected)", availablePoints.GetInputPositionCount(),
             (sectorDensity * sectorDensity));
 
+        // The points of the buffer are grouped by input position, in the same order as the input positions.
         uint claimIndex = 0;
-        for (auto& availablePoints : availablePointsPerPosition)
-        {
-            for (auto& surfacePoint : availablePoints.second)
+        sectorInfo.m_baseContext.m_availablePoints.reserve(availablePoints.GetPointCount());
+        for (size_t pointIndex = 0; pointIndex < availablePoints.GetPointCount(); ++pointIndex)
+        {
+            sectorInfo.m_baseContext.m_availablePoints.push_back();
+            ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
+            claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
+            claimPoint.m_position = availablePoints.GetPosition(pointIndex);
+            claimPoint.m_normal = availablePoints.GetNormal(pointIndex);
+            for (size_t tagIndex = 0; tagIndex < availablePoints.GetTagCount(); ++tagIndex)
             {
-                sectorInfo.m_baseContext.m_availablePoints.push_back();
-                ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
-                claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
-                claimPoint.m_position = surfacePoint.m_position;
-                claimPoint.m_normal = surfacePoint.m_normal;
-                claimPoint.m_masks = surfacePoint.m_masks;
-                SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, surfacePoint.m_masks);
+                if (availablePoints.HasTag(pointIndex, tagIndex))
+                {
+                    claimPoint.m_masks[availablePoints.GetTag(tagIndex)] = availablePoints.GetTagWeight(pointIndex, tagIndex);
+                }
             }
+            SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, claimPoint.m_masks);
         }
     }
 
@@ -1167,21 +1180,12 @@ namespace Vegetation
             auto claimItr = sectorInfo.m_claimedWorldPointsBeforeFill.find(handle);
             bool exists = claimItr != sectorInfo.m_claimedWorldPointsBeforeFill.end();
 
-            if (exists)
+            // A point previously claimed by another area is unclaimed by GatherUnusedClaims, because that area can be claiming
+            // points for another sector right now.
+            if (exists && (claimItr->second.m_id == instanceData.m_id))
             {
-                const auto& claimedInstanceData = claimItr->second;
-                if (claimedInstanceData.m_id != instanceData.m_id)
-                {
-                    //must force bus connect if areas are different
-                    AreaNotificationBus::Event(claimedInstanceData.m_id, &AreaNotificationBus::Events::OnAreaConnect);
-                    AreaRequestBus::Event(claimedInstanceData.m_id, &AreaRequestBus::Events::UnclaimPosition, handle);
-                    AreaNotificationBus::Event(claimedInstanceData.m_id, &AreaNotificationBus::Events::OnAreaDisconnect);
-                }
-                else
-                {
-                    //already connected during fill sector
-                    AreaRequestBus::Event(claimedInstanceData.m_id, &AreaRequestBus::Events::UnclaimPosition, handle);
-                }
+                //already connected during fill sector
+                AreaRequestBus::Event(instanceData.m_id, &AreaRequestBus::Events::UnclaimPosition, handle);
             }
 
             CreateClaim(sectorInfo, handle, instanceData);
@@ -1273,24 +1277,29 @@ namespace Vegetation
         }
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::ReleaseUnusedClaims(SectorInfo& sectorInfo)
+    void AreaSystemComponent::VegetationThreadTasks::GatherUnusedClaims(SectorInfo& sectorInfo, ClaimsByArea& unusedClaims)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
-
-        // Group up all the previously-claimed-but-no-longer-claimed points based on area id
+        // Group up all the previously-claimed-but-no-longer-claimed points based on area id, including the points that are
+        // claimed by a different area now
         for (const auto& claimPair : sectorInfo.m_claimedWorldPointsBeforeFill)
         {
             const auto& handle = claimPair.first;
             const auto& instanceData = claimPair.second;
             const auto& areaId = instanceData.m_id;
-            if (sectorInfo.m_claimedWorldPoints.find(handle) == sectorInfo.m_claimedWorldPoints.end())
+            const auto claimItr = sectorInfo.m_claimedWorldPoints.find(handle);
+            if ((claimItr == sectorInfo.m_claimedWorldPoints.end()) || (claimItr->second.m_id != areaId))
             {
-                claimsToRelease[areaId].insert(handle);
+                unusedClaims[areaId].insert(handle);
             }
         }
         sectorInfo.m_claimedWorldPointsBeforeFill.clear();
+    }
+
+    void AreaSystemComponent::VegetationThreadTasks::ReleaseClaims(const ClaimsByArea& claimsToRelease)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
         // Iterate over the claims by area id and release them
         for (const auto& claimPair : claimsToRelease)
@@ -1308,44 +1317,52 @@ namespace Vegetation
         }
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas)
+    void AreaSystemComponent::VegetationThreadTasks::BeginFillSector(SectorInfo& sectorInfo, ClaimContext& activeContext)
     {
         AZ_PROFILE_FUNCTION(Entity);
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorStart, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::system_clock::now()));
 
-        ReleaseUnregisteredClaims(sectorInfo);
-
         //m_availablePoints is a free list initialized with the complete set of points in the sector.
-        ClaimContext activeContext = sectorInfo.m_baseContext;
-
-        // Clear out the list of claimed world points before we begin
-        sectorInfo.m_claimedWorldPointsBeforeFill = sectorInfo.m_claimedWorldPoints;
-        sectorInfo.m_claimedWorldPoints.clear();
+        activeContext = sectorInfo.m_baseContext;
 
-        //for all active areas attempt to spawn vegetation on sector grid positions
-        for (const auto& area : activeAreas)
+        // Clear out the list of claimed world points before we begin.  The claimed world points can be enumerated from other
+        // threads while the sector is filled, so they are only modified with the rolling window mutex locked.
         {
-            //if one or more areas claimed all the points in m_availablePoints, there's no reason to continue.
-            if (activeContext.m_availablePoints.empty())
-            {
-                break;
-            }
+            AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
+            AZStd::swap(sectorInfo.m_claimedWorldPointsBeforeFill, sectorInfo.m_claimedWorldPoints);
+            sectorInfo.m_claimedWorldPoints.clear();
+        }
+    }
 
-            //only consider areas that intersect this sector
-            if (!area.m_bounds.IsValid() || area.m_bounds.Overlaps(sectorInfo.m_bounds))
-            {
-                VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillAreaStart, area.m_id, AZStd::chrono::system_clock::now()));
+    void AreaSystemComponent::VegetationThreadTasks::ClaimSectorPositions(const VegetationAreaInfo& area, AreaRequests* pinnedArea, ClaimContext& activeContext)
+    {
+        //if one or more areas claimed all the points in m_availablePoints, there's no reason to continue.
+        if (activeContext.m_availablePoints.empty())
+        {
+            return;
+        }
 
-                //each area is responsible for removing whatever points it claims from m_availablePoints, so subsequent areas will have fewer points to try to claim.
-                AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaConnect);
-                AreaRequestBus::Event(area.m_id, &AreaRequestBus::Events::ClaimPositions, EntityIdStack{}, activeContext);
-                AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaDisconnect);
+        VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillAreaStart, area.m_id, AZStd::chrono::system_clock::now()));
 
-                VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillAreaEnd, area.m_id, AZStd::chrono::system_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
-            }
+        //each area is responsible for removing whatever points it claims from m_availablePoints, so subsequent areas will have fewer points to try to claim.
+        if (pinnedArea)
+        {
+            EntityIdStack stackIds;
+            pinnedArea->ClaimPositions(stackIds, activeContext);
+        }
+        else
+        {
+            AreaRequestBus::Event(area.m_id, &AreaRequestBus::Events::ClaimPositions, EntityIdStack{}, activeContext);
         }
 
-        ReleaseUnusedClaims(sectorInfo);
+        VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillAreaEnd, area.m_id, AZStd::chrono::system_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
+    }
+
+    void AreaSystemComponent::VegetationThreadTasks::EndFillSector(SectorInfo& sectorInfo, [[maybe_unused]] const ClaimContext& activeContext, ClaimsByArea& unusedClaims)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        GatherUnusedClaims(sectorInfo, unusedClaims);
 
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorEnd, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::system_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
     }
@@ -1354,7 +1371,7 @@ namespace Vegetation
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
+        ClaimsByArea claimsToRelease;
 
         // group up all the points based on area id
         for (const auto& claimPair : sectorInfo.m_claimedWorldPoints)
@@ -1366,20 +1383,7 @@ namespace Vegetation
         }
         sectorInfo.m_claimedWorldPoints.clear();
 
-        // iterate over the claims by area id and release them
-        for (const auto& claimPair : claimsToRelease)
-        {
-            const auto& areaId = claimPair.first;
-            const auto& handles = claimPair.second;
-            AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaConnect);
-
-            for (const auto& handle : handles)
-            {
-                AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPosition, handle);
-            }
-
-            AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaDisconnect);
-        }
+        ReleaseClaims(claimsToRelease);
     }
 
     void AreaSystemComponent::VegetationThreadTasks::ClearSectors()
@@ -1400,6 +1404,7 @@ namespace Vegetation
     void AreaSystemComponent::VegetationThreadTasks::CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData)
     {
         AZ_PROFILE_FUNCTION(Entity);
+        AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         sectorInfo.m_claimedWorldPoints[handle] = instanceData;
     }
 
@@ -1494,9 +1499,14 @@ namespace Vegetation
 
             if (keepProcessing)
             {
-                keepProcessing = UpdateOneSector(threadData, vegTasks);
+                keepProcessing = UpdateSectorBatch(threadData, vegTasks);
             }
         }
+
+        // After we're done processing as much as we can, clear our thread states and exit.  This happens before unlocking, so once
+        // the main thread has waited for this thread, e.g. in ReleaseAllClaims(), the next tick can start it again.
+        threadData->m_vegetationThreadState = PersistentThreadData::VegetationThreadState::Stopped;
+        threadData->m_vegetationDataSyncState = PersistentThreadData::VegetationDataSyncState::Synchronized;
     }
 
     void AreaSystemComponent::UpdateContext::UpdateActiveVegetationAreas(PersistentThreadData* threadData, const ViewRect& viewRect)
@@ -1759,13 +1769,13 @@ namespace Vegetation
         return !m_deleteWorkList.empty() || !m_updateWorkList.empty();
     }
 
-    bool AreaSystemComponent::UpdateContext::UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    bool AreaSystemComponent::UpdateContext::UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
         // This chooses work in the following order:
         // 1) Delete if we have more sectors than the total that should be in the view rectangle
-        // 2) Create/update if we have any sectors to create / update
+        // 2) Create/update a batch of sectors if we have any sectors to create / update
         // 3) Delete if we have any sectors to delete
 
         // Delete if there are more active sectors than the number of desired sectors or the update list is empty.
@@ -1784,52 +1794,297 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
-            m_updateWorkList.pop_back();
+            SelectSectorBatch();
+            FillSectorBatch(threadData, vegTasks);
+            return true;
+        }
+
+        // No sectors left to process, so tell our main loop to stop processing.
+        return false;
+    }
+
+    void AreaSystemComponent::UpdateContext::SelectSectorBatch()
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Filling a sector can look at the instances of the sectors around it through EnumerateInstancesInOverlappingSectors,
+        // which searches the neighboring sectors plus the sector search padding.  Only sectors that are further apart than that
+        // are batched together, so the claims of every sector are the same no matter which sectors are filled at the same time.
+        const int minSectorSpacing = m_cachedMainThreadData.m_sectorSearchPadding + 2;
+        auto isIndependent = [minSectorSpacing](const SectorId& lhsSectorId, const SectorId& rhsSectorId)
+        {
+            return (abs(lhsSectorId.first - rhsSectorId.first) >= minSectorSpacing) ||
+                (abs(lhsSectorId.second - rhsSectorId.second) >= minSectorSpacing);
+        };
 
+        // The closest sectors are at the end of the work list, so the batch is gathered from the back.
+        m_sectorBatch.clear();
+        for (auto entryItr = m_updateWorkList.rbegin(); (entryItr != m_updateWorkList.rend()) && (m_sectorBatch.size() < s_maxSectorsPerBatch); ++entryItr)
+        {
+            const SectorId& sectorId = entryItr->first;
+            auto conflict = AZStd::find_if(m_sectorBatch.begin(), m_sectorBatch.end(), [&](const SectorBatchEntry& entry)
             {
-                AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+                return !isIndependent(entry.m_id, sectorId);
+            });
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+            if (conflict == m_sectorBatch.end())
+            {
+                m_sectorBatch.emplace_back();
+                m_sectorBatch.back().m_id = sectorId;
+                m_sectorBatch.back().m_mode = entryItr->second;
+            }
+        }
 
-                switch (mode)
+        m_updateWorkList.erase(
+            AZStd::remove_if(
+                m_updateWorkList.begin(),
+                m_updateWorkList.end(),
+                [this](const auto& workEntry)
                 {
-                    case UpdateMode::RebuildSurfaceCacheAndFill:
+                    return AZStd::find_if(m_sectorBatch.begin(), m_sectorBatch.end(), [&workEntry](const SectorBatchEntry& entry)
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                        return entry.m_id == workEntry.first;
+                    }) != m_sectorBatch.end();
+                }),
+            m_updateWorkList.end());
+    }
 
-                    case UpdateMode::Fill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+    void AreaSystemComponent::UpdateContext::FillSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const VegetationAreaVector& activeAreas = threadData->m_activeAreasInBubble;
+
+        // Creating sectors and releasing the claims of unregistered areas modify state that's shared between sectors, so this
+        // happens up front.  After this, filling a sector only modifies the sector itself.
+        {
+            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+
+            for (auto& entry : m_sectorBatch)
+            {
+                if (entry.m_mode == UpdateMode::Create)
+                {
+                    AZ_Assert(!vegTasks->GetSector(entry.m_id), "Sector update mode is 'Create' but sector already exists");
+                    entry.m_sectorInfo = vegTasks->CreateSector(entry.m_id, sectorSizeInMeters);
+                }
+                else
+                {
+                    entry.m_sectorInfo = vegTasks->GetSector(entry.m_id);
+                    AZ_Assert(entry.m_sectorInfo, "Sector update mode is '%s' but sector doesn't exist",
+                        (entry.m_mode == UpdateMode::Fill) ? "Fill" : "RebuildSurfaceCache");
+                }
 
-                    case UpdateMode::Create:
+                vegTasks->ReleaseUnregisteredClaims(*entry.m_sectorInfo);
+            }
+        }
+
+        // Keep the active areas connected for the whole batch, and pin the areas that support it so that the sectors can claim with
+        // them directly.  Dispatching the claims through the AreaRequestBus would serialize all of them on the bus lock.
+        m_batchAreas.clear();
+        for (const auto& area : activeAreas)
+        {
+            AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaConnect);
+
+            BatchArea batchArea;
+            batchArea.m_area = &area;
+            AreaRequestBus::EnumerateHandlersId(area.m_id, [&batchArea](AreaRequests* handler)
+            {
+                batchArea.m_pinnedHandler = handler->PinForClaims() ? handler : nullptr;
+                return false;
+            });
+            m_batchAreas.push_back(batchArea);
+        }
+
+        // Every sector claims with its areas in priority order, like a serial fill, and every area claims for one sector at a time,
+        // in batch order, because areas aren't thread safe.  Different areas claim for different sectors at the same time, so the
+        // sectors are filled in a pipeline.
+        m_fillSteps.clear();
+        m_lastFillStepForArea.assign(m_batchAreas.size(), s_noFillStep);
+        for (size_t entryIndex = 0; entryIndex < m_sectorBatch.size(); ++entryIndex)
+        {
+            SectorBatchEntry& entry = m_sectorBatch[entryIndex];
+            entry.m_areaIndices.clear();
+            for (size_t areaIndex = 0; areaIndex < m_batchAreas.size(); ++areaIndex)
+            {
+                //only consider areas that intersect this sector
+                const AZ::Aabb& areaBounds = m_batchAreas[areaIndex].m_area->m_bounds;
+                if (!areaBounds.IsValid() || areaBounds.Overlaps(entry.m_sectorInfo->m_bounds))
+                {
+                    entry.m_areaIndices.push_back(areaIndex);
+                }
+            }
+
+            FillStep beginStep;
+            beginStep.m_entryIndex = entryIndex;
+            m_fillSteps.push_back(beginStep);
+
+            for (size_t stepIndex = 1; stepIndex <= entry.m_areaIndices.size(); ++stepIndex)
+            {
+                const size_t areaIndex = entry.m_areaIndices[stepIndex - 1];
+
+                FillStep claimStep;
+                claimStep.m_entryIndex = entryIndex;
+                claimStep.m_stepIndex = stepIndex;
+                claimStep.m_previousSectorStep = m_fillSteps.size() - 1;
+                claimStep.m_previousAreaStep = m_lastFillStepForArea[areaIndex];
+                claimStep.m_wave = m_fillSteps[claimStep.m_previousSectorStep].m_wave + 1;
+                if (claimStep.m_previousAreaStep != s_noFillStep)
+                {
+                    claimStep.m_wave = AZStd::GetMax(claimStep.m_wave, m_fillSteps[claimStep.m_previousAreaStep].m_wave + 1);
+                }
+
+                m_lastFillStepForArea[areaIndex] = m_fillSteps.size();
+                m_fillSteps.push_back(claimStep);
+            }
+        }
+
+        auto* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if ((m_cachedMainThreadData.m_sectorWorkerCount <= 1) || (m_sectorBatch.size() <= 1))
+        {
+            // The steps were added in an order that satisfies all of their dependencies.
+            for (const FillStep& step : m_fillSteps)
+            {
+                RunFillStep(step, vegTasks);
+            }
+        }
+        else if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            static const AZ::TaskDescriptor fillStepTaskDescriptor{ "Vegetation::AreaSystemComponent::FillSectorStep", "Vegetation" };
+
+            AZ::TaskGraph fillTaskGraph;
+            AZStd::vector<AZ::TaskToken> fillStepTasks;
+            fillStepTasks.reserve(m_fillSteps.size());
+            for (const FillStep& step : m_fillSteps)
+            {
+                fillStepTasks.push_back(fillTaskGraph.AddTask(fillStepTaskDescriptor, [this, &step, vegTasks]()
+                {
+                    RunFillStep(step, vegTasks);
+                }));
+
+                AZ::TaskToken& fillStepTask = fillStepTasks.back();
+                if (step.m_previousSectorStep != s_noFillStep)
+                {
+                    fillStepTask.Follows(fillStepTasks[step.m_previousSectorStep]);
+                }
+                if (step.m_previousAreaStep != s_noFillStep)
+                {
+                    fillStepTask.Follows(fillStepTasks[step.m_previousAreaStep]);
+                }
+            }
+
+            AZ::TaskGraphEvent fillFinishedEvent;
+            fillTaskGraph.Submit(&fillFinishedEvent);
+            fillFinishedEvent.Wait();
+        }
+        else
+        {
+            RunFillStepsWithJobs(vegTasks);
+        }
+
+        for (auto& entry : m_sectorBatch)
+        {
+            VegetationThreadTasks::EndFillSector(*entry.m_sectorInfo, entry.m_activeContext, entry.m_unusedClaims);
+        }
+
+        for (const BatchArea& batchArea : m_batchAreas)
+        {
+            if (batchArea.m_pinnedHandler)
+            {
+                batchArea.m_pinnedHandler->UnpinForClaims();
+            }
+            AreaNotificationBus::Event(batchArea.m_area->m_id, &AreaNotificationBus::Events::OnAreaDisconnect);
+        }
+        m_batchAreas.clear();
+
+        // Unclaiming positions connects the areas that claimed them, which can't safely happen while other sectors are claiming,
+        // so the claims that aren't used anymore are released after the whole batch is filled.
+        for (const auto& entry : m_sectorBatch)
+        {
+            vegTasks->ReleaseClaims(entry.m_unusedClaims);
+        }
+    }
+
+    void AreaSystemComponent::UpdateContext::RunFillStepsWithJobs(VegetationThreadTasks* vegTasks)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Without the task graph, the steps run with jobs one wave at a time.  The steps of a wave are for different sectors and
+        // different areas, and only wait for steps of earlier waves.
+        m_fillStepOrder.resize(m_fillSteps.size());
+        for (size_t stepIndex = 0; stepIndex < m_fillSteps.size(); ++stepIndex)
+        {
+            m_fillStepOrder[stepIndex] = stepIndex;
+        }
+        AZStd::sort(m_fillStepOrder.begin(), m_fillStepOrder.end(), [this](size_t lhs, size_t rhs)
+        {
+            return (m_fillSteps[lhs].m_wave < m_fillSteps[rhs].m_wave) || ((m_fillSteps[lhs].m_wave == m_fillSteps[rhs].m_wave) && (lhs < rhs));
+        });
+
+        const size_t workerCount = static_cast<size_t>(AZStd::GetMax(m_cachedMainThreadData.m_sectorWorkerCount, 1));
+        size_t waveBegin = 0;
+        while (waveBegin < m_fillStepOrder.size())
+        {
+            const size_t wave = m_fillSteps[m_fillStepOrder[waveBegin]].m_wave;
+            size_t waveEnd = waveBegin + 1;
+            while ((waveEnd < m_fillStepOrder.size()) && (m_fillSteps[m_fillStepOrder[waveEnd]].m_wave == wave))
+            {
+                ++waveEnd;
+            }
+
+            // Every job runs every jobCount-th step of the wave.
+            const size_t jobCount = AZStd::GetMin(waveEnd - waveBegin, workerCount);
+            auto runSteps = [this, vegTasks, waveBegin, waveEnd, jobCount](size_t jobIndex)
+            {
+                for (size_t orderIndex = waveBegin + jobIndex; orderIndex < waveEnd; orderIndex += jobCount)
+                {
+                    RunFillStep(m_fillSteps[m_fillStepOrder[orderIndex]], vegTasks);
+                }
+            };
+
+            if ((jobCount <= 1) || (AZ::JobContext::GetGlobalContext() == nullptr))
+            {
+                for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+                {
+                    runSteps(jobIndex);
+                }
+            }
+            else
+            {
+                AZ::JobCompletion jobCompletion;
+                for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([&runSteps, jobIndex]()
                     {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                        AZ_PROFILE_SCOPE(Entity, "Vegetation::AreaSystemComponent::FillSectorJob");
+                        runSteps(jobIndex);
+                    }, true);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
                 }
+                jobCompletion.StartAndWaitForCompletion();
             }
 
-            return true;
+            waveBegin = waveEnd;
         }
+    }
 
-        // No sectors left to process, so tell our main loop to stop processing.
-        return false;
+    void AreaSystemComponent::UpdateContext::RunFillStep(const FillStep& step, VegetationThreadTasks* vegTasks)
+    {
+        SectorBatchEntry& entry = m_sectorBatch[step.m_entryIndex];
+        if (step.m_stepIndex == 0)
+        {
+            if (entry.m_mode != UpdateMode::Fill)
+            {
+                vegTasks->UpdateSectorPoints(*entry.m_sectorInfo, m_cachedMainThreadData.m_sectorDensity, m_cachedMainThreadData.m_sectorSizeInMeters, m_cachedMainThreadData.m_sectorPointSnapMode);
+            }
+            vegTasks->BeginFillSector(*entry.m_sectorInfo, entry.m_activeContext);
+        }
+        else
+        {
+            const BatchArea& batchArea = m_batchAreas[entry.m_areaIndices[step.m_stepIndex - 1]];
+            VegetationThreadTasks::ClaimSectorPositions(*batchArea.m_area, batchArea.m_pinnedHandler, entry.m_activeContext);
+        }
     }
 
 }
@@ -15,6 +15,7 @@
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/limits.h>
 #include <GradientSignal/Ebuses/SectorDataRequestBus.h>
 #include <SurfaceData/SurfaceDataSystemNotificationBus.h>
 #include <CrySystemBus.h>
@@ -50,7 +51,8 @@ namespace Vegetation
                    && m_sectorSizeInMeters == other.m_sectorSizeInMeters
                    && m_threadProcessingIntervalMs == other.m_threadProcessingIntervalMs
                    && m_sectorSearchPadding == other.m_sectorSearchPadding
-                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode;
+                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode
+                   && m_sectorWorkerCount == other.m_sectorWorkerCount;
         }
 
         int m_viewRectangleSize = 13;
@@ -59,10 +61,12 @@ namespace Vegetation
         int m_threadProcessingIntervalMs = 500;
         int m_sectorSearchPadding = 0;
         SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+        int m_sectorWorkerCount = 4;
     private:
         static const int s_maxViewRectangleSize;
         static const int s_maxSectorDensity;
         static const int s_maxSectorSizeInMeters;
+        static const int s_maxSectorWorkerCount;
 
         static const int s_maxInstancesPerMeter;
         static const int64_t s_maxVegetationInstances;
@@ -162,6 +166,7 @@ namespace Vegetation
     private:
         using ClaimContainer = AZStd::unordered_map<ClaimHandle, InstanceData>;
         using ClaimContainerEntry = AZStd::pair<ClaimHandle, InstanceData>;
+        using ClaimsByArea = AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>>;
 
         using SectorId = AZStd::pair<int, int>;
 
@@ -272,6 +277,8 @@ namespace Vegetation
             int m_sectorSizeInMeters = 0;
             int m_sectorDensity = 0;
             SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+            int m_sectorSearchPadding = 0;
+            int m_sectorWorkerCount = 1;
         };
 
         // VegetationThreadTasks is the task queue that's used equally by the main thread and the vegetation thread.
@@ -292,12 +299,21 @@ namespace Vegetation
             const SectorInfo* GetSector(const SectorId& sectorId) const;
             SectorInfo* GetSector(const SectorId& sectorId);
 
-            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Creates a new sector without any surface points, UpdateSectorPoints needs to be called before filling it.
+            SectorInfo* CreateSector(const SectorId& sectorId, int sectorSizeInMeters);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
+            //! Filling a sector is split in steps so that sectors can be filled in parallel: BeginFillSector sets up the claim context,
+            //! ClaimSectorPositions lets one area claim points from it, in priority order, and EndFillSector returns the claims that
+            //! aren't used anymore in unusedClaims, which need to be released with ReleaseClaims. Only the given sector is modified.
+            void BeginFillSector(SectorInfo& sectorInfo, ClaimContext& activeContext);
+            static void ClaimSectorPositions(const VegetationAreaInfo& area, AreaRequests* pinnedArea, ClaimContext& activeContext);
+            static void EndFillSector(SectorInfo& sectorInfo, const ClaimContext& activeContext, ClaimsByArea& unusedClaims);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
 
+            void ReleaseUnregisteredClaims(SectorInfo& sectorInfo);
+            static void ReleaseClaims(const ClaimsByArea& claimsToRelease);
+
             //! Gets the AABB for a sector
             static AZ::Aabb GetSectorBounds(const SectorId& sectorId, int sectorSizeInMeters);
 
@@ -316,8 +332,7 @@ namespace Vegetation
             void CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData);
             ClaimHandle CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const;
 
-            void ReleaseUnusedClaims(SectorInfo& sectorInfo);
-            void ReleaseUnregisteredClaims(SectorInfo& sectorInfo);
+            static void GatherUnusedClaims(SectorInfo& sectorInfo, ClaimsByArea& unusedClaims);
 
             //! Creates a new sector
             void UpdateSectorCallbacks(SectorInfo& sectorInfo);
@@ -430,7 +445,10 @@ namespace Vegetation
 
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
-            bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            bool UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void SelectSectorBatch();
+            void FillSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void RunFillStepsWithJobs(VegetationThreadTasks* vegTasks);
 
             enum class UpdateMode
             {
@@ -439,6 +457,44 @@ namespace Vegetation
                 Fill
             };
 
+            struct SectorBatchEntry
+            {
+                SectorId m_id = {};
+                UpdateMode m_mode = UpdateMode::Fill;
+                SectorInfo* m_sectorInfo = nullptr;
+                ClaimContext m_activeContext;
+                //! Indices into m_batchAreas of the areas that overlap the sector, in the order they claim
+                AZStd::vector<size_t> m_areaIndices;
+                ClaimsByArea m_unusedClaims;
+            };
+
+            //! An active area of the batch.  Pinned areas are called directly instead of through the AreaRequestBus, so the
+            //! bus lock doesn't serialize the claims of the whole batch.
+            struct BatchArea
+            {
+                const VegetationAreaInfo* m_area = nullptr;
+                AreaRequests* m_pinnedHandler = nullptr;
+            };
+
+            static constexpr size_t s_noFillStep = AZStd::numeric_limits<size_t>::max();
+
+            //! A step of filling a sector of the batch.  Step 0 begins the fill, step n claims with the n-th area of the sector.
+            struct FillStep
+            {
+                size_t m_entryIndex = 0;
+                size_t m_stepIndex = 0;
+                //! The previous step of the same sector, and the previous step of the same area in an earlier sector
+                size_t m_previousSectorStep = s_noFillStep;
+                size_t m_previousAreaStep = s_noFillStep;
+                //! The longest chain of steps this step waits for, so the steps of a wave can run together
+                size_t m_wave = 0;
+            };
+
+            void RunFillStep(const FillStep& step, VegetationThreadTasks* vegTasks);
+
+            // The batch size doesn't depend on the worker count, so the same sectors get filled together for every worker count.
+            static constexpr size_t s_maxSectorsPerBatch = 16;
+
             // The sorted work list of sectors to delete.  The list is recreated every time UpdateSectorWorkLists() is run.
             AZStd::vector<SectorId> m_deleteWorkList;
 
@@ -447,6 +503,16 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // The sectors from the update work list that are currently being created / updated.  These are far enough apart from
+            // each other that they can be filled in parallel.
+            AZStd::vector<SectorBatchEntry> m_sectorBatch;
+
+            // The areas and fill steps of the current batch.  These are kept persistent to avoid reallocating them for every batch.
+            AZStd::vector<BatchArea> m_batchAreas;
+            AZStd::vector<FillStep> m_fillSteps;
+            AZStd::vector<size_t> m_fillStepOrder;
+            AZStd::vector<size_t> m_lastFillStepForArea;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
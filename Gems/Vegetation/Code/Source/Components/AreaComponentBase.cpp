@@ -146,6 +146,7 @@ namespace Vegetation
     void AreaComponentBase::Activate()
     {
         m_areaRegistered = false;
+        m_areaConnectionCount = 0;
         LmbrCentral::ShapeComponentNotificationsBus::Handler::BusConnect(GetEntityId());
         AZ::TransformNotificationBus::Handler::BusConnect(GetEntityId());
         AreaNotificationBus::Handler::BusConnect(GetEntityId());
@@ -164,7 +165,12 @@ namespace Vegetation
         // OnCompositionChanged event which ended up looping back into this component.
         AreaNotificationBus::Handler::BusDisconnect();
         AreaInfoBus::Handler::BusDisconnect();
-        AreaRequestBus::Handler::BusDisconnect();
+        {
+            // Wait for the sectors that claim with this area without the bus lock.
+            AZStd::unique_lock<decltype(m_claimPinMutex)> pinLock(m_claimPinMutex);
+            AreaRequestBus::Handler::BusDisconnect();
+        }
+        m_areaConnectionCount = 0;
         LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
         LmbrCentral::ShapeComponentNotificationsBus::Handler::BusDisconnect();
         AZ::TransformNotificationBus::Handler::BusDisconnect();
@@ -265,18 +271,37 @@ namespace Vegetation
 
     void AreaComponentBase::OnAreaConnect()
     {
-        AreaRequestBus::Handler::BusConnect(GetEntityId());
+        // Connections nest when sectors are filled in parallel, so only the outermost connect / disconnect pair changes the
+        // AreaRequestBus connection. Both are only called through the AreaNotificationBus, which serializes them.
+        if (m_areaConnectionCount++ == 0)
+        {
+            AreaRequestBus::Handler::BusConnect(GetEntityId());
+        }
     }
 
     void AreaComponentBase::OnAreaDisconnect()
     {
-        AreaRequestBus::Handler::BusDisconnect();
+        if (m_areaConnectionCount > 0 && --m_areaConnectionCount == 0)
+        {
+            AreaRequestBus::Handler::BusDisconnect();
+        }
     }
 
     void AreaComponentBase::OnAreaRefreshed()
     {
     }
 
+    bool AreaComponentBase::PinForClaims()
+    {
+        // Deactivate() holds the mutex exclusively, and waiting for it here could deadlock with the bus lock it waits on.
+        return m_claimPinMutex.try_lock_shared();
+    }
+
+    void AreaComponentBase::UnpinForClaims()
+    {
+        m_claimPinMutex.unlock_shared();
+    }
+
     void AreaComponentBase::OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& /*world*/)
     {
         AZ_PROFILE_FUNCTION(Entity);
@@ -973,13 +973,20 @@ void DebugComponent::DrawDebugStats(AzFramework::DebugDisplayRequests& debugDisp
     AZ::u32 destroyTaskCount = 0;
     InstanceSystemStatsRequestBus::BroadcastResult(destroyTaskCount, &InstanceSystemStatsRequestBus::Events::GetDestroyTaskCount);
 
+    AZ::u32 peakTotalTaskCount = 0;
+    InstanceSystemStatsRequestBus::BroadcastResult(peakTotalTaskCount, &InstanceSystemStatsRequestBus::Events::GetPeakTotalTaskCount);
+
+    AZ::u32 processedTaskCount = 0;
+    InstanceSystemStatsRequestBus::BroadcastResult(processedTaskCount, &InstanceSystemStatsRequestBus::Events::GetProcessedTaskCountLastTick);
+
     debugDisplay.SetColor(AZ::Color(1.0f));
     debugDisplay.Draw2dTextLabel(
         40.0f, 22.0f, 0.7f,
         AZStd::string::format(
-            "VegetationSystemStats:\nActive Instances Count: %d\nInstance Register Queue: %d\nInstance Unregister Queue: %d\nThread "
-            "Queue Count: %d\nThread Processing Count: %d",
-            instanceCount, createTaskCount, destroyTaskCount, m_debugData->m_areaTaskQueueCount.load(AZStd::memory_order_relaxed),
+            "VegetationSystemStats:\nActive Instances Count: %d\nInstance Register Queue: %d\nInstance Unregister Queue: %d\nInstance "
+            "Queue Peak: %d\nInstance Tasks Per Tick: %d\nThread Queue Count: %d\nThread Processing Count: %d",
+            instanceCount, createTaskCount, destroyTaskCount, peakTotalTaskCount, processedTaskCount,
+            m_debugData->m_areaTaskQueueCount.load(AZStd::memory_order_relaxed),
             m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed))
             .c_str(),
         false);
@@ -9,11 +9,10 @@
 #include "InstanceSystemComponent.h"
 
 #include <AzCore/Debug/Profiler.h> 
-#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
-#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 
 #include <LmbrCentral/Rendering/MaterialAsset.h>
 #include <LmbrCentral/Rendering/MeshAsset.h>
@@ -132,6 +131,9 @@ namespace Vegetation
     void InstanceSystemComponent::Activate()
     {
         Cleanup();
+        m_mainThreadId = AZStd::this_thread::get_id();
+        m_peakTotalTaskCount = 0;
+        m_processedTaskCountLastTick = 0;
         AZ::TickBus::Handler::BusConnect();
         InstanceSystemRequestBus::Handler::BusConnect();
         InstanceSystemStatsRequestBus::Handler::BusConnect();
@@ -289,12 +291,8 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceData]() {
-            CreateInstanceNode(instanceData);
-            m_createTaskCount--;
-        });
-
         m_createTaskCount++;
+        AddTask(instanceData.m_instanceId, &instanceData);
     }
 
     void InstanceSystemComponent::DestroyInstance(InstanceId instanceId)
@@ -310,17 +308,8 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceId]() {
-            ReleaseInstanceNode(instanceId);
-
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.erase(instanceId);
-            m_destroyTaskCount--;
-        });
-
-        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        m_instanceDeletionSet.insert(instanceId);
         m_destroyTaskCount++;
+        AddTask(instanceId, nullptr);
     }
 
     void InstanceSystemComponent::DestroyAllInstances()
@@ -331,28 +320,18 @@ namespace Vegetation
         ClearTasks();
 
         // clear all instances
+        for (auto instancePair : m_instanceMap)
         {
-            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            for (auto instancePair : m_instanceMap)
+            InstanceId instanceId = instancePair.first;
+            DescriptorPtr descriptor = instancePair.second.first;
+            InstancePtr opaqueInstanceData = instancePair.second.second;
+            if (opaqueInstanceData)
             {
-                InstanceId instanceId = instancePair.first;
-                DescriptorPtr descriptor = instancePair.second.first;
-                InstancePtr opaqueInstanceData = instancePair.second.second;
-                if (opaqueInstanceData)
-                {
-                    descriptor->DestroyInstance(instanceId, opaqueInstanceData);
-                }
-                ReleaseInstanceId(instanceId);
+                descriptor->DestroyInstance(instanceId, opaqueInstanceData);
             }
-            m_instanceMap.clear();
-            m_instanceCount = 0;
-        }
-
-        {
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.clear();
-            m_destroyTaskCount = 0;
         }
+        m_instanceMap.clear();
+        m_instanceCount = 0;
     }
 
     void InstanceSystemComponent::Cleanup()
@@ -386,8 +365,20 @@ namespace Vegetation
         return m_destroyTaskCount;
     }
 
+    AZ::u32 InstanceSystemComponent::GetPeakTotalTaskCount() const
+    {
+        return m_peakTotalTaskCount;
+    }
+
+    AZ::u32 InstanceSystemComponent::GetProcessedTaskCountLastTick() const
+    {
+        return m_processedTaskCountLastTick;
+    }
+
     void InstanceSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        m_processedTaskCountLastTick = 0;
+
         if (HasTasks())
         {
             ProcessMainThreadTasks();
@@ -408,171 +399,252 @@ namespace Vegetation
 
     InstanceId InstanceSystemComponent::CreateInstanceId()
     {
-        AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
-
-        //recycle a previously used id from the pool/free-list before generating a new one
-        if (!m_instanceIdPool.empty())
+        //ids are 64 bit and never reused, so generating them only takes an atomic increment
+        const InstanceId instanceId = m_instanceIdCounter.fetch_add(1, AZStd::memory_order_relaxed);
+        if (instanceId >= MaxInstanceId)
         {
-            auto instanceIdItr = m_instanceIdPool.begin();
-            InstanceId instanceId = *instanceIdItr;
-            m_instanceIdPool.erase(instanceIdItr);
-            return instanceId;
-        }
-
-        //if all ids have been used, no more can be created until the counter is reset
-        if (m_instanceIdCounter >= MaxInstanceId)
-        {
-            AZ_Error("vegetation", false, "MaxInstanceId reached! No more instance ids can be created until some are released!");
+            AZ_Error("vegetation", false, "MaxInstanceId reached! No more instance ids can be created!");
             return InvalidInstanceId;
         }
 
-        return m_instanceIdCounter++;
-    }
-
-    void InstanceSystemComponent::ReleaseInstanceId(InstanceId instanceId)
-    {
-        AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
-
-        //add released ids to the free list for recycling
-        m_instanceIdPool.insert(instanceId);
+        return instanceId;
     }
 
     bool InstanceSystemComponent::IsInstanceSkippable(const InstanceData& instanceData) const
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        //if the instance was queued for deletion before its creation task executed then skip it
-        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        return instanceData.m_instanceId == InvalidInstanceId || m_instanceDeletionSet.find(instanceData.m_instanceId) != m_instanceDeletionSet.end();
+        //if the instance is destroyed by the same batch of tasks that creates it then skip it
+        return instanceData.m_instanceId == InvalidInstanceId ||
+            AZStd::binary_search(m_destroyedInstanceIds.begin(), m_destroyedInstanceIds.end(), instanceData.m_instanceId);
     }
 
-    void InstanceSystemComponent::CreateInstanceNode(const InstanceData& instanceData)
+    void InstanceSystemComponent::CreateInstanceNodes(const AZStd::vector<const InstanceData*>& instanceDatas)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        if (IsInstanceSkippable(instanceData))
+        m_createdInstanceDatas.clear();
         {
-            return;
-        }
+            AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
 
-        // Only support valid, registered descriptors with loaded assets
-        if (!instanceData.m_descriptorPtr || !instanceData.m_descriptorPtr->IsLoaded())
-        {
-            //descriptor and mesh must be valid but it's not an error
-            //an edit, asset change, or other event could have released descriptors or render groups on this or another thread
-            //this should result in a composition change and refresh
-            return;
+            for (const InstanceData* instanceData : instanceDatas)
+            {
+                if (IsInstanceSkippable(*instanceData))
+                {
+                    continue;
+                }
+
+                // Only support valid, registered descriptors with loaded assets
+                if (!instanceData->m_descriptorPtr || !instanceData->m_descriptorPtr->IsLoaded())
+                {
+                    //descriptor and mesh must be valid but it's not an error
+                    //an edit, asset change, or other event could have released descriptors or render groups on this or another thread
+                    //this should result in a composition change and refresh
+                    continue;
+                }
+
+                if (m_uniqueDescriptors.find(instanceData->m_descriptorPtr) == m_uniqueDescriptors.end())
+                {
+                    //descriptor must be registered with the system to create an instance.
+                    //it could have been removed or re-added while editing or deleting entities that control the registration
+                    continue;
+                }
+
+                m_createdInstanceDatas.push_back(instanceData);
+            }
         }
 
+        AZStd::sort(m_createdInstanceDatas.begin(), m_createdInstanceDatas.end(), [](const InstanceData* lhs, const InstanceData* rhs)
         {
-            AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
+            return lhs->m_descriptorPtr.get() < rhs->m_descriptorPtr.get();
+        });
 
-            auto descItr = m_uniqueDescriptors.find(instanceData.m_descriptorPtr);
-            if (descItr == m_uniqueDescriptors.end())
+        for (size_t first = 0; first < m_createdInstanceDatas.size();)
+        {
+            const DescriptorPtr& descriptorPtr = m_createdInstanceDatas[first]->m_descriptorPtr;
+            size_t last = first + 1;
+            while (last < m_createdInstanceDatas.size() && m_createdInstanceDatas[last]->m_descriptorPtr == descriptorPtr)
             {
-                //descriptor must be registered with the system to create an instance.
-                //it could have been removed or re-added while editing or deleting entities that control the registration
-                return;
+                ++last;
             }
-        }
 
-        InstancePtr opaqueInstanceData = instanceData.m_descriptorPtr->CreateInstance(instanceData);
+            m_spawnerInstanceDatas.assign(m_createdInstanceDatas.begin() + first, m_createdInstanceDatas.begin() + last);
+            descriptorPtr->CreateInstances(m_spawnerInstanceDatas, m_spawnerInstances);
 
-        if (opaqueInstanceData)
-        {
-            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
-            m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, opaqueInstanceData);
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
+            for (size_t index = 0; index < m_spawnerInstanceDatas.size(); ++index)
+            {
+                InstancePtr opaqueInstanceData = m_spawnerInstances[index];
+                if (opaqueInstanceData)
+                {
+                    const InstanceId instanceId = m_spawnerInstanceDatas[index]->m_instanceId;
+                    AZ_Assert(m_instanceMap.find(instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceId);
+                    m_instanceMap[instanceId] = AZStd::make_pair(descriptorPtr, opaqueInstanceData);
+                }
+            }
+            first = last;
         }
+        m_instanceCount = static_cast<int>(m_instanceMap.size());
     }
 
-    void InstanceSystemComponent::ReleaseInstanceNode(InstanceId instanceId)
+    void InstanceSystemComponent::ReleaseInstanceNodes(const AZStd::vector<InstanceId>& instanceIds)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        DescriptorPtr descriptor = nullptr;
-        InstancePtr opaqueInstanceData = nullptr;
-
+        m_releasedInstances.clear();
+        for (InstanceId instanceId : instanceIds)
         {
-            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
             auto instanceItr = m_instanceMap.find(instanceId);
             if (instanceItr != m_instanceMap.end())
             {
-                descriptor = instanceItr->second.first;
-                opaqueInstanceData = instanceItr->second.second;
+                m_releasedInstances.push_back({ instanceItr->second.first, instanceId, instanceItr->second.second });
                 m_instanceMap.erase(instanceItr);
             }
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
         }
+        m_instanceCount = static_cast<int>(m_instanceMap.size());
+
+        AZStd::sort(m_releasedInstances.begin(), m_releasedInstances.end(), [](const ReleasedInstance& lhs, const ReleasedInstance& rhs)
+        {
+            return lhs.m_descriptorPtr.get() < rhs.m_descriptorPtr.get();
+        });
 
-        if (opaqueInstanceData)
+        for (size_t first = 0; first < m_releasedInstances.size();)
         {
-            descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+            const DescriptorPtr descriptorPtr = m_releasedInstances[first].m_descriptorPtr;
+            m_spawnerReleasedInstances.clear();
+            size_t last = first;
+            for (; last < m_releasedInstances.size() && m_releasedInstances[last].m_descriptorPtr == descriptorPtr; ++last)
+            {
+                if (m_releasedInstances[last].m_instance)
+                {
+                    m_spawnerReleasedInstances.emplace_back(m_releasedInstances[last].m_instanceId, m_releasedInstances[last].m_instance);
+                }
+            }
+
+            if (!m_spawnerReleasedInstances.empty())
+            {
+                descriptorPtr->DestroyInstances(m_spawnerReleasedInstances);
+            }
+            first = last;
         }
-        ReleaseInstanceId(instanceId);
+
+        // Release the descriptors held by the scratch list.
+        m_releasedInstances.clear();
     }
 
     bool InstanceSystemComponent::HasTasks() const
     {
-        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        return !m_mainThreadTaskQueue.empty();
+        return m_commandBuffer.GetSize() > 0;
     }
 
-    void InstanceSystemComponent::AddTask(const Task& task)
+    void InstanceSystemComponent::AddTask(InstanceId instanceId, const InstanceData* instanceData)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        if (m_mainThreadTaskQueue.empty() || m_mainThreadTaskQueue.back().size() >= m_configuration.m_maxInstanceTaskBatchSize)
+        // Commands are written in place into reused slots, so only assign what executing them needs. The surface masks
+        // aren't used to create instances and are left out, copying them would allocate.
+        auto writeCommand = [instanceId, instanceData](InstanceCommand& command)
         {
-            m_mainThreadTaskQueue.push_back();
-            m_mainThreadTaskQueue.back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
-        }
-        m_mainThreadTaskQueue.back().emplace_back(task);
-    }
-
-    void InstanceSystemComponent::ClearTasks()
-    {
-        AZ_PROFILE_FUNCTION(Entity);
+            command.m_destroy = !instanceData;
+            InstanceData& commandData = command.m_instanceData;
+            commandData.m_instanceId = instanceId;
+            if (instanceData)
+            {
+                commandData.m_id = instanceData->m_id;
+                commandData.m_changeIndex = instanceData->m_changeIndex;
+                commandData.m_position = instanceData->m_position;
+                commandData.m_normal = instanceData->m_normal;
+                commandData.m_rotation = instanceData->m_rotation;
+                commandData.m_alignment = instanceData->m_alignment;
+                commandData.m_scale = instanceData->m_scale;
+                commandData.m_descriptorPtr = instanceData->m_descriptorPtr;
+            }
+        };
 
-        AZStd::lock_guard<decltype(m_mainThreadTaskInProgressMutex)> mainThreadTaskInProgressLock(m_mainThreadTaskInProgressMutex);
-        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        m_mainThreadTaskQueue.clear();
+        // The request bus dispatches without a lock, so a producer waiting here for room doesn't block the other producers.
+        while (!m_commandBuffer.TryPush(writeCommand))
+        {
+            // The buffer only fills up when the main thread falls far behind, so either make room or wait for it to.
+            if (AZStd::this_thread::get_id() == m_mainThreadId)
+            {
+                ExecuteTasks();
+            }
+            else
+            {
+                AZStd::this_thread::yield();
+            }
+        }
 
-        m_createTaskCount = 0;
-        m_destroyTaskCount = 0;
+        const int taskCount = aznumeric_cast<int>(m_commandBuffer.GetSize());
+        int peakTaskCount = m_peakTotalTaskCount.load(AZStd::memory_order_relaxed);
+        while (taskCount > peakTaskCount && !m_peakTotalTaskCount.compare_exchange_weak(peakTaskCount, taskCount, AZStd::memory_order_relaxed))
+        {
+        }
     }
 
-    bool InstanceSystemComponent::GetTasks(TaskList& removedTasks)
+    void InstanceSystemComponent::ClearTasks()
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        if (!m_mainThreadTaskQueue.empty())
+        // Discard every queued command, including the ones other threads are still writing, and only take the discarded
+        // commands off the task counts. Tasks that are counted but not queued yet are still executed later.
+        m_commandBuffer.Drain([this](InstanceCommand& command)
         {
-            removedTasks.splice(removedTasks.end(), m_mainThreadTaskQueue, m_mainThreadTaskQueue.begin());
-            return true;
-        }
-        return false;
+            if (command.m_destroy)
+            {
+                m_destroyTaskCount--;
+            }
+            else
+            {
+                // Release the descriptor held by the command, the slots are reused as they are.
+                command.m_instanceData.m_descriptorPtr.reset();
+                m_createTaskCount--;
+            }
+        });
     }
 
     void InstanceSystemComponent::ExecuteTasks()
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::lock_guard<decltype(m_mainThreadTaskInProgressMutex)> scopedLock(m_mainThreadTaskInProgressMutex);
-
         AZStd::chrono::system_clock::time_point initialTime = AZStd::chrono::system_clock::now();
         AZStd::chrono::system_clock::time_point currentTime = initialTime;
 
-        auto removedTasksPtr = AZStd::make_shared<TaskList>();
-        while (GetTasks(*removedTasksPtr))
+        const size_t maxBatchSize = aznumeric_cast<size_t>(AZStd::max(m_configuration.m_maxInstanceTaskBatchSize, 1));
+        size_t batchSize = 0;
+        while ((batchSize = m_commandBuffer.GetReadableCount(maxBatchSize)) > 0)
         {
-            for (const auto& task : (*removedTasksPtr).back())
+            // Instance ids are never reused, so releasing the destroyed instances before creating the new ones gives the same result
+            // as executing the tasks in order: an instance destroyed in the same batch that creates it is skipped instead.
+            m_destroyedInstanceIds.clear();
+            m_batchInstanceDatas.clear();
+            for (size_t taskIndex = 0; taskIndex < batchSize; ++taskIndex)
+            {
+                const InstanceCommand& command = m_commandBuffer.Front(taskIndex);
+                if (command.m_destroy)
+                {
+                    m_destroyedInstanceIds.push_back(command.m_instanceData.m_instanceId);
+                }
+                else
+                {
+                    m_batchInstanceDatas.push_back(&command.m_instanceData);
+                }
+            }
+            AZStd::sort(m_destroyedInstanceIds.begin(), m_destroyedInstanceIds.end());
+
+            ReleaseInstanceNodes(m_destroyedInstanceIds);
+            m_destroyTaskCount -= aznumeric_cast<int>(m_destroyedInstanceIds.size());
+            CreateInstanceNodes(m_batchInstanceDatas);
+            m_createTaskCount -= aznumeric_cast<int>(m_batchInstanceDatas.size());
+            m_batchInstanceDatas.clear();
+
+            // Release the descriptors held by the commands, the slots are reused as they are.
+            for (size_t taskIndex = 0; taskIndex < batchSize; ++taskIndex)
             {
-                task();
+                m_commandBuffer.Front(taskIndex).m_instanceData.m_descriptorPtr.reset();
             }
+            m_commandBuffer.PopFront(batchSize);
+            m_destroyedInstanceIds.clear();
+            m_processedTaskCountLastTick += aznumeric_cast<int>(batchSize);
 
             currentTime = AZStd::chrono::system_clock::now();
             if (AZStd::chrono::microseconds(currentTime - initialTime).count() > m_configuration.m_maxInstanceProcessTimeMicroseconds)
@@ -580,10 +652,6 @@ namespace Vegetation
                 break;
             }
         }
-
-        //offloading garbage collection to job to save time deallocating tasks on main thread
-        auto garbageCollectionJob = AZ::CreateJobFunction([]() mutable {}, true);
-        garbageCollectionJob->Start();
     }
 
     void InstanceSystemComponent::ProcessMainThreadTasks()
@@ -16,14 +16,15 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/vector.h>
-#include <AzCore/std/containers/list.h>
-#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <Vegetation/Descriptor.h>
 #include <Vegetation/InstanceData.h>
 #include <Vegetation/Ebuses/InstanceSystemRequestBus.h>
 #include <Vegetation/Ebuses/SystemConfigurationBus.h>
 
+#include "Util/ConcurrentCommandBuffer.h"
+
 namespace AZ
 {
     class Aabb;
@@ -103,6 +104,8 @@ namespace Vegetation
         AZ::u32 GetTotalTaskCount() const override;
         AZ::u32 GetCreateTaskCount() const override;
         AZ::u32 GetDestroyTaskCount() const override;
+        AZ::u32 GetPeakTotalTaskCount() const override;
+        AZ::u32 GetProcessedTaskCountLastTick() const override;
 
         // AZ::TickBus
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
@@ -115,38 +118,52 @@ namespace Vegetation
         ////////////////////////////////////////////////////////////////
         // vegetation instance id management
         InstanceId CreateInstanceId();
-        void ReleaseInstanceId(InstanceId instanceId);
 
-        mutable AZStd::recursive_mutex m_instanceIdMutex;
-        InstanceId m_instanceIdCounter = 0;
-        AZStd::unordered_set<InstanceId> m_instanceIdPool;
+        AZStd::atomic<InstanceId> m_instanceIdCounter{ 0 };
 
         ////////////////////////////////////////////////////////////////
         // vegetation instance management
+        // The instance nodes are only created and released on the main thread, which owns the instance map.
+        // The nodes of a batch are grouped by descriptor, so each spawner creates or destroys all of its instances with one call.
         bool IsInstanceSkippable(const InstanceData& instanceData) const;
-        void CreateInstanceNode(const InstanceData& instanceData);
+        void CreateInstanceNodes(const AZStd::vector<const InstanceData*>& instanceDatas);
 
-        void ReleaseInstanceNode(InstanceId instanceId);
+        void ReleaseInstanceNodes(const AZStd::vector<InstanceId>& instanceIds);
 
-        mutable AZStd::recursive_mutex m_instanceMapMutex;
         AZStd::unordered_map<InstanceId, AZStd::pair<DescriptorPtr, InstancePtr>> m_instanceMap;
 
-        mutable AZStd::recursive_mutex m_instanceDeletionSetMutex;
-        AZStd::unordered_set<InstanceId> m_instanceDeletionSet;
+        // sorted ids of the instances destroyed by the batch of tasks being executed, their creation can be skipped
+        AZStd::vector<InstanceId> m_destroyedInstanceIds;
+
+        // scratch lists for executing a batch of tasks, kept to reuse their memory
+        struct ReleasedInstance
+        {
+            DescriptorPtr m_descriptorPtr;
+            InstanceId m_instanceId = InvalidInstanceId;
+            InstancePtr m_instance = nullptr;
+        };
+        AZStd::vector<const InstanceData*> m_batchInstanceDatas;
+        AZStd::vector<const InstanceData*> m_createdInstanceDatas;
+        AZStd::vector<const InstanceData*> m_spawnerInstanceDatas;
+        AZStd::vector<InstancePtr> m_spawnerInstances;
+        AZStd::vector<ReleasedInstance> m_releasedInstances;
+        AZStd::vector<AZStd::pair<InstanceId, InstancePtr>> m_spawnerReleasedInstances;
 
         ////////////////////////////////////////////////////////////////
         // Task management
-        using Task = AZStd::function<void(void)>;
-        using TaskBatch = AZStd::vector<Task>;
-        using TaskList = AZStd::list<TaskBatch>;
-        TaskList m_mainThreadTaskQueue;
-        mutable AZStd::recursive_mutex m_mainThreadTaskMutex;
-        mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
+        // Instance creation and destruction is recorded from any thread into a lock free command buffer, and executed in
+        // batches on the main thread.
+        struct InstanceCommand
+        {
+            bool m_destroy = false;
+            InstanceData m_instanceData;
+        };
+        ConcurrentCommandBuffer<InstanceCommand> m_commandBuffer;
+        AZStd::thread_id m_mainThreadId;
 
         bool HasTasks() const;
-        void AddTask(const Task& task);
+        void AddTask(InstanceId instanceId, const InstanceData* instanceData);
         void ClearTasks();
-        bool GetTasks(TaskList& removedTasks);
         void ExecuteTasks();
         void ProcessMainThreadTasks();
 
@@ -163,5 +180,7 @@ namespace Vegetation
         AZStd::atomic_int m_instanceCount{ 0 };
         AZStd::atomic_int m_createTaskCount{ 0 };
         AZStd::atomic_int m_destroyTaskCount{ 0 };
+        AZStd::atomic_int m_peakTotalTaskCount{ 0 };
+        AZStd::atomic_int m_processedTaskCountLastTick{ 0 };
     };
 } // namespace Vegetation
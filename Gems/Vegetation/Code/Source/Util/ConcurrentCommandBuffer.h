@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace Vegetation
+{
+    /**
+    * A lock free command buffer with many producers and a single consumer.
+    * Commands live in fixed size segments of slots that are allocated on first use and reused afterwards, so once the
+    * buffer has grown to its high water mark, writing and consuming commands doesn't allocate. Producers write their
+    * command in place, and the consumer reads and releases commands in place, in the order they were reserved.
+    * The buffer holds at most SegmentSize * MaxSegmentCount unconsumed commands, TryPush fails when it's full.
+    */
+    template <typename TCommand, size_t SegmentSize = 1024, size_t MaxSegmentCount = 1024>
+    class ConcurrentCommandBuffer final
+    {
+    public:
+        static constexpr size_t Capacity = SegmentSize * MaxSegmentCount;
+
+        ConcurrentCommandBuffer() = default;
+        ConcurrentCommandBuffer(const ConcurrentCommandBuffer&) = delete;
+        ConcurrentCommandBuffer& operator=(const ConcurrentCommandBuffer&) = delete;
+
+        ~ConcurrentCommandBuffer()
+        {
+            for (auto& segment : m_segments)
+            {
+                delete segment.load(AZStd::memory_order_relaxed);
+            }
+        }
+
+        // Producers: reserves the next slot and calls writeFunc(TCommand&) to fill it in, returns false if the buffer is full.
+        // The slot still holds whatever the consumer left in it, so writeFunc needs to set every field it relies on.
+        template <typename WriteFunc>
+        AZ_INLINE bool TryPush(WriteFunc&& writeFunc)
+        {
+            size_t index = m_writeIndex.load(AZStd::memory_order_relaxed);
+            do
+            {
+                if (index - m_readIndex.load(AZStd::memory_order_acquire) >= Capacity)
+                {
+                    return false;
+                }
+            } while (!m_writeIndex.compare_exchange_weak(index, index + 1, AZStd::memory_order_relaxed));
+
+            Slot& slot = GetOrCreateSegment(index).m_slots[index % SegmentSize];
+            writeFunc(slot.m_command);
+            slot.m_sequence.store(index + 1, AZStd::memory_order_release);
+            return true;
+        }
+
+        // Consumer: the number of commands, up to maxCount, that are completely written and can be read with Front.
+        AZ_INLINE size_t GetReadableCount(size_t maxCount) const
+        {
+            const size_t readIndex = m_readIndex.load(AZStd::memory_order_relaxed);
+            size_t count = 0;
+            for (; count < maxCount; ++count)
+            {
+                const size_t index = readIndex + count;
+                const Segment* segment = m_segments[(index / SegmentSize) % MaxSegmentCount].load(AZStd::memory_order_acquire);
+                if (!segment || segment->m_slots[index % SegmentSize].m_sequence.load(AZStd::memory_order_acquire) != index + 1)
+                {
+                    break;
+                }
+            }
+            return count;
+        }
+
+        // Consumer: the command at the given offset from the oldest unconsumed command, offset must be less than the readable count.
+        AZ_INLINE TCommand& Front(size_t offset)
+        {
+            const size_t index = m_readIndex.load(AZStd::memory_order_relaxed) + offset;
+            Segment* segment = m_segments[(index / SegmentSize) % MaxSegmentCount].load(AZStd::memory_order_relaxed);
+            return segment->m_slots[index % SegmentSize].m_command;
+        }
+
+        // Consumer: hands the oldest count readable slots back to the producers.
+        AZ_INLINE void PopFront(size_t count)
+        {
+            m_readIndex.fetch_add(count, AZStd::memory_order_release);
+        }
+
+        // Consumer: calls discardFunc(TCommand&) on every command reserved before the call, in order, and hands their slots back
+        // to the producers. Unlike GetReadableCount, it waits for the producers that are still writing their commands, so no
+        // reserved command is left behind to be consumed after the buffer was drained. Returns the number of drained commands.
+        template <typename DiscardFunc>
+        size_t Drain(DiscardFunc&& discardFunc)
+        {
+            const size_t readIndex = m_readIndex.load(AZStd::memory_order_relaxed);
+            const size_t writeIndex = m_writeIndex.load(AZStd::memory_order_acquire);
+            for (size_t index = readIndex; index != writeIndex; ++index)
+            {
+                const AZStd::atomic<Segment*>& segmentPtr = m_segments[(index / SegmentSize) % MaxSegmentCount];
+                Segment* segment = segmentPtr.load(AZStd::memory_order_acquire);
+                while (!segment || segment->m_slots[index % SegmentSize].m_sequence.load(AZStd::memory_order_acquire) != index + 1)
+                {
+                    AZStd::this_thread::yield();
+                    segment = segmentPtr.load(AZStd::memory_order_acquire);
+                }
+                discardFunc(segment->m_slots[index % SegmentSize].m_command);
+            }
+            m_readIndex.store(writeIndex, AZStd::memory_order_release);
+            return writeIndex - readIndex;
+        }
+
+        // Any thread: the number of reserved commands that haven't been consumed yet.
+        AZ_INLINE size_t GetSize() const
+        {
+            const size_t readIndex = m_readIndex.load(AZStd::memory_order_acquire);
+            return m_writeIndex.load(AZStd::memory_order_acquire) - readIndex;
+        }
+
+    private:
+        struct Slot
+        {
+            // index + 1 of the last command that was written to this slot
+            AZStd::atomic<size_t> m_sequence{ 0 };
+            TCommand m_command;
+        };
+
+        struct Segment
+        {
+            AZ_CLASS_ALLOCATOR(Segment, AZ::SystemAllocator, 0);
+            Slot m_slots[SegmentSize];
+        };
+
+        AZ_INLINE Segment& GetOrCreateSegment(size_t index)
+        {
+            AZStd::atomic<Segment*>& segmentPtr = m_segments[(index / SegmentSize) % MaxSegmentCount];
+            Segment* segment = segmentPtr.load(AZStd::memory_order_acquire);
+            if (!segment)
+            {
+                // Segments are only ever added, if another producer won the race use its segment instead.
+                Segment* newSegment = aznew Segment();
+                if (segmentPtr.compare_exchange_strong(segment, newSegment, AZStd::memory_order_acq_rel))
+                {
+                    segment = newSegment;
+                }
+                else
+                {
+                    delete newSegment;
+                }
+            }
+            return *segment;
+        }
+
+        AZStd::atomic<Segment*> m_segments[MaxSegmentCount] = {};
+        AZStd::atomic<size_t> m_writeIndex{ 0 };
+        AZStd::atomic<size_t> m_readIndex{ 0 };
+    };
+}
@@ -9,18 +9,24 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Asset/AssetManagerComponent.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/sort.h>
 
 //////////////////////////////////////////////////////////////////////////
 
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
+#include "VegetationMocks.h"
 
 namespace UnitTest
 {
@@ -61,10 +67,13 @@ namespace UnitTest
             AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
             AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
 
-            // Initialize the job manager with 1 thread for the AssetManager to use.
+            // Initialize the job manager with a few threads for the AssetManager and the vegetation sector fill jobs to use.
             AZ::JobManagerDesc jobDesc;
             AZ::JobManagerThreadDesc threadDesc;
-            jobDesc.m_workerThreads.push_back(threadDesc);
+            for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
             m_jobManager = aznew AZ::JobManager(jobDesc);
             m_jobContext = aznew AZ::JobContext(*m_jobManager);
             AZ::JobContext::SetGlobalContext(m_jobContext);
@@ -159,5 +168,272 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
-}
 
+    //! Signals once the areas of a fill have claimed the expected number of points.
+    struct FillCompletion
+    {
+        void Reset(size_t expectedClaimCount)
+        {
+            m_remainingClaimCount = expectedClaimCount;
+        }
+
+        void AddClaims(size_t claimCount)
+        {
+            if ((claimCount > 0) && (m_remainingClaimCount.fetch_sub(claimCount) == claimCount))
+            {
+                m_filled.release();
+            }
+        }
+
+        bool WaitForFill()
+        {
+            return m_filled.try_acquire_for(AZStd::chrono::seconds(60));
+        }
+
+        AZStd::atomic<size_t> m_remainingClaimCount{ 0 };
+        AZStd::binary_semaphore m_filled;
+    };
+
+    //! An area that claims every point in its bounds, and reports its claims to a FillCompletion.  It's pinned like an
+    //! AreaComponentBase, so the sectors claim with it directly instead of through the AreaRequestBus.
+    //! With a spacing, the area only claims points that are further than the spacing from its other instances, which it looks up
+    //! with EnumerateInstancesInOverlappingSectors like the distance between filter does, so its claims depend on the
+    //! neighboring sectors.
+    struct FillTestArea
+        : public MockClaimingArea
+    {
+        FillTestArea(AZ::EntityId areaId, AZ::u32 priority, const AZ::Aabb& bounds, float spacing, FillCompletion& completion)
+            : MockClaimingArea(areaId, priority, bounds)
+            , m_spacing(spacing)
+            , m_completion(completion)
+        {
+        }
+
+        ~FillTestArea()
+        {
+            // The vegetation thread can still be finishing the fill after the last claim.
+            AZStd::unique_lock<AZStd::shared_mutex> pinLock(m_claimPinMutex);
+        }
+
+        bool PinForClaims() override
+        {
+            return m_claimPinMutex.try_lock_shared();
+        }
+
+        void UnpinForClaims() override
+        {
+            m_claimPinMutex.unlock_shared();
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            size_t availableCount = 0;
+            for (const auto& point : context.m_availablePoints)
+            {
+                if ((m_bounds.IsValid() && !m_bounds.Contains(point.m_position)) || IsTooClose(point.m_position))
+                {
+                    context.m_availablePoints[availableCount++] = point;
+                    continue;
+                }
+
+                Vegetation::InstanceData instanceData;
+                instanceData.m_id = m_areaId;
+                instanceData.m_position = point.m_position;
+                instanceData.m_normal = point.m_normal;
+                if (!context.m_existedCallback(point, instanceData))
+                {
+                    context.m_createdCallback(point, instanceData);
+                }
+            }
+
+            const size_t claimCount = context.m_availablePoints.size() - availableCount;
+            context.m_availablePoints.resize(availableCount);
+            m_claimCount += claimCount;
+            m_completion.AddClaims(claimCount);
+        }
+
+        bool IsTooClose(const AZ::Vector3& position) const
+        {
+            if (m_spacing <= 0.0f)
+            {
+                return false;
+            }
+
+            bool tooClose = false;
+            Vegetation::AreaSystemRequestBus::Broadcast(&Vegetation::AreaSystemRequestBus::Events::EnumerateInstancesInOverlappingSectors,
+                AZ::Aabb::CreateCenterRadius(position, m_spacing),
+                [this, &position, &tooClose](const Vegetation::InstanceData& instance)
+                {
+                    tooClose = (instance.m_id == m_areaId) && (instance.m_position.GetDistanceSq(position) < (m_spacing * m_spacing));
+                    return tooClose ? Vegetation::AreaSystemEnumerateCallbackResult::StopEnumerating
+                                    : Vegetation::AreaSystemEnumerateCallbackResult::KeepEnumerating;
+                });
+            return tooClose;
+        }
+
+        const float m_spacing;
+        FillCompletion& m_completion;
+        AZStd::shared_mutex m_claimPinMutex;
+    };
+
+    // Test harness that fills the vegetation view area around a camera at the origin, on a flat surface.
+    class VegetationAreaSystemFillTest
+        : public VegetationTestApp
+    {
+    public:
+        struct ClaimedInstance
+        {
+            float m_x = 0.0f;
+            float m_y = 0.0f;
+            AZ::u64 m_areaId = 0;
+
+            bool operator<(const ClaimedInstance& other) const
+            {
+                return AZStd::tie(m_y, m_x, m_areaId) < AZStd::tie(other.m_y, other.m_x, other.m_areaId);
+            }
+
+            bool operator==(const ClaimedInstance& other) const
+            {
+                return m_x == other.m_x && m_y == other.m_y && m_areaId == other.m_areaId;
+            }
+        };
+
+        struct FillResult
+        {
+            //! The claimed instances, sorted by position.
+            AZStd::vector<ClaimedInstance> m_instances;
+            //! The number of points each area claimed, in the order the areas were added.
+            AZStd::vector<size_t> m_claimCounts;
+        };
+
+        void SetUp() override
+        {
+            VegetationTestApp::SetUp();
+            m_surfaceHandler = AZStd::make_unique<MockFlatSurfaceHandler>();
+            m_camera = AZStd::make_unique<MockActiveCamera>();
+        }
+
+        void TearDown() override
+        {
+            m_areas.clear();
+            m_camera.reset();
+            m_surfaceHandler.reset();
+            VegetationTestApp::TearDown();
+        }
+
+        FillTestArea& AddArea(AZ::EntityId areaId, AZ::u32 priority = 0, const AZ::Aabb& bounds = AZ::Aabb::CreateNull(), float spacing = 0.0f)
+        {
+            m_areas.push_back(AZStd::make_unique<FillTestArea>(areaId, priority, bounds, spacing, m_completion));
+            return *m_areas.back();
+        }
+
+        // Refills the whole view area from scratch with the given sector worker count.
+        FillResult FillWorld(int sectorWorkerCount)
+        {
+            // Clearing waits for the vegetation thread of an earlier fill, so no claims of that fill are counted after this.
+            Vegetation::AreaSystemRequestBus::Broadcast(&Vegetation::AreaSystemRequestBus::Events::ClearAllAreas);
+            for (auto& area : m_areas)
+            {
+                area->m_claimCount = 0;
+            }
+
+            // A smaller view than the default still has several batches of sectors, and keeps the test fast.
+            Vegetation::AreaSystemConfig config;
+            config.m_viewRectangleSize = 8;
+            config.m_sectorDensity = 10;
+            config.m_threadProcessingIntervalMs = 0;
+            config.m_sectorWorkerCount = sectorWorkerCount;
+            Vegetation::SystemConfigurationRequestBus::Broadcast(&Vegetation::SystemConfigurationRequestBus::Events::UpdateSystemConfig, &config);
+
+            // The flat surface has a point for every position, and the areas claim all of them.
+            const size_t expectedInstanceCount =
+                static_cast<size_t>(config.m_viewRectangleSize * config.m_viewRectangleSize * config.m_sectorDensity * config.m_sectorDensity);
+            m_completion.Reset(expectedInstanceCount);
+
+            // A single tick applies the configuration and starts the vegetation thread, which fills every sector of the view before
+            // it stops.  Nothing else ticks, so the whole fill happens with the new worker count.
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+            EXPECT_TRUE(m_completion.WaitForFill());
+
+            FillResult result;
+            size_t claimCount = 0;
+            for (const auto& area : m_areas)
+            {
+                result.m_claimCounts.push_back(area->m_claimCount);
+                claimCount += area->m_claimCount;
+            }
+            EXPECT_EQ(claimCount, expectedInstanceCount);
+
+            const AZ::Aabb worldBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-10000.0f), AZ::Vector3(10000.0f));
+            AZStd::vector<Vegetation::InstanceData> instances;
+            Vegetation::AreaSystemRequestBus::BroadcastResult(instances, &Vegetation::AreaSystemRequestBus::Events::GetInstancesInAabb, worldBounds);
+            result.m_instances.reserve(instances.size());
+            for (const auto& instance : instances)
+            {
+                result.m_instances.push_back({ instance.m_position.GetX(), instance.m_position.GetY(), static_cast<AZ::u64>(instance.m_id) });
+            }
+            AZStd::sort(result.m_instances.begin(), result.m_instances.end());
+            return result;
+        }
+
+        AZStd::unique_ptr<MockFlatSurfaceHandler> m_surfaceHandler;
+        AZStd::unique_ptr<MockActiveCamera> m_camera;
+        FillCompletion m_completion;
+        AZStd::vector<AZStd::unique_ptr<FillTestArea>> m_areas;
+    };
+
+    TEST_F(VegetationAreaSystemFillTest, Vegetation_AreaSystemTest_ParallelSectorFillMatchesSerialFill)
+    {
+        // The highest priority area spaces out its instances across sector boundaries.  Two prioritized areas overlap each other
+        // in the middle of the view, and a lowest priority area claims the rest.  The bounds don't line up with the sectors, so
+        // the sectors on the area boundaries are claimed by several areas.
+        const float spacing = 5.0f;
+        const FillTestArea& spacedArea = AddArea(AZ::EntityId(0x1000), 3, AZ::Aabb::CreateNull(), spacing);
+        const FillTestArea& leftArea =
+            AddArea(AZ::EntityId(0x1001), 2, AZ::Aabb::CreateFromMinMax(AZ::Vector3(-70.3f, -90.3f, -1.0f), AZ::Vector3(20.3f, 50.3f, 1.0f)));
+        AddArea(AZ::EntityId(0x1002), 1, AZ::Aabb::CreateFromMinMax(AZ::Vector3(-20.3f, -50.3f, -1.0f), AZ::Vector3(70.3f, 90.3f, 1.0f)));
+        AddArea(AZ::EntityId(0x1003));
+
+        const FillResult serialResult = FillWorld(1);
+        const FillResult parallelResult = FillWorld(4);
+
+        // Every area claimed points, and the higher priority area kept the points where the areas overlap.
+        for (size_t claimCount : serialResult.m_claimCounts)
+        {
+            EXPECT_GT(claimCount, 0u);
+        }
+        const auto overlapInstance = AZStd::find_if(serialResult.m_instances.begin(), serialResult.m_instances.end(),
+            [&spacedArea](const ClaimedInstance& instance)
+            {
+                return instance.m_areaId != static_cast<AZ::u64>(spacedArea.m_areaId) &&
+                    instance.m_x > -20.0f && instance.m_x < 20.0f && instance.m_y > -50.0f && instance.m_y < 50.0f;
+            });
+        ASSERT_NE(overlapInstance, serialResult.m_instances.end());
+        EXPECT_EQ(overlapInstance->m_areaId, static_cast<AZ::u64>(leftArea.m_areaId));
+
+        // The spaced out instances are also spaced out across the sectors, which means the neighboring sectors were filled when
+        // their instances were looked up.
+        AZStd::vector<ClaimedInstance> spacedInstances;
+        for (const ClaimedInstance& instance : serialResult.m_instances)
+        {
+            if (instance.m_areaId == static_cast<AZ::u64>(spacedArea.m_areaId))
+            {
+                spacedInstances.push_back(instance);
+            }
+        }
+        for (size_t lhsIndex = 0; lhsIndex < spacedInstances.size(); ++lhsIndex)
+        {
+            for (size_t rhsIndex = lhsIndex + 1; rhsIndex < spacedInstances.size(); ++rhsIndex)
+            {
+                const float deltaX = spacedInstances[lhsIndex].m_x - spacedInstances[rhsIndex].m_x;
+                const float deltaY = spacedInstances[lhsIndex].m_y - spacedInstances[rhsIndex].m_y;
+                EXPECT_GE((deltaX * deltaX) + (deltaY * deltaY), spacing * spacing);
+            }
+        }
+
+        // The batched parallel fill claims the same points for the same areas.
+        EXPECT_EQ(parallelResult.m_claimCounts, serialResult.m_claimCounts);
+        ASSERT_EQ(parallelResult.m_instances.size(), serialResult.m_instances.size());
+        EXPECT_TRUE(parallelResult.m_instances == serialResult.m_instances);
+    }
+}
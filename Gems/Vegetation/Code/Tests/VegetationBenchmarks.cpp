@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include "Tests/VegetationMocks.h"
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/thread.h>
+#include <VegetationModule.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    // Provides the services that the vegetation system components depend on. The surface data itself is provided by
+    // MockFlatSurfaceHandler.
+    class BenchmarkVegetationDependenciesComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(BenchmarkVegetationDependenciesComponent, "{6F0C9B9E-4B3A-4D4B-9F53-5E4A2D1B8C71}");
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serialize->Class<BenchmarkVegetationDependenciesComponent, AZ::Component>()->Version(0);
+            }
+        }
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC("SurfaceDataSystemService", 0x1d44d25f));
+            provided.push_back(AZ_CRC("SurfaceDataProviderService", 0xfe9fb95e));
+        }
+
+    protected:
+        void Activate() override
+        {
+            AZ::Data::AssetManager::Descriptor descriptor;
+            AZ::Data::AssetManager::Create(descriptor);
+        }
+
+        void Deactivate() override
+        {
+            AZ::Data::AssetManager::Destroy();
+        }
+    };
+
+    class BenchmarkVegetationDependenciesModule
+        : public AZ::Module
+    {
+    public:
+        AZ_RTTI(BenchmarkVegetationDependenciesModule, "{1D7E3A52-8C0B-4E8F-A2C4-3B9D6F5E7A18}", AZ::Module);
+        AZ_CLASS_ALLOCATOR(BenchmarkVegetationDependenciesModule, AZ::SystemAllocator, 0);
+
+        BenchmarkVegetationDependenciesModule()
+        {
+            m_descriptors.insert(m_descriptors.end(), {
+                BenchmarkVegetationDependenciesComponent::CreateDescriptor()
+                });
+        }
+
+        AZ::ComponentTypeList GetRequiredSystemComponents() const override
+        {
+            return AZ::ComponentTypeList{
+                azrtti_typeid<BenchmarkVegetationDependenciesComponent>()
+            };
+        }
+    };
+
+    /*
+     * Fills the whole vegetation view area (13x13 sectors of 20x20 points) from scratch with a single area, the way the
+     * world gets refilled after all the vegetation got cleared. The argument is the number of job manager worker threads,
+     * which is also used as the sector worker count. The area has no instance descriptor, so this measures the sector fill
+     * and claim resolution without spawning instances. The reported items are claimed points.
+     */
+    class VegetationAreaSystemBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(aznumeric_cast<int>(state.range(0)));
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(aznumeric_cast<int>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            internalTearDown();
+        }
+
+        void internalSetUp(int workerCount)
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 256 * 1024 * 1024;
+
+            AZ::ComponentApplication::StartupParameters appStartup;
+            appStartup.m_createStaticModulesCallback =
+                [](AZStd::vector<AZ::Module*>& modules)
+            {
+                modules.emplace_back(new BenchmarkVegetationDependenciesModule);
+                modules.emplace_back(new Vegetation::VegetationModule);
+            };
+
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            m_systemEntity = m_app->Create(appDesc, appStartup);
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobDesc;
+            for (int threadIndex = 0; threadIndex < workerCount; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_surfaceHandler = AZStd::make_unique<MockFlatSurfaceHandler>();
+            m_camera = AZStd::make_unique<MockActiveCamera>();
+
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+
+            Vegetation::AreaSystemConfig config;
+            config.m_threadProcessingIntervalMs = 0;
+            config.m_sectorWorkerCount = workerCount;
+            Vegetation::SystemConfigurationRequestBus::Broadcast(&Vegetation::SystemConfigurationRequestBus::Events::UpdateSystemConfig, &config);
+            m_expectedClaimCount = static_cast<size_t>(config.m_viewRectangleSize * config.m_viewRectangleSize * config.m_sectorDensity * config.m_sectorDensity);
+
+            m_area = AZStd::make_unique<MockClaimingArea>(AZ::EntityId(0x44444444));
+
+            // Fill once so that the configuration change and the area registration are processed before measuring.
+            FillWorld();
+        }
+
+        void internalTearDown()
+        {
+            m_area.reset();
+            m_systemEntity->Deactivate();
+            m_camera.reset();
+            m_surfaceHandler.reset();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        void FillWorld()
+        {
+            Vegetation::AreaSystemRequestBus::Broadcast(&Vegetation::AreaSystemRequestBus::Events::ClearAllAreas);
+            m_area->m_claimCount = 0;
+
+            while (m_area->m_claimCount < m_expectedClaimCount)
+            {
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+                AZStd::this_thread::yield();
+            }
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZ::Entity* m_systemEntity = nullptr;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::unique_ptr<MockFlatSurfaceHandler> m_surfaceHandler;
+        AZStd::unique_ptr<MockActiveCamera> m_camera;
+        AZStd::unique_ptr<MockClaimingArea> m_area;
+        size_t m_expectedClaimCount = 0;
+    };
+
+    BENCHMARK_DEFINE_F(VegetationAreaSystemBenchmarkFixture, FillWorld)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            FillWorld();
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_expectedClaimCount);
+    }
+
+    BENCHMARK_REGISTER_F(VegetationAreaSystemBenchmarkFixture, FillWorld)
+        ->Arg(1)
+        ->Arg(4)
+        ->Arg(16)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+} // namespace UnitTest
+
+#endif
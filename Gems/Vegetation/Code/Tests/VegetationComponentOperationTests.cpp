@@ -18,9 +18,11 @@
 #include <Source/InstanceSystemComponent.h>
 #include <Source/DebugSystemComponent.h>
 #include <Source/Debugger/AreaDebugComponent.h>
+#include <Source/Util/ConcurrentCommandBuffer.h>
 #include <Vegetation/EmptyInstanceSpawner.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -395,6 +397,90 @@ namespace UnitTest
         mockDescriptorProviderBus.BusDisconnect();
     }
 
+    // An empty spawner that records the size of every batch it's asked to create or destroy.
+    class BatchCountingInstanceSpawner
+        : public Vegetation::EmptyInstanceSpawner
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BatchCountingInstanceSpawner, AZ::SystemAllocator, 0);
+
+        void CreateInstances(
+            const AZStd::vector<const Vegetation::InstanceData*>& instanceDatas, AZStd::vector<Vegetation::InstancePtr>& outInstances) override
+        {
+            m_createBatchSizes.push_back(instanceDatas.size());
+            EmptyInstanceSpawner::CreateInstances(instanceDatas, outInstances);
+        }
+
+        void DestroyInstances(const AZStd::vector<AZStd::pair<Vegetation::InstanceId, Vegetation::InstancePtr>>& instances) override
+        {
+            m_destroyBatchSizes.push_back(instances.size());
+            EmptyInstanceSpawner::DestroyInstances(instances);
+        }
+
+        AZStd::vector<size_t> m_createBatchSizes;
+        AZStd::vector<size_t> m_destroyBatchSizes;
+    };
+
+    TEST_F(VegetationComponentOperationTests, InstanceSystem_ExecutesTasksInBatchesPerSpawner)
+    {
+        Vegetation::InstanceSystemConfig instanceSystemConfig;
+        instanceSystemConfig.m_maxInstanceTaskBatchSize = 100;
+        instanceSystemConfig.m_maxInstanceProcessTimeMicroseconds = AZStd::numeric_limits<int>::max();
+        Vegetation::InstanceSystemComponent* instanceSystemComponent = nullptr;
+        auto instanceSystemEntity = CreateEntity(instanceSystemConfig, &instanceSystemComponent, [](AZ::Entity* e)
+        {
+            e->CreateComponent<Vegetation::DebugSystemComponent>();
+        });
+
+        auto instanceSpawner = AZStd::make_shared<BatchCountingInstanceSpawner>();
+        Vegetation::Descriptor descriptor;
+        descriptor.SetInstanceSpawner(instanceSpawner);
+        Vegetation::DescriptorPtr descriptorPtr;
+        Vegetation::InstanceSystemRequestBus::BroadcastResult(
+            descriptorPtr, &Vegetation::InstanceSystemRequestBus::Events::RegisterUniqueDescriptor, descriptor);
+        ASSERT_TRUE(descriptorPtr);
+
+        AZStd::vector<Vegetation::InstanceId> instanceIds;
+        for (int index = 0; index < 10; ++index)
+        {
+            Vegetation::InstanceData instanceData;
+            instanceData.m_descriptorPtr = descriptorPtr;
+            instanceData.m_position = AZ::Vector3(aznumeric_cast<float>(index), 0.0f, 0.0f);
+            Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::CreateInstance, instanceData);
+            instanceIds.push_back(instanceData.m_instanceId);
+        }
+
+        // An instance destroyed before its creation is executed is never created.
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstance, instanceIds[2]);
+
+        AZ::u32 peakTaskCount = 0;
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(
+            peakTaskCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetPeakTotalTaskCount);
+        EXPECT_EQ(peakTaskCount, 11);
+
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+        EXPECT_EQ(instanceSpawner->m_createBatchSizes, AZStd::vector<size_t>({ 9 }));
+        EXPECT_TRUE(instanceSpawner->m_destroyBatchSizes.empty());
+
+        AZ::u32 instanceCount = 0;
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(instanceCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetInstanceCount);
+        EXPECT_EQ(instanceCount, 9);
+
+        for (int index = 4; index < 8; ++index)
+        {
+            Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstance, instanceIds[index]);
+        }
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+        EXPECT_EQ(instanceSpawner->m_createBatchSizes.size(), 1u);
+        EXPECT_EQ(instanceSpawner->m_destroyBatchSizes, AZStd::vector<size_t>({ 4 }));
+
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(instanceCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetInstanceCount);
+        EXPECT_EQ(instanceCount, 5);
+
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyAllInstances);
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::ReleaseUniqueDescriptor, descriptorPtr);
+    }
+
     TEST_F(VegetationComponentOperationTests, AreaBlenderComponent)
     {
         auto entityBlocker = CreateEntity<Vegetation::BlockerComponent>(Vegetation::BlockerConfig(), nullptr, [](AZ::Entity* e)
@@ -543,4 +629,157 @@ namespace UnitTest
         mockDescriptorProviderBus.BusDisconnect();
     }
 
+    using VegetationCommandBufferTests = ScopedAllocatorSetupFixture;
+
+    TEST_F(VegetationCommandBufferTests, CommandBuffer_FullBufferRejectsCommandsUntilConsumed)
+    {
+        // two segments of four commands
+        Vegetation::ConcurrentCommandBuffer<int, 4, 2> commandBuffer;
+
+        for (int command = 0; command < 8; ++command)
+        {
+            EXPECT_TRUE(commandBuffer.TryPush([command](int& slot) { slot = command; }));
+        }
+        EXPECT_FALSE(commandBuffer.TryPush([](int& slot) { slot = 8; }));
+        EXPECT_EQ(commandBuffer.GetSize(), 8u);
+
+        ASSERT_EQ(commandBuffer.GetReadableCount(5), 5u);
+        for (size_t offset = 0; offset < 5; ++offset)
+        {
+            EXPECT_EQ(commandBuffer.Front(offset), static_cast<int>(offset));
+        }
+        commandBuffer.PopFront(5);
+
+        // the freed slots are reused, and commands keep their order across the wrap around
+        for (int command = 8; command < 13; ++command)
+        {
+            EXPECT_TRUE(commandBuffer.TryPush([command](int& slot) { slot = command; }));
+        }
+        EXPECT_FALSE(commandBuffer.TryPush([](int& slot) { slot = 13; }));
+
+        ASSERT_EQ(commandBuffer.GetReadableCount(100), 8u);
+        for (size_t offset = 0; offset < 8; ++offset)
+        {
+            EXPECT_EQ(commandBuffer.Front(offset), static_cast<int>(offset + 5));
+        }
+        commandBuffer.PopFront(8);
+        EXPECT_EQ(commandBuffer.GetSize(), 0u);
+        EXPECT_EQ(commandBuffer.GetReadableCount(100), 0u);
+    }
+
+    TEST_F(VegetationCommandBufferTests, CommandBuffer_ConcurrentProducersKeepTheirOrder)
+    {
+        constexpr int ProducerCount = 4;
+        constexpr int CommandsPerProducer = 10000;
+
+        // small enough that the producers regularly find the buffer full
+        Vegetation::ConcurrentCommandBuffer<int, 64, 4> commandBuffer;
+
+        AZStd::vector<AZStd::thread> producers;
+        for (int producer = 0; producer < ProducerCount; ++producer)
+        {
+            producers.emplace_back([&commandBuffer, producer]()
+            {
+                for (int index = 0; index < CommandsPerProducer; ++index)
+                {
+                    const int command = producer * CommandsPerProducer + index;
+                    while (!commandBuffer.TryPush([command](int& slot) { slot = command; }))
+                    {
+                        AZStd::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        // every producer's commands have to come out in the order they were pushed
+        int nextIndex[ProducerCount] = {};
+        int consumedCount = 0;
+        while (consumedCount < ProducerCount * CommandsPerProducer)
+        {
+            const size_t readableCount = commandBuffer.GetReadableCount(32);
+            for (size_t offset = 0; offset < readableCount; ++offset)
+            {
+                const int command = commandBuffer.Front(offset);
+                const int producer = command / CommandsPerProducer;
+                EXPECT_EQ(command % CommandsPerProducer, nextIndex[producer]);
+                nextIndex[producer] = command % CommandsPerProducer + 1;
+            }
+            commandBuffer.PopFront(readableCount);
+            consumedCount += static_cast<int>(readableCount);
+        }
+
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+        EXPECT_EQ(commandBuffer.GetSize(), 0u);
+    }
+
+    TEST_F(VegetationCommandBufferTests, CommandBuffer_DrainWhileProducersPushKeepsTheTaskCount)
+    {
+        constexpr int ProducerCount = 4;
+        constexpr int CommandsPerProducer = 10000;
+
+        Vegetation::ConcurrentCommandBuffer<int, 64, 4> commandBuffer;
+
+        // like the instance system, producers count their task before they queue it, and the consumer takes every
+        // executed or discarded command off the count
+        AZStd::atomic_int taskCount{ 0 };
+        AZStd::atomic_int runningProducerCount{ ProducerCount };
+        AZStd::vector<AZStd::thread> producers;
+        for (int producer = 0; producer < ProducerCount; ++producer)
+        {
+            producers.emplace_back([&commandBuffer, &taskCount, &runningProducerCount, producer]()
+            {
+                for (int index = 0; index < CommandsPerProducer; ++index)
+                {
+                    const int command = producer * CommandsPerProducer + index;
+                    taskCount++;
+                    while (!commandBuffer.TryPush([command](int& slot) { slot = command; }))
+                    {
+                        AZStd::this_thread::yield();
+                    }
+                }
+                runningProducerCount--;
+            });
+        }
+
+        // alternate between executing a batch and draining the whole buffer while the producers are still pushing
+        AZStd::vector<bool> seen(ProducerCount * CommandsPerProducer, false);
+        int consumedCount = 0;
+        const auto consume = [&seen, &consumedCount, &taskCount](int command)
+        {
+            EXPECT_FALSE(seen[command]);
+            seen[command] = true;
+            ++consumedCount;
+            taskCount--;
+        };
+        for (int iteration = 0; runningProducerCount > 0; ++iteration)
+        {
+            if (iteration % 2)
+            {
+                commandBuffer.Drain([&consume](int& command) { consume(command); });
+                EXPECT_GE(taskCount.load(), 0);
+            }
+            else
+            {
+                const size_t readableCount = commandBuffer.GetReadableCount(32);
+                for (size_t offset = 0; offset < readableCount; ++offset)
+                {
+                    consume(commandBuffer.Front(offset));
+                }
+                commandBuffer.PopFront(readableCount);
+            }
+        }
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+
+        // every command was either executed or discarded exactly once, so nothing is left on the count
+        commandBuffer.Drain([&consume](int& command) { consume(command); });
+        EXPECT_EQ(commandBuffer.GetSize(), 0u);
+        EXPECT_EQ(taskCount.load(), 0);
+        EXPECT_EQ(consumedCount, ProducerCount * CommandsPerProducer);
+    }
 }
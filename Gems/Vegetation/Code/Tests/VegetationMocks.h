@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Vegetation/Ebuses/AreaInfoBus.h>
 #include <Vegetation/Ebuses/AreaNotificationBus.h>
 #include <Vegetation/Ebuses/AreaRequestBus.h>
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
@@ -24,6 +25,8 @@
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzFramework/Components/CameraBus.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
@@ -415,6 +418,11 @@ namespace UnitTest
         {
         }
 
+        void GetSurfacePointBufferFromRegion([[maybe_unused]] const AZ::Aabb& inRegion, [[maybe_unused]] const AZ::Vector2 stepSize, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            [[maybe_unused]] SurfaceData::SurfacePointBuffer& surfacePoints) const override
+        {
+        }
+
         SurfaceData::SurfaceDataRegistryHandle RegisterSurfaceDataProvider([[maybe_unused]] const SurfaceData::SurfaceDataRegistryEntry& entry) override
         {
             ++m_count;
@@ -624,6 +632,148 @@ namespace UnitTest
         }
     };
 
+    // A flat surface at height 0 with one surface point for every position of a region.
+    struct MockFlatSurfaceHandler
+        : public MockSurfaceHandler
+    {
+        void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointBuffer& surfacePoints) const override
+        {
+            surfacePoints.Clear();
+            for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+            {
+                for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+                {
+                    const size_t inputIndex = surfacePoints.GetInputPositionCount();
+                    surfacePoints.AddInputPosition(AZ::Vector3(x, y, AZ::Constants::FloatMax));
+                    const size_t pointIndex = surfacePoints.AddSurfacePoint(inputIndex, AZ::EntityId(), AZ::Vector3(x, y, 0.0f), AZ::Vector3::CreateAxisZ());
+                    surfacePoints.AddMaxValueForTag(pointIndex, m_surfaceTag, 1.0f);
+                }
+            }
+            surfacePoints.CombineSortAndFilterNeighboringPoints(desiredTags);
+        }
+
+        const AZ::Crc32 m_surfaceTag = AZ::Crc32("mock_flat_surface");
+    };
+
+    // An active camera at the origin, which centers the vegetation view rectangle around the origin.
+    struct MockActiveCamera
+        : public MockTransformBus
+        , public Camera::CameraSystemRequestBus::Handler
+    {
+        MockActiveCamera()
+        {
+            AZ::TransformBus::Handler::BusConnect(m_cameraId);
+            Camera::CameraSystemRequestBus::Handler::BusConnect();
+        }
+
+        ~MockActiveCamera()
+        {
+            Camera::CameraSystemRequestBus::Handler::BusDisconnect();
+            AZ::TransformBus::Handler::BusDisconnect();
+        }
+
+        AZ::Vector3 GetWorldTranslation() override
+        {
+            return AZ::Vector3::CreateZero();
+        }
+
+        AZ::EntityId GetActiveCamera() override
+        {
+            return m_cameraId;
+        }
+
+        const AZ::EntityId m_cameraId = AZ::EntityId(0x33333333);
+    };
+
+    // A vegetation area registered with the area system, which claims every point it's offered within its bounds, or every
+    // point when its bounds are null. The claimed points are left out of the points offered to the lower priority areas.
+    struct MockClaimingArea
+        : public Vegetation::AreaRequestBus::Handler
+        , public Vegetation::AreaInfoBus::Handler
+    {
+        MockClaimingArea(AZ::EntityId areaId, AZ::u32 priority = 0, const AZ::Aabb& bounds = AZ::Aabb::CreateNull())
+            : m_areaId(areaId)
+            , m_priority(priority)
+            , m_bounds(bounds)
+        {
+            Vegetation::AreaRequestBus::Handler::BusConnect(m_areaId);
+            Vegetation::AreaInfoBus::Handler::BusConnect(m_areaId);
+            Vegetation::AreaSystemRequestBus::Broadcast(&Vegetation::AreaSystemRequestBus::Events::RegisterArea,
+                m_areaId, 0, m_priority, m_bounds);
+        }
+
+        ~MockClaimingArea()
+        {
+            Vegetation::AreaSystemRequestBus::Broadcast(&Vegetation::AreaSystemRequestBus::Events::UnregisterArea, m_areaId);
+            Vegetation::AreaInfoBus::Handler::BusDisconnect();
+            Vegetation::AreaRequestBus::Handler::BusDisconnect();
+        }
+
+        bool PrepareToClaim([[maybe_unused]] Vegetation::EntityIdStack& stackIds) override
+        {
+            return true;
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            size_t availableCount = 0;
+            for (const auto& point : context.m_availablePoints)
+            {
+                if (m_bounds.IsValid() && !m_bounds.Contains(point.m_position))
+                {
+                    context.m_availablePoints[availableCount++] = point;
+                    continue;
+                }
+
+                Vegetation::InstanceData instanceData;
+                instanceData.m_id = m_areaId;
+                instanceData.m_position = point.m_position;
+                instanceData.m_normal = point.m_normal;
+                if (!context.m_existedCallback(point, instanceData))
+                {
+                    context.m_createdCallback(point, instanceData);
+                }
+            }
+            m_claimCount += context.m_availablePoints.size() - availableCount;
+            context.m_availablePoints.resize(availableCount);
+        }
+
+        void UnclaimPosition([[maybe_unused]] const Vegetation::ClaimHandle handle) override
+        {
+        }
+
+        AZ::u32 GetLayer() const override
+        {
+            return 0;
+        }
+
+        AZ::u32 GetPriority() const override
+        {
+            return m_priority;
+        }
+
+        AZ::Aabb GetEncompassingAabb() const override
+        {
+            return m_bounds;
+        }
+
+        AZ::u32 GetProductCount() const override
+        {
+            return 0;
+        }
+
+        AZ::u32 GetChangeIndex() const override
+        {
+            return 0;
+        }
+
+        const AZ::EntityId m_areaId;
+        const AZ::u32 m_priority;
+        const AZ::Aabb m_bounds;
+        AZStd::atomic<size_t> m_claimCount{ 0 };
+    };
+
     class MockShapeServiceComponent
         : public AZ::Component
     {
@@ -91,6 +91,7 @@ set(FILES
     Source/Components/SurfaceMaskFilterComponent.h
     Source/Components/SurfaceSlopeFilterComponent.cpp
     Source/Components/SurfaceSlopeFilterComponent.h
+    Source/Util/ConcurrentCommandBuffer.h
     Source/Util/ConcurrentQueue.h
     Source/Util/ProducerConsumerQueue.h
     Source/Debugger/AreaDebugComponent.cpp